@@ -0,0 +1,171 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header file.
+* Allocator support shared by the containers.
+* Any std-compatible allocator can be used, including std::pmr::polymorphic_allocator to select the memory resource at runtime.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <memory>   //For std::allocator and std::allocator_traits
+#include <memory_resource>  //For std::pmr::polymorphic_allocator
+#include <utility>  //For std::swap
+#include <type_traits>
+
+/*
+* Holds the allocator of a container.
+* Empty allocators (like std::allocator) are stored as a base class, so they do not increase the size of the container.
+*/
+template<typename Allocator, bool = std::is_empty<Allocator>::value && !std::is_final<Allocator>::value>
+class AllocatorStorage : private Allocator
+{
+public:
+    AllocatorStorage() = default;
+
+    explicit AllocatorStorage(const Allocator& allocator) noexcept :
+        Allocator(allocator) {}
+
+    _NODISCARD __forceinline Allocator& GetAllocatorReference() noexcept { return *this; }
+
+    _NODISCARD __forceinline const Allocator& GetAllocatorReference() const noexcept { return *this; }
+};
+
+template<typename Allocator>
+class AllocatorStorage<Allocator, false>
+{
+public:
+    AllocatorStorage() = default;
+
+    explicit AllocatorStorage(const Allocator& allocator) noexcept :
+        m_Allocator(allocator) {}
+
+    _NODISCARD __forceinline Allocator& GetAllocatorReference() noexcept { return m_Allocator; }
+
+    _NODISCARD __forceinline const Allocator& GetAllocatorReference() const noexcept { return m_Allocator; }
+
+private:
+    Allocator m_Allocator;
+};
+
+/*
+* Applies the propagation rules of std::allocator_traits when a container is copied, moved or swapped.
+*/
+template<typename Allocator>
+struct AllocatorPropagation
+{
+    using Traits = std::allocator_traits<Allocator>;
+
+    /**
+    * @brief: Selects the allocator of a container created as a copy of other.
+    *
+    * @param: const Allocator& -> Allocator of the copied container.
+    *
+    * @return: Allocator -> Allocator of the new container.
+    */
+    _NODISCARD static __forceinline Allocator OnCopyConstruction(const Allocator& other)
+    {
+        return Traits::select_on_container_copy_construction(other);
+    }
+
+    static __forceinline void OnCopyAssignment(Allocator& allocator, const Allocator& other) noexcept
+    {
+        if constexpr (Traits::propagate_on_container_copy_assignment::value) { allocator = other; }
+    }
+
+    static __forceinline void OnMoveAssignment(Allocator& allocator, Allocator& other) noexcept
+    {
+        if constexpr (Traits::propagate_on_container_move_assignment::value) { allocator = std::move(other); }
+    }
+
+    static __forceinline void OnSwap(Allocator& allocator, Allocator& other) noexcept
+    {
+        if constexpr (Traits::propagate_on_container_swap::value)
+        {
+            using std::swap;
+            swap(allocator, other);
+        }
+    }
+
+    /*
+    * True if a move assignment always takes the memory of the moved container.
+    * Otherwise it can allocate and move the elements one by one, so it is not noexcept.
+    */
+    static _CONSTEXPR17 bool s_AlwaysTakesMemory = Traits::propagate_on_container_move_assignment::value || Traits::is_always_equal::value;
+
+    /**
+    * @brief: Checks if a container can take the memory of other on move assignment.
+    * @details: When it is false, the elements must be moved one by one into memory of the own allocator.
+    *
+    * @param: const Allocator& -> Allocator of the assigned container.
+    * @param: const Allocator& -> Allocator of the moved container.
+    *
+    * @return: bool -> True if the memory can be taken.
+    */
+    _NODISCARD static __forceinline bool CanTakeMemory(const Allocator& allocator, const Allocator& other) noexcept
+    {
+        if constexpr (Traits::propagate_on_container_move_assignment::value) { return true; }
+        else { return AreEqual(allocator, other); }
+    }
+
+    /**
+    * @brief: Checks if the memory allocated by one allocator can be released by the other.
+    *
+    * @param: const Allocator& -> First allocator.
+    * @param: const Allocator& -> Second allocator.
+    *
+    * @return: bool -> True if the allocators are interchangeable.
+    */
+    _NODISCARD static __forceinline bool AreEqual(const Allocator& allocator, const Allocator& other) noexcept
+    {
+        if constexpr (Traits::is_always_equal::value) { return true; }
+        else { return allocator == other; }
+    }
+};
+
+/*
+* True if the allocator is the default std::allocator, so the containers can use the C allocator (std::realloc) directly.
+*/
+template<typename Allocator, typename T>
+struct IsDefaultAllocator : std::is_same<Allocator, std::allocator<T>> {};
+
+/*
+* True if deallocate does nothing because the owner of the memory releases it all at once (for example an arena).
+* Containers with these allocators skip the teardown walk when the elements are trivially destructible.
+*/
+template<typename Allocator>
+struct IsReleaseAllAllocator : std::false_type {};
+
+/*
+* True if the allocator serves single blocks from a pool of free blocks shared between containers (for example NodePoolAllocator).
+* Node based containers allocate each node on its own with these allocators, so their free nodes go back to the shared pool.
+*/
+template<typename Allocator>
+struct IsNodePoolAllocator : std::false_type {};
@@ -0,0 +1,1381 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header class.
+* CompactList class is a sequence container with the same interface as List,
+* that keeps all its nodes in a single contiguous pool and links them by their 32 bit position in the pool instead of pointers.
+* A node only stores two 32 bit links and its element, so the overhead per element is a quarter of the one of List.
+* The pool grows by doubling like a Vector, the nodes keep their positions when it is relocated so no link has to be fixed.
+* Iterators store the container and a position, they remain valid when the pool grows but not after the container is moved or swapped.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <initializer_list>
+#include <cstring>  //For std::memcpy
+#include <cstdint>  //For uint32_t
+#include "TypeTraits.hpp"
+#include "Allocator.hpp"
+
+template<typename T, typename Allocator = std::allocator<T>>
+class CompactList : private AllocatorStorage<Allocator>
+{
+    using AllocatorBase = AllocatorStorage<Allocator>;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    using Propagation = AllocatorPropagation<Allocator>;
+    using AllocatorBase::GetAllocatorReference;
+
+    /*
+    * Node of the pool, linked to its neighbours by their positions in the pool.
+    * The node at position 0 is the sentinel, it has no element and closes the circle of nodes.
+    * Free nodes are linked through Next, position 0 ends the free nodes.
+    */
+    struct Node
+    {
+        _NODISCARD __forceinline T* Data() noexcept { return reinterpret_cast<T*>(Storage); }
+
+        uint32_t Prev;
+        uint32_t Next;
+        alignas(T) unsigned char Storage[sizeof(T)];
+    };
+
+    using NodeAllocator = typename AllocatorTraits::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+public:
+    template<typename ValueType>
+    class Iterator
+    {
+        friend class CompactList;
+        //Modifiers
+    public:
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Pre increment.
+        *
+        * @return: Iterator& -> Current iterator.
+        */
+        __forceinline Iterator& operator++() noexcept
+        {
+            m_Index = m_List->m_Pool[m_Index].Next;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Post increment.
+        *
+        * @return: Iterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline Iterator operator++(int) noexcept
+        {
+            Iterator it(*this);
+            operator++();
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        *
+        * @param: size_t -> distance to move.
+        * @return: Iterator& -> Current iterator.
+        */
+        Iterator& operator+=(size_t distance) noexcept
+        {
+            const Node* pool = m_List->m_Pool;
+            for (size_t i = 0; i < distance; ++i)
+            {
+                m_Index = pool[m_Index].Next;
+            }
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> distance to move.
+        * @return: Iterator& -> Current iterator.
+        */
+        __forceinline Iterator& operator+=(int distance) noexcept
+        {
+            if (distance < 0) { return operator-=((size_t)(-distance)); }
+            return operator+=((size_t)distance);
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Pre increment.
+        *
+        * @return: Iterator& -> Current iterator.
+        */
+        __forceinline Iterator& operator--() noexcept
+        {
+            m_Index = m_List->m_Pool[m_Index].Prev;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Post increment.
+        *
+        * @return: Iterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline Iterator operator--(int) noexcept
+        {
+            Iterator it(*this);
+            operator--();
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        *
+        * @param: size_t -> distance to move.
+        * @return: Iterator& -> Current iterator.
+        */
+        Iterator& operator-=(size_t distance) noexcept
+        {
+            const Node* pool = m_List->m_Pool;
+            for (size_t i = 0; i < distance; ++i)
+            {
+                m_Index = pool[m_Index].Prev;
+            }
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        *
+        * @param: int -> distance to move.
+        * @return: Iterator& -> Current iterator.
+        */
+        __forceinline Iterator& operator-=(int distance) noexcept
+        {
+            if (distance < 0) { return operator+=((size_t)(-distance)); }
+            return operator-=((size_t)distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward distance given from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator+(size_t distance) const noexcept
+        {
+            Iterator it(*this);
+            it += distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward distance given from the current iterator.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> distance to move.
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator+(int distance) const noexcept
+        {
+            Iterator it(*this);
+            it += distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward distance given from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator-(size_t distance) const noexcept
+        {
+            Iterator it(*this);
+            it -= distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward distance given from the current iterator.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        *
+        * @param: int -> distance to move.
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator-(int distance) const noexcept
+        {
+            Iterator it(*this);
+            it -= distance;
+            return it;
+        }
+
+        //Element access
+    public:
+        /**
+        * @brief: Returns the element at the given distance from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ValueType& -> Element in the resulting position.
+        */
+        _NODISCARD __forceinline ValueType& operator[](size_t index) const noexcept { return *(operator+(index)); }
+
+        /**
+        * @brief: Returns the element of the current iterator.
+        *
+        * @return: ValueType& -> Element of the iterator.
+        */
+        _NODISCARD __forceinline ValueType& operator*() const noexcept { return *m_List->m_Pool[m_Index].Data(); }
+
+        /**
+        * @brief: Returns the current iterator.
+        *
+        * @return: ValueType* -> Current iterator.
+        */
+        _NODISCARD __forceinline ValueType* operator->() const noexcept { return m_List->m_Pool[m_Index].Data(); }
+
+        //Non member functions
+    public:
+        /**
+        * @brief: Compares if two iterators are equal.
+        *
+        * @param: const Iterator& -> Given iterator.
+        * @return: bool -> True if both are equal.
+        */
+        _NODISCARD __forceinline bool operator==(const Iterator& other) const noexcept { return m_Index == other.m_Index && m_List == other.m_List; }
+
+        /**
+        * @brief: Compares if two iterators are not equal.
+        *
+        * @param: const Iterator& -> Given iterator.
+        * @return: bool -> True if both are not equal.
+        */
+        _NODISCARD __forceinline bool operator!=(const Iterator& other) const noexcept { return !(operator==(other)); }
+
+        /**
+        * @brief: Compares if the current iterator belongs to a container.
+        *
+        * @return: bool -> True if the current iterator is valid.
+        */
+        _NODISCARD __forceinline operator bool() const noexcept { return m_List; }
+
+        /**
+        * @brief: Compares if the current iterator belongs to a container.
+        *
+        * @return: bool -> True if the current iterator is valid.
+        */
+        _NODISCARD __forceinline bool IsValid() const noexcept { return m_List; }
+
+        //Member functions
+    public:
+        __forceinline Iterator(CompactList* list = nullptr, uint32_t index = 0) noexcept :
+            m_List(list),
+            m_Index(index) {}
+
+        __forceinline Iterator(const Iterator& other) noexcept = default;
+
+        __forceinline Iterator& operator=(const Iterator& other) noexcept = default;
+
+    private:
+        CompactList* m_List;
+        uint32_t m_Index;
+    };
+
+    template<typename ValueType>
+    class ReverseIterator
+    {
+        friend class CompactList;
+        //Modifiers
+    public:
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Pre increment.
+        *
+        * @return: ReverseIterator& -> Current iterator.
+        */
+        __forceinline ReverseIterator& operator++() noexcept
+        {
+            --m_Iterator;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Post increment.
+        *
+        * @return: ReverseIterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator++(int) noexcept
+        {
+            ReverseIterator it(*this);
+            --m_Iterator;
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ReverseIterator& -> Current iterator.
+        */
+        __forceinline ReverseIterator& operator+=(size_t distance) noexcept
+        {
+            m_Iterator -= distance;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Pre increment.
+        *
+        * @return: ReverseIterator& -> Current iterator.
+        */
+        __forceinline ReverseIterator& operator--() noexcept
+        {
+            ++m_Iterator;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Post increment.
+        *
+        * @return: ReverseIterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator--(int) noexcept
+        {
+            ReverseIterator it(*this);
+            ++m_Iterator;
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ReverseIterator& -> Current iterator.
+        */
+        __forceinline ReverseIterator& operator-=(size_t distance) noexcept
+        {
+            m_Iterator += distance;
+            return *this;
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward distance given from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ReverseIterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator+(size_t distance) const noexcept
+        {
+            ReverseIterator it(*this);
+            it += distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward distance given from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ReverseIterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator-(size_t distance) const noexcept
+        {
+            ReverseIterator it(*this);
+            it -= distance;
+            return it;
+        }
+
+        //Element access
+    public:
+        /**
+        * @brief: Returns the element of the current iterator.
+        *
+        * @return: ValueType& -> Element of the iterator.
+        */
+        _NODISCARD __forceinline ValueType& operator*() const noexcept { return *m_Iterator; }
+
+        /**
+        * @brief: Returns the current iterator.
+        *
+        * @return: ValueType* -> Current iterator.
+        */
+        _NODISCARD __forceinline ValueType* operator->() const noexcept { return m_Iterator.operator->(); }
+
+        //Non member functions
+    public:
+        _NODISCARD __forceinline bool operator==(const ReverseIterator& other) const noexcept { return m_Iterator == other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator!=(const ReverseIterator& other) const noexcept { return m_Iterator != other.m_Iterator; }
+
+        _NODISCARD __forceinline operator bool() const noexcept { return m_Iterator.IsValid(); }
+
+        _NODISCARD __forceinline bool IsValid() const noexcept { return m_Iterator.IsValid(); }
+
+        //Member functions
+    public:
+        __forceinline ReverseIterator(CompactList* list = nullptr, uint32_t index = 0) noexcept :
+            m_Iterator(list, index) {}
+
+        __forceinline ReverseIterator(const ReverseIterator& other) noexcept = default;
+
+        __forceinline ReverseIterator& operator=(const ReverseIterator& other) noexcept = default;
+
+    private:
+        Iterator<ValueType> m_Iterator;
+    };
+
+public:
+    using value_type = T;
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+    using reverse_iterator = ReverseIterator<T>;
+    using const_reverse_iterator = ReverseIterator<const T>;
+    using allocator_type = Allocator;
+
+    //Modifiers
+public:
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: The pool is only reallocated when it has no free nodes left.
+    *
+    * @param: const T& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushBack(const T& element) { EmplaceBack(element); }
+
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: The pool is only reallocated when it has no free nodes left.
+    *
+    * @param: T&& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushBack(T&& element) { EmplaceBack(std::move(element)); }
+
+    /**
+    * @brief: Inserts a new element at the begin of the container.
+    *
+    * @param: const T& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushFront(const T& element) { EmplaceFront(element); }
+
+    /**
+    * @brief: Inserts a new element at the begin of the container.
+    *
+    * @param: T&& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushFront(T&& element) { EmplaceFront(std::move(element)); }
+
+    /**
+    * @brief: Inserts a new element at the given index.
+    * @details: An index out of range inserts the element at the end.
+    *
+    * @param: size_t -> Index.
+    * @param: const T& -> Element.
+    * @return: iterator -> Iterator to the new element.
+    */
+    iterator Insert(size_t index, const T& element) { return EmplaceAt(GetInsertPosition(index), element); }
+
+    /**
+    * @brief: Inserts a new element before the given iterator.
+    *
+    * @param: iterator -> Position.
+    * @param: const T& -> Element.
+    * @return: iterator -> Iterator to the new element.
+    */
+    iterator Insert(iterator it, const T& element) { return EmplaceAt(it, element); }
+
+    /**
+    * @brief: Inserts a new element at the given index.
+    * @details: An index out of range inserts the element at the end.
+    *
+    * @param: size_t -> Index.
+    * @param: T&& -> Element.
+    * @return: iterator -> Iterator to the new element.
+    */
+    iterator Insert(size_t index, T&& element) { return EmplaceAt(GetInsertPosition(index), std::move(element)); }
+
+    /**
+    * @brief: Inserts a new element before the given iterator.
+    *
+    * @param: iterator -> Position.
+    * @param: T&& -> Element.
+    * @return: iterator -> Iterator to the new element.
+    */
+    iterator Insert(iterator it, T&& element) { return EmplaceAt(it, std::move(element)); }
+
+    /**
+    * @brief: Constructs a new element at the end of the container.
+    *
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        uint32_t index = ConstructNode(std::forward<Args>(args)...);
+        LinkBefore(0, index);
+        return *m_Pool[index].Data();
+    }
+
+    /**
+    * @brief: Constructs a new element at the begin of the container.
+    *
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& EmplaceFront(Args&&... args)
+    {
+        uint32_t index = ConstructNode(std::forward<Args>(args)...);
+        LinkBefore(m_Pool[0].Next, index);
+        return *m_Pool[index].Data();
+    }
+
+    /**
+    * @brief: Constructs a new element at the given index.
+    * @details: An index out of range constructs the element at the end.
+    *
+    * @param: size_t -> Index.
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& Emplace(size_t index, Args&&... args)
+    {
+        return *EmplaceAt(GetInsertPosition(index), std::forward<Args>(args)...);
+    }
+
+    /**
+    * @brief: Constructs a new element before the given iterator.
+    *
+    * @param: iterator -> Position.
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& Emplace(iterator it, Args&&... args)
+    {
+        return *EmplaceAt(it, std::forward<Args>(args)...);
+    }
+
+    /**
+    * @brief: Constructs a new element before the given iterator.
+    * @details: The position is kept by the iterator, so it remains valid if the pool is reallocated.
+    *
+    * @param: iterator -> Position.
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: iterator -> Iterator to the new element.
+    */
+    template<typename... Args>
+    iterator EmplaceAt(iterator it, Args&&... args)
+    {
+        uint32_t index = ConstructNode(std::forward<Args>(args)...);
+        LinkBefore(it.m_Index, index);
+        return iterator(this, index);
+    }
+
+    /**
+    * @brief: Removes the last element of the container.
+    * @details: Calling PopBack in a empty container does nothing.
+    *
+    * @return: void.
+    */
+    void PopBack() noexcept
+    {
+        if (IsEmpty()) { return; }
+
+        DestroyNode(m_Pool[0].Prev);
+    }
+
+    /**
+    * @brief: Removes the first element of the container.
+    * @details: Calling PopFront in a empty container does nothing.
+    *
+    * @return: void.
+    */
+    void PopFront() noexcept
+    {
+        if (IsEmpty()) { return; }
+
+        DestroyNode(m_Pool[0].Next);
+    }
+
+    /**
+    * @brief: Removes the element at the given index.
+    * @details: An index out of range removes the last element, calling it in a empty container does nothing.
+    *
+    * @param: size_t -> Index.
+    * @return: iterator -> Iterator to the element after the erased one.
+    */
+    iterator Erase(size_t index) noexcept
+    {
+        if (IsEmpty()) { return end(); }
+        if (index >= m_Elements) { index = m_Elements - 1; }
+        return Erase(GetIteratorAtIndex(index));
+    }
+
+    /**
+    * @brief: Removes the element of the given iterator.
+    * @details: The node goes to the free nodes of the pool, no memory is released.
+    *
+    * @param: iterator -> Element to remove.
+    * @return: iterator -> Iterator to the element after the erased one.
+    */
+    iterator Erase(iterator it) noexcept
+    {
+        uint32_t next = m_Pool[it.m_Index].Next;
+        DestroyNode(it.m_Index);
+        return iterator(this, next);
+    }
+
+    /**
+    * @brief: Removes all the elements of the container.
+    * @details: The pool is kept, all its nodes become free.
+    *
+    * @return: void.
+    */
+    void Clear() noexcept
+    {
+        if (!m_Pool) { return; }
+
+        DestroyElements();
+
+        m_Pool[0].Prev = 0;
+        m_Pool[0].Next = 0;
+        m_Carved = 1;
+        m_Free = 0;
+        m_Elements = 0;
+    }
+
+    /**
+    * @brief: Exchanges the content of the container by the content of other.
+    * @details: The pools are exchanged, no element is moved.
+    *
+    * @param: CompactList& -> Other container.
+    * @return: void.
+    */
+    void Swap(CompactList& other) noexcept
+    {
+        Propagation::OnSwap(GetAllocatorReference(), other.GetAllocatorReference());
+
+        Node* pool = m_Pool;
+        uint32_t capacity = m_Capacity;
+        uint32_t carved = m_Carved;
+        uint32_t free = m_Free;
+        size_t elements = m_Elements;
+
+        m_Pool = other.m_Pool;
+        m_Capacity = other.m_Capacity;
+        m_Carved = other.m_Carved;
+        m_Free = other.m_Free;
+        m_Elements = other.m_Elements;
+
+        other.m_Pool = pool;
+        other.m_Capacity = capacity;
+        other.m_Carved = carved;
+        other.m_Free = free;
+        other.m_Elements = elements;
+    }
+
+    /**
+    * @brief: Appends the elements of other at the end of the container.
+    *
+    * @param: const CompactList& -> Other container.
+    * @return: void.
+    */
+    void Append(const CompactList& other)
+    {
+        if (&other == this) { return; }
+
+        Reserve(m_Elements + other.m_Elements);
+        for (const_iterator it = other.cbegin(); it != other.cend(); ++it)
+        {
+            EmplaceBack(*it);
+        }
+    }
+
+    /**
+    * @brief: Appends the elements of other at the end of the container.
+    * @details: An empty container takes the pool of other when both allocators are equal,
+    * otherwise the elements are moved one by one. Other is left empty.
+    *
+    * @param: CompactList&& -> Other container.
+    * @return: void.
+    */
+    void Append(CompactList&& other)
+    {
+        if (&other == this || other.IsEmpty()) { return; }
+        if (IsEmpty() && Propagation::AreEqual(GetAllocatorReference(), other.GetAllocatorReference()))
+        {
+            Swap(other);
+            other.Clear();
+            return;
+        }
+
+        Reserve(m_Elements + other.m_Elements);
+        for (iterator it = other.begin(); it != other.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+        other.Clear();
+    }
+
+    //Capacity
+public:
+    /**
+    * @brief: Requests the removal of unused capacity.
+    * @details: The pool is reallocated with room for the current elements only, and the nodes are placed in the order of the list,
+    * so a traversal after a Shrink reads the pool sequentially.
+    *
+    * @return: void.
+    */
+    void Shrink()
+    {
+        if (IsEmpty())
+        {
+            Release();
+            return;
+        }
+        if (m_Capacity == m_Elements + 1 && m_Free == 0) { return; }
+
+        const uint32_t capacity = (uint32_t)m_Elements + 1;
+        Node* pool = AllocatePool(capacity);
+
+        uint32_t index = 1;
+        for (uint32_t node = m_Pool[0].Next; node != 0; node = m_Pool[node].Next, ++index)
+        {
+            new (pool[index].Data()) T(std::move(*m_Pool[node].Data()));
+            m_Pool[node].Data()->~T();
+            pool[index].Prev = index - 1;
+            pool[index].Next = index + 1;
+        }
+        pool[0].Next = 1;
+        pool[0].Prev = capacity - 1;
+        pool[capacity - 1].Next = 0;
+
+        FreePool(m_Pool, m_Capacity);
+        m_Pool = pool;
+        m_Capacity = capacity;
+        m_Carved = capacity;
+        m_Free = 0;
+    }
+
+    /**
+    * @brief: Makes room for the given number of elements.
+    * @details: Reallocates the pool if the current capacity is smaller, the nodes keep their positions.
+    *
+    * @param: size_t -> New capacity.
+    * @return: void.
+    */
+    void Reserve(size_t capacity)
+    {
+        if (capacity > s_MaxCompactListSize) { CompactListMaxLenghtError(); }
+        if (capacity + 1 <= m_Capacity) { return; }
+
+        Reallocate((uint32_t)capacity + 1);
+    }
+
+    /**
+    * @brief: Checks if the container is empty.
+    *
+    * @return: bool -> True if the container has no elements.
+    */
+    _NODISCARD __forceinline bool IsEmpty() const noexcept { return m_Elements == 0; }
+
+    /**
+    * @brief: Number of elements in the container.
+    *
+    * @return: size_t -> Elements.
+    */
+    _NODISCARD __forceinline size_t Size() const noexcept { return m_Elements; }
+
+    /**
+    * @brief: Number of elements that fit in the pool without reallocating it.
+    *
+    * @return: size_t -> Capacity.
+    */
+    _NODISCARD __forceinline size_t Capacity() const noexcept { return m_Capacity ? m_Capacity - 1 : 0; }
+
+    //Element Access
+public:
+    /**
+    * @brief: Returns a reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD T& Front() noexcept { return *m_Pool[m_Pool[0].Next].Data(); }
+
+    /**
+    * @brief: Returns a const reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD const T& Front() const noexcept { return *m_Pool[m_Pool[0].Next].Data(); }
+
+    /**
+    * @brief: Returns a reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD T& Back() noexcept { return *m_Pool[m_Pool[0].Prev].Data(); }
+
+    /**
+    * @brief: Returns a const reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD const T& Back() const noexcept { return *m_Pool[m_Pool[0].Prev].Data(); }
+
+    /**
+    * @brief: Returns a reference to the element at the given position.
+    * @details: Calling [] in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD T& operator[](size_t index) noexcept { return *GetIteratorAtIndex(index); }
+
+    /**
+    * @brief: Returns a const reference to the element at the given position.
+    * @details: Calling [] in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD const T& operator[](size_t index) const noexcept { return *const_cast<CompactList*>(this)->GetIteratorAtIndex(index); }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD T& At(size_t index)
+    {
+        if (index >= m_Elements) { CompactListOutOfRangeError(); }
+        return *GetIteratorAtIndex(index);
+    }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD const T& At(size_t index) const
+    {
+        if (index >= m_Elements) { CompactListOutOfRangeError(); }
+        return *const_cast<CompactList*>(this)->GetIteratorAtIndex(index);
+    }
+
+    /**
+    * @brief: Returns an iterator at the given index.
+    * @details: The walk starts from the closest end.
+    * Calling it with an index out of range is undefined.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD iterator GetIteratorAtIndex(size_t index) noexcept
+    {
+        if (index < (m_Elements >> 1))
+        {
+            iterator it = begin();
+            it += index;
+            return it;
+        }
+
+        iterator it = end();
+        it -= m_Elements - index;
+        return it;
+    }
+
+    //Iterators
+public:
+    /**
+    * @brief: Returns an iterator to the begin of the container.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator begin() noexcept { return iterator(this, First()); }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator begin() const noexcept { return const_iterator(const_cast<CompactList*>(this), First()); }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cbegin() const noexcept { return begin(); }
+
+    /**
+    * @brief: Returns an iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator end() noexcept { return iterator(this, 0); }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator end() const noexcept { return const_iterator(const_cast<CompactList*>(this), 0); }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cend() const noexcept { return end(); }
+
+    /**
+    * @brief: Returns a reverse iterator to the end of the container.
+    *
+    * @return: reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline reverse_iterator rbegin() noexcept { return reverse_iterator(this, Last()); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the end of the container.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(const_cast<CompactList*>(this), Last()); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the end of the container.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+    /**
+    * @brief: Returns a reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline reverse_iterator rend() noexcept { return reverse_iterator(this, 0); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator rend() const noexcept { return const_reverse_iterator(const_cast<CompactList*>(this), 0); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator crend() const noexcept { return rend(); }
+
+    //Member functions
+public:
+    explicit CompactList() noexcept {}
+
+    explicit CompactList(const Allocator& allocator) noexcept :
+        AllocatorBase(allocator) {}
+
+    explicit CompactList(size_t capacity)
+    {
+        Reserve(capacity);
+    }
+
+    CompactList(size_t capacity, const Allocator& allocator) :
+        AllocatorBase(allocator)
+    {
+        Reserve(capacity);
+    }
+
+    CompactList(const CompactList& other) :
+        AllocatorBase(Propagation::OnCopyConstruction(other.GetAllocatorReference()))
+    {
+        Append(other);
+    }
+
+    CompactList(CompactList&& other) noexcept :
+        AllocatorBase(std::move(other.GetAllocatorReference()))
+    {
+        Swap(other);
+    }
+
+    CompactList(std::initializer_list<T>&& list)
+    {
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+    }
+
+    CompactList(std::initializer_list<T>&& list, const Allocator& allocator) :
+        AllocatorBase(allocator)
+    {
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+    }
+
+    ~CompactList() noexcept
+    {
+        Release();
+    }
+
+    CompactList& operator=(const CompactList& other)
+    {
+        if (&other == this) { return *this; }
+
+        //The pool is released by the current allocator before it is replaced
+        Release();
+        Propagation::OnCopyAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        Append(other);
+
+        return *this;
+    }
+
+    CompactList& operator=(CompactList&& other) noexcept(Propagation::s_AlwaysTakesMemory)
+    {
+        if (&other == this) { return *this; }
+
+        Release();
+        if (!Propagation::CanTakeMemory(GetAllocatorReference(), other.GetAllocatorReference()))
+        {
+            //The pool of other can not be released by this allocator, the elements are moved one by one
+            Append(std::move(other));
+            return *this;
+        }
+
+        Propagation::OnMoveAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        m_Pool = other.m_Pool;
+        m_Capacity = other.m_Capacity;
+        m_Carved = other.m_Carved;
+        m_Free = other.m_Free;
+        m_Elements = other.m_Elements;
+        other.Default();
+
+        return *this;
+    }
+
+    CompactList& operator=(std::initializer_list<T>&& list)
+    {
+        Clear();
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+
+        return *this;
+    }
+
+    /**
+    * @brief: Returns a copy of the allocator used by the container.
+    *
+    * @return: Allocator -> Allocator.
+    */
+    _NODISCARD __forceinline Allocator GetAllocator() const noexcept { return GetAllocatorReference(); }
+
+    //Non-member functions
+public:
+    _NODISCARD bool operator==(const CompactList& other) const noexcept
+    {
+        if (m_Elements != other.m_Elements) { return false; }
+
+        const_iterator other_it = other.cbegin();
+        for (const_iterator this_it = cbegin(); this_it != cend(); ++this_it, ++other_it)
+        {
+            if (*this_it != *other_it) { return false; }
+        }
+
+        return true;
+    }
+
+    _NODISCARD __forceinline bool operator!=(const CompactList& other) const noexcept { return !(*this == other); }
+
+private:
+    /**
+    * @brief: Returns the iterator to insert before the given index.
+    * @details: An index out of range returns the end of the container.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator GetInsertPosition(size_t index) noexcept
+    {
+        return index >= m_Elements ? end() : GetIteratorAtIndex(index);
+    }
+
+    /**
+    * @brief: Constructs an element in a free node of the pool, the node is not linked.
+    * @details: Free nodes are reused first, then the nodes never used, and a full pool is doubled.
+    *
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: uint32_t -> Position of the node.
+    */
+    template<typename... Args>
+    __forceinline uint32_t ConstructNode(Args&&... args)
+    {
+        if (m_Elements >= s_MaxCompactListSize) { CompactListMaxLenghtError(); }
+
+        if (m_Free)
+        {
+            uint32_t index = m_Free;
+            new (m_Pool[index].Data()) T(std::forward<Args>(args)...);
+            m_Free = m_Pool[index].Next;
+            return index;
+        }
+        if (m_Carved < m_Capacity)
+        {
+            new (m_Pool[m_Carved].Data()) T(std::forward<Args>(args)...);
+            return m_Carved++;
+        }
+
+        return GrowPool(std::forward<Args>(args)...);
+    }
+
+    /**
+    * @brief: Doubles the pool and constructs an element in its first new node.
+    * @details: The element is constructed before the old pool is released, so the arguments may refer to an element of the container.
+    *
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: uint32_t -> Position of the node.
+    */
+    template<typename... Args>
+    uint32_t GrowPool(Args&&... args)
+    {
+        uint32_t capacity = m_Capacity ? m_Capacity * 2 : s_MinPoolNodes;
+        if (capacity > s_MaxCompactListSize + 1) { capacity = (uint32_t)s_MaxCompactListSize + 1; }
+
+        Node* pool = AllocatePool(capacity);
+        const uint32_t index = m_Carved ? m_Carved : 1;
+        try { new (pool[index].Data()) T(std::forward<Args>(args)...); }
+        catch (...)
+        {
+            FreePool(pool, capacity);
+            throw;
+        }
+
+        if (m_Pool)
+        {
+            RelocateNodes(pool);
+            FreePool(m_Pool, m_Capacity);
+        }
+        else
+        {
+            pool[0].Prev = 0;
+            pool[0].Next = 0;
+        }
+
+        m_Pool = pool;
+        m_Capacity = capacity;
+        m_Carved = index + 1;
+        return index;
+    }
+
+    /**
+    * @brief: Moves the pool to a new one with the given capacity, the nodes keep their positions.
+    *
+    * @param: uint32_t -> Nodes of the new pool, including the sentinel.
+    * @return: void.
+    */
+    void Reallocate(uint32_t capacity)
+    {
+        Node* pool = AllocatePool(capacity);
+        if (m_Pool)
+        {
+            RelocateNodes(pool);
+            FreePool(m_Pool, m_Capacity);
+        }
+        else
+        {
+            pool[0].Prev = 0;
+            pool[0].Next = 0;
+            m_Carved = 1;
+        }
+
+        m_Pool = pool;
+        m_Capacity = capacity;
+    }
+
+    /**
+    * @brief: Moves the used nodes of the pool to the same positions of another pool.
+    * @details: Trivially relocatable elements are copied with the links in a single memcpy.
+    *
+    * @param: Node* -> Destination pool.
+    * @return: void.
+    */
+    void RelocateNodes(Node* pool) noexcept
+    {
+        if constexpr (IsTriviallyRelocatable<T>::value)
+        {
+            std::memcpy((void*)pool, (const void*)m_Pool, sizeof(Node) * m_Carved);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < m_Carved; ++i)
+            {
+                pool[i].Prev = m_Pool[i].Prev;
+                pool[i].Next = m_Pool[i].Next;
+            }
+            for (uint32_t node = m_Pool[0].Next; node != 0; node = m_Pool[node].Next)
+            {
+                new (pool[node].Data()) T(std::move(*m_Pool[node].Data()));
+                m_Pool[node].Data()->~T();
+            }
+        }
+    }
+
+    __forceinline void LinkBefore(uint32_t position, uint32_t index) noexcept
+    {
+        Node& node = m_Pool[index];
+        Node& next = m_Pool[position];
+        node.Prev = next.Prev;
+        node.Next = position;
+        m_Pool[next.Prev].Next = index;
+        next.Prev = index;
+        ++m_Elements;
+    }
+
+    /**
+    * @brief: Unlinks a node, destroys its element and adds it to the free nodes.
+    *
+    * @param: uint32_t -> Position of the node.
+    * @return: void.
+    */
+    __forceinline void DestroyNode(uint32_t index) noexcept
+    {
+        Node& node = m_Pool[index];
+        m_Pool[node.Prev].Next = node.Next;
+        m_Pool[node.Next].Prev = node.Prev;
+        node.Data()->~T();
+
+        node.Next = m_Free;
+        m_Free = index;
+        --m_Elements;
+    }
+
+    __forceinline void DestroyElements() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible<T>::value)
+        {
+            for (uint32_t node = m_Pool[0].Next; node != 0; node = m_Pool[node].Next)
+            {
+                m_Pool[node].Data()->~T();
+            }
+        }
+    }
+
+    _NODISCARD Node* AllocatePool(uint32_t capacity)
+    {
+        NodeAllocator allocator(GetAllocatorReference());
+        Node* pool = nullptr;
+        try { pool = NodeTraits::allocate(allocator, capacity); }
+        catch (...) { CompactListBadAllocationError(); }
+
+        return pool;
+    }
+
+    __forceinline void FreePool(Node* pool, uint32_t capacity) noexcept
+    {
+        NodeAllocator allocator(GetAllocatorReference());
+        NodeTraits::deallocate(allocator, pool, capacity);
+    }
+
+    void Release() noexcept
+    {
+        if (!m_Pool) { return; }
+
+        DestroyElements();
+        FreePool(m_Pool, m_Capacity);
+        Default();
+    }
+
+    __forceinline void Default() noexcept
+    {
+        m_Pool = nullptr;
+        m_Capacity = 0;
+        m_Carved = 0;
+        m_Free = 0;
+        m_Elements = 0;
+    }
+
+    _NODISCARD __forceinline uint32_t First() const noexcept { return m_Pool ? m_Pool[0].Next : 0; }
+
+    _NODISCARD __forceinline uint32_t Last() const noexcept { return m_Pool ? m_Pool[0].Prev : 0; }
+
+    [[noreturn]] __forceinline static void CompactListOutOfRangeError() {
+        throw std::exception("CompactList index out of range");
+    }
+
+    [[noreturn]] __forceinline static void CompactListMaxLenghtError() {
+        throw std::exception("CompactList too long");
+    }
+
+    [[noreturn]] __forceinline static void CompactListBadAllocationError() {
+        throw std::exception("Bad allocation");
+    }
+
+private:
+    Node* m_Pool = nullptr;
+    uint32_t m_Capacity = 0;
+    uint32_t m_Carved = 0;
+    uint32_t m_Free = 0;
+    size_t m_Elements = 0;
+
+    static _CONSTEXPR17 size_t s_MaxCompactListSize = 10000000;
+    static _CONSTEXPR17 uint32_t s_MinPoolNodes = 8;
+};
+
+/*
+* CompactList that takes its memory from a std::pmr::memory_resource selected at runtime.
+*/
+template<typename T>
+using PmrCompactList = CompactList<T, std::pmr::polymorphic_allocator<T>>;
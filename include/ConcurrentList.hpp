@@ -0,0 +1,418 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header class.
+* ConcurrentList is a lock-free sorted set, many threads can insert, erase and look for elements at the same time.
+* It is the list of Harris: an erased node is first marked in the low bit of its Next link and then unlinked,
+* so no thread can link a new node after a node that is being erased. Any thread that finds a marked node helps to unlink it.
+* Nodes keep the layout of the List nodes, the links followed by the element in the same block, without Prev.
+* Unlinked nodes are freed through EpochReclamation, so a thread never reads a node that another thread has freed.
+* Size is exact once the threads that modify the list have finished, while they run it is only an estimate.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <atomic>  //For std::atomic
+#include <cstdint>  //For uintptr_t
+#include <functional>  //For std::less
+#include <initializer_list>  //For std::initializer_list
+#include <new>  //For placement new
+#include <utility>  //For std::forward
+#include "EpochReclamation.hpp"
+
+template<typename T, typename Compare = std::less<T>>
+class ConcurrentList
+{
+    struct Node
+    {
+        //Modifiers
+    public:
+        __forceinline void GenerateData() noexcept
+        {
+            Node* aux = this;
+            ++aux;
+            Data = reinterpret_cast<T*>(aux);
+        }
+
+    public:
+        T* Data = nullptr;
+        std::atomic<uintptr_t> Next{ 0 };
+    };
+
+    /*
+    * Memory of a node and its element, both are allocated as a single block.
+    */
+    struct alignas(alignof(Node) > alignof(T) ? alignof(Node) : alignof(T)) NodeBlock
+    {
+        unsigned char Bytes[sizeof(Node) + sizeof(T)];
+    };
+
+    using Link = std::atomic<uintptr_t>;
+
+public:
+    using value_type = T;
+
+    //Modifiers
+public:
+    /**
+    * @brief: Inserts a copy of value if the container has no element equivalent to it.
+    * @details: The node is only allocated once the element is known to be missing.
+    * Can throw exceptions (Typically std::bad_alloc)
+    *
+    * @param: const T& -> Element.
+    * @return: bool -> True if the element was inserted.
+    */
+    __forceinline bool Insert(const T& value) { return InsertValue(value); }
+
+    /**
+    * @brief: Inserts value if the container has no element equivalent to it.
+    * @details: The node is only allocated once the element is known to be missing, otherwise value is not moved.
+    * Can throw exceptions (Typically std::bad_alloc)
+    *
+    * @param: T&& -> Element.
+    * @return: bool -> True if the element was inserted.
+    */
+    __forceinline bool Insert(T&& value) { return InsertValue(std::move(value)); }
+
+    /**
+    * @brief: Constructs an element with the given arguments and inserts it if the container has no element equivalent to it.
+    * @details: The element is always constructed, and destroyed if it was not inserted.
+    * Can throw exceptions (Typically std::bad_alloc)
+    *
+    * @param: Args&&... -> Arguments of the element.
+    * @return: bool -> True if the element was inserted.
+    */
+    template<typename... Args>
+    bool Emplace(Args&&... args)
+    {
+        Node* node = CreateNode(std::forward<Args>(args)...);
+
+        EpochReclamation::Guard guard;
+        Link* prev;
+        Node* curr;
+        while (true)
+        {
+            if (Search(*node->Data, prev, curr))
+            {
+                DestroyNode(node);
+                return false;
+            }
+            if (LinkNode(prev, curr, node)) { return true; }
+        }
+    }
+
+    /**
+    * @brief: Erases the element equivalent to value.
+    * @details: The element is destroyed once no thread can be reading it.
+    *
+    * @param: const T& -> Element to erase.
+    * @return: bool -> True if the element was in the container.
+    */
+    bool Erase(const T& value)
+    {
+        EpochReclamation::Guard guard;
+        Link* prev;
+        Node* curr;
+        while (true)
+        {
+            if (!Search(value, prev, curr)) { return false; }
+
+            uintptr_t next = curr->Next.load(std::memory_order_acquire);
+            if (IsMarked(next)) { continue; }
+            if (!curr->Next.compare_exchange_weak(next, next | s_Mark, std::memory_order_acq_rel, std::memory_order_relaxed)) { continue; }
+
+            //The element is erased once marked, unlinking it is only cleanup that any thread can finish
+            m_Elements.fetch_sub(1, std::memory_order_relaxed);
+            Unlink(prev, curr, next, value);
+            return true;
+        }
+    }
+
+    /**
+    * @brief: Erases all the elements of the container.
+    * @details: Elements inserted by other threads while clearing may remain in the container.
+    *
+    * @return: void.
+    */
+    void Clear()
+    {
+        while (true)
+        {
+            EpochReclamation::Guard guard;
+            const uintptr_t first = m_Head.load(std::memory_order_acquire);
+            Node* node = ToNode(first);
+            if (!node) { return; }
+
+            uintptr_t next = node->Next.load(std::memory_order_acquire);
+            if (!IsMarked(next))
+            {
+                if (!node->Next.compare_exchange_weak(next, next | s_Mark, std::memory_order_acq_rel, std::memory_order_relaxed)) { continue; }
+                m_Elements.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            uintptr_t expected = first;
+            if (m_Head.compare_exchange_strong(expected, Unmarked(next), std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                EpochReclamation::Retire(node, &ReleaseNode);
+            }
+        }
+    }
+
+    //Capacity
+public:
+    /**
+    * @brief: Checks if the container is empty.
+    *
+    * @return: bool -> True if the container has no elements.
+    */
+    _NODISCARD __forceinline bool IsEmpty() const noexcept { return Size() == 0; }
+
+    /**
+    * @brief: Number of elements of the container.
+    * @details: Exact when no thread is modifying the container.
+    *
+    * @return: size_t -> Elements.
+    */
+    _NODISCARD __forceinline size_t Size() const noexcept { return m_Elements.load(std::memory_order_relaxed); }
+
+    //Element Access
+public:
+    /**
+    * @brief: Checks if the container has an element equivalent to value.
+    * @details: Wait-free, it only reads the nodes and skips the ones marked as erased.
+    *
+    * @param: const T& -> Element to look for.
+    * @return: bool -> True if the element is in the container.
+    */
+    _NODISCARD bool Contains(const T& value) const noexcept
+    {
+        EpochReclamation::Guard guard;
+        Node* node = ToNode(m_Head.load(std::memory_order_acquire));
+        while (node && m_Compare(*node->Data, value))
+        {
+            node = ToNode(node->Next.load(std::memory_order_acquire));
+        }
+
+        return node && !m_Compare(value, *node->Data) && !IsMarked(node->Next.load(std::memory_order_acquire));
+    }
+
+    /**
+    * @brief: Calls function with every element of the container in order.
+    * @details: Elements inserted or erased by other threads meanwhile may or may not be visited.
+    *
+    * @param: Function -> Function that takes a const T&.
+    * @return: void.
+    */
+    template<typename Function>
+    void ForEach(Function function) const
+    {
+        EpochReclamation::Guard guard;
+        Node* node = ToNode(m_Head.load(std::memory_order_acquire));
+        while (node)
+        {
+            const uintptr_t next = node->Next.load(std::memory_order_acquire);
+            if (!IsMarked(next)) { function(static_cast<const T&>(*node->Data)); }
+            node = ToNode(next);
+        }
+    }
+
+    //Member functions
+public:
+    ConcurrentList() noexcept = default;
+
+    explicit ConcurrentList(const Compare& compare) noexcept :
+        m_Compare(compare) {}
+
+    ConcurrentList(std::initializer_list<T> list) :
+        ConcurrentList()
+    {
+        for (const T& element : list)
+        {
+            Insert(element);
+        }
+    }
+
+    ConcurrentList(const ConcurrentList& other) = delete;
+
+    /**
+    * @brief: Destroys the elements still linked.
+    * @details: No other thread can be using the container, the nodes already unlinked are freed by EpochReclamation.
+    */
+    ~ConcurrentList() noexcept
+    {
+        Node* node = ToNode(m_Head.load(std::memory_order_acquire));
+        while (node)
+        {
+            Node* next = ToNode(node->Next.load(std::memory_order_relaxed));
+            DestroyNode(node);
+            node = next;
+        }
+    }
+
+    ConcurrentList& operator=(const ConcurrentList& other) = delete;
+
+private:
+    _NODISCARD static __forceinline bool IsMarked(uintptr_t link) noexcept { return link & s_Mark; }
+
+    _NODISCARD static __forceinline uintptr_t Unmarked(uintptr_t link) noexcept { return link & ~s_Mark; }
+
+    _NODISCARD static __forceinline Node* ToNode(uintptr_t link) noexcept { return reinterpret_cast<Node*>(link & ~s_Mark); }
+
+    _NODISCARD static __forceinline uintptr_t ToLink(Node* node) noexcept { return reinterpret_cast<uintptr_t>(node); }
+
+    template<typename... Args>
+    _NODISCARD static Node* CreateNode(Args&&... args)
+    {
+        Node* node = new (new NodeBlock) Node();
+        node->GenerateData();
+        try
+        {
+            new (node->Data) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            node->~Node();
+            delete reinterpret_cast<NodeBlock*>(node);
+            throw;
+        }
+
+        return node;
+    }
+
+    static void DestroyNode(Node* node) noexcept
+    {
+        node->Data->~T();
+        node->~Node();
+        delete reinterpret_cast<NodeBlock*>(node);
+    }
+
+    static void ReleaseNode(void* node) noexcept { DestroyNode(static_cast<Node*>(node)); }
+
+    /**
+    * @brief: Finds the first node that is not less than value, unlinking the marked nodes found on the way.
+    * @details: The caller must be inside a critical section. If a link changes under the search, it starts again from the head.
+    *
+    * @param: const T& -> Element to look for.
+    * @param: Link*& -> Output, link that points to the found node.
+    * @param: Node*& -> Output, found node, nullptr if every node is less than value.
+    * @return: bool -> True if the found node is equivalent to value.
+    */
+    bool Search(const T& value, Link*& prev, Node*& curr)
+    {
+        while (true)
+        {
+            prev = &m_Head;
+            uintptr_t link = prev->load(std::memory_order_acquire);
+            bool restart = false;
+
+            while (!restart)
+            {
+                curr = ToNode(link);
+                if (!curr) { return false; }
+
+                const uintptr_t next = curr->Next.load(std::memory_order_acquire);
+                if (IsMarked(next))
+                {
+                    uintptr_t expected = link;
+                    if (prev->compare_exchange_strong(expected, Unmarked(next), std::memory_order_acq_rel, std::memory_order_relaxed))
+                    {
+                        EpochReclamation::Retire(curr, &ReleaseNode);
+                        link = Unmarked(next);
+                    }
+                    else { restart = true; }
+                    continue;
+                }
+
+                if (!m_Compare(*curr->Data, value)) { return !m_Compare(value, *curr->Data); }
+
+                prev = &curr->Next;
+                link = next;
+            }
+        }
+    }
+
+    /**
+    * @brief: Links node between the link prev and curr.
+    * @details: Fails if prev no longer points to curr, or if the node of prev has been marked meanwhile.
+    *
+    * @return: bool -> True if the node was linked.
+    */
+    __forceinline bool LinkNode(Link* prev, Node* curr, Node* node) noexcept
+    {
+        node->Next.store(ToLink(curr), std::memory_order_relaxed);
+        uintptr_t expected = ToLink(curr);
+        if (!prev->compare_exchange_strong(expected, ToLink(node), std::memory_order_release, std::memory_order_relaxed)) { return false; }
+
+        m_Elements.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+    * @brief: Unlinks a marked node, or leaves it to a search if prev has changed.
+    * @details: Only the thread that unlinks a node retires it.
+    *
+    * @return: void.
+    */
+    __forceinline void Unlink(Link* prev, Node* curr, uintptr_t next, const T& value)
+    {
+        uintptr_t expected = ToLink(curr);
+        if (prev->compare_exchange_strong(expected, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            EpochReclamation::Retire(curr, &ReleaseNode);
+        }
+        else { Search(value, prev, curr); }
+    }
+
+    template<typename Value>
+    bool InsertValue(Value&& value)
+    {
+        EpochReclamation::Guard guard;
+        Node* node = nullptr;
+        Link* prev;
+        Node* curr;
+        while (true)
+        {
+            if (Search(node ? *node->Data : value, prev, curr))
+            {
+                if (node) { DestroyNode(node); }
+                return false;
+            }
+            if (!node) { node = CreateNode(std::forward<Value>(value)); }
+            if (LinkNode(prev, curr, node)) { return true; }
+        }
+    }
+
+private:
+    Link m_Head{ 0 };
+    std::atomic<size_t> m_Elements{ 0 };
+    Compare m_Compare;
+
+    static _CONSTEXPR17 uintptr_t s_Mark = 1;
+};
@@ -0,0 +1,1777 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header class.
+* Deque class is a double-ended sequence container with constant time insertion and removal at both ends and constant time access by index.
+* The elements are stored in fixed size blocks of BlockSize elements, the blocks are referenced from a circular map.
+* The map is a ring of positions, the elements of the container are a contiguous range of that ring that can start anywhere,
+* so pushing at the front only moves the start of the range back and no element is ever shifted.
+* The blocks are allocated when the range first reaches them and kept when it leaves them, a deque used as a queue reuses the same blocks.
+* Inserting or erasing elements invalidates the iterators. Pushing at either end keeps the references to the elements valid,
+* unless the map grows while the range wraps around the ring.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <initializer_list>
+#include <cstring>  //For std::memcpy
+#include <algorithm>  //For std::move and std::move_backward
+#include "TypeTraits.hpp"
+#include "Allocator.hpp"
+
+/*
+* Default number of elements per block, the largest power of two that keeps a block under 4 KiB and never less than 16.
+*/
+template<typename T>
+struct DequeBlockSize
+{
+    static constexpr size_t Floor(size_t elements) noexcept { return elements < 2 ? 1 : 2 * Floor(elements / 2); }
+
+    static constexpr size_t value = sizeof(T) * 16 < 4096 ? Floor(4096 / sizeof(T)) : 16;
+};
+
+template<typename T, size_t BlockSize = DequeBlockSize<T>::value, typename Allocator = std::allocator<T>>
+class Deque : private AllocatorStorage<Allocator>
+{
+    static_assert(BlockSize > 0 && (BlockSize & (BlockSize - 1)) == 0, "The block size of a Deque must be a power of two");
+
+    using AllocatorBase = AllocatorStorage<Allocator>;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    using Propagation = AllocatorPropagation<Allocator>;
+    using AllocatorBase::GetAllocatorReference;
+
+    using MapAllocator = typename AllocatorTraits::template rebind_alloc<T*>;
+    using MapTraits = std::allocator_traits<MapAllocator>;
+
+public:
+    template<typename ValueType>
+    class Iterator
+    {
+        friend class Deque;
+        //Modifiers
+    public:
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Pre increment. The block is only looked up in the map when the iterator leaves the current one.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator++() noexcept
+        {
+            ++m_Index;
+            if (m_Ptr != m_Last) { ++m_Ptr; }
+            else { Resolve(); }
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Post increment.
+        *
+        * @return: Iterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline Iterator operator++(int) noexcept
+        {
+            Iterator it(*this);
+            operator++();
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator+=(size_t distance) noexcept
+        {
+            m_Index += distance;
+            Resolve();
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator+=(int distance) noexcept
+        {
+            m_Index += (size_t)distance;
+            Resolve();
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        * @details: By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: void.
+        */
+        void Advance(size_t distance = 1)
+        {
+            if (!m_Deque) { throw std::exception("Invalid iterator"); }
+            operator+=(distance);
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        * By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: void.
+        */
+        void Advance(int distance = 1)
+        {
+            if (!m_Deque) { throw std::exception("Invalid iterator"); }
+            operator+=(distance);
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Pre increment.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator--() noexcept
+        {
+            --m_Index;
+            if (m_Ptr != m_First) { --m_Ptr; }
+            else { Resolve(); }
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Post increment.
+        *
+        * @return: Iterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline Iterator operator--(int) noexcept
+        {
+            Iterator it(*this);
+            operator--();
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator-=(size_t distance) noexcept
+        {
+            m_Index -= distance;
+            Resolve();
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator-=(int distance) noexcept
+        {
+            m_Index -= (size_t)distance;
+            Resolve();
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        * @details: By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: void.
+        */
+        void Retreat(size_t distance = 1)
+        {
+            if (!m_Deque) { throw std::exception("Invalid iterator"); }
+            operator-=(distance);
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        * By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: void.
+        */
+        void Retreat(int distance = 1)
+        {
+            if (!m_Deque) { throw std::exception("Invalid iterator"); }
+            operator-=(distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator+(size_t distance) const noexcept { return Iterator(m_Deque, m_Index + distance); }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator+(int distance) const noexcept { return Iterator(m_Deque, m_Index + (size_t)distance); }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        * @details: By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD Iterator Next(size_t distance = 1) const
+        {
+            if (!m_Deque) { throw std::exception("Invalid iterator"); }
+            return operator+(distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        * @details: By giving a negative number, the iterator will move backward instead.
+        * By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD Iterator Next(int distance = 1) const
+        {
+            if (!m_Deque) { throw std::exception("Invalid iterator"); }
+            return operator+(distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator-(size_t distance) const noexcept { return Iterator(m_Deque, m_Index - distance); }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator-(int distance) const noexcept { return Iterator(m_Deque, m_Index - (size_t)distance); }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        * @details: By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD Iterator Prev(size_t distance = 1) const
+        {
+            if (!m_Deque) { throw std::exception("Invalid iterator"); }
+            return operator-(distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        * @details: By giving a negative number, the iterator will move forward instead.
+        * By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD Iterator Prev(int distance = 1) const
+        {
+            if (!m_Deque) { throw std::exception("Invalid iterator"); }
+            return operator-(distance);
+        }
+
+        //Element access
+    public:
+        /**
+        * @brief: Returns the element to the forward given distance.
+        *
+        * @param: size_t -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD __forceinline ValueType& operator[](size_t index) const noexcept { return *m_Deque->Slot(m_Index + index); }
+
+        /**
+        * @brief: Returns the element to the forward given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD __forceinline ValueType& operator[](int index) const noexcept { return *m_Deque->Slot(m_Index + (size_t)index); }
+
+        /**
+        * @brief: Returns the element to the forward given distance.
+        * @details: If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD ValueType& At(size_t index) const { return *(Next(index)); }
+
+        /**
+        * @brief: Returns the element to the forward given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD ValueType& At(int index) const { return *(Next(index)); }
+
+        /**
+        * @brief: Returns the data of the iterator.
+        *
+        * @return: ValueType& -> Data.
+        */
+        _NODISCARD __forceinline ValueType& operator*() const noexcept { return *m_Ptr; }
+
+        /**
+        * @brief: Returns the data of the iterator.
+        * @details: If the iterator is not valid, throws std::exception.
+        *
+        * @return: ValueType& -> Data.
+        */
+        _NODISCARD ValueType& Data() const
+        {
+            if (!m_Ptr) { throw std::exception("Invalid iterator"); }
+            return *m_Ptr;
+        }
+
+        /**
+        * @brief: Returns the Iterator.
+        *
+        * @return: ValueType* -> Iterator.
+        */
+        _NODISCARD __forceinline ValueType* operator->() const noexcept { return m_Ptr; }
+
+        /**
+        * @brief: Returns the Iterator.
+        * @details: If the iterator is not valid, throws std::exception.
+        *
+        * @return: ValueType* -> Iterator.
+        */
+        _NODISCARD ValueType* Get() const
+        {
+            if (!m_Ptr) { throw std::exception("Invalid iterator"); }
+            return m_Ptr;
+        }
+
+        //Non member functions
+    public:
+        /**
+        * @brief: Returns the distance between the iterator and other.
+        * @details: The result is always a positive number.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: size_t -> Distance.
+        */
+        _NODISCARD size_t Distance(const Iterator& other) const
+        {
+            if (!m_Deque) { throw std::exception("Invalid iterator"); }
+            if (!other) { throw std::exception("Invalid parameter"); }
+            if (m_Index > other.m_Index) { return m_Index - other.m_Index; }
+            return other.m_Index - m_Index;
+        }
+
+        /**
+        * @brief: Compares if two iterators are equal.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if both are equal.
+        */
+        _NODISCARD __forceinline bool operator==(const Iterator& other) const noexcept { return m_Index == other.m_Index && m_Deque == other.m_Deque; }
+
+        /**
+        * @brief: Compares if two iterators are not equal.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if both are not equal.
+        */
+        _NODISCARD __forceinline bool operator!=(const Iterator& other) const noexcept { return !(operator==(other)); }
+
+        /**
+        * @brief: Compares if the iterator is lesser than the other.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if the iterator is lesser.
+        */
+        _NODISCARD __forceinline bool operator<(const Iterator& other) const noexcept { return m_Index < other.m_Index; }
+
+        /**
+        * @brief: Compares if the iterator is lesser or equal than the other.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if the iterator is lesser or equal.
+        */
+        _NODISCARD __forceinline bool operator<=(const Iterator& other) const noexcept { return !(operator>(other)); }
+
+        /**
+        * @brief: Compares if the iterator is greater than the other.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if the iterator is greater.
+        */
+        _NODISCARD __forceinline bool operator>(const Iterator& other) const noexcept { return m_Index > other.m_Index; }
+
+        /**
+        * @brief: Compares if the iterator is greater or equal than the other.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if the iterator is greater or equal.
+        */
+        _NODISCARD __forceinline bool operator>=(const Iterator& other) const noexcept { return !(operator<(other)); }
+
+        /**
+        * @brief: Checks if the iterator belongs to a container.
+        *
+        * @return: bool -> True if the iterator is valid.
+        */
+        _NODISCARD __forceinline operator bool() const noexcept { return m_Deque; }
+
+        /**
+        * @brief: Checks if the iterator belongs to a container.
+        *
+        * @return: bool -> True if the iterator is valid.
+        */
+        _NODISCARD __forceinline bool IsValid() const noexcept { return m_Deque; }
+
+        //Member functions
+    public:
+        __forceinline Iterator(const Deque* deque = nullptr, size_t index = 0) noexcept :
+            m_Deque(deque),
+            m_Index(index)
+        {
+            Resolve();
+        }
+
+        __forceinline Iterator(const Iterator& other) noexcept = default;
+
+        __forceinline Iterator& operator=(const Iterator& other) noexcept = default;
+
+    private:
+        /**
+        * @brief: Looks up the block of the index in the map.
+        * @details: The positions of a block without memory, like the end of a full block, get a null pointer.
+        *
+        * @return: void.
+        */
+        __forceinline void Resolve() noexcept
+        {
+            T* block = m_Deque ? m_Deque->BlockOf(m_Index) : nullptr;
+            if (!block)
+            {
+                m_Ptr = nullptr;
+                m_First = nullptr;
+                m_Last = nullptr;
+                return;
+            }
+
+            m_First = block;
+            m_Last = block + BlockSize - 1;
+            m_Ptr = block + m_Deque->OffsetOf(m_Index);
+        }
+
+    private:
+        ValueType* m_Ptr = nullptr;
+        ValueType* m_First = nullptr;
+        ValueType* m_Last = nullptr;
+        const Deque* m_Deque;
+        size_t m_Index;
+    };
+
+    template<typename ValueType>
+    class ReverseIterator
+    {
+        friend class Deque;
+        //Modifiers
+    public:
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Pre increment.
+        *
+        * @return: ReverseIterator& -> Iterator.
+        */
+        __forceinline ReverseIterator& operator++() noexcept
+        {
+            --m_Iterator;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Post increment.
+        *
+        * @return: ReverseIterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator++(int) noexcept
+        {
+            ReverseIterator it(*this);
+            --m_Iterator;
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: ReverseIterator& -> Iterator.
+        */
+        __forceinline ReverseIterator& operator+=(size_t distance) noexcept
+        {
+            m_Iterator -= distance;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Pre increment.
+        *
+        * @return: ReverseIterator& -> Iterator.
+        */
+        __forceinline ReverseIterator& operator--() noexcept
+        {
+            ++m_Iterator;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Post increment.
+        *
+        * @return: ReverseIterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator--(int) noexcept
+        {
+            ReverseIterator it(*this);
+            ++m_Iterator;
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: ReverseIterator& -> Iterator.
+        */
+        __forceinline ReverseIterator& operator-=(size_t distance) noexcept
+        {
+            m_Iterator += distance;
+            return *this;
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: ReverseIterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator+(size_t distance) const noexcept
+        {
+            ReverseIterator it(*this);
+            it += distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: ReverseIterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator-(size_t distance) const noexcept
+        {
+            ReverseIterator it(*this);
+            it -= distance;
+            return it;
+        }
+
+        //Element access
+    public:
+        /**
+        * @brief: Returns the element to the forward given distance.
+        *
+        * @param: size_t -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD __forceinline ValueType& operator[](size_t index) const noexcept { return *(operator+(index)); }
+
+        /**
+        * @brief: Returns the data of the iterator.
+        *
+        * @return: ValueType& -> Data.
+        */
+        _NODISCARD __forceinline ValueType& operator*() const noexcept { return *m_Iterator; }
+
+        /**
+        * @brief: Returns the Iterator.
+        *
+        * @return: ValueType* -> Iterator.
+        */
+        _NODISCARD __forceinline ValueType* operator->() const noexcept { return m_Iterator.operator->(); }
+
+        //Non member functions
+    public:
+        /**
+        * @brief: Returns the distance between the iterator and other.
+        * @details: The result is always a positive number.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: const ReverseIterator& -> Iterator to compare.
+        *
+        * @return: size_t -> Distance.
+        */
+        _NODISCARD size_t Distance(const ReverseIterator& other) const { return m_Iterator.Distance(other.m_Iterator); }
+
+        _NODISCARD __forceinline bool operator==(const ReverseIterator& other) const noexcept { return m_Iterator == other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator!=(const ReverseIterator& other) const noexcept { return m_Iterator != other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator<(const ReverseIterator& other) const noexcept { return m_Iterator > other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator<=(const ReverseIterator& other) const noexcept { return m_Iterator >= other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator>(const ReverseIterator& other) const noexcept { return m_Iterator < other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator>=(const ReverseIterator& other) const noexcept { return m_Iterator <= other.m_Iterator; }
+
+        _NODISCARD __forceinline operator bool() const noexcept { return m_Iterator.IsValid(); }
+
+        _NODISCARD __forceinline bool IsValid() const noexcept { return m_Iterator.IsValid(); }
+
+        //Member functions
+    public:
+        __forceinline ReverseIterator(const Deque* deque = nullptr, size_t index = 0) noexcept :
+            m_Iterator(deque, index) {}
+
+        __forceinline ReverseIterator(const ReverseIterator& other) noexcept = default;
+
+        __forceinline ReverseIterator& operator=(const ReverseIterator& other) noexcept = default;
+
+    private:
+        Iterator<ValueType> m_Iterator;
+    };
+
+public:
+    using value_type = T;
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+    using reverse_iterator = ReverseIterator<T>;
+    using const_reverse_iterator = ReverseIterator<const T>;
+    using allocator_type = Allocator;
+
+    //Modifiers
+public:
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: Amortized constant time, no element is moved.
+    * If an exception is thrown (which can be due to the allocation or element copy constructor), this function has no effect.
+    *
+    * @param: const T& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushBack(const T& element) { EmplaceBack(element); }
+
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: Amortized constant time, no element is moved.
+    * If an exception is thrown (which can be due to the allocation or element move constructor), this function has no effect.
+    *
+    * @param: T&& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushBack(T&& element) { EmplaceBack(std::move(element)); }
+
+    /**
+    * @brief: Inserts a new element at the begin of the container.
+    * @details: Amortized constant time, no element is moved.
+    * If an exception is thrown (which can be due to the allocation or element copy constructor), this function has no effect.
+    *
+    * @param: const T& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushFront(const T& element) { EmplaceFront(element); }
+
+    /**
+    * @brief: Inserts a new element at the begin of the container.
+    * @details: Amortized constant time, no element is moved.
+    * If an exception is thrown (which can be due to the allocation or element move constructor), this function has no effect.
+    *
+    * @param: T&& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushFront(T&& element) { EmplaceFront(std::move(element)); }
+
+    /**
+    * @brief: Inserts a new element into the container directly before index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @param: const T& -> Element.
+    * @return: iterator -> Iterator to the new element.
+    */
+    iterator Insert(size_t index, const T& element) { return Emplace(index, element); }
+
+    /**
+    * @brief: Inserts a new element into the container directly before index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @param: T&& -> Element.
+    * @return: iterator -> Iterator to the new element.
+    */
+    iterator Insert(size_t index, T&& element) { return Emplace(index, std::move(element)); }
+
+    /**
+    * @brief: Inserts a new element into the container directly before the iterator.
+    *
+    * @param: iterator -> Position.
+    * @param: const T& -> Element.
+    * @return: iterator -> Iterator to the new element.
+    */
+    iterator Insert(iterator it, const T& element) { return Emplace(it.m_Index, element); }
+
+    /**
+    * @brief: Inserts a new element into the container directly before the iterator.
+    *
+    * @param: iterator -> Position.
+    * @param: T&& -> Element.
+    * @return: iterator -> Iterator to the new element.
+    */
+    iterator Insert(iterator it, T&& element) { return Emplace(it.m_Index, std::move(element)); }
+
+    /**
+    * @brief: Constructs a new element at the end of the container.
+    * @details: Amortized constant time, no element is moved.
+    *
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        if (m_Elements == RingSize())
+        {
+            //The arguments can refer to an element of the container, the element is built before the map relocates the elements
+            T element(std::forward<Args>(args)...);
+            GrowMap(m_Elements + 1);
+            return EmplaceBack(std::move(element));
+        }
+
+        T* slot = CreateSlot((m_Start + m_Elements) & RingMask());
+        new (slot) T(std::forward<Args>(args)...);
+        ++m_Elements;
+
+        return *slot;
+    }
+
+    /**
+    * @brief: Constructs a new element at the begin of the container.
+    * @details: Amortized constant time, the start of the elements moves one position back in the ring.
+    *
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& EmplaceFront(Args&&... args)
+    {
+        if (m_Elements == RingSize())
+        {
+            //The arguments can refer to an element of the container, the element is built before the map relocates the elements
+            T element(std::forward<Args>(args)...);
+            GrowMap(m_Elements + 1);
+            return EmplaceFront(std::move(element));
+        }
+
+        const size_t position = (m_Start - 1) & RingMask();
+        T* slot = CreateSlot(position);
+        new (slot) T(std::forward<Args>(args)...);
+        m_Start = position;
+        ++m_Elements;
+
+        return *slot;
+    }
+
+    /**
+    * @brief: Constructs a new element into the container directly before index.
+    * @details: The elements on the shorter side of the index are shifted one position, so the cost is linear in the distance to the nearest end.
+    * std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: iterator -> Iterator to the new element.
+    */
+    template<typename... Args>
+    iterator Emplace(size_t index, Args&&... args)
+    {
+        if (index > m_Elements) { DequeOutOfRangeError(); }
+        if (index == m_Elements)
+        {
+            EmplaceBack(std::forward<Args>(args)...);
+            return iterator(this, index);
+        }
+        if (index == 0)
+        {
+            EmplaceFront(std::forward<Args>(args)...);
+            return begin();
+        }
+
+        T element(std::forward<Args>(args)...);
+        //The map grows first, so the ends are not relocated while they are moved
+        if (m_Elements == RingSize()) { GrowMap(m_Elements + 1); }
+
+        if (index < (m_Elements >> 1))
+        {
+            EmplaceFront(std::move(Front()));
+            MoveForwards(1, 2, index - 1);
+        }
+        else
+        {
+            EmplaceBack(std::move(Back()));
+            MoveBackwards(m_Elements - 1, m_Elements - 2, m_Elements - 2 - index);
+        }
+        *Slot(index) = std::move(element);
+
+        return iterator(this, index);
+    }
+
+    /**
+    * @brief: Constructs a new element into the container directly before the iterator.
+    *
+    * @param: iterator -> Position.
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: iterator -> Iterator to the new element.
+    */
+    template<typename... Args>
+    iterator EmplaceAt(iterator it, Args&&... args) { return Emplace(it.m_Index, std::forward<Args>(args)...); }
+
+    /**
+    * @brief: Delete the last element of the container.
+    * @details: The block of the element is kept for the next insertions.
+    *
+    * @return: void.
+    */
+    void PopBack() noexcept
+    {
+        if (IsEmpty()) { return; }
+
+        Slot(m_Elements - 1)->~T();
+        --m_Elements;
+    }
+
+    /**
+    * @brief: Delete the first element of the container.
+    * @details: The block of the element is kept for the next insertions.
+    *
+    * @return: void.
+    */
+    void PopFront() noexcept
+    {
+        if (IsEmpty()) { return; }
+
+        Slot(0)->~T();
+        m_Start = (m_Start + 1) & RingMask();
+        --m_Elements;
+    }
+
+    /**
+    * @brief: Delete the element at the given index.
+    * @details: The elements on the shorter side of the index are shifted one position.
+    * std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: iterator -> Iterator to the element at the index position after deleting.
+    */
+    iterator Erase(size_t index)
+    {
+        if (index >= m_Elements) { DequeOutOfRangeError(); }
+
+        if (index < (m_Elements >> 1))
+        {
+            MoveBackwards(index + 1, index, index);
+            PopFront();
+        }
+        else
+        {
+            MoveForwards(index, index + 1, m_Elements - 1 - index);
+            PopBack();
+        }
+
+        return iterator(this, index);
+    }
+
+    /**
+    * @brief: Delete the element of the given iterator.
+    * @details: The elements on the shorter side of the iterator are shifted one position.
+    *
+    * @param: iterator -> Position.
+    * @return: iterator -> Iterator to the element at the iterator position after deleting.
+    */
+    iterator Erase(iterator it) { return Erase(it.m_Index); }
+
+    /**
+    * @brief: Clears the content of the container.
+    * @details: The blocks and the map are kept, use Shrink to release them.
+    *
+    * @return: void.
+    */
+    void Clear() noexcept
+    {
+        DestroyElements();
+        m_Start = 0;
+        m_Elements = 0;
+    }
+
+    /**
+    * @brief: Swaps the content of two Deques.
+    * @details: Only the maps are exchanged, no element is moved.
+    * The allocators are only swapped if the allocator propagates on swap, otherwise both allocators must be equal.
+    *
+    * @param: Deque& -> Other deque.
+    * @return: void.
+    */
+    void Swap(Deque& other) noexcept
+    {
+        if (&other == this) { return; }
+
+        Propagation::OnSwap(GetAllocatorReference(), other.GetAllocatorReference());
+
+        T** map = m_Map;
+        size_t map_size = m_MapSize;
+        size_t start = m_Start;
+        size_t elements = m_Elements;
+        size_t blocks = m_Blocks;
+
+        m_Map = other.m_Map;
+        m_MapSize = other.m_MapSize;
+        m_Start = other.m_Start;
+        m_Elements = other.m_Elements;
+        m_Blocks = other.m_Blocks;
+
+        other.m_Map = map;
+        other.m_MapSize = map_size;
+        other.m_Start = start;
+        other.m_Elements = elements;
+        other.m_Blocks = blocks;
+    }
+
+    /**
+    * @brief: Appends the elements of other at the end of the container.
+    * @details: The elements are copied, other can be the container itself.
+    *
+    * @param: const Deque& -> Other deque.
+    * @return: void.
+    */
+    void Append(const Deque& other)
+    {
+        const size_t elements = other.m_Elements;
+        Reserve(m_Elements + elements);
+
+        for (size_t i = 0; i < elements; ++i)
+        {
+            EmplaceBack(*other.Slot(i));
+        }
+    }
+
+    /**
+    * @brief: Appends the elements of other at the end of the container.
+    * @details: If the container is empty and both allocators are equal, the map of other is taken in constant time.
+    * Otherwise the elements are moved one by one. Other is left empty.
+    *
+    * @param: Deque&& -> Other deque.
+    * @return: void.
+    */
+    void Append(Deque&& other)
+    {
+        if (&other == this || other.IsEmpty()) { return; }
+        if (IsEmpty() && Propagation::AreEqual(GetAllocatorReference(), other.GetAllocatorReference()))
+        {
+            ReleaseStorage();
+            TakeStorage(other);
+            return;
+        }
+
+        Reserve(m_Elements + other.m_Elements);
+        for (size_t i = 0; i < other.m_Elements; ++i)
+        {
+            EmplaceBack(std::move(*other.Slot(i)));
+        }
+        other.Clear();
+    }
+
+    //Capacity
+public:
+    /**
+    * @brief: Makes room for at least capacity elements.
+    * @details: The map grows if needed and the blocks after the last element are allocated, so the next push backs do not allocate.
+    * std::exception execption will be thrown if the capacity is greater than the maximum size.
+    *
+    * @param: size_t -> Capacity.
+    * @return: void.
+    */
+    void Reserve(size_t capacity)
+    {
+        if (capacity > RingSize()) { GrowMap(capacity); }
+        if (capacity == 0) { return; }
+
+        const size_t first = m_Start / BlockSize;
+        size_t blocks = ((m_Start % BlockSize) + capacity + BlockSize - 1) / BlockSize;
+        if (blocks > m_MapSize) { blocks = m_MapSize; }
+
+        for (size_t i = 0; i < blocks; ++i)
+        {
+            CreateBlock((first + i) & (m_MapSize - 1));
+        }
+    }
+
+    /**
+    * @brief: Requests the removal of unused capacity.
+    * @details: The blocks without elements are released, an empty container also releases its map.
+    *
+    * @return: void.
+    */
+    void Shrink() noexcept
+    {
+        if (!m_Map) { return; }
+        if (IsEmpty()) { return ReleaseStorage(); }
+
+        const size_t first = m_Start / BlockSize;
+        const size_t used = ((m_Start % BlockSize) + m_Elements + BlockSize - 1) / BlockSize;
+
+        for (size_t i = used; i < m_MapSize; ++i)
+        {
+            T*& block = m_Map[(first + i) & (m_MapSize - 1)];
+            if (block)
+            {
+                FreeBlock(block);
+                block = nullptr;
+            }
+        }
+    }
+
+    /**
+    * @brief: Checks if the container is empty.
+    *
+    * @return: bool -> True if the container has no elements.
+    */
+    _NODISCARD __forceinline bool IsEmpty() const noexcept { return m_Elements == 0; }
+
+    /**
+    * @brief: Number of elements in the container.
+    *
+    * @return: size_t -> Elements.
+    */
+    _NODISCARD __forceinline size_t Size() const noexcept { return m_Elements; }
+
+    /**
+    * @brief: Number of elements that fit in the allocated blocks.
+    *
+    * @return: size_t -> Capacity.
+    */
+    _NODISCARD __forceinline size_t Capacity() const noexcept { return m_Blocks * BlockSize; }
+
+    /**
+    * @brief: Number of allocated blocks.
+    *
+    * @return: size_t -> Blocks.
+    */
+    _NODISCARD __forceinline size_t Blocks() const noexcept { return m_Blocks; }
+
+    //Element Access
+public:
+    /**
+    * @brief: Returns a reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Front() noexcept { return *Slot(0); }
+
+    /**
+    * @brief: Returns a const reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Front() const noexcept { return *Slot(0); }
+
+    /**
+    * @brief: Returns a reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Back() noexcept { return *Slot(m_Elements - 1); }
+
+    /**
+    * @brief: Returns a const reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Back() const noexcept { return *Slot(m_Elements - 1); }
+
+    /**
+    * @brief: Returns a reference to the element at the given index.
+    * @details: Constant time, the block is found in the map with a shift and a mask.
+    * Calling [] in a empty container is undefined.
+    *
+    * @param: size_t -> Index.
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& operator[](size_t index) noexcept { return *Slot(index); }
+
+    /**
+    * @brief: Returns a const reference to the element at the given index.
+    * @details: Calling [] in a empty container is undefined.
+    *
+    * @param: size_t -> Index.
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& operator[](size_t index) const noexcept { return *Slot(index); }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: T& -> Element.
+    */
+    _NODISCARD T& At(size_t index)
+    {
+        if (index >= m_Elements) { DequeOutOfRangeError(); }
+        return *Slot(index);
+    }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: const T& -> Element.
+    */
+    _NODISCARD const T& At(size_t index) const
+    {
+        if (index >= m_Elements) { DequeOutOfRangeError(); }
+        return *Slot(index);
+    }
+
+    //Iterators
+public:
+    /**
+    * @brief: Returns an iterator to the begin of the container.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator begin() noexcept { return iterator(this, 0); }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator begin() const noexcept { return const_iterator(this, 0); }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cbegin() const noexcept { return const_iterator(this, 0); }
+
+    /**
+    * @brief: Returns an iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator end() noexcept { return iterator(this, m_Elements); }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator end() const noexcept { return const_iterator(this, m_Elements); }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cend() const noexcept { return const_iterator(this, m_Elements); }
+
+    /**
+    * @brief: Returns a reverse iterator to the end of the container.
+    * @details: The iterator points to the last element.
+    *
+    * @return: reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline reverse_iterator rbegin() noexcept { return reverse_iterator(this, m_Elements - 1); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the end of the container.
+    * @details: The iterator points to the last element.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(this, m_Elements - 1); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the end of the container.
+    * @details: The iterator points to the last element.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(this, m_Elements - 1); }
+
+    /**
+    * @brief: Returns a reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline reverse_iterator rend() noexcept { return reverse_iterator(this, (size_t)-1); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator rend() const noexcept { return const_reverse_iterator(this, (size_t)-1); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator crend() const noexcept { return const_reverse_iterator(this, (size_t)-1); }
+
+    //Member functions
+public:
+    explicit Deque() noexcept = default;
+
+    explicit Deque(const Allocator& allocator) noexcept :
+        AllocatorBase(allocator) {}
+
+    explicit Deque(size_t capacity)
+    {
+        Reserve(capacity);
+    }
+
+    Deque(size_t capacity, const Allocator& allocator) :
+        AllocatorBase(allocator)
+    {
+        Reserve(capacity);
+    }
+
+    Deque(const Deque& other) :
+        AllocatorBase(Propagation::OnCopyConstruction(other.GetAllocatorReference()))
+    {
+        Append(other);
+    }
+
+    Deque(Deque&& other) noexcept :
+        AllocatorBase(std::move(other.GetAllocatorReference()))
+    {
+        TakeStorage(other);
+    }
+
+    Deque(std::initializer_list<T>&& list)
+    {
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+    }
+
+    Deque(std::initializer_list<T>&& list, const Allocator& allocator) :
+        AllocatorBase(allocator)
+    {
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+    }
+
+    ~Deque() noexcept
+    {
+        Nullify();
+    }
+
+    Deque& operator=(const Deque& other)
+    {
+        if (&other == this) { return *this; }
+
+        //The blocks are released by the current allocator before it is replaced
+        Nullify();
+        Propagation::OnCopyAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        Append(other);
+
+        return *this;
+    }
+
+    Deque& operator=(Deque&& other) noexcept(Propagation::s_AlwaysTakesMemory)
+    {
+        if (&other == this) { return *this; }
+
+        Nullify();
+        if (!Propagation::CanTakeMemory(GetAllocatorReference(), other.GetAllocatorReference()))
+        {
+            //The blocks of other can not be released by this allocator, the elements are moved one by one
+            Append(std::move(other));
+            return *this;
+        }
+
+        Propagation::OnMoveAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        TakeStorage(other);
+
+        return *this;
+    }
+
+    Deque& operator=(std::initializer_list<T>&& list)
+    {
+        Clear();
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+
+        return *this;
+    }
+
+    /**
+    * @brief: Returns a copy of the allocator used by the container.
+    *
+    * @return: Allocator -> Allocator.
+    */
+    _NODISCARD __forceinline Allocator GetAllocator() const noexcept { return GetAllocatorReference(); }
+
+    //Non-member functions
+public:
+    /**
+    * @brief: Compares the content of two Deques.
+    *
+    * @return: bool -> True if the content of both containers are equal.
+    */
+    _NODISCARD bool operator==(const Deque& other) const noexcept
+    {
+        if (m_Elements != other.m_Elements) { return false; }
+
+        const_iterator other_it = other.cbegin();
+        for (const_iterator this_it = cbegin(); this_it != cend(); ++this_it, ++other_it)
+        {
+            if (*this_it != *other_it) { return false; }
+        }
+
+        return true;
+    }
+
+    /**
+    * @brief: Compares the content of two Deques.
+    *
+    * @return: bool -> True if the content of both containers are not equal.
+    */
+    _NODISCARD __forceinline bool operator!=(const Deque& other) const noexcept { return !(*this == other); }
+
+private:
+    _NODISCARD __forceinline size_t RingSize() const noexcept { return m_MapSize * BlockSize; }
+
+    _NODISCARD __forceinline size_t RingMask() const noexcept { return m_MapSize * BlockSize - 1; }
+
+    /**
+    * @brief: Returns the slot of the element at the given index, its block must be allocated.
+    *
+    * @param: size_t -> Index.
+    * @return: T* -> Slot.
+    */
+    _NODISCARD __forceinline T* Slot(size_t index) const noexcept
+    {
+        const size_t position = (m_Start + index) & RingMask();
+        return m_Map[position / BlockSize] + position % BlockSize;
+    }
+
+    /**
+    * @brief: Returns the block that holds the position of the given index, nullptr if there is no map or the block is not allocated.
+    *
+    * @param: size_t -> Index.
+    * @return: T* -> Block.
+    */
+    _NODISCARD __forceinline T* BlockOf(size_t index) const noexcept
+    {
+        if (!m_Map) { return nullptr; }
+        return m_Map[((m_Start + index) & RingMask()) / BlockSize];
+    }
+
+    /**
+    * @brief: Returns the offset of the given index inside its block, the ring has a whole number of blocks so it does not depend on the wrap.
+    *
+    * @param: size_t -> Index.
+    * @return: size_t -> Offset.
+    */
+    _NODISCARD __forceinline size_t OffsetOf(size_t index) const noexcept { return (m_Start + index) % BlockSize; }
+
+    /**
+    * @brief: Returns the slot of a position of the ring, allocating its block if needed.
+    *
+    * @param: size_t -> Position.
+    * @return: T* -> Slot.
+    */
+    _NODISCARD __forceinline T* CreateSlot(size_t position)
+    {
+        return CreateBlock(position / BlockSize) + position % BlockSize;
+    }
+
+    __forceinline T* CreateBlock(size_t block)
+    {
+        T*& memory_block = m_Map[block];
+        if (!memory_block) { memory_block = AllocateBlock(); }
+        return memory_block;
+    }
+
+    /**
+    * @brief: Replaces the map with a larger one that holds at least required elements.
+    * @details: The blocks are copied in the order of the ring starting with the block of the first element, so the elements keep their offsets.
+    * If the last elements wrapped around into the front of the block of the first element, they are moved to a new block after the old ones.
+    *
+    * @param: size_t -> Required number of elements.
+    * @return: void.
+    */
+    void GrowMap(size_t required)
+    {
+        if (required > s_MaxDequeSize) { DequeMaxLenghtError(); }
+
+        size_t map_size = m_MapSize ? m_MapSize * 2 : s_DefaultMapSize;
+        while (map_size * BlockSize < required)
+        {
+            map_size *= 2;
+        }
+
+        T** map = AllocateMap(map_size);
+        const size_t first = m_Start / BlockSize;
+        const size_t offset = m_Start % BlockSize;
+        for (size_t i = 0; i < m_MapSize; ++i)
+        {
+            map[i] = m_Map[(first + i) & (m_MapSize - 1)];
+        }
+        for (size_t i = m_MapSize; i < map_size; ++i)
+        {
+            map[i] = nullptr;
+        }
+
+        if (offset + m_Elements > RingSize())
+        {
+            T* block = nullptr;
+            try { block = AllocateBlock(); }
+            catch (...)
+            {
+                FreeMap(map, map_size);
+                throw;
+            }
+
+            map[m_MapSize] = block;
+            RelocateElements(block, map[0], offset + m_Elements - RingSize());
+        }
+
+        if (m_Map) { FreeMap(m_Map, m_MapSize); }
+        m_Map = map;
+        m_MapSize = map_size;
+        m_Start = offset;
+    }
+
+    /**
+    * @brief: Move assigns count elements starting at index from to the elements starting at index to, in ascending order.
+    * @details: The destination must be before the source. The elements are moved in runs that do not cross a block.
+    *
+    * @param: size_t -> Index of the first destination.
+    * @param: size_t -> Index of the first source.
+    * @param: size_t -> Number of elements.
+    *
+    * @return: void.
+    */
+    void MoveForwards(size_t to, size_t from, size_t count)
+    {
+        while (count)
+        {
+            size_t run = BlockSize - (OffsetOf(to) > OffsetOf(from) ? OffsetOf(to) : OffsetOf(from));
+            if (run > count) { run = count; }
+
+            T* source = Slot(from);
+            std::move(source, source + run, Slot(to));
+            to += run;
+            from += run;
+            count -= run;
+        }
+    }
+
+    /**
+    * @brief: Move assigns the count elements that end before index from to the elements that end before index to, in descending order.
+    * @details: The destination must be after the source. The elements are moved in runs that do not cross a block.
+    *
+    * @param: size_t -> Index after the last destination.
+    * @param: size_t -> Index after the last source.
+    * @param: size_t -> Number of elements.
+    *
+    * @return: void.
+    */
+    void MoveBackwards(size_t to_end, size_t from_end, size_t count)
+    {
+        while (count)
+        {
+            size_t run = 1 + (OffsetOf(to_end - 1) < OffsetOf(from_end - 1) ? OffsetOf(to_end - 1) : OffsetOf(from_end - 1));
+            if (run > count) { run = count; }
+
+            T* source_end = Slot(from_end - 1) + 1;
+            std::move_backward(source_end - run, source_end, Slot(to_end - 1) + 1);
+            to_end -= run;
+            from_end -= run;
+            count -= run;
+        }
+    }
+
+    /**
+    * @brief: Moves count elements from first to to, the destination is raw storage and the source is left as raw storage.
+    * @details: The ranges must not overlap. Trivially relocatable elements are moved with a single memcpy.
+    *
+    * @param: T* -> Destination.
+    * @param: T* -> First element to move.
+    * @param: size_t -> Number of elements.
+    *
+    * @return: void.
+    */
+    static __forceinline void RelocateElements(T* to, T* first, size_t count) noexcept
+    {
+        if constexpr (IsTriviallyRelocatable<T>::value)
+        {
+            std::memcpy((void*)to, (const void*)first, sizeof(T) * count);
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                new (to + i) T(std::move(first[i]));
+                first[i].~T();
+            }
+        }
+    }
+
+    __forceinline void DestroyElements() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible<T>::value)
+        {
+            for (size_t i = 0; i < m_Elements; ++i)
+            {
+                Slot(i)->~T();
+            }
+        }
+    }
+
+    __forceinline void Nullify() noexcept
+    {
+        if constexpr (s_SkipTeardown)
+        {
+            //The allocator releases all the memory at once and the elements need no destructor
+            return Default();
+        }
+
+        DestroyElements();
+        ReleaseStorage();
+    }
+
+    /**
+    * @brief: Releases every block and the map, the elements must be already destroyed or moved.
+    *
+    * @return: void.
+    */
+    void ReleaseStorage() noexcept
+    {
+        for (size_t i = 0; i < m_MapSize; ++i)
+        {
+            if (m_Map[i]) { FreeBlock(m_Map[i]); }
+        }
+        if (m_Map) { FreeMap(m_Map, m_MapSize); }
+
+        Default();
+    }
+
+    /**
+    * @brief: Takes the map and the blocks of other, the container must have no storage.
+    *
+    * @param: Deque& -> Other deque.
+    * @return: void.
+    */
+    __forceinline void TakeStorage(Deque& other) noexcept
+    {
+        m_Map = other.m_Map;
+        m_MapSize = other.m_MapSize;
+        m_Start = other.m_Start;
+        m_Elements = other.m_Elements;
+        m_Blocks = other.m_Blocks;
+
+        other.Default();
+    }
+
+    _NODISCARD T* AllocateBlock()
+    {
+        T* memory_block = nullptr;
+        try { memory_block = AllocatorTraits::allocate(GetAllocatorReference(), BlockSize); }
+        catch (...) { DequeBadAllocationError(); }
+
+        ++m_Blocks;
+        return memory_block;
+    }
+
+    __forceinline void FreeBlock(T* memory_block) noexcept
+    {
+        AllocatorTraits::deallocate(GetAllocatorReference(), memory_block, BlockSize);
+        --m_Blocks;
+    }
+
+    _NODISCARD T** AllocateMap(size_t map_size)
+    {
+        MapAllocator allocator(GetAllocatorReference());
+        T** map = nullptr;
+        try { map = MapTraits::allocate(allocator, map_size); }
+        catch (...) { DequeBadAllocationError(); }
+
+        return map;
+    }
+
+    __forceinline void FreeMap(T** map, size_t map_size) noexcept
+    {
+        MapAllocator allocator(GetAllocatorReference());
+        MapTraits::deallocate(allocator, map, map_size);
+    }
+
+    __forceinline void Default() noexcept
+    {
+        m_Map = nullptr;
+        m_MapSize = 0;
+        m_Start = 0;
+        m_Elements = 0;
+        m_Blocks = 0;
+    }
+
+    [[noreturn]] __forceinline static void DequeOutOfRangeError() {
+        throw std::exception("Deque index out of range");
+    }
+
+    [[noreturn]] __forceinline static void DequeMaxLenghtError() {
+        throw std::exception("Deque too long");
+    }
+
+    [[noreturn]] __forceinline static void DequeBadAllocationError() {
+        throw std::exception("Bad allocation");
+    }
+
+private:
+    T** m_Map = nullptr;
+    size_t m_MapSize = 0;
+    size_t m_Start = 0;
+    size_t m_Elements = 0;
+    size_t m_Blocks = 0;
+
+    static _CONSTEXPR17 size_t s_DefaultMapSize = 8;
+    static _CONSTEXPR17 size_t s_MaxDequeSize = 10000000;
+    static _CONSTEXPR17 bool s_SkipTeardown = IsReleaseAllAllocator<Allocator>::value && std::is_trivially_destructible<T>::value;
+};
+
+/*
+* Deque that takes its memory from a std::pmr::memory_resource selected at runtime.
+*/
+template<typename T, size_t BlockSize = DequeBlockSize<T>::value>
+using PmrDeque = Deque<T, BlockSize, std::pmr::polymorphic_allocator<T>>;
@@ -0,0 +1,320 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header class.
+* EpochReclamation frees the memory of lock-free containers once no thread can be reading it.
+* Threads read shared nodes inside a critical section (Guard) that announces the global epoch they entered in.
+* Unlinked nodes are retired with the epoch of their removal, and freed once the global epoch is two epochs ahead,
+* the global epoch only advances when every thread inside a critical section has announced the current one.
+* Each thread keeps its retired nodes in its own record, so retiring needs no synchronization.
+* The records of finished threads are reused by the next threads, the nodes they kept are freed by their new owner.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <atomic>  //For std::atomic
+#include <cstdint>  //For uint64_t
+#include "Vector.hpp"
+
+class EpochReclamation
+{
+    /*
+    * Object removed from a shared structure, freed through Deleter once it can not be reached.
+    */
+    struct Retired
+    {
+        void* Object;
+        void (*Deleter)(void*);
+        uint64_t Epoch;
+    };
+
+    /*
+    * State of one thread. Announced is zero outside critical sections, otherwise the announced epoch shifted and tagged with 1.
+    * Records are never released before the end of the program, so scanning them needs no reclamation.
+    */
+    struct Record
+    {
+        std::atomic<uint64_t> Announced{ 0 };
+        std::atomic<bool> InUse{ true };
+        Record* Next = nullptr;
+        size_t Nesting = 0;
+        size_t RetiredSinceCollect = 0;
+        Vector<Retired> RetiredObjects;
+    };
+
+    /*
+    * Collects the retired objects and gives the record back when the thread ends, registered the first time the thread uses it.
+    */
+    struct ThreadExit
+    {
+        ~ThreadExit() noexcept
+        {
+            Record* record = s_Record;
+            if (!record) { return; }
+
+            record->Nesting = 0;
+            record->Announced.store(0, std::memory_order_release);
+            Collect(*record);
+            record->RetiredSinceCollect = 0;
+            record->InUse.store(false, std::memory_order_release);
+            s_Record = nullptr;
+        }
+
+        ThreadExit() noexcept :
+            Registered(false) {}
+
+        bool Registered;
+    };
+
+    /*
+    * Global epoch and records of every thread, the objects still retired are freed when the program ends.
+    */
+    struct Domain
+    {
+        ~Domain() noexcept
+        {
+            Record* record = Records.load(std::memory_order_acquire);
+            while (record)
+            {
+                Record* next = record->Next;
+                for (size_t i = 0; i < record->RetiredObjects.Size(); ++i)
+                {
+                    record->RetiredObjects[i].Deleter(record->RetiredObjects[i].Object);
+                }
+                delete record;
+                record = next;
+            }
+        }
+
+        Domain() noexcept :
+            Epoch(1),
+            Records(nullptr) {}
+
+        std::atomic<uint64_t> Epoch;
+        std::atomic<Record*> Records;
+    };
+
+public:
+    /*
+    * Critical section of the calling thread, the nodes read while it lives are not freed. Guards can be nested.
+    */
+    class Guard
+    {
+    public:
+        __forceinline Guard() noexcept { Enter(); }
+
+        __forceinline ~Guard() noexcept { Exit(); }
+
+        Guard(const Guard& other) = delete;
+
+        Guard& operator=(const Guard& other) = delete;
+    };
+
+    //Modifiers
+public:
+    /**
+    * @brief: Starts a critical section of the calling thread.
+    * @details: Announces the current global epoch, the announcement is visible before any later read of shared nodes.
+    *
+    * @return: void.
+    */
+    static void Enter() noexcept
+    {
+        Record* record = s_Record ? s_Record : AcquireRecord();
+        if (record->Nesting++ != 0) { return; }
+
+        uint64_t epoch = s_Domain.Epoch.load(std::memory_order_relaxed);
+        while (true)
+        {
+            record->Announced.store(Announce(epoch), std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            //The epoch could have advanced before the announcement was visible
+            const uint64_t current = s_Domain.Epoch.load(std::memory_order_relaxed);
+            if (current == epoch) { return; }
+            epoch = current;
+        }
+    }
+
+    /**
+    * @brief: Ends a critical section of the calling thread.
+    *
+    * @return: void.
+    */
+    static __forceinline void Exit() noexcept
+    {
+        Record* record = s_Record;
+        if (--record->Nesting != 0) { return; }
+
+        record->Announced.store(0, std::memory_order_release);
+    }
+
+    /**
+    * @brief: Retires an object that has been unlinked from a shared structure.
+    * @details: The object is freed by the deleter once every thread that could be reading it has left its critical section.
+    * Every s_CollectThreshold retired objects the thread tries to advance the epoch and frees its safe objects.
+    * Can throw exceptions (Typically std::bad_alloc)
+    *
+    * @param: void* -> Unlinked object.
+    * @param: void (*)(void*) -> Function that frees the object.
+    * @return: void.
+    */
+    static void Retire(void* object, void (*deleter)(void*))
+    {
+        Record* record = s_Record ? s_Record : AcquireRecord();
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        record->RetiredObjects.PushBack(Retired{ object, deleter, s_Domain.Epoch.load(std::memory_order_relaxed) });
+
+        if (++record->RetiredSinceCollect >= s_CollectThreshold)
+        {
+            record->RetiredSinceCollect = 0;
+            Collect(*record);
+        }
+    }
+
+    /**
+    * @brief: Tries to advance the global epoch and frees the objects retired by the calling thread that can not be reached.
+    *
+    * @return: void.
+    */
+    static void Collect() noexcept
+    {
+        Record* record = s_Record ? s_Record : AcquireRecord();
+        Collect(*record);
+    }
+
+    //Capacity
+public:
+    /**
+    * @brief: Number of objects retired by the calling thread that are still waiting to be freed.
+    *
+    * @return: size_t -> Objects.
+    */
+    _NODISCARD static __forceinline size_t PendingObjects() noexcept { return s_Record ? s_Record->RetiredObjects.Size() : 0; }
+
+    /**
+    * @brief: Current global epoch.
+    *
+    * @return: uint64_t -> Epoch.
+    */
+    _NODISCARD static __forceinline uint64_t Epoch() noexcept { return s_Domain.Epoch.load(std::memory_order_acquire); }
+
+    /**
+    * @brief: Checks if the calling thread is inside a critical section.
+    *
+    * @return: bool -> True if the thread is inside a critical section.
+    */
+    _NODISCARD static __forceinline bool IsInCriticalSection() noexcept { return s_Record && s_Record->Nesting != 0; }
+
+private:
+    EpochReclamation() = delete;
+
+    _NODISCARD static __forceinline uint64_t Announce(uint64_t epoch) noexcept { return (epoch << 1) | 1; }
+
+    /**
+    * @brief: Takes the record of a finished thread, or adds a new one to the domain.
+    *
+    * @return: Record* -> Record of the calling thread.
+    */
+    static Record* AcquireRecord()
+    {
+        s_Exit.Registered = true;
+
+        for (Record* record = s_Domain.Records.load(std::memory_order_acquire); record; record = record->Next)
+        {
+            bool in_use = false;
+            if (!record->InUse.load(std::memory_order_relaxed) &&
+                record->InUse.compare_exchange_strong(in_use, true, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                s_Record = record;
+                return record;
+            }
+        }
+
+        Record* record = new Record();
+        Record* head = s_Domain.Records.load(std::memory_order_relaxed);
+        do
+        {
+            record->Next = head;
+        } while (!s_Domain.Records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+
+        s_Record = record;
+        return record;
+    }
+
+    /**
+    * @brief: Advances the global epoch if every thread inside a critical section has announced the current one.
+    *
+    * @return: void.
+    */
+    static void TryAdvance() noexcept
+    {
+        uint64_t epoch = s_Domain.Epoch.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        for (Record* record = s_Domain.Records.load(std::memory_order_acquire); record; record = record->Next)
+        {
+            const uint64_t announced = record->Announced.load(std::memory_order_acquire);
+            if (announced != 0 && announced != Announce(epoch)) { return; }
+        }
+
+        s_Domain.Epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel, std::memory_order_relaxed);
+    }
+
+    /**
+    * @brief: Frees the objects of the record retired at least two epochs ago.
+    * @details: The objects are kept in retire order, so the ones to free are always at the begin of the record.
+    *
+    * @param: Record& -> Record of the calling thread.
+    * @return: void.
+    */
+    static void Collect(Record& record) noexcept
+    {
+        if (record.RetiredObjects.IsEmpty()) { return; }
+
+        TryAdvance();
+        const uint64_t epoch = s_Domain.Epoch.load(std::memory_order_acquire);
+
+        size_t freed = 0;
+        while (freed < record.RetiredObjects.Size() && record.RetiredObjects[freed].Epoch + 2 <= epoch)
+        {
+            record.RetiredObjects[freed].Deleter(record.RetiredObjects[freed].Object);
+            ++freed;
+        }
+        if (freed != 0) { record.RetiredObjects.EraseRange(record.RetiredObjects.begin(), record.RetiredObjects.begin() + freed); }
+    }
+
+private:
+    static inline Domain s_Domain;
+    static inline thread_local Record* s_Record = nullptr;
+    static inline thread_local ThreadExit s_Exit;
+
+    static _CONSTEXPR17 size_t s_CollectThreshold = 64;
+};
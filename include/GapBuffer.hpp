@@ -0,0 +1,876 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header class.
+* GapBuffer class is a sequence container for edits around a cursor.
+* The elements are stored in one memory block with a gap at the cursor, the elements before the cursor are at the begin
+* of the block and the elements after the cursor at its end.
+* Inserting or erasing at the cursor only changes the bounds of the gap, moving the cursor moves the elements between the old
+* and the new position to the other side of the gap, so a run of k edits around the cursor costs O(k + distance moved).
+* The two sides of the gap are contiguous and can be read or exported as two spans.
+* The way the storage is expanded is selected by the GrowthPolicy template parameter (see GrowthPolicy.hpp).
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <initializer_list>
+#include <cstring>  //For std::memcpy and std::memmove
+#include "GrowthPolicy.hpp"
+#include "TypeTraits.hpp"
+#include "Allocator.hpp"
+#include "Vector.hpp"
+
+template<typename T, typename GrowthPolicy = DoublingGrowthPolicy, typename Allocator = std::allocator<T>>
+class GapBuffer : private AllocatorStorage<Allocator>
+{
+    using AllocatorBase = AllocatorStorage<Allocator>;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    using Propagation = AllocatorPropagation<Allocator>;
+    using AllocatorBase::GetAllocatorReference;
+
+public:
+    /*
+    * Contiguous range of elements of the buffer, one side of the gap.
+    */
+    template<typename ValueType>
+    struct Span
+    {
+        _NODISCARD __forceinline ValueType* begin() const noexcept { return Data; }
+
+        _NODISCARD __forceinline ValueType* end() const noexcept { return Data + Size; }
+
+        _NODISCARD __forceinline ValueType& operator[](size_t index) const noexcept { return Data[index]; }
+
+        ValueType* Data = nullptr;
+        size_t Size = 0;
+    };
+
+public:
+    using value_type = T;
+    using span = Span<T>;
+    using const_span = Span<const T>;
+    using allocator_type = Allocator;
+
+    //Modifiers
+public:
+    /**
+    * @brief: Moves the cursor to the given position.
+    * @details: The elements between the cursor and the position are moved to the other side of the gap.
+    * Trivially relocatable elements are moved with a single memmove.
+    * std::exception execption will be thrown if the position is out of range.
+    *
+    * @param: size_t -> Position, from 0 to Size().
+    * @return: void.
+    */
+    void MoveCursor(size_t position)
+    {
+        if (position > Size()) { GapBufferOutOfRangeError(); }
+
+        if (m_GapStart == m_GapEnd)
+        {
+            //Without gap the elements are already in place
+            m_GapStart = position;
+            m_GapEnd = position;
+        }
+        else if (position < m_GapStart)
+        {
+            const size_t count = m_GapStart - position;
+            RelocateBackwards(m_Data + m_GapEnd - count, m_Data + position, count);
+            m_GapStart = position;
+            m_GapEnd -= count;
+        }
+        else if (position > m_GapStart)
+        {
+            const size_t count = position - m_GapStart;
+            RelocateForwards(m_Data + m_GapStart, m_Data + m_GapEnd, count);
+            m_GapStart += count;
+            m_GapEnd += count;
+        }
+    }
+
+    /**
+    * @brief: Inserts a new element at the cursor, the cursor moves after it.
+    * @details: Amortized constant time.
+    *
+    * @param: const T& -> Element.
+    * @return: void.
+    */
+    __forceinline void Insert(const T& element) { Emplace(element); }
+
+    /**
+    * @brief: Inserts a new element at the cursor, the cursor moves after it.
+    * @details: Amortized constant time.
+    *
+    * @param: T&& -> Element.
+    * @return: void.
+    */
+    __forceinline void Insert(T&& element) { Emplace(std::move(element)); }
+
+    /**
+    * @brief: Inserts a new element directly before index, the cursor moves after it.
+    * @details: The cursor is moved to the index first, an element of the container is copied before it is moved.
+    * std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @param: const T& -> Element.
+    * @return: void.
+    */
+    void Insert(size_t index, const T& element)
+    {
+        if (IsInside(&element))
+        {
+            T copy(element);
+            return Insert(index, std::move(copy));
+        }
+
+        MoveCursor(index);
+        Emplace(element);
+    }
+
+    /**
+    * @brief: Inserts a new element directly before index, the cursor moves after it.
+    * @details: The cursor is moved to the index first, an element of the container is moved out before it is moved.
+    * std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @param: T&& -> Element.
+    * @return: void.
+    */
+    void Insert(size_t index, T&& element)
+    {
+        if (IsInside(&element))
+        {
+            T moved(std::move(element));
+            return Insert(index, std::move(moved));
+        }
+
+        MoveCursor(index);
+        Emplace(std::move(element));
+    }
+
+    /**
+    * @brief: Inserts the elements of the range [first, last) at the cursor, the cursor moves after them.
+    * @details: The gap grows at most once. The range must not belong to the container.
+    * A single pass range is inserted element by element, the gap grows as the elements arrive.
+    *
+    * @param: InputIterator -> First element of the range.
+    * @param: InputIterator -> End of the range.
+    * @return: void.
+    */
+    template<typename InputIterator>
+    void InsertRange(InputIterator first, InputIterator last)
+    {
+        if constexpr (IsSinglePassIterator<InputIterator>::value)
+        {
+            for (; first != last; ++first)
+            {
+                Emplace(*first);
+            }
+        }
+        else
+        {
+            size_t count = 0;
+            for (InputIterator it = first; it != last; ++it)
+            {
+                ++count;
+            }
+            if (count > GapSize()) { Grow(Size() + count); }
+
+            for (; first != last; ++first)
+            {
+                new (m_Data + m_GapStart) T(*first);
+                ++m_GapStart;
+            }
+        }
+    }
+
+    /**
+    * @brief: Constructs a new element at the cursor, the cursor moves after it.
+    * @details: Amortized constant time.
+    *
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& Emplace(Args&&... args)
+    {
+        if (m_GapStart == m_GapEnd)
+        {
+            //The arguments can refer to an element of the buffer, the element is built before the memory is moved
+            T element(std::forward<Args>(args)...);
+            Grow(Size() + 1);
+            new (m_Data + m_GapStart) T(std::move(element));
+        }
+        else { new (m_Data + m_GapStart) T(std::forward<Args>(args)...); }
+
+        return m_Data[m_GapStart++];
+    }
+
+    /**
+    * @brief: Deletes elements before the cursor, like a backspace.
+    * @details: std::exception execption will be thrown if there are less elements before the cursor.
+    *
+    * @param: size_t -> Number of elements.
+    * @return: void.
+    */
+    void EraseBefore(size_t count = 1)
+    {
+        if (count > m_GapStart) { GapBufferOutOfRangeError(); }
+
+        DestroyRange(m_Data + m_GapStart - count, m_Data + m_GapStart);
+        m_GapStart -= count;
+    }
+
+    /**
+    * @brief: Deletes elements after the cursor, like a delete key.
+    * @details: std::exception execption will be thrown if there are less elements after the cursor.
+    *
+    * @param: size_t -> Number of elements.
+    * @return: void.
+    */
+    void EraseAfter(size_t count = 1)
+    {
+        if (count > m_Capacity - m_GapEnd) { GapBufferOutOfRangeError(); }
+
+        DestroyRange(m_Data + m_GapEnd, m_Data + m_GapEnd + count);
+        m_GapEnd += count;
+    }
+
+    /**
+    * @brief: Deletes the element at the given index, the cursor stays at the index.
+    * @details: The cursor is moved to the index first.
+    * std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: void.
+    */
+    void Erase(size_t index)
+    {
+        if (index >= Size()) { GapBufferOutOfRangeError(); }
+
+        MoveCursor(index);
+        EraseAfter(1);
+    }
+
+    /**
+    * @brief: Clears the content of the container.
+    * @details: The memory block is kept and the cursor goes back to the begin.
+    *
+    * @return: void.
+    */
+    void Clear() noexcept
+    {
+        DestroyElements();
+        m_GapStart = 0;
+        m_GapEnd = m_Capacity;
+    }
+
+    /**
+    * @brief: Swaps the content of two GapBuffers.
+    * @details: The allocators are only swapped if the allocator propagates on swap, otherwise both allocators must be equal.
+    *
+    * @param: GapBuffer& -> Other buffer.
+    * @return: void.
+    */
+    void Swap(GapBuffer& other) noexcept
+    {
+        if (&other == this) { return; }
+
+        Propagation::OnSwap(GetAllocatorReference(), other.GetAllocatorReference());
+
+        T* data = m_Data;
+        size_t capacity = m_Capacity;
+        size_t gap_start = m_GapStart;
+        size_t gap_end = m_GapEnd;
+
+        m_Data = other.m_Data;
+        m_Capacity = other.m_Capacity;
+        m_GapStart = other.m_GapStart;
+        m_GapEnd = other.m_GapEnd;
+
+        other.m_Data = data;
+        other.m_Capacity = capacity;
+        other.m_GapStart = gap_start;
+        other.m_GapEnd = gap_end;
+    }
+
+    //Capacity
+public:
+    /**
+    * @brief: Makes room for at least capacity elements.
+    * @details: The elements before the cursor stay at the begin of the new block and the elements after it go to its end.
+    * std::exception execption will be thrown if the capacity is greater than the maximum size.
+    *
+    * @param: size_t -> Capacity.
+    * @return: void.
+    */
+    void Reserve(size_t capacity)
+    {
+        if (capacity > s_MaxGapBufferSize) { GapBufferMaxLenghtError(); }
+        if (capacity <= m_Capacity) { return; }
+
+        Reallocate(capacity);
+    }
+
+    /**
+    * @brief: Requests the removal of unused capacity.
+    * @details: The gap is removed, the next insertion grows the buffer again. An empty container releases its memory.
+    *
+    * @return: void.
+    */
+    void Shrink()
+    {
+        if (!m_Data || m_GapStart == m_GapEnd) { return; }
+        if (IsEmpty()) { return ReleaseStorage(); }
+
+        Reallocate(Size());
+    }
+
+    /**
+    * @brief: Checks if the container is empty.
+    *
+    * @return: bool -> True if the container has no elements.
+    */
+    _NODISCARD __forceinline bool IsEmpty() const noexcept { return Size() == 0; }
+
+    /**
+    * @brief: Number of elements in the container.
+    *
+    * @return: size_t -> Elements.
+    */
+    _NODISCARD __forceinline size_t Size() const noexcept { return m_Capacity - (m_GapEnd - m_GapStart); }
+
+    /**
+    * @brief: Number of elements that fit in the memory block.
+    *
+    * @return: size_t -> Capacity.
+    */
+    _NODISCARD __forceinline size_t Capacity() const noexcept { return m_Capacity; }
+
+    /**
+    * @brief: Number of elements that can be inserted at the cursor without growing.
+    *
+    * @return: size_t -> Gap size.
+    */
+    _NODISCARD __forceinline size_t GapSize() const noexcept { return m_GapEnd - m_GapStart; }
+
+    /**
+    * @brief: Position of the cursor, the number of elements before it.
+    *
+    * @return: size_t -> Cursor.
+    */
+    _NODISCARD __forceinline size_t Cursor() const noexcept { return m_GapStart; }
+
+    //Element Access
+public:
+    /**
+    * @brief: Returns a reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Front() noexcept { return *Slot(0); }
+
+    /**
+    * @brief: Returns a const reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Front() const noexcept { return *Slot(0); }
+
+    /**
+    * @brief: Returns a reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Back() noexcept { return *Slot(Size() - 1); }
+
+    /**
+    * @brief: Returns a const reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Back() const noexcept { return *Slot(Size() - 1); }
+
+    /**
+    * @brief: Returns a reference to the element at the given index.
+    * @details: The indexes after the cursor skip the gap.
+    * Calling [] in a empty container is undefined.
+    *
+    * @param: size_t -> Index.
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& operator[](size_t index) noexcept { return *Slot(index); }
+
+    /**
+    * @brief: Returns a const reference to the element at the given index.
+    * @details: Calling [] in a empty container is undefined.
+    *
+    * @param: size_t -> Index.
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& operator[](size_t index) const noexcept { return *Slot(index); }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: T& -> Element.
+    */
+    _NODISCARD T& At(size_t index)
+    {
+        if (index >= Size()) { GapBufferOutOfRangeError(); }
+        return *Slot(index);
+    }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: const T& -> Element.
+    */
+    _NODISCARD const T& At(size_t index) const
+    {
+        if (index >= Size()) { GapBufferOutOfRangeError(); }
+        return *Slot(index);
+    }
+
+    /**
+    * @brief: Returns the contiguous elements before the cursor.
+    *
+    * @return: span -> Elements before the cursor.
+    */
+    _NODISCARD __forceinline span BeforeCursor() noexcept { return span{ m_Data, m_GapStart }; }
+
+    /**
+    * @brief: Returns the contiguous elements before the cursor.
+    *
+    * @return: const_span -> Elements before the cursor.
+    */
+    _NODISCARD __forceinline const_span BeforeCursor() const noexcept { return const_span{ m_Data, m_GapStart }; }
+
+    /**
+    * @brief: Returns the contiguous elements after the cursor.
+    *
+    * @return: span -> Elements after the cursor.
+    */
+    _NODISCARD __forceinline span AfterCursor() noexcept { return span{ m_Data + m_GapEnd, m_Capacity - m_GapEnd }; }
+
+    /**
+    * @brief: Returns the contiguous elements after the cursor.
+    *
+    * @return: const_span -> Elements after the cursor.
+    */
+    _NODISCARD __forceinline const_span AfterCursor() const noexcept { return const_span{ m_Data + m_GapEnd, m_Capacity - m_GapEnd }; }
+
+    /**
+    * @brief: Copies the elements at the end of the given Vector.
+    * @details: The Vector grows once and the two sides of the gap are copied as two contiguous ranges.
+    *
+    * @param: Vector& -> Destination.
+    * @return: void.
+    */
+    template<typename VectorGrowthPolicy, typename VectorAllocator>
+    void AppendTo(Vector<T, VectorGrowthPolicy, VectorAllocator>& vector) const
+    {
+        const const_span before = BeforeCursor();
+        const const_span after = AfterCursor();
+
+        vector.Reserve(vector.Size() + before.Size + after.Size);
+        vector.InsertRange(vector.Size(), before.begin(), before.end());
+        vector.InsertRange(vector.Size(), after.begin(), after.end());
+    }
+
+    /**
+    * @brief: Returns a Vector with a copy of the elements.
+    *
+    * @return: Vector<T> -> Elements.
+    */
+    _NODISCARD Vector<T> ToVector() const
+    {
+        Vector<T> vector;
+        AppendTo(vector);
+        return vector;
+    }
+
+    //Member functions
+public:
+    explicit GapBuffer() noexcept = default;
+
+    explicit GapBuffer(const Allocator& allocator) noexcept :
+        AllocatorBase(allocator) {}
+
+    explicit GapBuffer(size_t capacity)
+    {
+        Reserve(capacity);
+    }
+
+    GapBuffer(size_t capacity, const Allocator& allocator) :
+        AllocatorBase(allocator)
+    {
+        Reserve(capacity);
+    }
+
+    GapBuffer(const GapBuffer& other) :
+        AllocatorBase(Propagation::OnCopyConstruction(other.GetAllocatorReference()))
+    {
+        CopyElements(other);
+    }
+
+    GapBuffer(GapBuffer&& other) noexcept :
+        AllocatorBase(std::move(other.GetAllocatorReference()))
+    {
+        TakeStorage(other);
+    }
+
+    GapBuffer(std::initializer_list<T>&& list)
+    {
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            Emplace(std::move(*it));
+        }
+    }
+
+    GapBuffer(std::initializer_list<T>&& list, const Allocator& allocator) :
+        AllocatorBase(allocator)
+    {
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            Emplace(std::move(*it));
+        }
+    }
+
+    ~GapBuffer() noexcept
+    {
+        Nullify();
+    }
+
+    GapBuffer& operator=(const GapBuffer& other)
+    {
+        if (&other == this) { return *this; }
+
+        //The memory block is released by the current allocator before it is replaced
+        Nullify();
+        Propagation::OnCopyAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        CopyElements(other);
+
+        return *this;
+    }
+
+    GapBuffer& operator=(GapBuffer&& other) noexcept(Propagation::s_AlwaysTakesMemory)
+    {
+        if (&other == this) { return *this; }
+
+        Nullify();
+        if (!Propagation::CanTakeMemory(GetAllocatorReference(), other.GetAllocatorReference()))
+        {
+            //The memory of other can not be released by this allocator, the elements are moved one by one
+            Reserve(other.Size());
+            for (T& element : other.BeforeCursor())
+            {
+                Emplace(std::move(element));
+            }
+            const size_t cursor = m_GapStart;
+            for (T& element : other.AfterCursor())
+            {
+                Emplace(std::move(element));
+            }
+            MoveCursor(cursor);
+            other.Clear();
+
+            return *this;
+        }
+
+        Propagation::OnMoveAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        TakeStorage(other);
+
+        return *this;
+    }
+
+    GapBuffer& operator=(std::initializer_list<T>&& list)
+    {
+        Clear();
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            Emplace(std::move(*it));
+        }
+
+        return *this;
+    }
+
+    /**
+    * @brief: Returns a copy of the allocator used by the container.
+    *
+    * @return: Allocator -> Allocator.
+    */
+    _NODISCARD __forceinline Allocator GetAllocator() const noexcept { return GetAllocatorReference(); }
+
+    //Non-member functions
+public:
+    /**
+    * @brief: Compares the content of two GapBuffers, the position of the cursors is not compared.
+    *
+    * @return: bool -> True if the content of both containers are equal.
+    */
+    _NODISCARD bool operator==(const GapBuffer& other) const noexcept
+    {
+        const size_t elements = Size();
+        if (elements != other.Size()) { return false; }
+
+        for (size_t i = 0; i < elements; ++i)
+        {
+            if (*Slot(i) != *other.Slot(i)) { return false; }
+        }
+
+        return true;
+    }
+
+    /**
+    * @brief: Compares the content of two GapBuffers, the position of the cursors is not compared.
+    *
+    * @return: bool -> True if the content of both containers are not equal.
+    */
+    _NODISCARD __forceinline bool operator!=(const GapBuffer& other) const noexcept { return !(*this == other); }
+
+private:
+    _NODISCARD __forceinline T* Slot(size_t index) const noexcept
+    {
+        return m_Data + (index < m_GapStart ? index : index + (m_GapEnd - m_GapStart));
+    }
+
+    _NODISCARD __forceinline bool IsInside(const T* ptr) const noexcept
+    {
+        return m_Data && ptr >= m_Data && ptr < m_Data + m_Capacity;
+    }
+
+    /**
+    * @brief: Grows the memory block to hold at least required elements.
+    * @details: The new capacity is given by the growth policy and clamped to the maximum size of the container.
+    *
+    * @param: size_t -> Required number of elements.
+    * @return: void.
+    */
+    void Grow(size_t required)
+    {
+        size_t capacity = m_Data ? GrowthPolicy::NextCapacity(m_Capacity, sizeof(T)) : s_DefaultCapacity;
+        if (capacity < required) { capacity = required; }
+        if (capacity > s_MaxGapBufferSize && required <= s_MaxGapBufferSize) { capacity = s_MaxGapBufferSize; }
+
+        Reserve(capacity);
+    }
+
+    /**
+    * @brief: Moves the elements to a new memory block of the given capacity, the gap takes the new space.
+    *
+    * @param: size_t -> Capacity, not less than the number of elements.
+    * @return: void.
+    */
+    void Reallocate(size_t capacity)
+    {
+        T* memory_block = nullptr;
+        try { memory_block = AllocatorTraits::allocate(GetAllocatorReference(), capacity); }
+        catch (...) { GapBufferBadAllocationError(); }
+
+        const size_t after = m_Capacity - m_GapEnd;
+        if (m_Data)
+        {
+            RelocateForwards(memory_block, m_Data, m_GapStart);
+            RelocateForwards(memory_block + capacity - after, m_Data + m_GapEnd, after);
+            AllocatorTraits::deallocate(GetAllocatorReference(), m_Data, m_Capacity);
+        }
+
+        m_Data = memory_block;
+        m_Capacity = capacity;
+        m_GapEnd = capacity - after;
+    }
+
+    /**
+    * @brief: Moves count elements from first to to, where to is before first. The ranges can overlap.
+    * @details: The destination is raw storage and the source is left as raw storage.
+    * Trivially relocatable elements are moved with a single memmove.
+    *
+    * @param: T* -> Destination.
+    * @param: T* -> First element to move.
+    * @param: size_t -> Number of elements.
+    *
+    * @return: void.
+    */
+    static __forceinline void RelocateForwards(T* to, T* first, size_t count) noexcept
+    {
+        if constexpr (IsTriviallyRelocatable<T>::value)
+        {
+            if (count) { std::memmove((void*)to, (const void*)first, sizeof(T) * count); }
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                new (to + i) T(std::move(first[i]));
+                first[i].~T();
+            }
+        }
+    }
+
+    /**
+    * @brief: Moves count elements from first to to, where to is after first. The ranges can overlap.
+    * @details: The elements are moved from the last one, so each destination slot is free when it is reached.
+    *
+    * @param: T* -> Destination.
+    * @param: T* -> First element to move.
+    * @param: size_t -> Number of elements.
+    *
+    * @return: void.
+    */
+    static __forceinline void RelocateBackwards(T* to, T* first, size_t count) noexcept
+    {
+        if constexpr (IsTriviallyRelocatable<T>::value)
+        {
+            if (count) { std::memmove((void*)to, (const void*)first, sizeof(T) * count); }
+        }
+        else
+        {
+            for (size_t i = count; i > 0; --i)
+            {
+                new (to + i - 1) T(std::move(first[i - 1]));
+                first[i - 1].~T();
+            }
+        }
+    }
+
+    static __forceinline void DestroyRange(T* first, T* last) noexcept
+    {
+        if constexpr (!std::is_trivially_destructible<T>::value)
+        {
+            for (; first != last; ++first)
+            {
+                first->~T();
+            }
+        }
+    }
+
+    __forceinline void DestroyElements() noexcept
+    {
+        DestroyRange(m_Data, m_Data + m_GapStart);
+        DestroyRange(m_Data + m_GapEnd, m_Data + m_Capacity);
+    }
+
+    /**
+    * @brief: Copies the elements of other keeping the position of its cursor, the container must have no elements.
+    *
+    * @param: const GapBuffer& -> Other buffer.
+    * @return: void.
+    */
+    void CopyElements(const GapBuffer& other)
+    {
+        Reserve(other.Size());
+        for (const T& element : other.BeforeCursor())
+        {
+            Emplace(element);
+        }
+        for (const T& element : other.AfterCursor())
+        {
+            Emplace(element);
+        }
+        MoveCursor(other.m_GapStart);
+    }
+
+    __forceinline void Nullify() noexcept
+    {
+        if constexpr (s_SkipTeardown)
+        {
+            //The allocator releases all the memory at once and the elements need no destructor
+            return Default();
+        }
+
+        DestroyElements();
+        ReleaseStorage();
+    }
+
+    __forceinline void ReleaseStorage() noexcept
+    {
+        if (m_Data) { AllocatorTraits::deallocate(GetAllocatorReference(), m_Data, m_Capacity); }
+
+        Default();
+    }
+
+    __forceinline void TakeStorage(GapBuffer& other) noexcept
+    {
+        m_Data = other.m_Data;
+        m_Capacity = other.m_Capacity;
+        m_GapStart = other.m_GapStart;
+        m_GapEnd = other.m_GapEnd;
+
+        other.Default();
+    }
+
+    __forceinline void Default() noexcept
+    {
+        m_Data = nullptr;
+        m_Capacity = 0;
+        m_GapStart = 0;
+        m_GapEnd = 0;
+    }
+
+    [[noreturn]] __forceinline static void GapBufferOutOfRangeError() {
+        throw std::exception("GapBuffer index out of range");
+    }
+
+    [[noreturn]] __forceinline static void GapBufferMaxLenghtError() {
+        throw std::exception("GapBuffer too long");
+    }
+
+    [[noreturn]] __forceinline static void GapBufferBadAllocationError() {
+        throw std::exception("Bad allocation");
+    }
+
+private:
+    T* m_Data = nullptr;
+    size_t m_Capacity = 0;
+    size_t m_GapStart = 0;
+    size_t m_GapEnd = 0;
+
+    static _CONSTEXPR17 size_t s_DefaultCapacity = 8;
+    static _CONSTEXPR17 size_t s_MaxGapBufferSize = 10000000;
+    static _CONSTEXPR17 bool s_SkipTeardown = IsReleaseAllAllocator<Allocator>::value && std::is_trivially_destructible<T>::value;
+};
+
+/*
+* GapBuffer that takes its memory from a std::pmr::memory_resource selected at runtime.
+*/
+template<typename T, typename GrowthPolicy = DoublingGrowthPolicy>
+using PmrGapBuffer = GapBuffer<T, GrowthPolicy, std::pmr::polymorphic_allocator<T>>;
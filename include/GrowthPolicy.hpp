@@ -0,0 +1,139 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header file.
+* Growth policies decide the capacity of the next reallocation when a container runs out of space.
+* A policy is a type with a static function NextCapacity(capacity, element_size) returning a capacity greater than the given one.
+* They are used as compile-time parameters of the containers, so the cost of the selection is zero at runtime.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <cstddef> //For size_t
+
+/*
+* Doubles the capacity on every reallocation.
+* Fewest reallocations, but up to half of the memory block can be unused.
+*/
+struct DoublingGrowthPolicy
+{
+    /**
+    * @brief: Computes the capacity of the next reallocation.
+    *
+    * @param: size_t -> Current capacity.
+    * @param: size_t -> Size in bytes of one element.
+    *
+    * @return: size_t -> New capacity.
+    */
+    _NODISCARD static _CONSTEXPR17 size_t NextCapacity(size_t capacity, size_t) noexcept { return capacity << 1; }
+};
+
+/*
+* Grows the capacity by a factor of 1.5.
+* Wastes at most a third of the memory block, at the cost of more reallocations than doubling.
+*/
+struct OneAndHalfGrowthPolicy
+{
+    /**
+    * @brief: Computes the capacity of the next reallocation.
+    *
+    * @param: size_t -> Current capacity.
+    * @param: size_t -> Size in bytes of one element.
+    *
+    * @return: size_t -> New capacity.
+    */
+    _NODISCARD static _CONSTEXPR17 size_t NextCapacity(size_t capacity, size_t) noexcept { return capacity + ((capacity + 1) >> 1); }
+};
+
+/*
+* Grows the capacity by a factor of 1.5 and rounds the block up to the next allocator size class.
+* Small blocks use four classes per power of two, blocks bigger than a page are rounded to whole pages.
+* The slack the allocator would add anyway becomes usable capacity.
+*/
+struct SizeClassGrowthPolicy
+{
+    /**
+    * @brief: Computes the capacity of the next reallocation.
+    *
+    * @param: size_t -> Current capacity.
+    * @param: size_t -> Size in bytes of one element.
+    *
+    * @return: size_t -> New capacity.
+    */
+    _NODISCARD static _CONSTEXPR17 size_t NextCapacity(size_t capacity, size_t element_size) noexcept
+    {
+        const size_t minimum = OneAndHalfGrowthPolicy::NextCapacity(capacity, element_size);
+        const size_t capacity_per_class = RoundToSizeClass(minimum * element_size) / element_size;
+        return capacity_per_class > minimum ? capacity_per_class : minimum;
+    }
+
+    /**
+    * @brief: Rounds the given amount of bytes up to the next size class.
+    *
+    * @param: size_t -> Bytes.
+    *
+    * @return: size_t -> Bytes of the size class.
+    */
+    _NODISCARD static _CONSTEXPR17 size_t RoundToSizeClass(size_t bytes) noexcept
+    {
+        if (bytes <= s_MinClass) { return s_MinClass; }
+        if (bytes > s_PageSize) { return (bytes + s_PageSize - 1) & ~(s_PageSize - 1); }
+
+        size_t power = s_MinClass;
+        while ((power << 1) < bytes) { power <<= 1; }
+
+        const size_t step = power >> 2;
+        return (bytes + step - 1) & ~(step - 1);
+    }
+
+private:
+    static _CONSTEXPR17 size_t s_MinClass = 16;
+    static _CONSTEXPR17 size_t s_PageSize = 4096;
+};
+
+/*
+* Grows the capacity by a fixed amount of elements.
+* The unused memory is bounded by the step, but the number of reallocations grows linearly with the size.
+*/
+template<size_t Step>
+struct FixedStepGrowthPolicy
+{
+    static_assert(Step > 0, "The step of the growth policy must be greater than zero");
+
+    /**
+    * @brief: Computes the capacity of the next reallocation.
+    *
+    * @param: size_t -> Current capacity.
+    * @param: size_t -> Size in bytes of one element.
+    *
+    * @return: size_t -> New capacity.
+    */
+    _NODISCARD static _CONSTEXPR17 size_t NextCapacity(size_t capacity, size_t) noexcept { return capacity + Step; }
+};
@@ -0,0 +1,930 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header class.
+* IntrusiveList is a doubly linked list whose links live inside the elements, in an IntrusiveListHook member given as template argument.
+* The container never allocates, copies or destroys elements: it only links elements that live in storage owned by the user.
+* An element can be in several lists at the same time by having one hook for each of them,
+* and it can be unlinked in constant time from a reference to it.
+* The elements must outlive their links, destroying a linked element is undefined.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <cstddef>  //For size_t and ptrdiff_t
+#include <cstdint>  //For uintptr_t and int32_t
+#include <cstring>  //For std::memcpy
+#include <utility>  //For std::move
+
+/*
+* Links of an element in an IntrusiveList, the element keeps one hook for every list it can be in at the same time.
+* Copying an element does not copy its links, the copy starts unlinked.
+*/
+struct IntrusiveListHook
+{
+    /**
+    * @brief: Checks if the element is in a list through this hook.
+    *
+    * @return: bool -> True if the hook is linked.
+    */
+    _NODISCARD __forceinline bool IsLinked() const noexcept { return Next != nullptr; }
+
+    IntrusiveListHook() noexcept = default;
+
+    IntrusiveListHook(const IntrusiveListHook&) noexcept {}
+
+    IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept { return *this; }
+
+    IntrusiveListHook* Prev = nullptr;
+    IntrusiveListHook* Next = nullptr;
+};
+
+template<typename T, IntrusiveListHook T::* Hook>
+class IntrusiveList
+{
+#if defined(_MSC_VER)
+    using HookOffsetType = int32_t;
+#else
+    using HookOffsetType = ptrdiff_t;
+#endif
+
+    static_assert(sizeof(IntrusiveListHook T::*) == sizeof(HookOffsetType), "IntrusiveList hooks can not be members of a virtual base");
+
+public:
+    template<typename ValueType>
+    class Iterator
+    {
+        friend class IntrusiveList;
+        //Modifiers
+    public:
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Pre increment.
+        *
+        * @return: Iterator& -> Current iterator.
+        */
+        __forceinline Iterator& operator++() noexcept
+        {
+            m_Ptr = m_Ptr->Next;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Post increment.
+        *
+        * @return: Iterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline Iterator operator++(int) noexcept
+        {
+            Iterator it(*this);
+            m_Ptr = m_Ptr->Next;
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        *
+        * @param: size_t -> distance to move.
+        * @return: Iterator& -> Current iterator.
+        */
+        Iterator& operator+=(size_t distance) noexcept
+        {
+            for (size_t i = 0; i < distance; ++i)
+            {
+                m_Ptr = m_Ptr->Next;
+            }
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> distance to move.
+        * @return: Iterator& -> Current iterator.
+        */
+        __forceinline Iterator& operator+=(int distance) noexcept
+        {
+            if (distance < 0) { return operator-=((size_t)(-distance)); }
+            return operator+=((size_t)distance);
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Pre increment.
+        *
+        * @return: Iterator& -> Current iterator.
+        */
+        __forceinline Iterator& operator--() noexcept
+        {
+            m_Ptr = m_Ptr->Prev;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Post increment.
+        *
+        * @return: Iterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline Iterator operator--(int) noexcept
+        {
+            Iterator it(*this);
+            m_Ptr = m_Ptr->Prev;
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        *
+        * @param: size_t -> distance to move.
+        * @return: Iterator& -> Current iterator.
+        */
+        Iterator& operator-=(size_t distance) noexcept
+        {
+            for (size_t i = 0; i < distance; ++i)
+            {
+                m_Ptr = m_Ptr->Prev;
+            }
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        *
+        * @param: int -> distance to move.
+        * @return: Iterator& -> Current iterator.
+        */
+        __forceinline Iterator& operator-=(int distance) noexcept
+        {
+            if (distance < 0) { return operator+=((size_t)(-distance)); }
+            return operator-=((size_t)distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward distance given from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator+(size_t distance) const noexcept
+        {
+            Iterator it(*this);
+            it += distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward distance given from the current iterator.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> distance to move.
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator+(int distance) const noexcept
+        {
+            Iterator it(*this);
+            it += distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward distance given from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator-(size_t distance) const noexcept
+        {
+            Iterator it(*this);
+            it -= distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward distance given from the current iterator.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        *
+        * @param: int -> distance to move.
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator-(int distance) const noexcept
+        {
+            Iterator it(*this);
+            it -= distance;
+            return it;
+        }
+
+        //Element access
+    public:
+        /**
+        * @brief: Returns the element at the given distance from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ValueType& -> Element in the resulting position.
+        */
+        _NODISCARD __forceinline ValueType& operator[](size_t index) const noexcept { return *(operator+(index)); }
+
+        /**
+        * @brief: Returns the element of the current iterator.
+        *
+        * @return: ValueType& -> Element of the iterator.
+        */
+        _NODISCARD __forceinline ValueType& operator*() const noexcept { return *IntrusiveList::ElementOf(m_Ptr); }
+
+        /**
+        * @brief: Returns the current iterator.
+        *
+        * @return: ValueType* -> Current iterator.
+        */
+        _NODISCARD __forceinline ValueType* operator->() const noexcept { return IntrusiveList::ElementOf(m_Ptr); }
+
+        //Non member functions
+    public:
+        /**
+        * @brief: Compares if two iterators are equal.
+        *
+        * @param: const Iterator& -> Given iterator.
+        * @return: bool -> True if both are equal.
+        */
+        _NODISCARD __forceinline bool operator==(const Iterator& other) const noexcept { return m_Ptr == other.m_Ptr; }
+
+        /**
+        * @brief: Compares if two iterators are not equal.
+        *
+        * @param: const Iterator& -> Given iterator.
+        * @return: bool -> True if both are not equal.
+        */
+        _NODISCARD __forceinline bool operator!=(const Iterator& other) const noexcept { return m_Ptr != other.m_Ptr; }
+
+        /**
+        * @brief: Compares if the current iterator points to a valid position.
+        *
+        * @return: bool -> True if the current iterator is valid.
+        */
+        _NODISCARD __forceinline operator bool() const noexcept { return m_Ptr; }
+
+        /**
+        * @brief: Compares if the current iterator points to a valid position.
+        *
+        * @return: bool -> True if the current iterator is valid.
+        */
+        _NODISCARD __forceinline bool IsValid() const noexcept { return m_Ptr; }
+
+        //Member functions
+    public:
+        __forceinline Iterator(IntrusiveListHook* hook = nullptr) noexcept :
+            m_Ptr(hook) {}
+
+        __forceinline Iterator(const Iterator& other) noexcept = default;
+
+        __forceinline Iterator& operator=(const Iterator& other) noexcept = default;
+
+    private:
+        IntrusiveListHook* m_Ptr;
+    };
+
+    template<typename ValueType>
+    class ReverseIterator
+    {
+        friend class IntrusiveList;
+        //Modifiers
+    public:
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Pre increment.
+        *
+        * @return: ReverseIterator& -> Current iterator.
+        */
+        __forceinline ReverseIterator& operator++() noexcept
+        {
+            --m_Iterator;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Post increment.
+        *
+        * @return: ReverseIterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator++(int) noexcept
+        {
+            ReverseIterator it(*this);
+            --m_Iterator;
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ReverseIterator& -> Current iterator.
+        */
+        __forceinline ReverseIterator& operator+=(size_t distance) noexcept
+        {
+            m_Iterator -= distance;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Pre increment.
+        *
+        * @return: ReverseIterator& -> Current iterator.
+        */
+        __forceinline ReverseIterator& operator--() noexcept
+        {
+            ++m_Iterator;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Post increment.
+        *
+        * @return: ReverseIterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator--(int) noexcept
+        {
+            ReverseIterator it(*this);
+            ++m_Iterator;
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ReverseIterator& -> Current iterator.
+        */
+        __forceinline ReverseIterator& operator-=(size_t distance) noexcept
+        {
+            m_Iterator += distance;
+            return *this;
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward distance given from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ReverseIterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator+(size_t distance) const noexcept
+        {
+            ReverseIterator it(*this);
+            it += distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward distance given from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ReverseIterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator-(size_t distance) const noexcept
+        {
+            ReverseIterator it(*this);
+            it -= distance;
+            return it;
+        }
+
+        //Element access
+    public:
+        /**
+        * @brief: Returns the element of the current iterator.
+        *
+        * @return: ValueType& -> Element of the iterator.
+        */
+        _NODISCARD __forceinline ValueType& operator*() const noexcept { return *m_Iterator; }
+
+        /**
+        * @brief: Returns the current iterator.
+        *
+        * @return: ValueType* -> Current iterator.
+        */
+        _NODISCARD __forceinline ValueType* operator->() const noexcept { return m_Iterator.operator->(); }
+
+        //Non member functions
+    public:
+        _NODISCARD __forceinline bool operator==(const ReverseIterator& other) const noexcept { return m_Iterator == other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator!=(const ReverseIterator& other) const noexcept { return m_Iterator != other.m_Iterator; }
+
+        _NODISCARD __forceinline operator bool() const noexcept { return m_Iterator.IsValid(); }
+
+        _NODISCARD __forceinline bool IsValid() const noexcept { return m_Iterator.IsValid(); }
+
+        //Member functions
+    public:
+        __forceinline ReverseIterator(IntrusiveListHook* hook = nullptr) noexcept :
+            m_Iterator(hook) {}
+
+        __forceinline ReverseIterator(const ReverseIterator& other) noexcept = default;
+
+        __forceinline ReverseIterator& operator=(const ReverseIterator& other) noexcept = default;
+
+    private:
+        Iterator<ValueType> m_Iterator;
+    };
+
+public:
+    using value_type = T;
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+    using reverse_iterator = ReverseIterator<T>;
+    using const_reverse_iterator = ReverseIterator<const T>;
+
+    //Modifiers
+public:
+    /**
+    * @brief: Links the element at the end of the container.
+    * @details: The element must not be linked through this hook, no memory is allocated.
+    *
+    * @param: T& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushBack(T& element) noexcept { LinkBefore(&m_Sentinel, &(element.*Hook)); }
+
+    /**
+    * @brief: Links the element at the begin of the container.
+    * @details: The element must not be linked through this hook, no memory is allocated.
+    *
+    * @param: T& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushFront(T& element) noexcept { LinkBefore(m_Sentinel.Next, &(element.*Hook)); }
+
+    /**
+    * @brief: Links the element before the given iterator.
+    * @details: The element must not be linked through this hook, no memory is allocated.
+    *
+    * @param: iterator -> Position.
+    * @param: T& -> Element.
+    * @return: iterator -> Iterator to the element.
+    */
+    __forceinline iterator Insert(iterator it, T& element) noexcept
+    {
+        IntrusiveListHook* hook = &(element.*Hook);
+        LinkBefore(it.m_Ptr, hook);
+        return iterator(hook);
+    }
+
+    /**
+    * @brief: Unlinks the last element of the container.
+    * @details: Calling PopBack in a empty container does nothing.
+    *
+    * @return: void.
+    */
+    __forceinline void PopBack() noexcept
+    {
+        if (IsEmpty()) { return; }
+
+        Unlink(m_Sentinel.Prev);
+    }
+
+    /**
+    * @brief: Unlinks the first element of the container.
+    * @details: Calling PopFront in a empty container does nothing.
+    *
+    * @return: void.
+    */
+    __forceinline void PopFront() noexcept
+    {
+        if (IsEmpty()) { return; }
+
+        Unlink(m_Sentinel.Next);
+    }
+
+    /**
+    * @brief: Unlinks the element of the given iterator.
+    * @details: The element is not destroyed.
+    *
+    * @param: iterator -> Element to unlink.
+    * @return: iterator -> Iterator to the element after the unlinked one.
+    */
+    __forceinline iterator Erase(iterator it) noexcept
+    {
+        IntrusiveListHook* next = it.m_Ptr->Next;
+        Unlink(it.m_Ptr);
+        return iterator(next);
+    }
+
+    /**
+    * @brief: Unlinks the given element in constant time.
+    * @details: The element must be linked in this container through the hook, it is not destroyed.
+    *
+    * @param: T& -> Element to unlink.
+    * @return: iterator -> Iterator to the element after the unlinked one.
+    */
+    __forceinline iterator Erase(T& element) noexcept { return Erase(iterator(&(element.*Hook))); }
+
+    /**
+    * @brief: Unlinks all the elements of the container.
+    * @details: Every hook is reset so the elements can be linked again, the elements are not destroyed.
+    *
+    * @return: void.
+    */
+    void Clear() noexcept
+    {
+        IntrusiveListHook* hook = m_Sentinel.Next;
+        while (hook != &m_Sentinel)
+        {
+            IntrusiveListHook* next = hook->Next;
+            hook->Prev = nullptr;
+            hook->Next = nullptr;
+            hook = next;
+        }
+
+        Reset();
+    }
+
+    /**
+    * @brief: Exchanges the content of the container by the content of other.
+    * @details: Only the first and the last element of each container are relinked.
+    *
+    * @param: IntrusiveList& -> Other container.
+    * @return: void.
+    */
+    void Swap(IntrusiveList& other) noexcept
+    {
+        if (&other == this) { return; }
+
+        IntrusiveList aux(std::move(other));
+        other.TakeElements(*this);
+        TakeElements(aux);
+    }
+
+    /**
+    * @brief: Moves all the elements of other before position.
+    * @details: The elements are relinked in constant time, other is left empty.
+    *
+    * @param: iterator -> Position in the container.
+    * @param: IntrusiveList& -> Other list.
+    * @return: void.
+    */
+    void Splice(iterator position, IntrusiveList& other) noexcept
+    {
+        if (&other == this || other.IsEmpty()) { return; }
+
+        IntrusiveListHook* first = other.m_Sentinel.Next;
+        IntrusiveListHook* last = other.m_Sentinel.Prev;
+        const size_t elements = other.m_Elements;
+        other.Reset();
+
+        LinkRange(position.m_Ptr, first, last);
+        m_Elements += elements;
+    }
+
+    /**
+    * @brief: Moves the element of it from other before position.
+    * @details: The element is relinked in constant time, other can be the container itself.
+    *
+    * @param: iterator -> Position in the container.
+    * @param: IntrusiveList& -> Other list.
+    * @param: iterator -> Element of other to move.
+    * @return: void.
+    */
+    void Splice(iterator position, IntrusiveList& other, iterator it) noexcept
+    {
+        if (position == it || position.m_Ptr == it.m_Ptr->Next) { return; }
+
+        other.Unlink(it.m_Ptr);
+        LinkBefore(position.m_Ptr, it.m_Ptr);
+    }
+
+    /**
+    * @brief: Moves all the elements of other at the end of the container.
+    *
+    * @param: IntrusiveList& -> Other list.
+    * @return: void.
+    */
+    __forceinline void Append(IntrusiveList& other) noexcept { Splice(end(), other); }
+
+    //Capacity
+public:
+    /**
+    * @brief: Checks if the container is empty.
+    *
+    * @return: bool -> True if the container has no elements.
+    */
+    _NODISCARD __forceinline bool IsEmpty() const noexcept { return m_Elements == 0; }
+
+    /**
+    * @brief: Number of elements linked in the container.
+    *
+    * @return: size_t -> Elements.
+    */
+    _NODISCARD __forceinline size_t Size() const noexcept { return m_Elements; }
+
+    //Element Access
+public:
+    /**
+    * @brief: Returns a reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Front() noexcept { return *ElementOf(m_Sentinel.Next); }
+
+    /**
+    * @brief: Returns a const reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Front() const noexcept { return *ElementOf(m_Sentinel.Next); }
+
+    /**
+    * @brief: Returns a reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Back() noexcept { return *ElementOf(m_Sentinel.Prev); }
+
+    /**
+    * @brief: Returns a const reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Back() const noexcept { return *ElementOf(m_Sentinel.Prev); }
+
+    /**
+    * @brief: Returns an iterator to the given element.
+    * @details: The element must be linked in this container through the hook.
+    *
+    * @param: T& -> Element.
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator GetIterator(T& element) noexcept { return iterator(&(element.*Hook)); }
+
+    /**
+    * @brief: Checks if the element is linked in a list through the hook of the container.
+    *
+    * @param: const T& -> Element.
+    * @return: bool -> True if the element is linked.
+    */
+    _NODISCARD static __forceinline bool IsLinked(const T& element) noexcept { return (element.*Hook).IsLinked(); }
+
+    //Iterators
+public:
+    /**
+    * @brief: Returns an iterator to the begin of the container.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator begin() noexcept { return iterator(m_Sentinel.Next); }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator begin() const noexcept { return const_iterator(m_Sentinel.Next); }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cbegin() const noexcept { return const_iterator(m_Sentinel.Next); }
+
+    /**
+    * @brief: Returns an iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator end() noexcept { return iterator(&m_Sentinel); }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator end() const noexcept { return const_iterator(Sentinel()); }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cend() const noexcept { return const_iterator(Sentinel()); }
+
+    /**
+    * @brief: Returns a reverse iterator to the end of the container.
+    *
+    * @return: reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline reverse_iterator rbegin() noexcept { return reverse_iterator(m_Sentinel.Prev); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the end of the container.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(m_Sentinel.Prev); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the end of the container.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(m_Sentinel.Prev); }
+
+    /**
+    * @brief: Returns a reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline reverse_iterator rend() noexcept { return reverse_iterator(&m_Sentinel); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator rend() const noexcept { return const_reverse_iterator(Sentinel()); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator crend() const noexcept { return const_reverse_iterator(Sentinel()); }
+
+    //Member functions
+public:
+    IntrusiveList() noexcept
+    {
+        Reset();
+    }
+
+    IntrusiveList(const IntrusiveList& other) = delete;
+
+    IntrusiveList(IntrusiveList&& other) noexcept
+    {
+        TakeElements(other);
+    }
+
+    ~IntrusiveList() noexcept
+    {
+        Clear();
+    }
+
+    IntrusiveList& operator=(const IntrusiveList& other) = delete;
+
+    IntrusiveList& operator=(IntrusiveList&& other) noexcept
+    {
+        if (&other == this) { return *this; }
+
+        Clear();
+        TakeElements(other);
+
+        return *this;
+    }
+
+    //Non-member functions
+public:
+    _NODISCARD bool operator==(const IntrusiveList& other) const noexcept
+    {
+        if (m_Elements != other.m_Elements) { return false; }
+
+        const_iterator other_it = other.cbegin();
+        for (const_iterator this_it = cbegin(); this_it != cend(); ++this_it, ++other_it)
+        {
+            if (*this_it != *other_it) { return false; }
+        }
+
+        return true;
+    }
+
+    _NODISCARD __forceinline bool operator!=(const IntrusiveList& other) const noexcept { return !(*this == other); }
+
+private:
+    /**
+    * @brief: Returns the element that contains the given hook.
+    *
+    * @param: const IntrusiveListHook* -> Hook of the element.
+    * @return: T* -> Element.
+    */
+    _NODISCARD static __forceinline T* ElementOf(const IntrusiveListHook* hook) noexcept
+    {
+        return reinterpret_cast<T*>(reinterpret_cast<uintptr_t>(hook) - HookOffset());
+    }
+
+    /**
+    * @brief: Returns the offset of the hook inside T.
+    * @details: MSVC and the Itanium ABI of GCC and Clang represent a pointer to a data member as the offset of the member,
+    * so it is read from the template argument without any object of type T.
+    *
+    * @return: uintptr_t -> Offset in bytes.
+    */
+    _NODISCARD static __forceinline uintptr_t HookOffset() noexcept
+    {
+        IntrusiveListHook T::* hook = Hook;
+        HookOffsetType offset;
+        std::memcpy(&offset, &hook, sizeof(offset));
+        return (uintptr_t)offset;
+    }
+
+    _NODISCARD __forceinline IntrusiveListHook* Sentinel() const noexcept { return const_cast<IntrusiveListHook*>(&m_Sentinel); }
+
+    __forceinline void LinkBefore(IntrusiveListHook* position, IntrusiveListHook* hook) noexcept
+    {
+        hook->Prev = position->Prev;
+        hook->Next = position;
+        position->Prev->Next = hook;
+        position->Prev = hook;
+        ++m_Elements;
+    }
+
+    __forceinline void LinkRange(IntrusiveListHook* position, IntrusiveListHook* first, IntrusiveListHook* last) noexcept
+    {
+        first->Prev = position->Prev;
+        last->Next = position;
+        position->Prev->Next = first;
+        position->Prev = last;
+    }
+
+    __forceinline void Unlink(IntrusiveListHook* hook) noexcept
+    {
+        hook->Prev->Next = hook->Next;
+        hook->Next->Prev = hook->Prev;
+        hook->Prev = nullptr;
+        hook->Next = nullptr;
+        --m_Elements;
+    }
+
+    /**
+    * @brief: Takes the elements of other, that is left empty.
+    * @details: The sentinel lives inside the container, so the first and the last element are relinked to the new one.
+    * The current elements of the container are not unlinked.
+    *
+    * @param: IntrusiveList& -> Other container.
+    * @return: void.
+    */
+    __forceinline void TakeElements(IntrusiveList& other) noexcept
+    {
+        if (other.IsEmpty())
+        {
+            Reset();
+            return;
+        }
+
+        m_Sentinel.Next = other.m_Sentinel.Next;
+        m_Sentinel.Prev = other.m_Sentinel.Prev;
+        m_Sentinel.Next->Prev = &m_Sentinel;
+        m_Sentinel.Prev->Next = &m_Sentinel;
+        m_Elements = other.m_Elements;
+        other.Reset();
+    }
+
+    __forceinline void Reset() noexcept
+    {
+        m_Sentinel.Prev = &m_Sentinel;
+        m_Sentinel.Next = &m_Sentinel;
+        m_Elements = 0;
+    }
+
+private:
+    IntrusiveListHook m_Sentinel;
+    size_t m_Elements = 0;
+};
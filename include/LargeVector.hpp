@@ -0,0 +1,710 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header class.
+* LargeVector class is a sequence container for very large arrays.
+* The container reserves a range of virtual addresses for its maximum size up front and commits the pages lazily,
+* in chunks, as it grows. The elements never move, so growing costs no copies and the references stay valid.
+* The size is only limited by the reserved range, which can be requested to be backed by transparent huge pages
+* to cut the TLB misses of random access.
+* The memory comes directly from the operating system, so the container has no allocator.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <initializer_list>
+#include <cstring>  //For std::memcpy
+#include "TypeTraits.hpp"
+
+#if defined(_WIN32)
+#include <windows.h>  //For VirtualAlloc and VirtualFree
+#else
+#include <sys/mman.h>  //For mmap, mprotect, madvise and munmap
+#endif
+
+/*
+* Reservation and commit of pages through the virtual memory functions of the operating system.
+*/
+class VirtualMemory
+{
+public:
+    /**
+    * @brief: Reserves a range of addresses without memory behind it.
+    * @details: On Linux the start of the range is aligned to s_HugePageSize, so huge pages can back it.
+    * Windows only aligns it to the allocation granularity (64KB), it does not give huge pages to reserved ranges anyway.
+    *
+    * @param: size_t -> Bytes, a multiple of s_HugePageSize.
+    * @return: void* -> Start of the range, nullptr if the range could not be reserved.
+    */
+    _NODISCARD static void* Reserve(size_t bytes) noexcept
+    {
+#if defined(_WIN32)
+        return VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS);
+#else
+        //The range is reserved with one extra huge page and the unaligned ends are given back
+        const size_t padded = bytes + s_HugePageSize;
+        void* memory = mmap(nullptr, padded, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (memory == MAP_FAILED) { return nullptr; }
+
+        char* first = static_cast<char*>(memory);
+        char* aligned = first + ((s_HugePageSize - (size_t)first % s_HugePageSize) % s_HugePageSize);
+        if (aligned != first) { munmap(first, aligned - first); }
+        munmap(aligned + bytes, (first + padded) - (aligned + bytes));
+
+        return aligned;
+#endif
+    }
+
+    /**
+    * @brief: Backs part of a reserved range with memory that can be read and written.
+    *
+    * @param: void* -> Start, aligned to the page size.
+    * @param: size_t -> Bytes.
+    * @return: bool -> True if the memory was committed.
+    */
+    _NODISCARD static bool Commit(void* address, size_t bytes) noexcept
+    {
+#if defined(_WIN32)
+        return VirtualAlloc(address, bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+        return mprotect(address, bytes, PROT_READ | PROT_WRITE) == 0;
+#endif
+    }
+
+    /**
+    * @brief: Gives the memory of part of a reserved range back to the system, the addresses stay reserved.
+    *
+    * @param: void* -> Start, aligned to the page size.
+    * @param: size_t -> Bytes.
+    * @return: void.
+    */
+    static void Decommit(void* address, size_t bytes) noexcept
+    {
+#if defined(_WIN32)
+        VirtualFree(address, bytes, MEM_DECOMMIT);
+#else
+        madvise(address, bytes, MADV_DONTNEED);
+        mprotect(address, bytes, PROT_NONE);
+#endif
+    }
+
+    /**
+    * @brief: Releases a reserved range and its memory.
+    *
+    * @param: void* -> Start of the range.
+    * @param: size_t -> Bytes of the range.
+    * @return: void.
+    */
+    static void Release(void* address, size_t bytes) noexcept
+    {
+#if defined(_WIN32)
+        VirtualFree(address, 0, MEM_RELEASE);
+#else
+        munmap(address, bytes);
+#endif
+    }
+
+    /**
+    * @brief: Asks the system to back a reserved range with transparent huge pages.
+    * @details: Windows only gives large pages to memory committed at once by privileged processes,
+    * so the advice is ignored there.
+    *
+    * @param: void* -> Start of the range.
+    * @param: size_t -> Bytes of the range.
+    * @return: bool -> True if the system accepted the advice.
+    */
+    static bool AdviseHugePages(void* address, size_t bytes) noexcept
+    {
+#if defined(_WIN32) || !defined(MADV_HUGEPAGE)
+        return false;
+#else
+        return madvise(address, bytes, MADV_HUGEPAGE) == 0;
+#endif
+    }
+
+public:
+    static _CONSTEXPR17 size_t s_HugePageSize = (size_t)2 * 1024 * 1024;
+};
+
+template<typename T>
+class LargeVector
+{
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    //Modifiers
+public:
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: Constant time, a full container commits the next chunk of its range and no element is moved.
+    *
+    * @param: const T& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushBack(const T& element) { EmplaceBack(element); }
+
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: Constant time, a full container commits the next chunk of its range and no element is moved.
+    *
+    * @param: T&& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushBack(T&& element) { EmplaceBack(std::move(element)); }
+
+    /**
+    * @brief: Constructs a new element at the end of the container.
+    * @details: Constant time, a full container commits the next chunk of its range and no element is moved.
+    * std::exception execption will be thrown if the container reached its maximum size.
+    *
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        if (m_Elements == m_Capacity) { Commit(m_Elements + 1); }
+
+        T* slot = m_Data + m_Elements;
+        new (slot) T(std::forward<Args>(args)...);
+        ++m_Elements;
+
+        return *slot;
+    }
+
+    /**
+    * @brief: Delete the last element of the container.
+    * @details: The committed memory is kept for the next insertions.
+    *
+    * @return: void.
+    */
+    void PopBack() noexcept
+    {
+        if (IsEmpty()) { return; }
+
+        --m_Elements;
+        m_Data[m_Elements].~T();
+    }
+
+    /**
+    * @brief: Clears the content of the container.
+    * @details: The committed memory is kept for the next insertions.
+    *
+    * @return: void.
+    */
+    void Clear() noexcept
+    {
+        DestroyElements();
+        m_Elements = 0;
+    }
+
+    /**
+    * @brief: Swaps the content of two LargeVectors.
+    * @details: Only the ranges are exchanged, no element is moved.
+    *
+    * @param: LargeVector& -> Other vector.
+    * @return: void.
+    */
+    void Swap(LargeVector& other) noexcept
+    {
+        if (&other == this) { return; }
+
+        LargeVector vector(std::move(other));
+        other.TakeStorage(*this);
+        TakeStorage(vector);
+    }
+
+    //Capacity
+public:
+    /**
+    * @brief: Commits the memory for at least capacity elements.
+    * @details: The range is reserved on the first call, the elements are never moved.
+    * std::exception execption will be thrown if the capacity is greater than the maximum size.
+    *
+    * @param: size_t -> Capacity.
+    * @return: void.
+    */
+    void Reserve(size_t capacity)
+    {
+        if (capacity <= m_Capacity) { return; }
+
+        Commit(capacity);
+    }
+
+    /**
+    * @brief: Requests the removal of unused capacity.
+    * @details: The chunks after the last element are decommitted, the range stays reserved.
+    * An empty container releases its range.
+    *
+    * @return: void.
+    */
+    void Shrink() noexcept
+    {
+        if (!m_Data) { return; }
+        if (IsEmpty()) { return ReleaseStorage(); }
+
+        const size_t bytes = RoundToChunk(m_Elements * sizeof(T));
+        if (bytes < m_CommittedBytes)
+        {
+            VirtualMemory::Decommit(reinterpret_cast<char*>(m_Data) + bytes, m_CommittedBytes - bytes);
+            SetCommittedBytes(bytes);
+        }
+    }
+
+    /**
+    * @brief: Checks if the container is empty.
+    *
+    * @return: bool -> True if the container has no elements.
+    */
+    _NODISCARD __forceinline bool IsEmpty() const noexcept { return m_Elements == 0; }
+
+    /**
+    * @brief: Number of elements in the container.
+    *
+    * @return: size_t -> Elements.
+    */
+    _NODISCARD __forceinline size_t Size() const noexcept { return m_Elements; }
+
+    /**
+    * @brief: Number of elements that fit in the committed memory.
+    *
+    * @return: size_t -> Capacity.
+    */
+    _NODISCARD __forceinline size_t Capacity() const noexcept { return m_Capacity; }
+
+    /**
+    * @brief: Maximum number of elements, given by the reserved range.
+    *
+    * @return: size_t -> Maximum size.
+    */
+    _NODISCARD __forceinline size_t MaxSize() const noexcept { return m_MaxSize; }
+
+    /**
+    * @brief: Checks if the range was requested to be backed by huge pages and the system accepted it.
+    *
+    * @return: bool -> True if the range uses transparent huge pages.
+    */
+    _NODISCARD __forceinline bool UsesHugePages() const noexcept { return m_HugePagesAdvised; }
+
+    //Element Access
+public:
+    /**
+    * @brief: Returns a reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Front() noexcept { return *m_Data; }
+
+    /**
+    * @brief: Returns a const reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Front() const noexcept { return *m_Data; }
+
+    /**
+    * @brief: Returns a reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Back() noexcept { return m_Data[m_Elements - 1]; }
+
+    /**
+    * @brief: Returns a const reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Back() const noexcept { return m_Data[m_Elements - 1]; }
+
+    /**
+    * @brief: Returns a reference to the element at the given index.
+    * @details: Calling [] in a empty container is undefined.
+    *
+    * @param: size_t -> Index.
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& operator[](size_t index) noexcept { return m_Data[index]; }
+
+    /**
+    * @brief: Returns a const reference to the element at the given index.
+    * @details: Calling [] in a empty container is undefined.
+    *
+    * @param: size_t -> Index.
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& operator[](size_t index) const noexcept { return m_Data[index]; }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: T& -> Element.
+    */
+    _NODISCARD T& At(size_t index)
+    {
+        if (index >= m_Elements) { LargeVectorOutOfRangeError(); }
+        return m_Data[index];
+    }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: const T& -> Element.
+    */
+    _NODISCARD const T& At(size_t index) const
+    {
+        if (index >= m_Elements) { LargeVectorOutOfRangeError(); }
+        return m_Data[index];
+    }
+
+    /**
+    * @brief: Returns a pointer to the container data.
+    *
+    * @return: T* -> Data.
+    */
+    _NODISCARD __forceinline T* Data() noexcept { return m_Data; }
+
+    /**
+    * @brief: Returns a const pointer to the container data.
+    *
+    * @return: const T* -> Data.
+    */
+    _NODISCARD __forceinline const T* Data() const noexcept { return m_Data; }
+
+    //Iterators
+public:
+    /**
+    * @brief: Returns an iterator to the begin of the container.
+    * @details: The elements are contiguous, so the iterators are pointers.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator begin() noexcept { return m_Data; }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator begin() const noexcept { return m_Data; }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cbegin() const noexcept { return m_Data; }
+
+    /**
+    * @brief: Returns an iterator to the end of the container.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator end() noexcept { return m_Data + m_Elements; }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator end() const noexcept { return m_Data + m_Elements; }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cend() const noexcept { return m_Data + m_Elements; }
+
+    //Member functions
+public:
+    /**
+    * @brief: Creates an empty container, the range is reserved on the first insertion.
+    *
+    * @param: size_t -> Maximum number of elements, the size of the reserved range.
+    * @param: bool -> True to back the range with transparent huge pages.
+    */
+    explicit LargeVector(size_t max_size = s_DefaultMaxSize, bool huge_pages = false) noexcept :
+        m_MaxSize(max_size),
+        m_HugePages(huge_pages) {}
+
+    LargeVector(const LargeVector& other) :
+        m_MaxSize(other.m_MaxSize),
+        m_HugePages(other.m_HugePages)
+    {
+        CopyElements(other);
+    }
+
+    LargeVector(LargeVector&& other) noexcept :
+        m_MaxSize(other.m_MaxSize),
+        m_HugePages(other.m_HugePages)
+    {
+        TakeStorage(other);
+    }
+
+    LargeVector(std::initializer_list<T>&& list) :
+        m_MaxSize(s_DefaultMaxSize)
+    {
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+    }
+
+    ~LargeVector() noexcept
+    {
+        DestroyElements();
+        ReleaseStorage();
+    }
+
+    LargeVector& operator=(const LargeVector& other)
+    {
+        if (&other == this) { return *this; }
+
+        Clear();
+        CopyElements(other);
+
+        return *this;
+    }
+
+    LargeVector& operator=(LargeVector&& other) noexcept
+    {
+        if (&other == this) { return *this; }
+
+        DestroyElements();
+        ReleaseStorage();
+        m_MaxSize = other.m_MaxSize;
+        m_HugePages = other.m_HugePages;
+        TakeStorage(other);
+
+        return *this;
+    }
+
+    LargeVector& operator=(std::initializer_list<T>&& list)
+    {
+        Clear();
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+
+        return *this;
+    }
+
+    //Non-member functions
+public:
+    /**
+    * @brief: Compares the content of two LargeVectors.
+    *
+    * @return: bool -> True if the content of both containers are equal.
+    */
+    _NODISCARD bool operator==(const LargeVector& other) const noexcept
+    {
+        if (m_Elements != other.m_Elements) { return false; }
+
+        for (size_t i = 0; i < m_Elements; ++i)
+        {
+            if (m_Data[i] != other.m_Data[i]) { return false; }
+        }
+
+        return true;
+    }
+
+    /**
+    * @brief: Compares the content of two LargeVectors.
+    *
+    * @return: bool -> True if the content of both containers are not equal.
+    */
+    _NODISCARD __forceinline bool operator!=(const LargeVector& other) const noexcept { return !(*this == other); }
+
+private:
+    _NODISCARD static __forceinline size_t RoundToChunk(size_t bytes) noexcept
+    {
+        return (bytes + s_CommitChunk - 1) / s_CommitChunk * s_CommitChunk;
+    }
+
+    __forceinline void SetCommittedBytes(size_t bytes) noexcept
+    {
+        m_CommittedBytes = bytes;
+        m_Capacity = bytes / sizeof(T);
+        if (m_Capacity > m_MaxSize) { m_Capacity = m_MaxSize; }
+    }
+
+    /**
+    * @brief: Commits the chunks needed by capacity elements, reserving the range first if needed.
+    * @details: std::exception execption will be thrown if the capacity is greater than the maximum size
+    * or the system has no memory to commit.
+    *
+    * @param: size_t -> Capacity.
+    * @return: void.
+    */
+    void Commit(size_t capacity)
+    {
+        if (capacity > m_MaxSize || m_MaxSize > s_MaxLargeVectorSize) { LargeVectorMaxLenghtError(); }
+
+        if (!m_Data)
+        {
+            m_ReservedBytes = RoundToChunk(m_MaxSize * sizeof(T));
+            void* range = VirtualMemory::Reserve(m_ReservedBytes);
+            if (!range) { LargeVectorBadAllocationError(); }
+
+            m_Data = static_cast<T*>(range);
+            m_HugePagesAdvised = m_HugePages && VirtualMemory::AdviseHugePages(range, m_ReservedBytes);
+        }
+
+        const size_t bytes = RoundToChunk(capacity * sizeof(T));
+        if (bytes <= m_CommittedBytes) { return; }
+
+        if (!VirtualMemory::Commit(reinterpret_cast<char*>(m_Data) + m_CommittedBytes, bytes - m_CommittedBytes))
+        {
+            LargeVectorBadAllocationError();
+        }
+        SetCommittedBytes(bytes);
+    }
+
+    /**
+    * @brief: Copies the elements of other, the container must have no elements.
+    *
+    * @param: const LargeVector& -> Other vector.
+    * @return: void.
+    */
+    void CopyElements(const LargeVector& other)
+    {
+        if (other.IsEmpty()) { return; }
+
+        Reserve(other.m_Elements);
+        if constexpr (std::is_trivially_copyable<T>::value)
+        {
+            std::memcpy((void*)m_Data, (const void*)other.m_Data, sizeof(T) * other.m_Elements);
+            m_Elements = other.m_Elements;
+        }
+        else
+        {
+            for (size_t i = 0; i < other.m_Elements; ++i)
+            {
+                EmplaceBack(other.m_Data[i]);
+            }
+        }
+    }
+
+    __forceinline void DestroyElements() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible<T>::value)
+        {
+            for (size_t i = 0; i < m_Elements; ++i)
+            {
+                m_Data[i].~T();
+            }
+        }
+    }
+
+    /**
+    * @brief: Releases the range, the elements must be already destroyed or moved.
+    *
+    * @return: void.
+    */
+    __forceinline void ReleaseStorage() noexcept
+    {
+        if (m_Data) { VirtualMemory::Release(m_Data, m_ReservedBytes); }
+
+        Default();
+    }
+
+    /**
+    * @brief: Takes the range of other, the container must have no storage.
+    *
+    * @param: LargeVector& -> Other vector.
+    * @return: void.
+    */
+    __forceinline void TakeStorage(LargeVector& other) noexcept
+    {
+        m_Data = other.m_Data;
+        m_Elements = other.m_Elements;
+        m_Capacity = other.m_Capacity;
+        m_CommittedBytes = other.m_CommittedBytes;
+        m_ReservedBytes = other.m_ReservedBytes;
+        m_MaxSize = other.m_MaxSize;
+        m_HugePages = other.m_HugePages;
+        m_HugePagesAdvised = other.m_HugePagesAdvised;
+
+        other.Default();
+    }
+
+    __forceinline void Default() noexcept
+    {
+        m_Data = nullptr;
+        m_Elements = 0;
+        m_Capacity = 0;
+        m_CommittedBytes = 0;
+        m_ReservedBytes = 0;
+        m_HugePagesAdvised = false;
+    }
+
+    [[noreturn]] __forceinline static void LargeVectorOutOfRangeError() {
+        throw std::exception("LargeVector index out of range");
+    }
+
+    [[noreturn]] __forceinline static void LargeVectorMaxLenghtError() {
+        throw std::exception("LargeVector too long");
+    }
+
+    [[noreturn]] __forceinline static void LargeVectorBadAllocationError() {
+        throw std::exception("Bad allocation");
+    }
+
+public:
+    //64 GB of addresses on 64-bit builds, 256 MB on 32-bit builds
+    static _CONSTEXPR17 size_t s_DefaultMaxSize = (size_t)(sizeof(void*) == 8 ? (1ull << 36) : (1ull << 28)) / sizeof(T);
+
+private:
+    T* m_Data = nullptr;
+    size_t m_Elements = 0;
+    size_t m_Capacity = 0;
+    size_t m_CommittedBytes = 0;
+    size_t m_ReservedBytes = 0;
+    size_t m_MaxSize = s_DefaultMaxSize;
+    bool m_HugePages = false;
+    bool m_HugePagesAdvised = false;
+
+    //The memory is committed in huge page sized chunks, so every chunk can be backed by one huge page
+    static _CONSTEXPR17 size_t s_CommitChunk = VirtualMemory::s_HugePageSize;
+    static _CONSTEXPR17 size_t s_MaxLargeVectorSize = ((size_t)-1 - s_CommitChunk) / sizeof(T);
+};
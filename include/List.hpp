@@ -11,6 +11,8 @@
 * List containers are implemented as doubly-linked lists.
 * Doubly linked lists can store each of the elements they contain in different and unrelated storage locations.
 * The ordering is kept internally by the association to each element of a link to the element preceding it and a link to the element following it.
+* An IndexedList also threads its nodes through a tree ordered by position, so access and insertion by index take logarithmic time.
+* A List can also keep a finger, the last node found by index, so accesses close to the previous one walk from there.
 */
 
 /*
@@ -38,11 +40,40 @@ Copyright (c) 2020 Luis Poveda Cano
 */
 
 #include <initializer_list>
-
-template<typename T>
-class List
+#include <functional>  //For std::less, std::equal_to
+#include <cstdint>  //For uint64_t and uintptr_t
+#include <atomic>  //For std::atomic
+#include <xmmintrin.h>  //For _mm_prefetch
+#include "Allocator.hpp"
+
+template<typename T, typename Allocator = std::allocator<T>, bool Indexed = false>
+class List : private AllocatorStorage<Allocator>
 {
-    struct Node
+    using AllocatorBase = AllocatorStorage<Allocator>;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    using Propagation = AllocatorPropagation<Allocator>;
+    using AllocatorBase::GetAllocatorReference;
+
+    struct Node;
+    struct Slab;
+
+    /*
+    * Links of the position tree of an indexed list, a treap whose in-order traversal is the order of the list.
+    * Weight is the number of nodes of the subtree. The head sentinel is the header of the tree, its Left is the root.
+    */
+    struct IndexLinks
+    {
+        Node* Parent = nullptr;
+        Node* Left = nullptr;
+        Node* Right = nullptr;
+        size_t Weight = 0;
+    };
+
+    struct NoIndexLinks {};
+
+    using NodeLinks = typename std::conditional<Indexed, IndexLinks, NoIndexLinks>::type;
+
+    struct Node : NodeLinks
     {
         //Modifiers
     public:
@@ -135,6 +166,70 @@ class List
         Node* Next = nullptr;
     };
 
+    /*
+    * Memory of a node and its element, both are allocated as a single block.
+    */
+    struct alignas(alignof(Node) > alignof(T) ? alignof(Node) : alignof(T)) PlainBlock
+    {
+        unsigned char Bytes[sizeof(Node) + sizeof(T)];
+    };
+
+    /*
+    * Block of a node that can be carved from a slab, it keeps the slab it was carved from after the element.
+    */
+    struct alignas(alignof(Node) > alignof(T) ? alignof(Node) : alignof(T)) SlabBlock
+    {
+        unsigned char Bytes[sizeof(Node) + sizeof(T)];
+        Slab* Home;
+    };
+
+    using NodeBlock = typename std::conditional<IsNodePoolAllocator<Allocator>::value, PlainBlock, SlabBlock>::type;
+
+    /*
+    * Header of a contiguous block of nodes, the nodes are carved one after the other from the blocks that follow it.
+    * The slabs form a circular list that starts after the newest slab, the slabs with free nodes also form a list.
+    * Nodes released by Shrink go to the free nodes of their slab, the slab is released once all its carved nodes are free.
+    * A slab only belongs to the container that carved it. Nodes spliced into other containers are returned through Balance,
+    * and once the owner is gone the last node returned releases the slab.
+    */
+    struct Slab
+    {
+        Slab* Next = nullptr;
+        Slab* NextFree = nullptr;
+        Node* Free = nullptr;
+        size_t FreeNodes = 0;
+        size_t Nodes = 0;
+        size_t Blocks = 0;
+        uint64_t Owner = 0;
+        std::atomic<ptrdiff_t> Balance{ 0 };
+    };
+
+    /*
+    * Slabs of a single container, Id tells its slabs from the slabs of the nodes spliced from other containers.
+    * Shared is set once nodes were spliced to or from another container.
+    */
+    struct SlabPool
+    {
+        Slab* Slabs = nullptr;
+        Slab* FreeSlabs = nullptr;
+        NodeBlock* Cursor = nullptr;
+        NodeBlock* End = nullptr;
+        uint64_t Id = 0;
+        bool Shared = false;
+    };
+
+    static _CONSTEXPR17 size_t s_SlabHeaderBlocks = (sizeof(Slab) + sizeof(NodeBlock) - 1) / sizeof(NodeBlock);
+    static _CONSTEXPR17 size_t s_MinSlabNodes = 16;
+    static _CONSTEXPR17 size_t s_MaxSlabNodes = 65536 / sizeof(NodeBlock);
+    static _CONSTEXPR17 bool s_UseSlabs = s_MaxSlabNodes >= s_MinSlabNodes && !IsNodePoolAllocator<Allocator>::value;
+
+    using BlockAllocator = typename AllocatorTraits::template rebind_alloc<NodeBlock>;
+    using BlockTraits = std::allocator_traits<BlockAllocator>;
+    using SentinelAllocator = typename AllocatorTraits::template rebind_alloc<Node>;
+    using SentinelTraits = std::allocator_traits<SentinelAllocator>;
+    using PoolAllocator = typename AllocatorTraits::template rebind_alloc<SlabPool>;
+    using PoolTraits = std::allocator_traits<PoolAllocator>;
+
 public:
     template<typename ValueType>
     class Iterator
@@ -1375,6 +1470,7 @@ public:
     using const_iterator = Iterator<const T>;
     using reverse_iterator = ReverseIterator<T>;
     using const_reverse_iterator = ReverseIterator<const T>;
+    using allocator_type = Allocator;
 
     //Modifiers
 public:
@@ -1394,32 +1490,35 @@ public:
         if (capacity >= m_Elements)
         {
             size_t diff = m_Capacity - capacity;
-            for (size_t i = 0; i < diff; ++i)
+            Node* first = m_Unused;
+            Node* last = m_Unused;
+            for (size_t i = 1; i < diff; ++i)
             {
-                Node* current = m_Unused;
-                m_Unused = m_Unused->Next;
-                (*current).~Node();
-                ::operator delete(current, sizeof(Node) + sizeof(T));
+                last = last->Next;
             }
+            m_Unused = last->Next;
+            if (m_Unused) { m_Unused->Prev = first->Prev; }
+            last->Next = nullptr;
+
+            ReleaseNodes(first);
             m_Capacity = capacity;
             return;
         }
 
         size_t diff = m_Elements - capacity;
         reverse_iterator it = rbegin();
-        it.m_Ptr->Next = m_Unused;
 
         for (size_t i = 0; i < diff; ++i, ++it)
         {
             it.m_Ptr->ClearData();
         }
 
-        m_Unused = it.m_Ptr;
-        ++it;
-        m_Unused->Prev = nullptr;
+        //The iterator is at the new last element, the nodes after it go to the unused nodes
+        PushUnused(it.m_Ptr->Next, m_LastElement);
         m_LastElement = it.m_Ptr;
         m_LastElement->Next = m_Tail;
         m_Tail->Prev = m_LastElement;
+        InvalidateIndex();
 
         Shrink();
 
@@ -1547,7 +1646,7 @@ public:
     {
         if (IsEmpty() || index == 0)
         {
-            PushEmpty(element);
+            PushFront(element);
             return begin();
         }
         if (index >= m_Elements)
@@ -1635,7 +1734,7 @@ public:
     {
         if (IsEmpty() || index == 0)
         {
-            PushEmpty(std::move(element));
+            PushFront(std::move(element));
             return begin();
         }
         if (index >= m_Elements)
@@ -1789,8 +1888,7 @@ public:
     {
         if (IsEmpty() || index == 0)
         {
-            EmplaceEmpty(std::forward<Args>(args)...);
-            return *m_FirstElement->Data;
+            return EmplaceFront(std::forward<Args>(args)...);
         }
         if (index >= m_Elements)
         {
@@ -1884,9 +1982,10 @@ public:
 
         --m_Elements;
         m_LastElement->ClearData();
+        if constexpr (Indexed) { IndexErase(m_LastElement); }
+        FingerErase(m_LastElement);
 
-        m_LastElement->Next = m_Unused;
-        m_Unused = m_LastElement;
+        Node* node = m_LastElement;
 
         if (IsEmpty())
         {
@@ -1898,11 +1997,12 @@ public:
         else
         {
             m_LastElement = m_LastElement->Prev;
-            m_Unused->Prev = nullptr;
 
             m_LastElement->Next = m_Tail;
             m_Tail->Prev = m_LastElement;
         }
+
+        RecycleNodes(node, node);
     }
 
     /**
@@ -1917,11 +2017,10 @@ public:
 
         --m_Elements;
         m_FirstElement->ClearData();
+        if constexpr (Indexed) { IndexErase(m_FirstElement); }
+        FingerErase(m_FirstElement);
 
-        Node* tmp = m_FirstElement->Next;
-
-        m_FirstElement->Next = m_Unused;
-        m_Unused = m_FirstElement;
+        Node* node = m_FirstElement;
 
         if (IsEmpty())
         {
@@ -1932,12 +2031,13 @@ public:
         }
         else
         {
-            m_FirstElement = tmp;
-            m_Unused->Prev = nullptr;
+            m_FirstElement = m_FirstElement->Next;
 
             m_FirstElement->Prev = m_Head;
             m_Head->Next = m_FirstElement;
         }
+
+        RecycleNodes(node, node);
     }
 
     /**
@@ -1962,6 +2062,8 @@ public:
         }
         iterator it = GetIteratorAtIndex(index);
         it.m_Ptr->ClearData();
+        if constexpr (Indexed) { IndexErase(it.m_Ptr); }
+        FingerErase(it.m_Ptr);
 
         --m_Elements;
         it.m_Ptr->Prev->Next = it.m_Ptr->Next;
@@ -1969,9 +2071,7 @@ public:
 
         iterator aux(it.m_Ptr->Next);
 
-        it.m_Ptr->Prev = nullptr;
-        it.m_Ptr->Next = m_Unused;
-        m_Unused = it.m_Ptr;
+        RecycleNodes(it.m_Ptr, it.m_Ptr);
 
         return aux;
     }
@@ -1998,6 +2098,8 @@ public:
         }
 
         it.m_Ptr->ClearData();
+        if constexpr (Indexed) { IndexErase(it.m_Ptr); }
+        FingerErase(it.m_Ptr);
 
         --m_Elements;
         it.m_Ptr->Prev->Next = it.m_Ptr->Next;
@@ -2005,9 +2107,7 @@ public:
 
         iterator aux(it.m_Ptr->Next);
 
-        it.m_Ptr->Prev = nullptr;
-        it.m_Ptr->Next = m_Unused;
-        m_Unused = it.m_Ptr;
+        RecycleNodes(it.m_Ptr, it.m_Ptr);
 
         return aux;
     }
@@ -2034,6 +2134,8 @@ public:
         }
 
         it.m_Ptr->ClearData();
+        if constexpr (Indexed) { IndexErase(it.m_Ptr); }
+        FingerErase(it.m_Ptr);
 
         --m_Elements;
         it.m_Ptr->Prev->Next = it.m_Ptr->Next;
@@ -2041,9 +2143,7 @@ public:
 
         reverse_iterator aux(it.m_Ptr->Next);
 
-        it.m_Ptr->Prev = nullptr;
-        it.m_Ptr->Next = m_Unused;
-        m_Unused = it.m_Ptr;
+        RecycleNodes(it.m_Ptr, it.m_Ptr);
 
         return aux;
     }
@@ -2063,19 +2163,20 @@ public:
             it.m_Ptr->ClearData();
         }
 
-        m_LastElement->Next = m_Unused;
-        m_Unused = m_FirstElement;
+        RecycleNodes(m_FirstElement, m_LastElement);
 
         m_FirstElement = nullptr;
         m_LastElement = nullptr;
         m_Head->Next = nullptr;
         m_Tail->Prev = nullptr;
         m_Elements = 0;
+        InvalidateIndex();
     }
 
     /**
     * @brief: Swaps the content of two Lists.
     * @details: If the container is the same as the given, no action will be performed.
+    * The allocators are only swapped if the allocator propagates on swap, otherwise both allocators must be equal.
     *
     * @param: List& -> Other list.
     * @return: void.
@@ -2084,29 +2185,43 @@ public:
     {
         if (&other == this) { return; }
 
+        Propagation::OnSwap(GetAllocatorReference(), other.GetAllocatorReference());
+
         Node* aux_FirstElement = m_FirstElement;
         Node* aux_LastElement = m_LastElement;
         Node* aux_Head = m_Head;
         Node* aux_Tail = m_Tail;
         Node* aux_Unused = m_Unused;
+        SlabPool* aux_Pool = m_Pool;
         size_t aux_Elements = m_Elements;
         size_t aux_Capacity = m_Capacity;
+        Node* aux_Finger = m_Finger;
+        size_t aux_FingerIndex = m_FingerIndex;
+        bool aux_UseFinger = m_UseFinger;
 
         m_FirstElement = other.m_FirstElement;
         m_LastElement = other.m_LastElement;
         m_Head = other.m_Head;
         m_Tail = other.m_Tail;
         m_Unused = other.m_Unused;
+        m_Pool = other.m_Pool;
         m_Elements = other.m_Elements;
         m_Capacity = other.m_Capacity;
+        m_Finger = other.m_Finger;
+        m_FingerIndex = other.m_FingerIndex;
+        m_UseFinger = other.m_UseFinger;
 
         other.m_FirstElement = aux_FirstElement;
         other.m_LastElement = aux_LastElement;
         other.m_Head = aux_Head;
         other.m_Tail = aux_Tail;
         other.m_Unused = aux_Unused;
+        other.m_Pool = aux_Pool;
         other.m_Elements = aux_Elements;
         other.m_Capacity = aux_Capacity;
+        other.m_Finger = aux_Finger;
+        other.m_FingerIndex = aux_FingerIndex;
+        other.m_UseFinger = aux_UseFinger;
     }
 
     /**
@@ -2125,7 +2240,8 @@ public:
 
     /**
     * @brief: Append one list to the end of the current list.
-    * @details: The elements are moved from the given list.
+    * @details: The elements are moved from the given list, the nodes are relinked in constant time and the unused nodes of other are taken too.
+    * If the nodes can not be taken, the elements are moved one by one.
     *
     * @param: List&& -> Other list.
     * @return: void.
@@ -2134,26 +2250,258 @@ public:
     {
         if (&other == this) { return; }
 
-        delete other.m_Head;
-        delete m_Tail;
+        Splice(end(), other);
+        if (!other.m_Unused || !ShareNodes(other)) { return; }
 
-        other.m_FirstElement->Prev = m_LastElement;
-        m_LastElement->Next = other.m_FirstElement;
-        m_Tail = other.m_Tail;
-        m_Elements += other.m_Elements;
+        PushUnused(other.m_Unused, other.m_Unused->Prev);
         m_Capacity += other.m_Capacity;
+        other.m_Unused = nullptr;
+        other.m_Capacity = 0;
+    }
+
+    /**
+    * @brief: Moves all the elements of other before position.
+    * @details: No elements are copied or moved, the nodes are relinked in constant time and other is left empty keeping its unused nodes.
+    * If the allocators are not equal, the elements are moved one by one.
+    *
+    * @param: Iterator -> Position in the container.
+    * @param: List& -> Other list.
+    * @return: void.
+    */
+    void Splice(iterator position, List& other)
+    {
+        if (&other == this || other.IsEmpty()) { return; }
+
+        SpliceNodes(position, other, other.m_FirstElement, other.m_LastElement, other.m_Elements);
+    }
+
+    /**
+    * @brief: Moves all the elements of other before position.
+    *
+    * @param: Iterator -> Position in the container.
+    * @param: List&& -> Other list.
+    * @return: void.
+    */
+    void Splice(iterator position, List&& other) { Splice(position, other); }
+
+    /**
+    * @brief: Moves the element at it from other before position.
+    * @details: The node is relinked in constant time, other can be the container itself.
+    *
+    * @param: Iterator -> Position in the container.
+    * @param: List& -> Other list.
+    * @param: Iterator -> Element of other.
+    * @return: void.
+    */
+    void Splice(iterator position, List& other, iterator it)
+    {
+        Node* node = it.m_Ptr;
+        if (&other == this)
+        {
+            if (node == position.m_Ptr || node->Next == position.m_Ptr) { return; }
+
+            if constexpr (Indexed) { IndexErase(node); }
+            FingerErase(node);
+            UnlinkNodes(node, node);
+            LinkNodes(position.m_Ptr, node, node);
+            if constexpr (Indexed) { IndexInsert(node); }
+            FingerInsert(node);
+            return;
+        }
+
+        SpliceNodes(position, other, node, node, 1);
+    }
+
+    /**
+    * @brief: Moves the elements in the range [first, last) from other before position.
+    * @details: The nodes are relinked in constant time if other is the container itself, otherwise the range is walked once to count its elements.
+    * The position can not be inside the range.
+    *
+    * @param: Iterator -> Position in the container.
+    * @param: List& -> Other list.
+    * @param: Iterator -> First element of the range.
+    * @param: Iterator -> Element after the range.
+    * @return: void.
+    */
+    void Splice(iterator position, List& other, iterator first, iterator last)
+    {
+        if (first == last) { return; }
 
-        Node* aux = m_Unused;
-        Node* prev = nullptr;
-        while (aux)
+        Node* back = last.m_Ptr->Prev;
+        if (&other == this)
         {
-            prev = aux;
-            aux = aux->Next;
+            if (position == first || position == last) { return; }
+
+            UnlinkNodes(first.m_Ptr, back);
+            LinkNodes(position.m_Ptr, first.m_Ptr, back);
+            InvalidateIndex();
+            return;
         }
-        aux = other.m_Unused;
-        if (prev) { prev->Next = aux; }
 
-        other.Default();
+        size_t count = other.m_Elements;
+        if (first.m_Ptr != other.m_FirstElement || back != other.m_LastElement)
+        {
+            count = 1;
+            for (Node* node = first.m_Ptr; node != back; node = node->Next)
+            {
+                ++count;
+            }
+        }
+
+        SpliceNodes(position, other, first.m_Ptr, back, count);
+    }
+
+    /**
+    * @brief: Merges two sorted lists into one, the elements of other are moved into the container.
+    * @details: No elements are copied or moved and no memory is allocated, the nodes of other are spliced and relinked in order.
+    * The merge is stable, for equivalent elements the ones of the container go first.
+    * If the allocators are not equal, the elements of other are moved one by one into new nodes, which invalidates the iterators to other.
+    *
+    * @param: List& -> Other sorted list.
+    * @param: Compare -> Comparison function object, true if the first element goes before the second.
+    * @return: void.
+    */
+    template<typename Compare = std::less<T>>
+    void Merge(List& other, Compare compare = Compare())
+    {
+        if (&other == this || other.IsEmpty()) { return; }
+        if (IsEmpty())
+        {
+            Splice(end(), other);
+            return;
+        }
+
+        Node* last = m_LastElement;
+        Splice(end(), other);
+
+        Node* right = last->Next;
+        last->Next = nullptr;
+        m_LastElement->Next = nullptr;
+        LinkChain(MergeNodes(m_FirstElement, right, compare));
+        InvalidateIndex();
+    }
+
+    /**
+    * @brief: Merges two sorted lists into one, the elements of other are moved into the container.
+    *
+    * @param: List&& -> Other sorted list.
+    * @param: Compare -> Comparison function object, true if the first element goes before the second.
+    * @return: void.
+    */
+    template<typename Compare = std::less<T>>
+    void Merge(List&& other, Compare compare = Compare()) { Merge(other, compare); }
+
+    /**
+    * @brief: Sorts the elements of the container.
+    * @details: Bottom-up merge sort that only relinks the nodes, no elements are copied or moved and no memory is allocated.
+    * The sort is stable, the comparison function object must not throw.
+    *
+    * @param: Compare -> Comparison function object, true if the first element goes before the second.
+    * @return: void.
+    */
+    template<typename Compare = std::less<T>>
+    void Sort(Compare compare = Compare())
+    {
+        if (m_Elements < 2) { return; }
+
+        //Run i holds 2^i nodes or none, runs with a greater index hold older nodes
+        Node* runs[s_SortRuns] = {};
+        size_t used = 0;
+
+        m_LastElement->Next = nullptr;
+        Node* chain = m_FirstElement;
+        while (chain)
+        {
+            Node* run = chain;
+            chain = chain->Next;
+            run->Next = nullptr;
+
+            size_t i = 0;
+            for (; i < used && runs[i]; ++i)
+            {
+                run = MergeNodes(runs[i], run, compare);
+                runs[i] = nullptr;
+            }
+            if (i == used) { ++used; }
+            runs[i] = run;
+        }
+
+        Node* sorted = nullptr;
+        for (size_t i = 0; i < used; ++i)
+        {
+            if (!runs[i]) { continue; }
+            sorted = sorted ? MergeNodes(runs[i], sorted, compare) : runs[i];
+        }
+
+        LinkChain(sorted);
+        InvalidateIndex();
+    }
+
+    /**
+    * @brief: Removes the consecutive equivalent elements, only the first element of each group is kept.
+    * @details: No reallocations are performed, the removed nodes go to the unused nodes.
+    *
+    * @param: Predicate -> Binary predicate, true if both elements are equivalent.
+    * @return: size_t -> Number of removed elements.
+    */
+    template<typename Predicate = std::equal_to<T>>
+    size_t Unique(Predicate predicate = Predicate())
+    {
+        if (m_Elements < 2) { return 0; }
+
+        InvalidateIndex();
+
+        size_t removed = 0;
+        Node* kept = m_FirstElement;
+        Node* node = kept->Next;
+        while (node != m_Tail)
+        {
+            Node* next = node->Next;
+            if (predicate(*kept->Data, *node->Data))
+            {
+                kept->Next = next;
+                next->Prev = kept;
+                if (node == m_LastElement) { m_LastElement = kept; }
+
+                node->ClearData();
+                RecycleNodes(node, node);
+                --m_Elements;
+                ++removed;
+            }
+            else { kept = node; }
+            node = next;
+        }
+
+        return removed;
+    }
+
+    /**
+    * @brief: Reverses the order of the elements.
+    * @details: No elements are copied or moved, the links of each node are swapped.
+    *
+    * @return: void.
+    */
+    void Reverse() noexcept
+    {
+        if (m_Elements < 2) { return; }
+
+        //After the swap, Prev is the next node in the old order
+        for (Node* node = m_FirstElement; node != m_Tail; node = node->Prev)
+        {
+            Node* next = node->Next;
+            node->Next = node->Prev;
+            node->Prev = next;
+        }
+
+        Node* first = m_LastElement;
+        m_LastElement = m_FirstElement;
+        m_FirstElement = first;
+
+        m_FirstElement->Prev = m_Head;
+        m_Head->Next = m_FirstElement;
+        m_LastElement->Next = m_Tail;
+        m_Tail->Prev = m_LastElement;
+        InvalidateIndex();
     }
 
     //Capacity
@@ -2166,14 +2514,46 @@ public:
     */
     void Shrink() noexcept
     {
-        while (m_Unused)
-        {
-            Node* current = m_Unused;
-            m_Unused = m_Unused->Next;
-            --m_Capacity;
-            (*current).~Node();
-            ::operator delete(current, sizeof(Node) + sizeof(T));
-        };
+        if (!m_Unused) { return; }
+
+        ReleaseNodes(m_Unused);
+        m_Unused = nullptr;
+        m_Capacity = m_Elements;
+    }
+
+    /**
+    * @brief: Moves the elements to new nodes laid out in memory in the order of the container.
+    * @details: The unused nodes are released first, then every element is moved to a node carved from new slabs,
+    * and the old nodes are released, so the slabs left empty by them go back to the allocator.
+    * Invalidates all the iterators, pointers and references to the elements.
+    * Can throw exceptions (Typically std::bad_alloc), if so the elements moved keep their new nodes and the container stays valid.
+    *
+    * @return: void.
+    */
+    void Defragment()
+    {
+        Shrink();
+        if (IsEmpty()) { return; }
+
+        RelocateNodes(m_FirstElement, m_Elements);
+    }
+
+    /**
+    * @brief: Moves up to budget elements to new nodes laid out in memory in the order of the container, starting at position.
+    * @details: Incremental version of Defragment, to spread the work over several calls. A call that starts at begin() also releases the unused nodes.
+    * Invalidates the iterators, pointers and references to the moved elements, the returned iterator stays valid.
+    * Can throw exceptions (Typically std::bad_alloc), if so the elements moved keep their new nodes and the container stays valid.
+    *
+    * @param: iterator -> First element to move.
+    * @param: size_t -> Maximum number of elements to move.
+    * @return: iterator -> Element to continue from in the next call, end() once the whole container has been defragmented.
+    */
+    iterator Defragment(iterator position, size_t budget)
+    {
+        if (position == end() || budget == 0) { return position; }
+        if (position == begin()) { Shrink(); }
+
+        return iterator(RelocateNodes(position.m_Ptr, budget));
     }
 
     /**
@@ -2194,6 +2574,12 @@ public:
 
         size_t diff = capacity - m_Capacity;
 
+        if constexpr (s_UseSlabs)
+        {
+            //The new nodes are carved from a single slab when possible
+            if (!m_Pool || (m_Pool->Cursor == m_Pool->End && !m_Pool->FreeSlabs)) { AddSlab(diff); }
+        }
+
         Node* new_node = CreateNode();
         Node* start = new_node;
 
@@ -2203,11 +2589,7 @@ public:
             new_node = new_node->Next;
         }
 
-        if (m_Unused)
-        {
-            new_node->Next = m_Unused;
-        }
-        m_Unused = start;
+        PushUnused(start, new_node);
     }
 
     /**
@@ -2308,29 +2690,76 @@ public:
     /**
     * @brief: Returns an iterator at the given index.
     * @details: std::exception execption will be thrown if the index is out of range.
+    * The walk starts at the nearest of the first element, the last element and the finger if it is enabled.
+    * An indexed list finds the node through its position tree in logarithmic time.
     *
     * @return: Iterator -> Iterator.
     */
     _NODISCARD iterator GetIteratorAtIndex(size_t index)
     {
-        iterator it;
-        if (index < (m_Elements >> 1))
+        if constexpr (Indexed)
         {
-            it = begin();
-            it += index;
+            if (index >= m_Elements) { ListOutOfRangeError(); }
+            if (!m_Head->Left) { RebuildIndex(); }
+
+            return iterator(SelectIndexNode(index));
         }
-        else
+
+        if (index >= m_Elements) { ListOutOfRangeError(); }
+
+        Node* node = m_FirstElement;
+        size_t position = 0;
+        size_t distance = index;
+        if (m_Elements - 1 - index < distance)
         {
-            if (index >= m_Elements) { ListOutOfRangeError(); }
+            node = m_LastElement;
+            position = m_Elements - 1;
+            distance = position - index;
+        }
+        if (m_Finger)
+        {
+            const size_t finger_distance = index > m_FingerIndex ? index - m_FingerIndex : m_FingerIndex - index;
+            if (finger_distance < distance)
+            {
+                node = m_Finger;
+                position = m_FingerIndex;
+            }
+        }
+
+        for (; position < index; ++position) { node = node->Next; }
+        for (; position > index; --position) { node = node->Prev; }
 
-            size_t diff = m_Elements - index;
-            it = end();
-            it -= diff;
+        if (m_UseFinger)
+        {
+            m_Finger = node;
+            m_FingerIndex = index;
         }
 
-        return it;
+        return iterator(node);
+    }
+
+    /**
+    * @brief: Enables or disables the finger, the last node found by index.
+    * @details: With the finger, an access by index close to the previous one walks only the distance between both,
+    * so near-sequential access by index takes amortized constant time. The finger follows the inserts and erases next to it or at the ends,
+    * other modifications drop it until the next access by index. An IndexedList ignores the finger.
+    *
+    * @param: bool -> True to enable the finger.
+    * @return: void.
+    */
+    void EnableFinger(bool enable = true) noexcept
+    {
+        m_UseFinger = enable;
+        if (!enable) { m_Finger = nullptr; }
     }
 
+    /**
+    * @brief: Checks if the finger is enabled.
+    *
+    * @return: bool -> True if the finger is enabled.
+    */
+    _NODISCARD bool IsFingerEnabled() const noexcept { return m_UseFinger; }
+
     /**
     * @brief: Returns a pointer to the container data.
     *
@@ -2345,6 +2774,113 @@ public:
     */
     _NODISCARD const Node* Data() const noexcept { return m_FirstElement; }
 
+    //Traversal
+public:
+    /**
+    * @brief: Calls function with every element of the container in order.
+    * @details: A second cursor runs s_PrefetchDistance nodes ahead and prefetches them,
+    * so the nodes are already in cache when function reaches them and the misses overlap with the work of function.
+    *
+    * @param: Function -> Function that takes a T&.
+    * @return: void.
+    */
+    template<typename Function>
+    void ForEach(Function function)
+    {
+        if (IsEmpty()) { return; }
+        VisitNodes(m_FirstElement, m_Tail, [&function](Node* node) { function(*node->Data); });
+    }
+
+    /**
+    * @brief: Calls function with every element of the container in order.
+    * @details: A second cursor runs s_PrefetchDistance nodes ahead and prefetches them,
+    * so the nodes are already in cache when function reaches them and the misses overlap with the work of function.
+    *
+    * @param: Function -> Function that takes a const T&.
+    * @return: void.
+    */
+    template<typename Function>
+    void ForEach(Function function) const
+    {
+        if (IsEmpty()) { return; }
+        VisitNodes(m_FirstElement, m_Tail, [&function](Node* node) { function(static_cast<const T&>(*node->Data)); });
+    }
+
+    /**
+    * @brief: Calls function with batches of up to batch consecutive elements, in order.
+    * @details: The elements of a batch are gathered and prefetched before function is called,
+    * so function can work on independent elements at once. The batch is clamped between 1 and s_MaxBatch.
+    *
+    * @param: Function -> Function that takes a T* const* with the elements and a size_t with their number.
+    * @param: size_t -> Elements of each batch.
+    * @return: void.
+    */
+    template<typename Function>
+    void ForEachBatch(Function function, size_t batch = s_MaxBatch)
+    {
+        if (IsEmpty()) { return; }
+        if (batch == 0) { batch = 1; }
+        if (batch > s_MaxBatch) { batch = s_MaxBatch; }
+
+        T* elements[s_MaxBatch];
+        size_t count = 0;
+        VisitNodes(m_FirstElement, m_Tail, [&](Node* node)
+        {
+            elements[count++] = node->Data;
+            if (count == batch)
+            {
+                function(static_cast<T* const*>(elements), count);
+                count = 0;
+            }
+        });
+        if (count != 0) { function(static_cast<T* const*>(elements), count); }
+    }
+
+    /**
+    * @brief: Calls function with every element, walking several sub-ranges of the container at once.
+    * @details: The sub-ranges go from each start to the next one, and from the last one to the end.
+    * One element of each sub-range is visited per round, so the misses of the independent chains of nodes overlap.
+    * The elements of different sub-ranges are visited interleaved, only the order inside each sub-range is kept.
+    * Every start must be an element of the container or end(), and the starts must be in the order of the container.
+    *
+    * @param: Function -> Function that takes a T&.
+    * @param: const iterator* -> Starts of the sub-ranges, usually the first one is begin().
+    * @param: size_t -> Number of sub-ranges.
+    * @return: void.
+    */
+    template<typename Function>
+    void ForEachInterleaved(Function function, const iterator* starts, size_t count)
+    {
+        Node* cursors[s_MaxCursors];
+        Node* ends[s_MaxCursors];
+
+        for (size_t group = 0; group < count; group += s_MaxCursors)
+        {
+            const size_t cursors_count = count - group < s_MaxCursors ? count - group : s_MaxCursors;
+            size_t active = 0;
+            for (size_t i = 0; i < cursors_count; ++i)
+            {
+                cursors[i] = starts[group + i].m_Ptr;
+                ends[i] = group + i + 1 < count ? starts[group + i + 1].m_Ptr : m_Tail;
+                if (cursors[i] != ends[i]) { ++active; }
+            }
+
+            while (active != 0)
+            {
+                for (size_t i = 0; i < cursors_count; ++i)
+                {
+                    Node* node = cursors[i];
+                    if (node == ends[i]) { continue; }
+
+                    cursors[i] = node->Next;
+                    Prefetch(cursors[i]);
+                    function(*node->Data);
+                    if (cursors[i] == ends[i]) { --active; }
+                }
+            }
+        }
+    }
+
     //Iterators
 public:
     /**
@@ -2352,21 +2888,21 @@ public:
     *
     * @return: Iterator -> Iterator.
     */
-    _NODISCARD __forceinline iterator begin() noexcept { return iterator(m_FirstElement); }
+    _NODISCARD __forceinline iterator begin() noexcept { return iterator(m_Elements ? m_FirstElement : m_Tail); }
 
     /**
     * @brief: Returns a const iterator to the begin of the container.
     *
     * @return: ConstIterator -> Iterator.
     */
-    _NODISCARD __forceinline const_iterator begin() const noexcept { return const_iterator(m_FirstElement); }
+    _NODISCARD __forceinline const_iterator begin() const noexcept { return const_iterator(m_Elements ? m_FirstElement : m_Tail); }
 
     /**
     * @brief: Returns a const iterator to the begin of the container.
     *
     * @return: ConstIterator -> Iterator.
     */
-    _NODISCARD __forceinline const_iterator cbegin() const noexcept { return const_iterator(m_FirstElement); }
+    _NODISCARD __forceinline const_iterator cbegin() const noexcept { return const_iterator(m_Elements ? m_FirstElement : m_Tail); }
 
     /**
     * @brief: Returns an iterator to the end of the container.
@@ -2398,7 +2934,7 @@ public:
     *
     * @return: ReverseIterator -> Iterator.
     */
-    _NODISCARD __forceinline reverse_iterator rbegin() noexcept { return reverse_iterator(m_LastElement); }
+    _NODISCARD __forceinline reverse_iterator rbegin() noexcept { return reverse_iterator(m_Elements ? m_LastElement : m_Head); }
 
     /**
     * @brief: Returns a const reverse iterator to the end of the container.
@@ -2406,7 +2942,7 @@ public:
     *
     * @return: ConstReverseIterator -> Iterator.
     */
-    _NODISCARD __forceinline const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(m_LastElement); }
+    _NODISCARD __forceinline const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(m_Elements ? m_LastElement : m_Head); }
 
     /**
     * @brief: Returns a const reverse iterator to the end of the container.
@@ -2414,7 +2950,7 @@ public:
     *
     * @return: ConstReverseIterator -> Iterator.
     */
-    _NODISCARD __forceinline const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(m_LastElement); }
+    _NODISCARD __forceinline const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(m_Elements ? m_LastElement : m_Head); }
 
     /**
     * @brief: Returns a reverse iterator to the begin of the container.
@@ -2447,16 +2983,31 @@ public:
         Init();
     }
 
+    explicit List(const Allocator& allocator) :
+        AllocatorBase(allocator)
+    {
+        Init();
+    }
+
     explicit List(size_t capacity)
     {
         Init();
         Reserve(capacity);
     }
 
-    List(const List& other)
+    List(size_t capacity, const Allocator& allocator) :
+        AllocatorBase(allocator)
     {
         Init();
-
+        Reserve(capacity);
+    }
+
+    List(const List& other) :
+        AllocatorBase(Propagation::OnCopyConstruction(other.GetAllocatorReference())),
+        m_UseFinger(other.m_UseFinger)
+    {
+        Init();
+
         if (other.IsEmpty()) { return; }
 
         Reserve(other.m_Elements);
@@ -2464,13 +3015,16 @@ public:
     }
 
     List(List&& other) :
+        AllocatorBase(std::move(other.GetAllocatorReference())),
         m_FirstElement(other.m_FirstElement),
         m_LastElement(other.m_LastElement),
         m_Head(other.m_Head),
         m_Tail(other.m_Tail),
         m_Unused(other.m_Unused),
+        m_Pool(other.m_Pool),
         m_Elements(other.m_Elements),
-        m_Capacity(other.m_Capacity)
+        m_Capacity(other.m_Capacity),
+        m_UseFinger(other.m_UseFinger)
     {
         other.Default();
     }
@@ -2486,6 +3040,18 @@ public:
         }
     }
 
+    List(std::initializer_list<T>&& list, const Allocator& allocator) :
+        AllocatorBase(allocator)
+    {
+        Init();
+        Reserve(list.size());
+
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            PushBack(std::move(*it));
+        }
+    }
+
     ~List() noexcept
     {
         Nullify();
@@ -2494,6 +3060,16 @@ public:
     List& operator=(const List& other) noexcept
     {
         Clear();
+        if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value)
+        {
+            if (!Propagation::AreEqual(GetAllocatorReference(), other.GetAllocatorReference()))
+            {
+                //The nodes must be released by the allocator that created them
+                Nullify();
+                Propagation::OnCopyAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+                Init();
+            }
+        }
 
         if (other.IsEmpty()) { return *this; }
 
@@ -2510,17 +3086,30 @@ public:
         return *this;
     }
 
-    List& operator=(List&& other) noexcept
+    List& operator=(List&& other) noexcept(Propagation::s_AlwaysTakesMemory)
     {
         Nullify();
+        if (!Propagation::CanTakeMemory(GetAllocatorReference(), other.GetAllocatorReference()))
+        {
+            //The nodes of other can not be released by this allocator, the elements are moved one by one
+            Init();
+            Append(std::move(other));
+            return *this;
+        }
 
-        if (other.IsEmpty()) { return *this; }
+        Propagation::OnMoveAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        if (other.IsEmpty())
+        {
+            Init();
+            return *this;
+        }
 
         m_FirstElement = other.m_FirstElement;
         m_LastElement = other.m_LastElement;
         m_Head = other.m_Head;
         m_Tail = other.m_Tail;
         m_Unused = other.m_Unused;
+        m_Pool = other.m_Pool;
         m_Elements = other.m_Elements;
         m_Capacity = other.m_Capacity;
 
@@ -2546,6 +3135,13 @@ public:
         return *this;
     }
 
+    /**
+    * @brief: Returns a copy of the allocator used by the container.
+    *
+    * @return: Allocator -> Allocator.
+    */
+    _NODISCARD __forceinline Allocator GetAllocator() const noexcept { return GetAllocatorReference(); }
+
     //Non-member functions
 public:
     _NODISCARD __forceinline bool operator==(const List& other) const noexcept
@@ -2559,7 +3155,7 @@ public:
         return true;
     }
 
-    _NODISCARD __forceinline bool operator!=(const List& other) const noexcept { return !(this == other); }
+    _NODISCARD __forceinline bool operator!=(const List& other) const noexcept { return !(*this == other); }
 
     _NODISCARD __forceinline bool operator<(const List& other) const noexcept { return Size() < other.Size() ? true : false; }
 
@@ -2581,7 +3177,7 @@ private:
     Node* CreateNode()
     {
         Node* memory_block = nullptr;
-        try { memory_block = (Node*)::operator new(sizeof(Node) + sizeof(T)); }
+        try { memory_block = AllocateNode(); }
         catch (...)
         {
             ListBadAllocationError();
@@ -2595,7 +3191,7 @@ private:
     Node* CreateNode(const T& element)
     {
         Node* memory_block = nullptr;
-        try { memory_block = (Node*)::operator new(sizeof(Node) + sizeof(T)); }
+        try { memory_block = AllocateNode(); }
         catch (...)
         {
             ListBadAllocationError();
@@ -2610,7 +3206,7 @@ private:
     Node* CreateNode(T&& element)
     {
         Node* memory_block = nullptr;
-        try { memory_block = (Node*)::operator new(sizeof(Node) + sizeof(T)); }
+        try { memory_block = AllocateNode(); }
         catch (...)
         {
             ListBadAllocationError();
@@ -2626,7 +3222,7 @@ private:
     Node* CreateNode(Args&&... args)
     {
         Node* memory_block = nullptr;
-        try { memory_block = (Node*)::operator new(sizeof(Node) + sizeof(T)); }
+        try { memory_block = AllocateNode(); }
         catch (...)
         {
             ListBadAllocationError();
@@ -2645,8 +3241,430 @@ private:
         --m_Elements;
         --m_Capacity;
 
+        FreeNode(node);
+    }
+
+    /**
+    * @brief: Returns the memory for a new node.
+    * @details: Free nodes of the slabs are reused first, otherwise the node is carved from the newest slab.
+    * If the element is too big for the slabs, each node is allocated on its own.
+    *
+    * @return: Node* -> Uninitialized node.
+    */
+    _NODISCARD __forceinline Node* AllocateNode()
+    {
+        if constexpr (s_UseSlabs)
+        {
+            SlabPool* pool = m_Pool;
+            if (pool)
+            {
+                if (pool->FreeSlabs) { return TakeFreeNode(); }
+                if (pool->Cursor != pool->End) { return CarveBlock(); }
+            }
+
+            AddSlab(m_Capacity);
+            return CarveBlock();
+        }
+        else
+        {
+            BlockAllocator allocator(GetAllocatorReference());
+            return reinterpret_cast<Node*>(BlockTraits::allocate(allocator, 1));
+        }
+    }
+
+    __forceinline void FreeNode(Node* node) noexcept
+    {
+        if constexpr (s_UseSlabs)
+        {
+            node->ClearData();
+            node->Next = nullptr;
+            ReleaseNodes(node);
+        }
+        else
+        {
+            (*node).~Node();
+            BlockAllocator allocator(GetAllocatorReference());
+            BlockTraits::deallocate(allocator, reinterpret_cast<NodeBlock*>(node), 1);
+        }
+    }
+
+    /**
+    * @brief: Frees a chain of unused nodes.
+    * @details: With slabs the nodes go to the free nodes of their slab, the nodes carved by other containers are returned to their slab instead.
+    * The slabs left with all their carved nodes free are released.
+    *
+    * @param: Node* -> First node of the chain, linked through Next and ended by nullptr.
+    * @return: void.
+    */
+    void ReleaseNodes(Node* first) noexcept
+    {
+        if constexpr (s_UseSlabs)
+        {
+            SlabPool* pool = m_Pool;
+            while (first)
+            {
+                Node* node = first;
+                first = first->Next;
+
+                Slab* slab = HomeSlab(node);
+                (*node).~Node();
+                if (!pool || slab->Owner != pool->Id)
+                {
+                    ReturnNode(slab);
+                    continue;
+                }
+
+                Node* free_node = new (node) Node();
+                free_node->Next = slab->Free;
+                slab->Free = free_node;
+                ++slab->FreeNodes;
+            }
+
+            if (!pool || !pool->Slabs) { return; }
+
+            size_t slabs = 0;
+            Slab* slab = pool->Slabs;
+            do
+            {
+                slab = slab->Next;
+                ++slabs;
+            } while (slab != pool->Slabs);
+
+            //Rebuilds both lists in the same order, dropping the empty slabs
+            slab = pool->Slabs->Next;
+            pool->Slabs = nullptr;
+            pool->FreeSlabs = nullptr;
+            for (size_t i = 0; i < slabs; ++i)
+            {
+                Slab* next = slab->Next;
+                if (IsSlabEmpty(slab))
+                {
+                    if (pool->End == FirstBlock(slab) + slab->Nodes)
+                    {
+                        pool->Cursor = nullptr;
+                        pool->End = nullptr;
+                    }
+                    FreeSlab(slab);
+                }
+                else
+                {
+                    LinkSlab(slab);
+                    if (slab->FreeNodes)
+                    {
+                        slab->NextFree = pool->FreeSlabs;
+                        pool->FreeSlabs = slab;
+                    }
+                }
+                slab = next;
+            }
+        }
+        else
+        {
+            while (first)
+            {
+                Node* node = first;
+                first = first->Next;
+                FreeNode(node);
+            }
+        }
+    }
+
+    /**
+    * @brief: Moves the elements of count nodes, from first, to new nodes carved one after the other.
+    * @details: With slabs the nodes are never taken from the free nodes of the slabs, only from the current slab and new ones.
+    * The old nodes are released together at the end.
+    *
+    * @param: Node* -> First node to move.
+    * @param: size_t -> Maximum number of nodes to move.
+    * @return: Node* -> Node after the last moved one, m_Tail if the end was reached.
+    */
+    Node* RelocateNodes(Node* first, size_t count)
+    {
+        Node* old_nodes = nullptr;
+        Node* node = first;
+        try
+        {
+            for (size_t i = 0; i < count && node != m_Tail; ++i)
+            {
+                Node* next = node->Next;
+                Node* moved = new (CarveNode(count - i < m_Elements ? count - i : m_Elements)) Node(std::move(*node->Data));
+                moved->Prev = node->Prev;
+                moved->Next = next;
+                moved->Prev->Next = moved;
+                next->Prev = moved;
+                if (node == m_FirstElement) { m_FirstElement = moved; }
+                if (node == m_LastElement) { m_LastElement = moved; }
+
+                node->ClearData();
+                node->Next = old_nodes;
+                old_nodes = node;
+                node = next;
+            }
+        }
+        catch (...)
+        {
+            InvalidateIndex();
+            if (old_nodes) { ReleaseNodes(old_nodes); }
+            throw;
+        }
+
+        InvalidateIndex();
+        if (old_nodes) { ReleaseNodes(old_nodes); }
+        return node;
+    }
+
+    /**
+    * @brief: Returns the memory for a new node placed right after the previous one carved.
+    * @details: A new slab is added for the remaining nodes once the current slab is full.
+    * If the element is too big for the slabs, each node is allocated on its own.
+    *
+    * @param: size_t -> Nodes still to carve, used as the size of a new slab.
+    * @return: Node* -> Uninitialized node.
+    */
+    _NODISCARD Node* CarveNode(size_t remaining)
+    {
+        if constexpr (s_UseSlabs)
+        {
+            if (!m_Pool || m_Pool->Cursor == m_Pool->End) { AddSlab(remaining); }
+            return CarveBlock();
+        }
+        else
+        {
+            BlockAllocator allocator(GetAllocatorReference());
+            Node* node = nullptr;
+            try { node = reinterpret_cast<Node*>(BlockTraits::allocate(allocator, 1)); }
+            catch (...) { ListBadAllocationError(); }
+            return node;
+        }
+    }
+
+    /**
+    * @brief: Calls visit with every node from first to last, not included, prefetching the nodes s_PrefetchDistance positions ahead.
+    *
+    * @param: Node* -> First node.
+    * @param: Node* -> Node after the last one.
+    * @param: Visitor -> Function that takes a Node*.
+    * @return: void.
+    */
+    template<typename Visitor>
+    static __forceinline void VisitNodes(Node* first, Node* last, Visitor visit)
+    {
+        Node* ahead = first;
+        for (size_t i = 0; i < s_PrefetchDistance && ahead != last; ++i)
+        {
+            ahead = ahead->Next;
+            Prefetch(ahead);
+        }
+
+        for (Node* node = first; node != last;)
+        {
+            if (ahead != last)
+            {
+                ahead = ahead->Next;
+                Prefetch(ahead);
+            }
+
+            Node* next = node->Next;
+            visit(node);
+            node = next;
+        }
+    }
+
+    static __forceinline void Prefetch(const Node* node) noexcept { _mm_prefetch(reinterpret_cast<const char*>(node), _MM_HINT_T0); }
+
+    _NODISCARD static __forceinline NodeBlock* FirstBlock(Slab* slab) noexcept
+    {
+        return reinterpret_cast<NodeBlock*>(slab) + s_SlabHeaderBlocks;
+    }
+
+    _NODISCARD __forceinline size_t CarvedNodes(Slab* slab) const noexcept
+    {
+        NodeBlock* first = FirstBlock(slab);
+        return m_Pool->End == first + slab->Nodes ? (size_t)(m_Pool->Cursor - first) : slab->Nodes;
+    }
+
+    _NODISCARD static __forceinline Slab* HomeSlab(Node* node) noexcept { return reinterpret_cast<NodeBlock*>(node)->Home; }
+
+    /**
+    * @brief: Checks if all the nodes carved from a slab of the container are free.
+    * @details: The nodes returned by other containers count as free, they are only reused once the whole slab is released.
+    *
+    * @param: Slab* -> Slab of the container.
+    * @return: bool -> True if the slab can be released.
+    */
+    _NODISCARD __forceinline bool IsSlabEmpty(Slab* slab) const noexcept
+    {
+        return slab->FreeNodes + (size_t)(-slab->Balance.load(std::memory_order_acquire)) == CarvedNodes(slab);
+    }
+
+    _NODISCARD __forceinline Node* CarveBlock() noexcept
+    {
+        NodeBlock* block = m_Pool->Cursor++;
+        block->Home = m_Pool->Slabs;
+        return reinterpret_cast<Node*>(block);
+    }
+
+    /**
+    * @brief: Returns a node carved by another container to its slab.
+    * @details: While the owner is alive the node is only counted, the last node returned after the owner is gone releases the slab.
+    *
+    * @param: Slab* -> Slab of the node.
+    * @return: void.
+    */
+    __forceinline void ReturnNode(Slab* slab) noexcept
+    {
+        if (slab->Balance.fetch_sub(1, std::memory_order_acq_rel) == 1) { FreeSlab(slab); }
+    }
+
+    _NODISCARD static uint64_t NextPoolId() noexcept
+    {
+        static std::atomic<uint64_t> s_PoolIds(0);
+        return s_PoolIds.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    /**
+    * @brief: Allocates a new slab and makes it the one the nodes are carved from.
+    * @details: The pool of the container is created with its first slab.
+    *
+    * @param: size_t -> Requested nodes, clamped between the minimum and the maximum nodes of a slab.
+    * @return: void.
+    */
+    void AddSlab(size_t nodes)
+    {
+        if (nodes < s_MinSlabNodes) { nodes = s_MinSlabNodes; }
+        if (nodes > s_MaxSlabNodes) { nodes = s_MaxSlabNodes; }
+
+        if (!m_Pool)
+        {
+            PoolAllocator pool_allocator(GetAllocatorReference());
+            try { m_Pool = PoolTraits::allocate(pool_allocator, 1); }
+            catch (...)
+            {
+                ListBadAllocationError();
+                return;
+            }
+            new (m_Pool) SlabPool();
+            m_Pool->Id = NextPoolId();
+            //Without a pool, the nodes the container already holds were carved by other containers
+            m_Pool->Shared = m_Capacity != 0;
+        }
+
+        BlockAllocator allocator(GetAllocatorReference());
+        NodeBlock* blocks = nullptr;
+        try { blocks = BlockTraits::allocate(allocator, s_SlabHeaderBlocks + nodes); }
+        catch (...)
+        {
+            ListBadAllocationError();
+            return;
+        }
+
+        Slab* slab = new (blocks) Slab();
+        slab->Nodes = nodes;
+        slab->Blocks = s_SlabHeaderBlocks + nodes;
+        slab->Owner = m_Pool->Id;
+        LinkSlab(slab);
+
+        m_Pool->Cursor = FirstBlock(slab);
+        m_Pool->End = m_Pool->Cursor + nodes;
+    }
+
+    __forceinline void LinkSlab(Slab* slab) noexcept
+    {
+        if (m_Pool->Slabs)
+        {
+            slab->Next = m_Pool->Slabs->Next;
+            m_Pool->Slabs->Next = slab;
+        }
+        else { slab->Next = slab; }
+        m_Pool->Slabs = slab;
+    }
+
+    _NODISCARD __forceinline Node* TakeFreeNode() noexcept
+    {
+        Slab* slab = m_Pool->FreeSlabs;
+        Node* node = slab->Free;
+        slab->Free = node->Next;
+        --slab->FreeNodes;
+        if (!slab->Free)
+        {
+            m_Pool->FreeSlabs = slab->NextFree;
+            slab->NextFree = nullptr;
+        }
+
         (*node).~Node();
-        ::operator delete(node, sizeof(Node) + sizeof(T));
+        return node;
+    }
+
+    /**
+    * @brief: Hands a slab over to the nodes still held by other containers.
+    * @details: The carved nodes that are not free are added to Balance, the nodes already returned take it back to zero.
+    *
+    * @param: Slab* -> Slab of the container.
+    * @return: bool -> True if no other container holds nodes of the slab, so it can be released.
+    */
+    _NODISCARD __forceinline bool DropOwnership(Slab* slab) noexcept
+    {
+        ptrdiff_t held = (ptrdiff_t)(CarvedNodes(slab) - slab->FreeNodes);
+        return held == 0 || slab->Balance.fetch_add(held, std::memory_order_acq_rel) + held == 0;
+    }
+
+    __forceinline void FreePool(SlabPool* pool) noexcept
+    {
+        (*pool).~SlabPool();
+        PoolAllocator allocator(GetAllocatorReference());
+        PoolTraits::deallocate(allocator, pool, 1);
+    }
+
+    __forceinline void FreeSlab(Slab* slab) noexcept
+    {
+        size_t blocks = slab->Blocks;
+        (*slab).~Slab();
+        BlockAllocator allocator(GetAllocatorReference());
+        BlockTraits::deallocate(allocator, reinterpret_cast<NodeBlock*>(slab), blocks);
+    }
+
+    /**
+    * @brief: Releases the slabs and the pool of the container.
+    * @details: If the pool is shared, the nodes of the container must be already released,
+    * the slabs with nodes still held by other containers are left to the last of them.
+    *
+    * @return: void.
+    */
+    void ReleaseSlabs() noexcept
+    {
+        if (!m_Pool) { return; }
+
+        if (m_Pool->Slabs)
+        {
+            Slab* slab = m_Pool->Slabs->Next;
+            m_Pool->Slabs->Next = nullptr;
+            while (slab)
+            {
+                Slab* next = slab->Next;
+                if (!m_Pool->Shared || DropOwnership(slab)) { FreeSlab(slab); }
+                slab = next;
+            }
+        }
+
+        FreePool(m_Pool);
+        m_Pool = nullptr;
+    }
+
+    _NODISCARD __forceinline Node* CreateSentinel()
+    {
+        SentinelAllocator allocator(GetAllocatorReference());
+        Node* sentinel = SentinelTraits::allocate(allocator, 1);
+        new (sentinel) Node();
+        return sentinel;
+    }
+
+    __forceinline void FreeSentinel(Node* sentinel) noexcept
+    {
+        if (!sentinel) { return; }
+
+        (*sentinel).~Node();
+        SentinelAllocator allocator(GetAllocatorReference());
+        SentinelTraits::deallocate(allocator, sentinel, 1);
     }
 
     __forceinline void Assign(Node* node, const T& element) noexcept
@@ -2670,14 +3688,50 @@ private:
 
     __forceinline void Nullify() noexcept
     {
+        if constexpr (s_SkipTeardown)
+        {
+            //The allocator releases all the memory at once and the elements need no destructor
+            return Default();
+        }
+
+        if constexpr (s_UseSlabs)
+        {
+            if (!m_Pool || m_Pool->Shared)
+            {
+                //Some nodes may come from the slabs of other containers, each node is returned to its own slab
+                Clear();
+                if (m_Unused) { ReleaseNodes(m_Unused); }
+                ReleaseSlabs();
+            }
+            else
+            {
+                //Only the elements are destroyed one by one, the nodes are released with their slabs
+                if constexpr (!std::is_trivially_destructible<T>::value)
+                {
+                    if (!IsEmpty())
+                    {
+                        for (Node* node = m_FirstElement; node != m_Tail; node = node->Next)
+                        {
+                            node->ClearData();
+                        }
+                    }
+                }
+                ReleaseSlabs();
+            }
+
+            FreeSentinel(m_Head);
+            FreeSentinel(m_Tail);
+
+            return Default();
+        }
+
         if (!IsEmpty())
         {
             while (m_FirstElement != m_Tail)
             {
                 Node* node = m_FirstElement;
                 m_FirstElement = m_FirstElement->Next;
-                (*node).~Node();
-                ::operator delete(node, sizeof(Node) + sizeof(T));
+                FreeNode(node);
             }
         }
 
@@ -2685,12 +3739,11 @@ private:
         {
             Node* node = m_Unused;
             m_Unused = m_Unused->Next;
-            (*node).~Node();
-            ::operator delete(node, sizeof(Node) + sizeof(T));
+            FreeNode(node);
         }
 
-        delete m_Head;
-        delete m_Tail;
+        FreeSentinel(m_Head);
+        FreeSentinel(m_Tail);
 
         Default();
     }
@@ -2702,16 +3755,18 @@ private:
         m_Head = nullptr;
         m_Tail = nullptr;
         m_Unused = nullptr;
+        m_Pool = nullptr;
         m_Elements = 0;
         m_Capacity = 0;
+        m_Finger = nullptr;
     }
 
     void Init()
     {
         try
         {
-            m_Head = new Node();
-            m_Tail = new Node();
+            m_Head = CreateSentinel();
+            m_Tail = CreateSentinel();
         }
         catch (...)
         {
@@ -2723,16 +3778,61 @@ private:
     {
         Node* node = m_Unused;
         m_Unused = m_Unused->Next;
+        if (m_Unused) { m_Unused->Prev = node->Prev; }
         node->Next = nullptr;
         return node;
     }
 
+    /**
+    * @brief: Adds a chain of nodes to the front of the unused nodes.
+    * @details: The first unused node keeps the last one in its Prev, so whole chains are joined in constant time.
+    *
+    * @param: Node* -> First node of the chain.
+    * @param: Node* -> Last node of the chain.
+    * @return: void.
+    */
+    __forceinline void PushUnused(Node* first, Node* last) noexcept
+    {
+        last->Next = m_Unused;
+        first->Prev = m_Unused ? m_Unused->Prev : last;
+        m_Unused = first;
+    }
+
+    __forceinline void PushUnused(Node* node) noexcept { PushUnused(node, node); }
+
+    /**
+    * @brief: Keeps the nodes from first to last, both included, of erased elements as unused nodes.
+    * @details: With a node pool allocator the nodes go straight back to the pool instead, so any container can reuse them.
+    *
+    * @param: Node* -> First node of the chain.
+    * @param: Node* -> Last node of the chain.
+    * @return: void.
+    */
+    __forceinline void RecycleNodes(Node* first, Node* last) noexcept
+    {
+        if constexpr (IsNodePoolAllocator<Allocator>::value)
+        {
+            last->Next = nullptr;
+            while (first)
+            {
+                Node* node = first;
+                first = first->Next;
+                FreeNode(node);
+                --m_Capacity;
+            }
+        }
+        else { PushUnused(first, last); }
+    }
+
     __forceinline void UpdateLastNode() noexcept
     {
         m_LastElement->Next->Prev = m_LastElement;
         m_LastElement = m_LastElement->Next;
         m_LastElement->Next = m_Tail;
         m_Tail->Prev = m_LastElement;
+
+        if constexpr (Indexed) { IndexInsert(m_LastElement); }
+        FingerInsert(m_LastElement);
     }
 
     __forceinline void UpdateFirstNode() noexcept
@@ -2741,6 +3841,9 @@ private:
         m_FirstElement = m_FirstElement->Prev;
         m_FirstElement->Prev = m_Head;
         m_Head->Next = m_FirstElement;
+
+        if constexpr (Indexed) { IndexInsert(m_FirstElement); }
+        FingerInsert(m_FirstElement);
     }
 
     /**
@@ -2756,12 +3859,14 @@ private:
         b->Prev = a->Prev;
         b->Next = a;
         a->Prev = b;
+
+        if constexpr (Indexed) { IndexInsert(b); }
+        FingerInsert(b);
     }
 
     __forceinline void SetUnusedFromEmpty() noexcept
     {
-        m_FirstElement = m_Unused;
-        m_Unused = m_Unused->Next;
+        m_FirstElement = GetNodeFromUnused();
 
         SetControlPointers();
     }
@@ -2773,6 +3878,195 @@ private:
         m_FirstElement->Next = m_Tail;
         m_Tail->Prev = m_FirstElement;
         m_LastElement = m_FirstElement;
+
+        if constexpr (Indexed) { IndexInsert(m_FirstElement); }
+        FingerInsert(m_FirstElement);
+    }
+
+    /**
+    * @brief: Moves the nodes from first to last, both included, from other before position.
+    * @details: If the nodes of other can not be shared, the elements are moved one by one into nodes of the container.
+    *
+    * @param: Iterator -> Position in the container.
+    * @param: List& -> Other list.
+    * @param: Node* -> First node.
+    * @param: Node* -> Last node.
+    * @param: size_t -> Number of nodes.
+    * @return: void.
+    */
+    void SpliceNodes(iterator position, List& other, Node* first, Node* last, size_t count)
+    {
+        //A moved from container has no sentinels
+        if (!m_Head) { Init(); }
+        Node* node = position.m_Ptr ? position.m_Ptr : m_Tail;
+
+        if (!ShareNodes(other))
+        {
+            Node* end = last->Next;
+            while (first != end)
+            {
+                Node* next = first->Next;
+                if (node == m_Tail) { PushBack(std::move(*first->Data)); }
+                else { InsertNode(node, std::move(*first->Data)); }
+                other.Erase(iterator(first));
+                first = next;
+            }
+            return;
+        }
+
+        if (count == 1)
+        {
+            if constexpr (Indexed) { other.IndexErase(first); }
+            other.FingerErase(first);
+        }
+        else { other.InvalidateIndex(); }
+        other.UnlinkNodes(first, last);
+        other.m_Elements -= count;
+        other.m_Capacity -= count;
+
+        LinkNodes(node, first, last);
+        m_Elements += count;
+        m_Capacity += count;
+        if (count == 1)
+        {
+            if constexpr (Indexed) { IndexInsert(first); }
+            FingerInsert(first);
+        }
+        else { InvalidateIndex(); }
+    }
+
+    /**
+    * @brief: Checks if the nodes of other can be linked into the container.
+    * @details: The allocators must be equal. With slabs both pools are marked as shared, the slabs stay with the container that carved them.
+    *
+    * @param: List& -> Other list.
+    * @return: bool -> True if the nodes can be linked.
+    */
+    _NODISCARD __forceinline bool ShareNodes(List& other) noexcept
+    {
+        if (!Propagation::AreEqual(GetAllocatorReference(), other.GetAllocatorReference())) { return false; }
+
+        if constexpr (s_UseSlabs)
+        {
+            if (m_Pool) { m_Pool->Shared = true; }
+            if (other.m_Pool) { other.m_Pool->Shared = true; }
+        }
+        return true;
+    }
+
+    /**
+    * @brief: Unlinks the nodes from first to last, both included, from the sequence of the container.
+    * @details: The number of elements and the capacity are not updated.
+    *
+    * @param: Node* -> First node.
+    * @param: Node* -> Last node.
+    * @return: void.
+    */
+    __forceinline void UnlinkNodes(Node* first, Node* last) noexcept
+    {
+        Node* prev = first->Prev;
+        Node* next = last->Next;
+        if (prev == m_Head && next == m_Tail)
+        {
+            m_Head->Next = nullptr;
+            m_Tail->Prev = nullptr;
+            m_FirstElement = nullptr;
+            m_LastElement = nullptr;
+            return;
+        }
+
+        prev->Next = next;
+        next->Prev = prev;
+        if (prev == m_Head) { m_FirstElement = next; }
+        if (next == m_Tail) { m_LastElement = prev; }
+    }
+
+    /**
+    * @brief: Links the chain of nodes from first to last before position.
+    * @details: The number of elements and the capacity are not updated.
+    *
+    * @param: Node* -> Position, ignored if the container is empty.
+    * @param: Node* -> First node.
+    * @param: Node* -> Last node.
+    * @return: void.
+    */
+    __forceinline void LinkNodes(Node* position, Node* first, Node* last) noexcept
+    {
+        if (!m_FirstElement)
+        {
+            m_Head->Next = first;
+            first->Prev = m_Head;
+            last->Next = m_Tail;
+            m_Tail->Prev = last;
+            m_FirstElement = first;
+            m_LastElement = last;
+            return;
+        }
+
+        Node* prev = position->Prev;
+        prev->Next = first;
+        first->Prev = prev;
+        last->Next = position;
+        position->Prev = last;
+        if (prev == m_Head) { m_FirstElement = first; }
+        if (position == m_Tail) { m_LastElement = last; }
+    }
+
+    /**
+    * @brief: Merges two sorted chains of nodes linked through Next and ended by nullptr.
+    * @details: Stable, for equivalent elements the nodes of the left chain go first. The Prev links are not updated.
+    *
+    * @param: Node* -> Left chain.
+    * @param: Node* -> Right chain.
+    * @param: Compare& -> Comparison function object.
+    * @return: Node* -> First node of the merged chain.
+    */
+    template<typename Compare>
+    _NODISCARD static Node* MergeNodes(Node* left, Node* right, Compare& compare)
+    {
+        Node* first = nullptr;
+        Node** last = &first;
+        while (left && right)
+        {
+            if (compare(*right->Data, *left->Data))
+            {
+                *last = right;
+                last = &right->Next;
+                right = right->Next;
+            }
+            else
+            {
+                *last = left;
+                last = &left->Next;
+                left = left->Next;
+            }
+        }
+        *last = left ? left : right;
+
+        return first;
+    }
+
+    /**
+    * @brief: Makes a chain of nodes linked through Next and ended by nullptr the sequence of the container.
+    * @details: The Prev links are rebuilt, the number of elements is not updated.
+    *
+    * @param: Node* -> First node of the chain.
+    * @return: void.
+    */
+    void LinkChain(Node* first) noexcept
+    {
+        Node* prev = m_Head;
+        for (Node* node = first; node; node = node->Next)
+        {
+            node->Prev = prev;
+            prev = node;
+        }
+
+        m_Head->Next = first;
+        m_FirstElement = first;
+        m_LastElement = prev;
+        prev->Next = m_Tail;
+        m_Tail->Prev = prev;
     }
 
     __forceinline void InsertNode(Node* node, const T& element)
@@ -2870,6 +4164,260 @@ private:
         }
     }
 
+    /**
+    * @brief: Links a node that was just linked in the list into the position tree.
+    * @details: The node becomes a leaf next to its neighbour in the list and is rotated up by its priority.
+    * If the tree was dropped by a bulk operation nothing is done, it is rebuilt on the next access by index.
+    *
+    * @param: Node* -> Linked node.
+    * @return: void.
+    */
+    void IndexInsert(Node* node) noexcept
+    {
+        node->Left = nullptr;
+        node->Right = nullptr;
+        node->Weight = 1;
+
+        if (node->Prev == m_Head && node->Next == m_Tail)
+        {
+            node->Parent = m_Head;
+            m_Head->Left = node;
+            return;
+        }
+        if (!m_Head->Left) { return; }
+
+        //Either the next node has no left subtree or the previous node has no right subtree
+        Node* next = node->Next;
+        if (next != m_Tail && !next->Left)
+        {
+            next->Left = node;
+            node->Parent = next;
+        }
+        else
+        {
+            node->Prev->Right = node;
+            node->Parent = node->Prev;
+        }
+
+        for (Node* parent = node->Parent; parent != m_Head; parent = parent->Parent)
+        {
+            ++parent->Weight;
+        }
+
+        while (node->Parent != m_Head && IndexPriority(node) > IndexPriority(node->Parent))
+        {
+            RotateIndexUp(node);
+        }
+    }
+
+    /**
+    * @brief: Unlinks a node from the position tree.
+    * @details: The node is rotated down until it has a single child, then it is replaced by that child.
+    *
+    * @param: Node* -> Node to unlink.
+    * @return: void.
+    */
+    void IndexErase(Node* node) noexcept
+    {
+        if (!m_Head->Left) { return; }
+
+        while (node->Left && node->Right)
+        {
+            RotateIndexUp(IndexPriority(node->Left) > IndexPriority(node->Right) ? node->Left : node->Right);
+        }
+
+        Node* child = node->Left ? node->Left : node->Right;
+        Node* parent = node->Parent;
+        if (child) { child->Parent = parent; }
+
+        if (parent == m_Head || parent->Left == node) { parent->Left = child; }
+        else { parent->Right = child; }
+
+        for (; parent != m_Head; parent = parent->Parent)
+        {
+            --parent->Weight;
+        }
+    }
+
+    /**
+    * @brief: Swaps a node with its parent in the position tree, keeping the order of the nodes.
+    *
+    * @param: Node* -> Node to move up.
+    * @return: void.
+    */
+    __forceinline void RotateIndexUp(Node* node) noexcept
+    {
+        Node* parent = node->Parent;
+        Node* grandparent = parent->Parent;
+
+        if (parent->Left == node)
+        {
+            parent->Left = node->Right;
+            if (node->Right) { node->Right->Parent = parent; }
+            node->Right = parent;
+        }
+        else
+        {
+            parent->Right = node->Left;
+            if (node->Left) { node->Left->Parent = parent; }
+            node->Left = parent;
+        }
+
+        node->Parent = grandparent;
+        parent->Parent = node;
+        if (grandparent == m_Head || grandparent->Left == parent) { grandparent->Left = node; }
+        else { grandparent->Right = node; }
+
+        node->Weight = parent->Weight;
+        parent->Weight = 1 + IndexWeight(parent->Left) + IndexWeight(parent->Right);
+    }
+
+    /**
+    * @brief: Returns the node at the given position, the tree must be built and the index in range.
+    *
+    * @param: size_t -> Index.
+    * @return: Node* -> Node.
+    */
+    _NODISCARD Node* SelectIndexNode(size_t index) const noexcept
+    {
+        Node* node = m_Head->Left;
+        while (true)
+        {
+            const size_t left = IndexWeight(node->Left);
+            if (index < left) { node = node->Left; }
+            else if (index == left) { return node; }
+            else
+            {
+                index -= left + 1;
+                node = node->Right;
+            }
+        }
+    }
+
+    /**
+    * @brief: Builds the position tree of all the elements in linear time.
+    * @details: The nodes are pushed in order on the right spine of the tree, popping the nodes with lower priority.
+    * The parent links of the spine are the stack, so no memory is needed. The weights are computed after in post order.
+    *
+    * @return: void.
+    */
+    void RebuildIndex() noexcept
+    {
+        m_Head->Left = nullptr;
+        if (IsEmpty()) { return; }
+
+        Node* spine = m_Head;
+        for (Node* node = m_FirstElement; node != m_Tail; node = node->Next)
+        {
+            Node* popped = nullptr;
+            while (spine != m_Head && IndexPriority(spine) < IndexPriority(node))
+            {
+                popped = spine;
+                spine = spine->Parent;
+            }
+
+            node->Left = popped;
+            node->Right = nullptr;
+            if (popped) { popped->Parent = node; }
+
+            node->Parent = spine;
+            if (spine == m_Head) { m_Head->Left = node; }
+            else { spine->Right = node; }
+            spine = node;
+        }
+
+        Node* node = m_Head->Left;
+        while (true)
+        {
+            while (node->Left || node->Right) { node = node->Left ? node->Left : node->Right; }
+
+            while (true)
+            {
+                node->Weight = 1 + IndexWeight(node->Left) + IndexWeight(node->Right);
+                Node* parent = node->Parent;
+                if (parent == m_Head) { return; }
+                if (parent->Left == node && parent->Right)
+                {
+                    node = parent->Right;
+                    break;
+                }
+                node = parent;
+            }
+        }
+    }
+
+    _NODISCARD static __forceinline size_t IndexWeight(const Node* node) noexcept { return node ? node->Weight : 0; }
+
+    /**
+    * @brief: Priority of a node in the position tree, a hash of its address so the nodes need no extra field.
+    *
+    * @param: const Node* -> Node.
+    * @return: uint64_t -> Priority.
+    */
+    _NODISCARD static __forceinline uint64_t IndexPriority(const Node* node) noexcept
+    {
+        uint64_t key = (uint64_t)reinterpret_cast<uintptr_t>(node);
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        return key;
+    }
+
+    /**
+    * @brief: Updates the finger after a node was linked.
+    * @details: The index of the finger only changes if the node went before it. If the node is not next to the finger or at an end,
+    * its side is unknown and the finger is dropped.
+    *
+    * @param: Node* -> Linked node.
+    * @return: void.
+    */
+    __forceinline void FingerInsert(Node* node) noexcept
+    {
+        if (!m_Finger) { return; }
+
+        if (node->Next == m_Finger || node->Prev == m_Head) { ++m_FingerIndex; }
+        else if (node->Prev != m_Finger && node->Next != m_Tail) { m_Finger = nullptr; }
+    }
+
+    /**
+    * @brief: Updates the finger before a node is unlinked.
+    * @details: If the node is the finger, the finger moves to the next node, or to the previous one at the end of the container.
+    *
+    * @param: Node* -> Node to unlink.
+    * @return: void.
+    */
+    __forceinline void FingerErase(Node* node) noexcept
+    {
+        if (!m_Finger) { return; }
+
+        if (node == m_Finger)
+        {
+            if (node->Next != m_Tail) { m_Finger = node->Next; }
+            else if (node->Prev != m_Head)
+            {
+                m_Finger = node->Prev;
+                --m_FingerIndex;
+            }
+            else { m_Finger = nullptr; }
+        }
+        else if (node->Next == m_Finger || node->Prev == m_Head) { --m_FingerIndex; }
+        else if (node->Prev != m_Finger && node->Next != m_Tail) { m_Finger = nullptr; }
+    }
+
+    /**
+    * @brief: Drops the position tree and the finger after an operation that relinks many nodes, the tree is rebuilt on the next access by index.
+    *
+    * @return: void.
+    */
+    __forceinline void InvalidateIndex() noexcept
+    {
+        m_Finger = nullptr;
+        if constexpr (Indexed)
+        {
+            if (m_Head) { m_Head->Left = nullptr; }
+        }
+    }
+
     [[noreturn]] __forceinline static void ListOutOfRangeError() {
         throw std::exception("List index out of range");
     }
@@ -2888,8 +4436,33 @@ private:
     Node* m_Head = nullptr;
     Node* m_Tail = nullptr;
     Node* m_Unused = nullptr;
+    SlabPool* m_Pool = nullptr;
     size_t m_Elements = 0;
     size_t m_Capacity = 0;
+    Node* m_Finger = nullptr;
+    size_t m_FingerIndex = 0;
+    bool m_UseFinger = false;
 
     static _CONSTEXPR17 size_t s_MaxListSize = 10000000;
+    static _CONSTEXPR17 size_t s_SortRuns = sizeof(size_t) * 8;
+    static _CONSTEXPR17 size_t s_PrefetchDistance = 8;
+    static _CONSTEXPR17 size_t s_MaxCursors = 16;
+    static _CONSTEXPR17 size_t s_MaxBatch = 64;
+    static _CONSTEXPR17 bool s_SkipTeardown = IsReleaseAllAllocator<Allocator>::value && std::is_trivially_destructible<T>::value;
 };
+
+/*
+* List that takes its memory from a std::pmr::memory_resource selected at runtime.
+*/
+template<typename T>
+using PmrList = List<T, std::pmr::polymorphic_allocator<T>>;
+
+/*
+* List with logarithmic access, insertion and erase by index.
+* Each node carries its links in the position tree, and pushing or erasing an element takes logarithmic time.
+*/
+template<typename T, typename Allocator = std::allocator<T>>
+using IndexedList = List<T, Allocator, true>;
+
+template<typename T>
+using PmrIndexedList = IndexedList<T, std::pmr::polymorphic_allocator<T>>;
@@ -0,0 +1,858 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header class.
+* MappedVector class is a sequence container of trivially copyable elements stored in a memory mapped file.
+* The file starts with a small header (magic, version, element size and number of elements) followed by the elements,
+* so a container written by one process is opened again by mapping the file, without reading or building anything.
+* The file grows by resizing it and mapping it again, which moves the elements to a new address.
+* Several processes can open the same file as read only and share its pages.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <algorithm>  //For std::min
+#include <cstdint>  //For uint32_t and uint64_t
+#include <cstring>  //For std::memset
+#include <type_traits>  //For std::is_trivially_copyable
+#include <utility>  //For std::move and std::forward
+#include "GrowthPolicy.hpp"
+
+#if defined(_WIN32)
+#include <windows.h>  //For CreateFileA, CreateFileMappingA and MapViewOfFile
+#else
+#include <sys/mman.h>  //For mmap, msync and munmap
+#include <sys/stat.h>  //For fstat
+#include <fcntl.h>  //For open
+#include <unistd.h>  //For ftruncate and close
+#endif
+
+/*
+* File mapped in memory through the functions of the operating system, the whole file is mapped as one view.
+*/
+class MappedFile
+{
+public:
+    /**
+    * @brief: Opens a file, a writable file is created if it does not exist.
+    *
+    * @param: const char* -> Path of the file.
+    * @param: bool -> True to open the file as read only.
+    * @return: bool -> True if the file was opened.
+    */
+    _NODISCARD bool Open(const char* path, bool read_only) noexcept
+    {
+        m_ReadOnly = read_only;
+#if defined(_WIN32)
+        const DWORD access = read_only ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE;
+        m_File = CreateFileA(path, access, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, read_only ? OPEN_EXISTING : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        return m_File != INVALID_HANDLE_VALUE;
+#else
+        m_File = read_only ? open(path, O_RDONLY) : open(path, O_RDWR | O_CREAT, 0644);
+        return m_File != -1;
+#endif
+    }
+
+    /**
+    * @brief: Size of the file on disk.
+    *
+    * @return: size_t -> Bytes.
+    */
+    _NODISCARD size_t FileSize() const noexcept
+    {
+#if defined(_WIN32)
+        LARGE_INTEGER size;
+        return GetFileSizeEx(m_File, &size) ? (size_t)size.QuadPart : 0;
+#else
+        struct stat status;
+        return fstat(m_File, &status) == 0 ? (size_t)status.st_size : 0;
+#endif
+    }
+
+    /**
+    * @brief: Maps the first bytes of the file, the file must be at least that long.
+    *
+    * @param: size_t -> Bytes.
+    * @return: bool -> True if the file was mapped.
+    */
+    _NODISCARD bool Map(size_t bytes) noexcept
+    {
+#if defined(_WIN32)
+        const unsigned long long size = bytes;
+        m_Mapping = CreateFileMappingA(m_File, nullptr, m_ReadOnly ? PAGE_READONLY : PAGE_READWRITE, (DWORD)(size >> 32), (DWORD)size, nullptr);
+        if (!m_Mapping) { return false; }
+
+        m_Address = MapViewOfFile(m_Mapping, m_ReadOnly ? FILE_MAP_READ : FILE_MAP_WRITE, 0, 0, bytes);
+        if (!m_Address)
+        {
+            CloseHandle(m_Mapping);
+            m_Mapping = nullptr;
+            return false;
+        }
+#else
+        void* address = mmap(nullptr, bytes, m_ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, m_File, 0);
+        if (address == MAP_FAILED) { return false; }
+        m_Address = address;
+#endif
+        m_Bytes = bytes;
+        return true;
+    }
+
+    /**
+    * @brief: Unmaps the file, the changes stay in the file.
+    *
+    * @return: void.
+    */
+    void Unmap() noexcept
+    {
+        if (!m_Address) { return; }
+#if defined(_WIN32)
+        UnmapViewOfFile(m_Address);
+        CloseHandle(m_Mapping);
+        m_Mapping = nullptr;
+#else
+        munmap(m_Address, m_Bytes);
+#endif
+        m_Address = nullptr;
+        m_Bytes = 0;
+    }
+
+    /**
+    * @brief: Changes the size of the file and maps it again, the mapped address can change.
+    * @details: The new bytes of the file are zeros.
+    *
+    * @param: size_t -> Bytes.
+    * @return: bool -> True if the file was resized and mapped.
+    */
+    _NODISCARD bool Resize(size_t bytes) noexcept
+    {
+        Unmap();
+#if defined(_WIN32)
+        LARGE_INTEGER size;
+        size.QuadPart = (LONGLONG)bytes;
+        if (!SetFilePointerEx(m_File, size, nullptr, FILE_BEGIN) || !SetEndOfFile(m_File)) { return false; }
+#else
+        if (ftruncate(m_File, (off_t)bytes) != 0) { return false; }
+#endif
+        return Map(bytes);
+    }
+
+    /**
+    * @brief: Writes the changes of the mapped bytes to the disk and waits for it.
+    *
+    * @return: bool -> True if the changes were written.
+    */
+    bool Flush() noexcept
+    {
+        if (!m_Address || m_ReadOnly) { return true; }
+#if defined(_WIN32)
+        return FlushViewOfFile(m_Address, m_Bytes) && FlushFileBuffers(m_File);
+#else
+        return msync(m_Address, m_Bytes, MS_SYNC) == 0;
+#endif
+    }
+
+    /**
+    * @brief: Unmaps and closes the file.
+    *
+    * @return: void.
+    */
+    void Close() noexcept
+    {
+        Unmap();
+        if (!IsOpen()) { return; }
+#if defined(_WIN32)
+        CloseHandle(m_File);
+        m_File = INVALID_HANDLE_VALUE;
+#else
+        close(m_File);
+        m_File = -1;
+#endif
+    }
+
+    _NODISCARD __forceinline bool IsOpen() const noexcept
+    {
+#if defined(_WIN32)
+        return m_File != INVALID_HANDLE_VALUE;
+#else
+        return m_File != -1;
+#endif
+    }
+
+    _NODISCARD __forceinline bool IsReadOnly() const noexcept { return m_ReadOnly; }
+
+    _NODISCARD __forceinline void* Address() const noexcept { return m_Address; }
+
+    _NODISCARD __forceinline size_t Bytes() const noexcept { return m_Bytes; }
+
+public:
+    MappedFile() noexcept = default;
+
+    MappedFile(const MappedFile& other) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+    {
+        TakeFile(other);
+    }
+
+    ~MappedFile() noexcept
+    {
+        Close();
+    }
+
+    MappedFile& operator=(const MappedFile& other) = delete;
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        if (&other == this) { return *this; }
+
+        Close();
+        TakeFile(other);
+
+        return *this;
+    }
+
+private:
+    __forceinline void TakeFile(MappedFile& other) noexcept
+    {
+        m_File = other.m_File;
+#if defined(_WIN32)
+        m_Mapping = other.m_Mapping;
+        other.m_File = INVALID_HANDLE_VALUE;
+        other.m_Mapping = nullptr;
+#else
+        other.m_File = -1;
+#endif
+        m_Address = other.m_Address;
+        m_Bytes = other.m_Bytes;
+        m_ReadOnly = other.m_ReadOnly;
+
+        other.m_Address = nullptr;
+        other.m_Bytes = 0;
+    }
+
+private:
+#if defined(_WIN32)
+    HANDLE m_File = INVALID_HANDLE_VALUE;
+    HANDLE m_Mapping = nullptr;
+#else
+    int m_File = -1;
+#endif
+    void* m_Address = nullptr;
+    size_t m_Bytes = 0;
+    bool m_ReadOnly = false;
+};
+
+template<typename T, typename GrowthPolicy = DoublingGrowthPolicy>
+class MappedVector
+{
+    static_assert(std::is_trivially_copyable<T>::value, "MappedVector only stores trivially copyable types");
+
+    /*
+    * Header at the start of the file, the elements start s_HeaderSize bytes after it.
+    */
+    struct Header
+    {
+        uint64_t Magic;
+        uint32_t Version;
+        uint32_t ElementSize;
+        uint64_t Count;
+    };
+
+    static_assert(alignof(T) <= 64, "MappedVector elements are aligned to 64 bytes in the file");
+
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    //Modifiers
+public:
+    /**
+    * @brief: Opens or creates a file to store the container, the file is opened as writable.
+    * @details: An empty file gets a new header, otherwise the header is checked against T.
+    * The previous file of the container is closed first.
+    * std::exception execption will be thrown if the file can not be opened or was written with other type or version.
+    *
+    * @param: const char* -> Path of the file.
+    * @return: void.
+    */
+    void Open(const char* path)
+    {
+        Close();
+        if (!m_File.Open(path, false)) { MappedVectorFileError(); }
+
+        const size_t bytes = m_File.FileSize();
+        if (bytes == 0)
+        {
+            if (!m_File.Resize(s_HeaderSize + s_DefaultCapacity * sizeof(T))) { Fail(); }
+
+            Header* header = GetHeader();
+            header->Magic = s_Magic;
+            header->Version = s_Version;
+            header->ElementSize = (uint32_t)sizeof(T);
+            header->Count = 0;
+        }
+        else if (bytes < s_HeaderSize || !m_File.Map(bytes)) { Fail(); }
+
+        Load();
+    }
+
+    /**
+    * @brief: Opens an existing file as read only, the pages are shared with every process that maps it.
+    * @details: The modifiers throw while the container is read only. The previous file of the container is closed first.
+    * The container keeps the number of elements of the file at this point, the elements added later by a writer are not seen.
+    * std::exception execption will be thrown if the file can not be opened or was written with other type or version.
+    *
+    * @param: const char* -> Path of the file.
+    * @return: void.
+    */
+    void OpenReadOnly(const char* path)
+    {
+        Close();
+        if (!m_File.Open(path, true)) { MappedVectorFileError(); }
+
+        const size_t bytes = m_File.FileSize();
+        if (bytes < s_HeaderSize || !m_File.Map(bytes)) { Fail(); }
+
+        Load();
+    }
+
+    /**
+    * @brief: Closes the file, the elements stay in it.
+    * @details: The changes are not flushed, the system writes them eventually. Call Flush to wait for them.
+    *
+    * @return: void.
+    */
+    void Close() noexcept
+    {
+        m_File.Close();
+        m_Data = nullptr;
+        m_Capacity = 0;
+        m_ReadOnlyCount = 0;
+    }
+
+    /**
+    * @brief: Writes the elements and the header to the disk and waits for it.
+    * @details: std::exception execption will be thrown if the system could not write the file.
+    *
+    * @return: void.
+    */
+    void Flush()
+    {
+        if (!m_File.Flush()) { MappedVectorFileError(); }
+    }
+
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: Amortized constant time, a full container grows its file and maps it again.
+    * std::exception execption will be thrown if the container is not writable.
+    *
+    * @param: const T& -> Element.
+    * @return: void.
+    */
+    void PushBack(const T& element)
+    {
+        CheckWritable();
+
+        Header* header = GetHeader();
+        if (header->Count == m_Capacity)
+        {
+            //The element can belong to the container, it is copied before the file is mapped again
+            const T copy = element;
+            Grow((size_t)header->Count + 1);
+            header = GetHeader();
+            m_Data[header->Count] = copy;
+        }
+        else { m_Data[header->Count] = element; }
+
+        ++header->Count;
+    }
+
+    /**
+    * @brief: Constructs a new element at the end of the container.
+    * @details: The element is built before the file grows, so the arguments can refer to the container.
+    * std::exception execption will be thrown if the container is not writable.
+    *
+    * @param: Args&&... -> Arguments of the element.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        PushBack(T(std::forward<Args>(args)...));
+        return Back();
+    }
+
+    /**
+    * @brief: Delete the last element of the container.
+    * @details: std::exception execption will be thrown if the container is not writable.
+    *
+    * @return: void.
+    */
+    void PopBack()
+    {
+        CheckWritable();
+        if (IsEmpty()) { return; }
+
+        --GetHeader()->Count;
+    }
+
+    /**
+    * @brief: Changes the number of elements, the new elements are zeros.
+    * @details: std::exception execption will be thrown if the container is not writable.
+    *
+    * @param: size_t -> Number of elements.
+    * @return: void.
+    */
+    void Resize(size_t size)
+    {
+        CheckWritable();
+
+        const size_t elements = Size();
+        if (size > m_Capacity) { Reserve(size); }
+        if (size > elements) { std::memset((void*)(m_Data + elements), 0, sizeof(T) * (size - elements)); }
+
+        GetHeader()->Count = size;
+    }
+
+    /**
+    * @brief: Clears the content of the container.
+    * @details: The file keeps its size for the next insertions.
+    * std::exception execption will be thrown if the container is not writable.
+    *
+    * @return: void.
+    */
+    void Clear()
+    {
+        CheckWritable();
+
+        GetHeader()->Count = 0;
+    }
+
+    /**
+    * @brief: Swaps the files of two MappedVectors.
+    *
+    * @param: MappedVector& -> Other vector.
+    * @return: void.
+    */
+    void Swap(MappedVector& other) noexcept
+    {
+        if (&other == this) { return; }
+
+        MappedVector vector(std::move(other));
+        other = std::move(*this);
+        *this = std::move(vector);
+    }
+
+    //Capacity
+public:
+    /**
+    * @brief: Grows the file to hold at least capacity elements.
+    * @details: The file is mapped again, so the pointers to the elements are invalidated.
+    * std::exception execption will be thrown if the container is not writable or the file can not grow.
+    *
+    * @param: size_t -> Capacity.
+    * @return: void.
+    */
+    void Reserve(size_t capacity)
+    {
+        CheckWritable();
+        if (capacity <= m_Capacity) { return; }
+
+        Remap(capacity);
+    }
+
+    /**
+    * @brief: Shrinks the file to the size of the elements.
+    * @details: The file is mapped again, so the pointers to the elements are invalidated.
+    * std::exception execption will be thrown if the container is not writable.
+    *
+    * @return: void.
+    */
+    void Shrink()
+    {
+        CheckWritable();
+        if (Size() == m_Capacity) { return; }
+
+        Remap(Size());
+    }
+
+    /**
+    * @brief: Checks if the container is empty.
+    *
+    * @return: bool -> True if the container has no elements.
+    */
+    _NODISCARD __forceinline bool IsEmpty() const noexcept { return Size() == 0; }
+
+    /**
+    * @brief: Number of elements in the container, zero if no file is open.
+    * @details: Other processes can write the file, so the count is never greater than the mapped capacity.
+    *
+    * @return: size_t -> Elements.
+    */
+    _NODISCARD __forceinline size_t Size() const noexcept
+    {
+        if (!m_Data) { return 0; }
+        if (m_File.IsReadOnly()) { return m_ReadOnlyCount; }
+
+        return (std::min)((size_t)GetHeader()->Count, m_Capacity);
+    }
+
+    /**
+    * @brief: Number of elements that fit in the file.
+    *
+    * @return: size_t -> Capacity.
+    */
+    _NODISCARD __forceinline size_t Capacity() const noexcept { return m_Capacity; }
+
+    /**
+    * @brief: Checks if the container has a file open.
+    *
+    * @return: bool -> True if a file is open.
+    */
+    _NODISCARD __forceinline bool IsOpen() const noexcept { return m_Data != nullptr; }
+
+    /**
+    * @brief: Checks if the file was opened as read only.
+    *
+    * @return: bool -> True if the container can not be modified.
+    */
+    _NODISCARD __forceinline bool IsReadOnly() const noexcept { return m_File.IsReadOnly(); }
+
+    //Element Access
+public:
+    /**
+    * @brief: Returns a reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined. Writing to a read only container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Front() noexcept { return *m_Data; }
+
+    /**
+    * @brief: Returns a const reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Front() const noexcept { return *m_Data; }
+
+    /**
+    * @brief: Returns a reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined. Writing to a read only container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Back() noexcept { return m_Data[Size() - 1]; }
+
+    /**
+    * @brief: Returns a const reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Back() const noexcept { return m_Data[Size() - 1]; }
+
+    /**
+    * @brief: Returns a reference to the element at the given index.
+    * @details: Calling [] in a empty container is undefined. Writing to a read only container is undefined.
+    *
+    * @param: size_t -> Index.
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& operator[](size_t index) noexcept { return m_Data[index]; }
+
+    /**
+    * @brief: Returns a const reference to the element at the given index.
+    * @details: Calling [] in a empty container is undefined.
+    *
+    * @param: size_t -> Index.
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& operator[](size_t index) const noexcept { return m_Data[index]; }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: T& -> Element.
+    */
+    _NODISCARD T& At(size_t index)
+    {
+        if (index >= Size()) { MappedVectorOutOfRangeError(); }
+        return m_Data[index];
+    }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: const T& -> Element.
+    */
+    _NODISCARD const T& At(size_t index) const
+    {
+        if (index >= Size()) { MappedVectorOutOfRangeError(); }
+        return m_Data[index];
+    }
+
+    /**
+    * @brief: Returns a pointer to the container data, inside the mapped file.
+    *
+    * @return: T* -> Data.
+    */
+    _NODISCARD __forceinline T* Data() noexcept { return m_Data; }
+
+    /**
+    * @brief: Returns a const pointer to the container data, inside the mapped file.
+    *
+    * @return: const T* -> Data.
+    */
+    _NODISCARD __forceinline const T* Data() const noexcept { return m_Data; }
+
+    //Iterators
+public:
+    /**
+    * @brief: Returns an iterator to the begin of the container.
+    * @details: The elements are contiguous, so the iterators are pointers.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator begin() noexcept { return m_Data; }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator begin() const noexcept { return m_Data; }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cbegin() const noexcept { return m_Data; }
+
+    /**
+    * @brief: Returns an iterator to the end of the container.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator end() noexcept { return m_Data + Size(); }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator end() const noexcept { return m_Data + Size(); }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cend() const noexcept { return m_Data + Size(); }
+
+    //Member functions
+public:
+    explicit MappedVector() noexcept = default;
+
+    /**
+    * @brief: Opens or creates the file as writable, or opens it as read only.
+    * @details: std::exception execption will be thrown if the file can not be opened or was written with other type or version.
+    *
+    * @param: const char* -> Path of the file.
+    * @param: bool -> True to open the file as read only.
+    */
+    explicit MappedVector(const char* path, bool read_only = false)
+    {
+        if (read_only) { OpenReadOnly(path); }
+        else { Open(path); }
+    }
+
+    MappedVector(const MappedVector& other) = delete;
+
+    MappedVector(MappedVector&& other) noexcept :
+        m_File(std::move(other.m_File)),
+        m_Data(other.m_Data),
+        m_Capacity(other.m_Capacity),
+        m_ReadOnlyCount(other.m_ReadOnlyCount)
+    {
+        other.m_Data = nullptr;
+        other.m_Capacity = 0;
+        other.m_ReadOnlyCount = 0;
+    }
+
+    ~MappedVector() noexcept
+    {
+        Close();
+    }
+
+    MappedVector& operator=(const MappedVector& other) = delete;
+
+    MappedVector& operator=(MappedVector&& other) noexcept
+    {
+        if (&other == this) { return *this; }
+
+        m_File = std::move(other.m_File);
+        m_Data = other.m_Data;
+        m_Capacity = other.m_Capacity;
+        m_ReadOnlyCount = other.m_ReadOnlyCount;
+
+        other.m_Data = nullptr;
+        other.m_Capacity = 0;
+        other.m_ReadOnlyCount = 0;
+
+        return *this;
+    }
+
+    //Non-member functions
+public:
+    /**
+    * @brief: Compares the content of two MappedVectors.
+    *
+    * @return: bool -> True if the content of both containers are equal.
+    */
+    _NODISCARD bool operator==(const MappedVector& other) const noexcept
+    {
+        const size_t elements = Size();
+        if (elements != other.Size()) { return false; }
+
+        for (size_t i = 0; i < elements; ++i)
+        {
+            if (m_Data[i] != other.m_Data[i]) { return false; }
+        }
+
+        return true;
+    }
+
+    /**
+    * @brief: Compares the content of two MappedVectors.
+    *
+    * @return: bool -> True if the content of both containers are not equal.
+    */
+    _NODISCARD __forceinline bool operator!=(const MappedVector& other) const noexcept { return !(*this == other); }
+
+private:
+    _NODISCARD __forceinline Header* GetHeader() const noexcept { return static_cast<Header*>(m_File.Address()); }
+
+    /**
+    * @brief: Checks the header of the mapped file and takes the elements from it.
+    * @details: std::exception execption will be thrown if the file was written with other type or version.
+    *
+    * @return: void.
+    */
+    void Load()
+    {
+        const Header* header = GetHeader();
+        const size_t capacity = (m_File.Bytes() - s_HeaderSize) / sizeof(T);
+        if (header->Magic != s_Magic || header->Version != s_Version || header->ElementSize != sizeof(T) || header->Count > capacity)
+        {
+            m_File.Close();
+            MappedVectorFormatError();
+        }
+
+        m_Data = reinterpret_cast<T*>(static_cast<char*>(m_File.Address()) + s_HeaderSize);
+        m_Capacity = capacity;
+        m_ReadOnlyCount = m_File.IsReadOnly() ? (size_t)header->Count : 0;
+    }
+
+    /**
+    * @brief: Grows the file to hold at least required elements.
+    * @details: The new capacity is given by the growth policy.
+    *
+    * @param: size_t -> Required number of elements.
+    * @return: void.
+    */
+    void Grow(size_t required)
+    {
+        size_t capacity = m_Capacity ? GrowthPolicy::NextCapacity(m_Capacity, sizeof(T)) : s_DefaultCapacity;
+        if (capacity < required) { capacity = required; }
+
+        Remap(capacity);
+    }
+
+    /**
+    * @brief: Resizes the file to hold capacity elements and maps it again.
+    * @details: std::exception execption will be thrown if the file can not be resized, the container is closed then.
+    *
+    * @param: size_t -> Capacity.
+    * @return: void.
+    */
+    void Remap(size_t capacity)
+    {
+        if (!m_File.Resize(s_HeaderSize + capacity * sizeof(T))) { Fail(); }
+
+        m_Data = reinterpret_cast<T*>(static_cast<char*>(m_File.Address()) + s_HeaderSize);
+        m_Capacity = capacity;
+    }
+
+    __forceinline void CheckWritable() const
+    {
+        if (!m_Data || m_File.IsReadOnly()) { MappedVectorReadOnlyError(); }
+    }
+
+    [[noreturn]] void Fail()
+    {
+        Close();
+        MappedVectorFileError();
+    }
+
+    [[noreturn]] __forceinline static void MappedVectorOutOfRangeError() {
+        throw std::exception("MappedVector index out of range");
+    }
+
+    [[noreturn]] __forceinline static void MappedVectorFileError() {
+        throw std::exception("MappedVector file error");
+    }
+
+    [[noreturn]] __forceinline static void MappedVectorFormatError() {
+        throw std::exception("MappedVector file has other format");
+    }
+
+    [[noreturn]] __forceinline static void MappedVectorReadOnlyError() {
+        throw std::exception("MappedVector is not writable");
+    }
+
+private:
+    MappedFile m_File;
+    T* m_Data = nullptr;
+    size_t m_Capacity = 0;
+    size_t m_ReadOnlyCount = 0;
+
+    static _CONSTEXPR17 uint64_t s_Magic = 0x524F544345564D44;  //"DMVECTOR"
+    static _CONSTEXPR17 uint32_t s_Version = 1;
+    static _CONSTEXPR17 size_t s_HeaderSize = 64;
+    static _CONSTEXPR17 size_t s_DefaultCapacity = 1024;
+};
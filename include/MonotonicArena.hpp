@@ -0,0 +1,264 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header class.
+* MonotonicArena is a bump pointer memory resource. Memory is taken from big chunks and is never released
+* one block at a time, all the memory is released at once when the arena is released or destroyed.
+* An initial buffer (for example on the stack) can be given, so small workloads never touch the heap.
+* ArenaAllocator is the allocator to use the arena with the containers. Containers using it skip the
+* teardown of their memory, and of their elements when they are trivially destructible.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <memory_resource>  //For std::pmr::memory_resource
+#include <cstdint>  //For uintptr_t
+#include "Allocator.hpp"
+
+class MonotonicArena : public std::pmr::memory_resource
+{
+    //Modifiers
+public:
+    /**
+    * @brief: Allocates a block of memory from the current chunk.
+    * @details: A new chunk is requested to the upstream resource when the current one is full.
+    * Can throw exceptions (Typically std::bad_alloc)
+    *
+    * @param: size_t -> Size in bytes.
+    * @param: size_t -> Alignment, must be a power of two.
+    *
+    * @return: void* -> Memory block.
+    */
+    _NODISCARD __forceinline void* Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t))
+    {
+        //Empty blocks take one byte, so they are never nullptr and never share an address
+        if (bytes == 0) { bytes = 1; }
+
+        const uintptr_t current = reinterpret_cast<uintptr_t>(m_Current);
+        const uintptr_t aligned = (current + alignment - 1) & ~(uintptr_t)(alignment - 1);
+        if (aligned + bytes <= reinterpret_cast<uintptr_t>(m_End) && aligned >= current)
+        {
+            m_Current = reinterpret_cast<unsigned char*>(aligned + bytes);
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        return AllocateFromNewChunk(bytes, alignment);
+    }
+
+    /**
+    * @brief: Releases all the memory of the arena.
+    * @details: The chunks are returned to the upstream resource and the arena starts again from the initial buffer.
+    * Every block allocated from the arena becomes invalid.
+    *
+    * @return: void.
+    */
+    void Release() noexcept
+    {
+        while (m_Chunks)
+        {
+            Chunk* chunk = m_Chunks;
+            m_Chunks = m_Chunks->Previous;
+            m_Upstream->deallocate(chunk, chunk->Size, alignof(Chunk));
+        }
+
+        m_Current = m_InitialBuffer;
+        m_End = m_InitialBuffer + m_InitialSize;
+        m_NextChunkSize = m_ChunkSize;
+        m_BytesReserved = m_InitialSize;
+    }
+
+    //Capacity
+public:
+    /**
+    * @brief: Bytes requested to the upstream resource plus the size of the initial buffer.
+    *
+    * @return: size_t -> Bytes.
+    */
+    _NODISCARD __forceinline size_t BytesReserved() const noexcept { return m_BytesReserved; }
+
+    /**
+    * @brief: Bytes left in the current chunk.
+    *
+    * @return: size_t -> Bytes.
+    */
+    _NODISCARD __forceinline size_t BytesAvailable() const noexcept { return m_End - m_Current; }
+
+    /**
+    * @brief: Checks if the arena has requested memory to the upstream resource.
+    *
+    * @return: bool -> True if there is at least one chunk.
+    */
+    _NODISCARD __forceinline bool HasChunks() const noexcept { return m_Chunks != nullptr; }
+
+    //Member functions
+public:
+    explicit MonotonicArena(size_t chunk_size = s_DefaultChunkSize, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept :
+        m_Upstream(upstream),
+        m_ChunkSize(chunk_size > s_MinChunkSize ? chunk_size : s_MinChunkSize),
+        m_NextChunkSize(m_ChunkSize) {}
+
+    MonotonicArena(void* buffer, size_t size, size_t chunk_size = s_DefaultChunkSize, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept :
+        m_InitialBuffer(static_cast<unsigned char*>(buffer)),
+        m_InitialSize(size),
+        m_Current(static_cast<unsigned char*>(buffer)),
+        m_End(static_cast<unsigned char*>(buffer) + size),
+        m_Upstream(upstream),
+        m_ChunkSize(chunk_size > s_MinChunkSize ? chunk_size : s_MinChunkSize),
+        m_NextChunkSize(m_ChunkSize),
+        m_BytesReserved(size) {}
+
+    MonotonicArena(const MonotonicArena& other) = delete;
+
+    MonotonicArena& operator=(const MonotonicArena& other) = delete;
+
+    ~MonotonicArena() noexcept
+    {
+        Release();
+    }
+
+private:
+    /*
+    * Header at the beginning of every chunk, the chunks form a list to release them.
+    */
+    struct Chunk
+    {
+        Chunk* Previous = nullptr;
+        size_t Size = 0;
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override { return Allocate(bytes, alignment); }
+
+    void do_deallocate(void*, size_t, size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    /**
+    * @brief: Requests a new chunk big enough for the block and allocates the block from it.
+    * @details: The size of the chunks grows geometrically up to s_MaxChunkSize.
+    *
+    * @param: size_t -> Size in bytes.
+    * @param: size_t -> Alignment.
+    *
+    * @return: void* -> Memory block.
+    */
+    void* AllocateFromNewChunk(size_t bytes, size_t alignment)
+    {
+        size_t chunk_size = m_NextChunkSize;
+        const size_t required = sizeof(Chunk) + bytes + alignment;
+        if (chunk_size < required) { chunk_size = required; }
+
+        Chunk* chunk = nullptr;
+        try
+        {
+            chunk = static_cast<Chunk*>(m_Upstream->allocate(chunk_size, alignof(Chunk)));
+        }
+        catch (...)
+        {
+            ArenaBadAllocationError();
+        }
+
+        chunk->Previous = m_Chunks;
+        chunk->Size = chunk_size;
+        m_Chunks = chunk;
+        m_BytesReserved += chunk_size;
+
+        m_Current = reinterpret_cast<unsigned char*>(chunk + 1);
+        m_End = reinterpret_cast<unsigned char*>(chunk) + chunk_size;
+        if (m_NextChunkSize < s_MaxChunkSize) { m_NextChunkSize <<= 1; }
+
+        return Allocate(bytes, alignment);
+    }
+
+    [[noreturn]] static __forceinline void ArenaBadAllocationError() {
+        throw std::exception("Bad allocation");
+    }
+
+private:
+    unsigned char* m_InitialBuffer = nullptr;
+    size_t m_InitialSize = 0;
+    unsigned char* m_Current = nullptr;
+    unsigned char* m_End = nullptr;
+    Chunk* m_Chunks = nullptr;
+    std::pmr::memory_resource* m_Upstream = nullptr;
+    size_t m_ChunkSize = s_DefaultChunkSize;
+    size_t m_NextChunkSize = s_DefaultChunkSize;
+    size_t m_BytesReserved = 0;
+
+    static _CONSTEXPR17 size_t s_MinChunkSize = 256;
+    static _CONSTEXPR17 size_t s_DefaultChunkSize = 64 * 1024;
+    static _CONSTEXPR17 size_t s_MaxChunkSize = 64 * 1024 * 1024;
+};
+
+/*
+* Allocator that takes the memory from a MonotonicArena.
+* Deallocate does nothing, the memory is released with the arena.
+*/
+template<typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    //Modifiers
+public:
+    _NODISCARD __forceinline T* allocate(size_t count)
+    {
+        return static_cast<T*>(m_Arena->Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    __forceinline void deallocate(T*, size_t) noexcept {}
+
+    //Element Access
+public:
+    _NODISCARD __forceinline MonotonicArena* Arena() const noexcept { return m_Arena; }
+
+    //Member functions
+public:
+    ArenaAllocator(MonotonicArena* arena) noexcept :
+        m_Arena(arena) {}
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept :
+        m_Arena(other.Arena()) {}
+
+    //Non-member functions
+public:
+    template<typename U>
+    _NODISCARD __forceinline bool operator==(const ArenaAllocator<U>& other) const noexcept { return m_Arena == other.Arena(); }
+
+    template<typename U>
+    _NODISCARD __forceinline bool operator!=(const ArenaAllocator<U>& other) const noexcept { return m_Arena != other.Arena(); }
+
+private:
+    MonotonicArena* m_Arena = nullptr;
+};
+
+template<typename T>
+struct IsReleaseAllAllocator<ArenaAllocator<T>> : std::true_type {};
@@ -0,0 +1,383 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header class.
+* NodePool is a pool of free blocks of one size, shared by every container whose nodes have that size.
+* Each thread keeps a small cache of blocks that needs no synchronization, full caches give a batch of blocks
+* to the global tier and empty caches take a batch from it. The global tier is a lock-free stack of batches.
+* The global tier keeps at most HighWater blocks, the blocks above it are returned to the system.
+* NodePoolAllocator is the allocator to use the pool with the containers, Lists using it allocate each node
+* from the pool instead of carving them from their own slabs, so short lived Lists reuse the nodes of the previous ones.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <atomic>  //For std::atomic
+#include <new>  //For std::align_val_t
+#include "Allocator.hpp"
+
+template<size_t Size, size_t Alignment>
+class NodePool
+{
+    /*
+    * Free block, the blocks of a batch are linked through Next.
+    * The first block of a batch also keeps the number of blocks of the batch and the next batch of the global tier.
+    */
+    struct Block
+    {
+        Block* Next;
+        Block* NextBatch;
+        size_t Count;
+    };
+
+    /*
+    * Blocks cached by one thread. It is trivial, so the hot paths access it without the guard of a thread_local with a destructor.
+    */
+    struct ThreadCache
+    {
+        Block* Blocks;
+        size_t Count;
+        bool Registered;
+    };
+
+    /*
+    * Gives the blocks of the cache to the global tier when the thread ends, registered the first time the thread uses the pool.
+    */
+    struct ThreadExit
+    {
+        ~ThreadExit() noexcept
+        {
+            ThreadCache& cache = s_Cache;
+            if (cache.Blocks) { FlushBatch(cache); }
+        }
+
+        ThreadCache* Cache = nullptr;
+    };
+
+    /*
+    * Batches shared by all the threads, released when the program ends.
+    */
+    struct GlobalTier
+    {
+        ~GlobalTier() noexcept
+        {
+            Block* batch = Batches.load(std::memory_order_acquire);
+            while (batch)
+            {
+                Block* next = batch->NextBatch;
+                ReleaseChain(batch);
+                batch = next;
+            }
+        }
+
+        std::atomic<Block*> Batches{ nullptr };
+        std::atomic<size_t> Cached{ 0 };
+        std::atomic<size_t> HighWater{ s_DefaultHighWater };
+        std::atomic<size_t> UpstreamAllocations{ 0 };
+    };
+
+public:
+    static _CONSTEXPR17 size_t s_Alignment = Alignment > alignof(Block) ? Alignment : alignof(Block);
+    static _CONSTEXPR17 size_t s_BlockSize = ((Size > sizeof(Block) ? Size : sizeof(Block)) + s_Alignment - 1) & ~(s_Alignment - 1);
+
+    //Modifiers
+public:
+    /**
+    * @brief: Returns a block of the pool.
+    * @details: The cache of the thread is used first, then a batch of the global tier, and finally the system allocator.
+    * Can throw exceptions (Typically std::bad_alloc)
+    *
+    * @return: void* -> Uninitialized block of s_BlockSize bytes.
+    */
+    _NODISCARD static __forceinline void* Allocate()
+    {
+        ThreadCache& cache = s_Cache;
+        Block* block = cache.Blocks;
+        if (block)
+        {
+            cache.Blocks = block->Next;
+            --cache.Count;
+            return block;
+        }
+
+        return AllocateFromGlobal(cache);
+    }
+
+    /**
+    * @brief: Returns a block to the pool.
+    * @details: The block goes to the cache of the thread, a full cache gives a batch to the global tier.
+    * The block can come from any thread.
+    *
+    * @param: void* -> Block returned by Allocate.
+    * @return: void.
+    */
+    static __forceinline void Deallocate(void* memory) noexcept
+    {
+        ThreadCache& cache = s_Cache;
+        if (!cache.Registered) { RegisterThread(cache); }
+
+        Block* block = static_cast<Block*>(memory);
+        block->Next = cache.Blocks;
+        cache.Blocks = block;
+        if (++cache.Count >= s_ThreadCacheBlocks) { FlushBatch(cache); }
+    }
+
+    /**
+    * @brief: Gives the cache of the calling thread to the global tier, and returns to the system the blocks above the given number.
+    * @details: Blocks cached by other threads are not touched.
+    *
+    * @param: size_t -> Blocks kept in the global tier.
+    * @return: void.
+    */
+    static void Trim(size_t blocks = 0) noexcept
+    {
+        ThreadCache& cache = s_Cache;
+        if (cache.Blocks) { FlushBatch(cache); }
+
+        Block* batch = s_Global.Batches.exchange(nullptr, std::memory_order_acquire);
+        while (batch && s_Global.Cached.load(std::memory_order_relaxed) > blocks)
+        {
+            Block* next = batch->NextBatch;
+            s_Global.Cached.fetch_sub(batch->Count, std::memory_order_relaxed);
+            ReleaseChain(batch);
+            batch = next;
+        }
+        if (batch) { PushBatches(batch); }
+    }
+
+    /**
+    * @brief: Sets the maximum number of blocks kept by the global tier.
+    * @details: Batches given to a global tier above the limit are returned to the system, the blocks already cached are kept until the next Trim.
+    *
+    * @param: size_t -> Blocks.
+    * @return: void.
+    */
+    static __forceinline void SetHighWater(size_t blocks) noexcept { s_Global.HighWater.store(blocks, std::memory_order_relaxed); }
+
+    //Capacity
+public:
+    /**
+    * @brief: Maximum number of blocks kept by the global tier.
+    *
+    * @return: size_t -> Blocks.
+    */
+    _NODISCARD static __forceinline size_t HighWater() noexcept { return s_Global.HighWater.load(std::memory_order_relaxed); }
+
+    /**
+    * @brief: Number of blocks in the global tier.
+    *
+    * @return: size_t -> Blocks.
+    */
+    _NODISCARD static __forceinline size_t GlobalBlocks() noexcept { return s_Global.Cached.load(std::memory_order_relaxed); }
+
+    /**
+    * @brief: Number of blocks in the cache of the calling thread.
+    *
+    * @return: size_t -> Blocks.
+    */
+    _NODISCARD static __forceinline size_t ThreadBlocks() noexcept { return s_Cache.Count; }
+
+    /**
+    * @brief: Number of blocks requested to the system since the program started.
+    *
+    * @return: size_t -> Blocks.
+    */
+    _NODISCARD static __forceinline size_t UpstreamAllocations() noexcept { return s_Global.UpstreamAllocations.load(std::memory_order_relaxed); }
+
+private:
+    NodePool() = delete;
+
+    static void* AllocateFromGlobal(ThreadCache& cache)
+    {
+        if (!cache.Registered) { RegisterThread(cache); }
+
+        Block* batch = PopBatch();
+        if (batch)
+        {
+            cache.Blocks = batch->Next;
+            cache.Count = batch->Count - 1;
+            return batch;
+        }
+
+        s_Global.UpstreamAllocations.fetch_add(1, std::memory_order_relaxed);
+        if constexpr (s_Alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) { return ::operator new(s_BlockSize, std::align_val_t(s_Alignment)); }
+        else { return ::operator new(s_BlockSize); }
+    }
+
+    static void RegisterThread(ThreadCache& cache) noexcept
+    {
+        cache.Registered = true;
+        s_Exit.Cache = &cache;
+    }
+
+    /**
+    * @brief: Gives all the blocks of the cache to the global tier as a single batch.
+    * @details: The chain of the cache already ends in nullptr, so no block is visited.
+    *
+    * @param: ThreadCache& -> Cache of the calling thread.
+    * @return: void.
+    */
+    static void FlushBatch(ThreadCache& cache) noexcept
+    {
+        PushBatch(cache.Blocks, cache.Count);
+        cache.Blocks = nullptr;
+        cache.Count = 0;
+    }
+
+    /**
+    * @brief: Adds a chain of blocks to the global tier as a single batch.
+    * @details: If the global tier would go above its high water mark, the blocks are returned to the system instead.
+    *
+    * @param: Block* -> First block of the chain, linked through Next and ended by nullptr.
+    * @param: size_t -> Blocks of the chain.
+    * @return: void.
+    */
+    static void PushBatch(Block* first, size_t count) noexcept
+    {
+        if (s_Global.Cached.load(std::memory_order_relaxed) + count > s_Global.HighWater.load(std::memory_order_relaxed))
+        {
+            ReleaseChain(first);
+            return;
+        }
+
+        s_Global.Cached.fetch_add(count, std::memory_order_relaxed);
+        first->Count = count;
+        first->NextBatch = nullptr;
+        PushBatches(first);
+    }
+
+    /**
+    * @brief: Adds a chain of batches to the global tier.
+    * @details: Only whole chains are pushed, and batches are only taken by taking all of them at once,
+    * so the stack never compares a block that could have been popped and pushed again in between (ABA).
+    *
+    * @param: Block* -> First batch of the chain, linked through NextBatch.
+    * @return: void.
+    */
+    static void PushBatches(Block* first) noexcept
+    {
+        Block* last = first;
+        while (last->NextBatch)
+        {
+            last = last->NextBatch;
+        }
+
+        Block* head = s_Global.Batches.load(std::memory_order_relaxed);
+        do
+        {
+            last->NextBatch = head;
+        } while (!s_Global.Batches.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    /**
+    * @brief: Takes a batch from the global tier.
+    * @details: All the batches are taken at once and the remaining ones are pushed back,
+    * a thread that finds the global tier empty meanwhile allocates from the system.
+    *
+    * @return: Block* -> First block of the batch, nullptr if the global tier is empty.
+    */
+    static Block* PopBatch() noexcept
+    {
+        if (!s_Global.Batches.load(std::memory_order_relaxed)) { return nullptr; }
+
+        Block* batch = s_Global.Batches.exchange(nullptr, std::memory_order_acquire);
+        if (!batch) { return nullptr; }
+
+        s_Global.Cached.fetch_sub(batch->Count, std::memory_order_relaxed);
+        if (batch->NextBatch) { PushBatches(batch->NextBatch); }
+        return batch;
+    }
+
+    static void ReleaseChain(Block* first) noexcept
+    {
+        while (first)
+        {
+            Block* next = first->Next;
+            if constexpr (s_Alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) { ::operator delete(first, std::align_val_t(s_Alignment)); }
+            else { ::operator delete(first); }
+            first = next;
+        }
+    }
+
+private:
+    static inline GlobalTier s_Global;
+    static inline thread_local ThreadCache s_Cache{ nullptr, 0, false };
+    static inline thread_local ThreadExit s_Exit;
+
+    static _CONSTEXPR17 size_t s_ThreadCacheBlocks = 128;
+    static _CONSTEXPR17 size_t s_DefaultHighWater = 65536;
+};
+
+/*
+* Allocator that takes single objects from the NodePool of their size, bigger requests go to the system allocator.
+* It has no state, every NodePoolAllocator can release the memory of any other.
+*/
+template<typename T>
+class NodePoolAllocator
+{
+    using Pool = NodePool<sizeof(T), alignof(T)>;
+
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+
+    //Modifiers
+public:
+    _NODISCARD __forceinline T* allocate(size_t count)
+    {
+        if (count == 1) { return static_cast<T*>(Pool::Allocate()); }
+        return std::allocator<T>().allocate(count);
+    }
+
+    __forceinline void deallocate(T* memory, size_t count) noexcept
+    {
+        if (count == 1) { Pool::Deallocate(memory); }
+        else { std::allocator<T>().deallocate(memory, count); }
+    }
+
+    //Member functions
+public:
+    NodePoolAllocator() noexcept = default;
+
+    template<typename U>
+    NodePoolAllocator(const NodePoolAllocator<U>&) noexcept {}
+
+    //Non-member functions
+public:
+    template<typename U>
+    _NODISCARD __forceinline bool operator==(const NodePoolAllocator<U>&) const noexcept { return true; }
+
+    template<typename U>
+    _NODISCARD __forceinline bool operator!=(const NodePoolAllocator<U>&) const noexcept { return false; }
+};
+
+template<typename T>
+struct IsNodePoolAllocator<NodePoolAllocator<T>> : std::true_type {};
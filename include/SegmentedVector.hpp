@@ -0,0 +1,1506 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header class.
+* SegmentedVector class is a sequence container that never relocates its elements.
+* The elements are stored in segments of power of two sizes, each segment doubles the size of the previous one,
+* so growing only allocates a new segment and the references, pointers and iterators to the elements stay valid.
+* The index of an element gives its segment and offset with a bit scan, so the indexing is O(1).
+* The elements of a segment are contiguous and can be traversed segment by segment.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <initializer_list>
+#include <intrin.h>  //For _BitScanReverse and _BitScanReverse64
+#include "TypeTraits.hpp"
+#include "Allocator.hpp"
+
+template<typename T, typename Allocator = std::allocator<T>>
+class SegmentedVector : private AllocatorStorage<Allocator>
+{
+    using AllocatorBase = AllocatorStorage<Allocator>;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    using Propagation = AllocatorPropagation<Allocator>;
+    using AllocatorBase::GetAllocatorReference;
+
+public:
+    template<typename ValueType>
+    class Iterator
+    {
+        friend class SegmentedVector;
+        //Modifiers
+    public:
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Pre increment. The segment is only looked up when the iterator leaves it.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator++() noexcept
+        {
+            ++m_Index;
+            if (m_Ptr != m_Last) { ++m_Ptr; }
+            else { Resolve(); }
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Post increment.
+        *
+        * @return: Iterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline Iterator operator++(int) noexcept
+        {
+            Iterator it(*this);
+            operator++();
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator+=(size_t distance) noexcept
+        {
+            m_Index += distance;
+            Resolve();
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator+=(int distance) noexcept
+        {
+            m_Index += (size_t)distance;
+            Resolve();
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        * @details: By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: void.
+        */
+        void Advance(size_t distance = 1)
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            operator+=(distance);
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        * By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: void.
+        */
+        void Advance(int distance = 1)
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            operator+=(distance);
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Pre increment.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator--() noexcept
+        {
+            if (m_Ptr != m_First)
+            {
+                --m_Index;
+                --m_Ptr;
+                return *this;
+            }
+
+            --m_Index;
+            Resolve();
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Post increment.
+        *
+        * @return: Iterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline Iterator operator--(int) noexcept
+        {
+            Iterator it(*this);
+            operator--();
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator-=(size_t distance) noexcept
+        {
+            m_Index -= distance;
+            Resolve();
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator-=(int distance) noexcept
+        {
+            m_Index -= (size_t)distance;
+            Resolve();
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        * @details: By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: void.
+        */
+        void Retreat(size_t distance = 1)
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            operator-=(distance);
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        * By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: void.
+        */
+        void Retreat(int distance = 1)
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            operator-=(distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator+(size_t distance) const noexcept { return Iterator(m_Vector, m_Index + distance); }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator+(int distance) const noexcept { return Iterator(m_Vector, m_Index + (size_t)distance); }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        * @details: By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD Iterator Next(size_t distance = 1) const
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            return operator+(distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        * @details: By giving a negative number, the iterator will move backward instead.
+        * By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD Iterator Next(int distance = 1) const
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            return operator+(distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator-(size_t distance) const noexcept { return Iterator(m_Vector, m_Index - distance); }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator-(int distance) const noexcept { return Iterator(m_Vector, m_Index - (size_t)distance); }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        * @details: By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD Iterator Prev(size_t distance = 1) const
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            return operator-(distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        * @details: By giving a negative number, the iterator will move forward instead.
+        * By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD Iterator Prev(int distance = 1) const
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            return operator-(distance);
+        }
+
+        //Element access
+    public:
+        /**
+        * @brief: Returns the element to the forward given distance.
+        *
+        * @param: size_t -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD __forceinline ValueType& operator[](size_t index) const noexcept { return *m_Vector->Slot(m_Index + index); }
+
+        /**
+        * @brief: Returns the element to the forward given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD __forceinline ValueType& operator[](int index) const noexcept { return *m_Vector->Slot(m_Index + (size_t)index); }
+
+        /**
+        * @brief: Returns the element to the forward given distance.
+        * @details: If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD ValueType& At(size_t index) const { return *(Next(index)); }
+
+        /**
+        * @brief: Returns the element to the forward given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD ValueType& At(int index) const { return *(Next(index)); }
+
+        /**
+        * @brief: Returns the data of the iterator.
+        *
+        * @return: ValueType& -> Data.
+        */
+        _NODISCARD __forceinline ValueType& operator*() const noexcept { return *m_Ptr; }
+
+        /**
+        * @brief: Returns the data of the iterator.
+        * @details: If the iterator is not valid, throws std::exception.
+        *
+        * @return: ValueType& -> Data.
+        */
+        _NODISCARD ValueType& Data() const
+        {
+            if (!m_Ptr) { throw std::exception("Invalid iterator"); }
+            return *m_Ptr;
+        }
+
+        /**
+        * @brief: Returns the Iterator.
+        *
+        * @return: ValueType* -> Iterator.
+        */
+        _NODISCARD __forceinline ValueType* operator->() const noexcept { return m_Ptr; }
+
+        /**
+        * @brief: Returns the Iterator.
+        * @details: If the iterator is not valid, throws std::exception.
+        *
+        * @return: ValueType* -> Iterator.
+        */
+        _NODISCARD ValueType* Get() const
+        {
+            if (!m_Ptr) { throw std::exception("Invalid iterator"); }
+            return m_Ptr;
+        }
+
+        //Non member functions
+    public:
+        /**
+        * @brief: Returns the distance between the iterator and other.
+        * @details: The result is always a positive number.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: size_t -> Distance.
+        */
+        _NODISCARD size_t Distance(const Iterator& other) const
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            if (!other) { throw std::exception("Invalid parameter"); }
+            if (m_Index > other.m_Index) { return m_Index - other.m_Index; }
+            return other.m_Index - m_Index;
+        }
+
+        /**
+        * @brief: Compares if two iterators are equal.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if both are equal.
+        */
+        _NODISCARD __forceinline bool operator==(const Iterator& other) const noexcept { return m_Index == other.m_Index && m_Vector == other.m_Vector; }
+
+        /**
+        * @brief: Compares if two iterators are not equal.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if both are not equal.
+        */
+        _NODISCARD __forceinline bool operator!=(const Iterator& other) const noexcept { return !(operator==(other)); }
+
+        /**
+        * @brief: Compares if the iterator is lesser than the other.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if the iterator is lesser.
+        */
+        _NODISCARD __forceinline bool operator<(const Iterator& other) const noexcept { return m_Index < other.m_Index; }
+
+        /**
+        * @brief: Compares if the iterator is lesser or equal than the other.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if the iterator is lesser or equal.
+        */
+        _NODISCARD __forceinline bool operator<=(const Iterator& other) const noexcept { return !(operator>(other)); }
+
+        /**
+        * @brief: Compares if the iterator is greater than the other.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if the iterator is greater.
+        */
+        _NODISCARD __forceinline bool operator>(const Iterator& other) const noexcept { return m_Index > other.m_Index; }
+
+        /**
+        * @brief: Compares if the iterator is greater or equal than the other.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if the iterator is greater or equal.
+        */
+        _NODISCARD __forceinline bool operator>=(const Iterator& other) const noexcept { return !(operator<(other)); }
+
+        /**
+        * @brief: Checks if the iterator belongs to a container.
+        *
+        * @return: bool -> True if the iterator is valid.
+        */
+        _NODISCARD __forceinline operator bool() const noexcept { return m_Vector; }
+
+        /**
+        * @brief: Checks if the iterator belongs to a container.
+        *
+        * @return: bool -> True if the iterator is valid.
+        */
+        _NODISCARD __forceinline bool IsValid() const noexcept { return m_Vector; }
+
+        //Member functions
+    public:
+        __forceinline Iterator(const SegmentedVector* vector = nullptr, size_t index = 0) noexcept :
+            m_Vector(vector),
+            m_Index(index)
+        {
+            Resolve();
+        }
+
+        __forceinline Iterator(const Iterator& other) noexcept = default;
+
+        __forceinline Iterator& operator=(const Iterator& other) noexcept = default;
+
+    private:
+        /**
+        * @brief: Looks up the segment of the index.
+        * @details: The positions of a segment without memory, like the end of a full container, get a null pointer.
+        *
+        * @return: void.
+        */
+        __forceinline void Resolve() noexcept
+        {
+            if (!m_Vector || m_Index >= m_Vector->Capacity())
+            {
+                m_Ptr = nullptr;
+                m_First = nullptr;
+                m_Last = nullptr;
+                return;
+            }
+
+            const size_t segment = SegmentedVector::SegmentOf(m_Index);
+            m_First = m_Vector->m_Segments[segment];
+            m_Last = m_First + (SegmentedVector::SegmentSize(segment) - 1);
+            m_Ptr = m_First + SegmentedVector::OffsetOf(m_Index, segment);
+        }
+
+    private:
+        ValueType* m_Ptr = nullptr;
+        ValueType* m_First = nullptr;
+        ValueType* m_Last = nullptr;
+        const SegmentedVector* m_Vector;
+        size_t m_Index;
+    };
+
+    template<typename ValueType>
+    class ReverseIterator
+    {
+        friend class SegmentedVector;
+        //Modifiers
+    public:
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Pre increment.
+        *
+        * @return: ReverseIterator& -> Iterator.
+        */
+        __forceinline ReverseIterator& operator++() noexcept
+        {
+            --m_Iterator;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Post increment.
+        *
+        * @return: ReverseIterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator++(int) noexcept
+        {
+            ReverseIterator it(*this);
+            --m_Iterator;
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: ReverseIterator& -> Iterator.
+        */
+        __forceinline ReverseIterator& operator+=(size_t distance) noexcept
+        {
+            m_Iterator -= distance;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Pre increment.
+        *
+        * @return: ReverseIterator& -> Iterator.
+        */
+        __forceinline ReverseIterator& operator--() noexcept
+        {
+            ++m_Iterator;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Post increment.
+        *
+        * @return: ReverseIterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator--(int) noexcept
+        {
+            ReverseIterator it(*this);
+            ++m_Iterator;
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: ReverseIterator& -> Iterator.
+        */
+        __forceinline ReverseIterator& operator-=(size_t distance) noexcept
+        {
+            m_Iterator += distance;
+            return *this;
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: ReverseIterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator+(size_t distance) const noexcept
+        {
+            ReverseIterator it(*this);
+            it += distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: ReverseIterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator-(size_t distance) const noexcept
+        {
+            ReverseIterator it(*this);
+            it -= distance;
+            return it;
+        }
+
+        //Element access
+    public:
+        /**
+        * @brief: Returns the element to the forward given distance.
+        *
+        * @param: size_t -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD __forceinline ValueType& operator[](size_t index) const noexcept { return *(operator+(index)); }
+
+        /**
+        * @brief: Returns the data of the iterator.
+        *
+        * @return: ValueType& -> Data.
+        */
+        _NODISCARD __forceinline ValueType& operator*() const noexcept { return *m_Iterator; }
+
+        /**
+        * @brief: Returns the Iterator.
+        *
+        * @return: ValueType* -> Iterator.
+        */
+        _NODISCARD __forceinline ValueType* operator->() const noexcept { return m_Iterator.operator->(); }
+
+        //Non member functions
+    public:
+        /**
+        * @brief: Returns the distance between the iterator and other.
+        * @details: The result is always a positive number.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: const ReverseIterator& -> Iterator to compare.
+        *
+        * @return: size_t -> Distance.
+        */
+        _NODISCARD size_t Distance(const ReverseIterator& other) const { return m_Iterator.Distance(other.m_Iterator); }
+
+        _NODISCARD __forceinline bool operator==(const ReverseIterator& other) const noexcept { return m_Iterator == other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator!=(const ReverseIterator& other) const noexcept { return m_Iterator != other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator<(const ReverseIterator& other) const noexcept { return m_Iterator > other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator<=(const ReverseIterator& other) const noexcept { return m_Iterator >= other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator>(const ReverseIterator& other) const noexcept { return m_Iterator < other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator>=(const ReverseIterator& other) const noexcept { return m_Iterator <= other.m_Iterator; }
+
+        _NODISCARD __forceinline operator bool() const noexcept { return m_Iterator.IsValid(); }
+
+        _NODISCARD __forceinline bool IsValid() const noexcept { return m_Iterator.IsValid(); }
+
+        //Member functions
+    public:
+        __forceinline ReverseIterator(const SegmentedVector* vector = nullptr, size_t index = 0) noexcept :
+            m_Iterator(vector, index) {}
+
+        __forceinline ReverseIterator(const ReverseIterator& other) noexcept = default;
+
+        __forceinline ReverseIterator& operator=(const ReverseIterator& other) noexcept = default;
+
+    private:
+        Iterator<ValueType> m_Iterator;
+    };
+
+public:
+    using value_type = T;
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+    using reverse_iterator = ReverseIterator<T>;
+    using const_reverse_iterator = ReverseIterator<const T>;
+    using allocator_type = Allocator;
+
+    //Modifiers
+public:
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: Constant time, a full container allocates the next segment and no element is moved.
+    *
+    * @param: const T& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushBack(const T& element) { EmplaceBack(element); }
+
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: Constant time, a full container allocates the next segment and no element is moved.
+    *
+    * @param: T&& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushBack(T&& element) { EmplaceBack(std::move(element)); }
+
+    /**
+    * @brief: Constructs a new element at the end of the container.
+    * @details: Constant time, a full container allocates the next segment and no element is moved.
+    * std::exception execption will be thrown if the container is full.
+    *
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        if (m_Elements == Capacity())
+        {
+            if (m_Elements == s_MaxSegmentedVectorSize) { SegmentedVectorMaxLenghtError(); }
+            AllocateSegment();
+        }
+
+        T* slot = Slot(m_Elements);
+        new (slot) T(std::forward<Args>(args)...);
+        ++m_Elements;
+
+        return *slot;
+    }
+
+    /**
+    * @brief: Delete the last element of the container.
+    * @details: The segments are kept for the next insertions.
+    *
+    * @return: void.
+    */
+    void PopBack() noexcept
+    {
+        if (IsEmpty()) { return; }
+
+        Slot(m_Elements - 1)->~T();
+        --m_Elements;
+    }
+
+    /**
+    * @brief: Clears the content of the container.
+    * @details: The segments are kept for the next insertions.
+    *
+    * @return: void.
+    */
+    void Clear() noexcept
+    {
+        DestroyElements();
+        m_Elements = 0;
+    }
+
+    /**
+    * @brief: Swaps the content of two SegmentedVectors.
+    * @details: Only the segment tables are exchanged, no element is moved.
+    * The allocators are only swapped if the allocator propagates on swap, otherwise both allocators must be equal.
+    *
+    * @param: SegmentedVector& -> Other vector.
+    * @return: void.
+    */
+    void Swap(SegmentedVector& other) noexcept
+    {
+        if (&other == this) { return; }
+
+        Propagation::OnSwap(GetAllocatorReference(), other.GetAllocatorReference());
+
+        for (size_t i = 0; i < s_MaxSegments; ++i)
+        {
+            T* segment = m_Segments[i];
+            m_Segments[i] = other.m_Segments[i];
+            other.m_Segments[i] = segment;
+        }
+
+        size_t allocated = m_Allocated;
+        size_t elements = m_Elements;
+
+        m_Allocated = other.m_Allocated;
+        m_Elements = other.m_Elements;
+
+        other.m_Allocated = allocated;
+        other.m_Elements = elements;
+    }
+
+    /**
+    * @brief: Appends the elements of other at the end of the container.
+    * @details: The elements are copied segment by segment, other can be the container itself.
+    *
+    * @param: const SegmentedVector& -> Other vector.
+    * @return: void.
+    */
+    void Append(const SegmentedVector& other)
+    {
+        const size_t elements = other.m_Elements;
+        Reserve(m_Elements + elements);
+
+        size_t remaining = elements;
+        for (size_t segment = 0; remaining > 0; ++segment)
+        {
+            const T* data = other.m_Segments[segment];
+            const size_t count = remaining < SegmentSize(segment) ? remaining : SegmentSize(segment);
+            for (size_t i = 0; i < count; ++i)
+            {
+                EmplaceBack(data[i]);
+            }
+            remaining -= count;
+        }
+    }
+
+    /**
+    * @brief: Appends the elements of other at the end of the container.
+    * @details: If the container is empty and both allocators are equal, the segments of other are taken in constant time.
+    * Otherwise the elements are moved one by one. Other is left empty.
+    *
+    * @param: SegmentedVector&& -> Other vector.
+    * @return: void.
+    */
+    void Append(SegmentedVector&& other)
+    {
+        if (&other == this || other.IsEmpty()) { return; }
+        if (IsEmpty() && Propagation::AreEqual(GetAllocatorReference(), other.GetAllocatorReference()))
+        {
+            ReleaseStorage();
+            TakeStorage(other);
+            return;
+        }
+
+        Reserve(m_Elements + other.m_Elements);
+        other.ForEachSegment([this](T* data, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                EmplaceBack(std::move(data[i]));
+            }
+        });
+        other.Clear();
+    }
+
+    //Capacity
+public:
+    /**
+    * @brief: Makes room for at least capacity elements.
+    * @details: The segments up to the capacity are allocated, the elements are never moved.
+    * std::exception execption will be thrown if the capacity is greater than the maximum size.
+    *
+    * @param: size_t -> Capacity.
+    * @return: void.
+    */
+    void Reserve(size_t capacity)
+    {
+        if (capacity > s_MaxSegmentedVectorSize) { SegmentedVectorMaxLenghtError(); }
+
+        while (Capacity() < capacity)
+        {
+            AllocateSegment();
+        }
+    }
+
+    /**
+    * @brief: Requests the removal of unused capacity.
+    * @details: The segments after the one of the last element are released. An empty container releases all its memory.
+    *
+    * @return: void.
+    */
+    void Shrink() noexcept
+    {
+        const size_t segments = IsEmpty() ? 0 : SegmentOf(m_Elements - 1) + 1;
+        while (m_Allocated > segments)
+        {
+            --m_Allocated;
+            FreeSegment(m_Segments[m_Allocated], SegmentSize(m_Allocated));
+            m_Segments[m_Allocated] = nullptr;
+        }
+    }
+
+    /**
+    * @brief: Checks if the container is empty.
+    *
+    * @return: bool -> True if the container has no elements.
+    */
+    _NODISCARD __forceinline bool IsEmpty() const noexcept { return m_Elements == 0; }
+
+    /**
+    * @brief: Number of elements in the container.
+    *
+    * @return: size_t -> Elements.
+    */
+    _NODISCARD __forceinline size_t Size() const noexcept { return m_Elements; }
+
+    /**
+    * @brief: Number of elements that fit in the allocated segments.
+    *
+    * @return: size_t -> Capacity.
+    */
+    _NODISCARD __forceinline size_t Capacity() const noexcept { return SegmentStart(m_Allocated); }
+
+    /**
+    * @brief: Number of allocated segments.
+    *
+    * @return: size_t -> Segments.
+    */
+    _NODISCARD __forceinline size_t Segments() const noexcept { return m_Allocated; }
+
+    //Element Access
+public:
+    /**
+    * @brief: Returns a reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Front() noexcept { return *m_Segments[0]; }
+
+    /**
+    * @brief: Returns a const reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Front() const noexcept { return *m_Segments[0]; }
+
+    /**
+    * @brief: Returns a reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Back() noexcept { return *Slot(m_Elements - 1); }
+
+    /**
+    * @brief: Returns a const reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Back() const noexcept { return *Slot(m_Elements - 1); }
+
+    /**
+    * @brief: Returns a reference to the element at the given index.
+    * @details: The segment and the offset come from the highest bit of the index, no loop is needed.
+    * Calling [] in a empty container is undefined.
+    *
+    * @param: size_t -> Index.
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& operator[](size_t index) noexcept { return *Slot(index); }
+
+    /**
+    * @brief: Returns a const reference to the element at the given index.
+    * @details: Calling [] in a empty container is undefined.
+    *
+    * @param: size_t -> Index.
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& operator[](size_t index) const noexcept { return *Slot(index); }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: T& -> Element.
+    */
+    _NODISCARD T& At(size_t index)
+    {
+        if (index >= m_Elements) { SegmentedVectorOutOfRangeError(); }
+        return *Slot(index);
+    }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: const T& -> Element.
+    */
+    _NODISCARD const T& At(size_t index) const
+    {
+        if (index >= m_Elements) { SegmentedVectorOutOfRangeError(); }
+        return *Slot(index);
+    }
+
+    //Traversal
+public:
+    /**
+    * @brief: Calls function with every contiguous run of elements, one per segment, in order.
+    * @details: Each run can be processed as a plain array.
+    *
+    * @param: Function -> Function that takes a T* with the first element of the run and a size_t with their number.
+    * @return: void.
+    */
+    template<typename Function>
+    void ForEachSegment(Function function)
+    {
+        size_t remaining = m_Elements;
+        for (size_t segment = 0; remaining > 0; ++segment)
+        {
+            const size_t count = remaining < SegmentSize(segment) ? remaining : SegmentSize(segment);
+            function(m_Segments[segment], count);
+            remaining -= count;
+        }
+    }
+
+    /**
+    * @brief: Calls function with every contiguous run of elements, one per segment, in order.
+    * @details: Each run can be processed as a plain array.
+    *
+    * @param: Function -> Function that takes a const T* with the first element of the run and a size_t with their number.
+    * @return: void.
+    */
+    template<typename Function>
+    void ForEachSegment(Function function) const
+    {
+        size_t remaining = m_Elements;
+        for (size_t segment = 0; remaining > 0; ++segment)
+        {
+            const size_t count = remaining < SegmentSize(segment) ? remaining : SegmentSize(segment);
+            function(static_cast<const T*>(m_Segments[segment]), count);
+            remaining -= count;
+        }
+    }
+
+    /**
+    * @brief: Calls function with every element of the container in order.
+    *
+    * @param: Function -> Function that takes a T&.
+    * @return: void.
+    */
+    template<typename Function>
+    void ForEach(Function function)
+    {
+        ForEachSegment([&function](T* data, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                function(data[i]);
+            }
+        });
+    }
+
+    /**
+    * @brief: Calls function with every element of the container in order.
+    *
+    * @param: Function -> Function that takes a const T&.
+    * @return: void.
+    */
+    template<typename Function>
+    void ForEach(Function function) const
+    {
+        ForEachSegment([&function](const T* data, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                function(data[i]);
+            }
+        });
+    }
+
+    //Iterators
+public:
+    /**
+    * @brief: Returns an iterator to the begin of the container.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator begin() noexcept { return iterator(this, 0); }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator begin() const noexcept { return const_iterator(this, 0); }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cbegin() const noexcept { return const_iterator(this, 0); }
+
+    /**
+    * @brief: Returns an iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator end() noexcept { return iterator(this, m_Elements); }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator end() const noexcept { return const_iterator(this, m_Elements); }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cend() const noexcept { return const_iterator(this, m_Elements); }
+
+    /**
+    * @brief: Returns a reverse iterator to the end of the container.
+    * @details: The iterator points to the last element.
+    *
+    * @return: reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline reverse_iterator rbegin() noexcept { return reverse_iterator(this, m_Elements - 1); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the end of the container.
+    * @details: The iterator points to the last element.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(this, m_Elements - 1); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the end of the container.
+    * @details: The iterator points to the last element.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(this, m_Elements - 1); }
+
+    /**
+    * @brief: Returns a reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline reverse_iterator rend() noexcept { return reverse_iterator(this, (size_t)-1); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator rend() const noexcept { return const_reverse_iterator(this, (size_t)-1); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator crend() const noexcept { return const_reverse_iterator(this, (size_t)-1); }
+
+    //Member functions
+public:
+    explicit SegmentedVector() noexcept = default;
+
+    explicit SegmentedVector(const Allocator& allocator) noexcept :
+        AllocatorBase(allocator) {}
+
+    explicit SegmentedVector(size_t capacity)
+    {
+        Reserve(capacity);
+    }
+
+    SegmentedVector(size_t capacity, const Allocator& allocator) :
+        AllocatorBase(allocator)
+    {
+        Reserve(capacity);
+    }
+
+    SegmentedVector(const SegmentedVector& other) :
+        AllocatorBase(Propagation::OnCopyConstruction(other.GetAllocatorReference()))
+    {
+        Append(other);
+    }
+
+    SegmentedVector(SegmentedVector&& other) noexcept :
+        AllocatorBase(std::move(other.GetAllocatorReference()))
+    {
+        TakeStorage(other);
+    }
+
+    SegmentedVector(std::initializer_list<T>&& list)
+    {
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+    }
+
+    SegmentedVector(std::initializer_list<T>&& list, const Allocator& allocator) :
+        AllocatorBase(allocator)
+    {
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+    }
+
+    ~SegmentedVector() noexcept
+    {
+        Nullify();
+    }
+
+    SegmentedVector& operator=(const SegmentedVector& other)
+    {
+        if (&other == this) { return *this; }
+
+        //The segments are released by the current allocator before it is replaced
+        Nullify();
+        Propagation::OnCopyAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        Append(other);
+
+        return *this;
+    }
+
+    SegmentedVector& operator=(SegmentedVector&& other) noexcept(Propagation::s_AlwaysTakesMemory)
+    {
+        if (&other == this) { return *this; }
+
+        Nullify();
+        if (!Propagation::CanTakeMemory(GetAllocatorReference(), other.GetAllocatorReference()))
+        {
+            //The segments of other can not be released by this allocator, the elements are moved one by one
+            Append(std::move(other));
+            return *this;
+        }
+
+        Propagation::OnMoveAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        TakeStorage(other);
+
+        return *this;
+    }
+
+    SegmentedVector& operator=(std::initializer_list<T>&& list)
+    {
+        Clear();
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+
+        return *this;
+    }
+
+    /**
+    * @brief: Returns a copy of the allocator used by the container.
+    *
+    * @return: Allocator -> Allocator.
+    */
+    _NODISCARD __forceinline Allocator GetAllocator() const noexcept { return GetAllocatorReference(); }
+
+    //Non-member functions
+public:
+    /**
+    * @brief: Compares the content of two SegmentedVectors.
+    *
+    * @return: bool -> True if the content of both containers are equal.
+    */
+    _NODISCARD bool operator==(const SegmentedVector& other) const noexcept
+    {
+        if (m_Elements != other.m_Elements) { return false; }
+
+        //Both containers have the same segment sizes, so the segments are compared as arrays
+        size_t remaining = m_Elements;
+        for (size_t segment = 0; remaining > 0; ++segment)
+        {
+            const size_t count = remaining < SegmentSize(segment) ? remaining : SegmentSize(segment);
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (m_Segments[segment][i] != other.m_Segments[segment][i]) { return false; }
+            }
+            remaining -= count;
+        }
+
+        return true;
+    }
+
+    /**
+    * @brief: Compares the content of two SegmentedVectors.
+    *
+    * @return: bool -> True if the content of both containers are not equal.
+    */
+    _NODISCARD __forceinline bool operator!=(const SegmentedVector& other) const noexcept { return !(*this == other); }
+
+private:
+    /**
+    * @brief: Returns the segment of the index.
+    * @details: Segment k holds the indexes [F * (2^k - 1), F * (2^(k + 1) - 1)) where F is the size of the first segment,
+    * so the segment is the position of the highest bit of index + F minus the bits of F.
+    *
+    * @param: size_t -> Index.
+    * @return: size_t -> Segment.
+    */
+    _NODISCARD static __forceinline size_t SegmentOf(size_t index) noexcept
+    {
+        unsigned long bit = 0;
+#if defined(_WIN64)
+        _BitScanReverse64(&bit, (unsigned long long)(index + s_FirstSegmentSize));
+#else
+        _BitScanReverse(&bit, (unsigned long)(index + s_FirstSegmentSize));
+#endif
+        return (size_t)bit - s_FirstSegmentShift;
+    }
+
+    _NODISCARD static __forceinline size_t OffsetOf(size_t index, size_t segment) noexcept
+    {
+        return index - SegmentStart(segment);
+    }
+
+    _NODISCARD static __forceinline _CONSTEXPR17 size_t SegmentSize(size_t segment) noexcept
+    {
+        return s_FirstSegmentSize << segment;
+    }
+
+    /**
+    * @brief: Index of the first element of the segment, also the capacity of the segments before it.
+    *
+    * @param: size_t -> Segment.
+    * @return: size_t -> Index.
+    */
+    _NODISCARD static __forceinline _CONSTEXPR17 size_t SegmentStart(size_t segment) noexcept
+    {
+        return SegmentSize(segment) - s_FirstSegmentSize;
+    }
+
+    _NODISCARD __forceinline T* Slot(size_t index) const noexcept
+    {
+        const size_t segment = SegmentOf(index);
+        return m_Segments[segment] + OffsetOf(index, segment);
+    }
+
+    __forceinline void DestroyElements() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible<T>::value)
+        {
+            ForEachSegment([](T* data, size_t count)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    data[i].~T();
+                }
+            });
+        }
+    }
+
+    __forceinline void Nullify() noexcept
+    {
+        if constexpr (s_SkipTeardown)
+        {
+            //The allocator releases all the memory at once and the elements need no destructor
+            return Default();
+        }
+
+        DestroyElements();
+        ReleaseStorage();
+    }
+
+    /**
+    * @brief: Releases every segment, the elements must be already destroyed or moved.
+    *
+    * @return: void.
+    */
+    void ReleaseStorage() noexcept
+    {
+        for (size_t i = 0; i < m_Allocated; ++i)
+        {
+            FreeSegment(m_Segments[i], SegmentSize(i));
+        }
+
+        Default();
+    }
+
+    /**
+    * @brief: Takes the segments of other, the container must have no storage.
+    *
+    * @param: SegmentedVector& -> Other vector.
+    * @return: void.
+    */
+    __forceinline void TakeStorage(SegmentedVector& other) noexcept
+    {
+        for (size_t i = 0; i < other.m_Allocated; ++i)
+        {
+            m_Segments[i] = other.m_Segments[i];
+        }
+        m_Allocated = other.m_Allocated;
+        m_Elements = other.m_Elements;
+
+        other.Default();
+    }
+
+    void AllocateSegment()
+    {
+        if (m_Allocated == s_MaxSegments) { SegmentedVectorMaxLenghtError(); }
+
+        T* memory_block = nullptr;
+        try { memory_block = AllocatorTraits::allocate(GetAllocatorReference(), SegmentSize(m_Allocated)); }
+        catch (...) { SegmentedVectorBadAllocationError(); }
+
+        m_Segments[m_Allocated] = memory_block;
+        ++m_Allocated;
+    }
+
+    __forceinline void FreeSegment(T* memory_block, size_t segment_size) noexcept
+    {
+        AllocatorTraits::deallocate(GetAllocatorReference(), memory_block, segment_size);
+    }
+
+    __forceinline void Default() noexcept
+    {
+        for (size_t i = 0; i < m_Allocated; ++i)
+        {
+            m_Segments[i] = nullptr;
+        }
+        m_Allocated = 0;
+        m_Elements = 0;
+    }
+
+    [[noreturn]] __forceinline static void SegmentedVectorOutOfRangeError() {
+        throw std::exception("SegmentedVector index out of range");
+    }
+
+    [[noreturn]] __forceinline static void SegmentedVectorMaxLenghtError() {
+        throw std::exception("SegmentedVector too long");
+    }
+
+    [[noreturn]] __forceinline static void SegmentedVectorBadAllocationError() {
+        throw std::exception("Bad allocation");
+    }
+
+private:
+    static _CONSTEXPR17 size_t s_FirstSegmentShift = 4;
+    static _CONSTEXPR17 size_t s_FirstSegmentSize = (size_t)1 << s_FirstSegmentShift;
+    static _CONSTEXPR17 size_t s_MaxSegmentedVectorSize = 10000000;
+    static _CONSTEXPR17 size_t s_MaxSegments = 20;  //16 * (2^20 - 1) elements, enough for the maximum size
+    static _CONSTEXPR17 bool s_SkipTeardown = IsReleaseAllAllocator<Allocator>::value && std::is_trivially_destructible<T>::value;
+
+private:
+    //The table never grows, so the segments are never moved either
+    T* m_Segments[s_MaxSegments] = {};
+    size_t m_Allocated = 0;
+    size_t m_Elements = 0;
+};
+
+/*
+* SegmentedVector that takes its memory from a std::pmr::memory_resource selected at runtime.
+*/
+template<typename T>
+using PmrSegmentedVector = SegmentedVector<T, std::pmr::polymorphic_allocator<T>>;
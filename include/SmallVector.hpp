@@ -0,0 +1,838 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header class.
+* SmallVector class is a sequence container with the same interface as Vector,
+* that stores up to N elements inside the object itself, like an Array.
+* The heap is only used when the number of elements exceeds N, so small and short-lived containers
+* never allocate memory.
+* The iterators are the same as the Vector ones.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <initializer_list>
+#include <cstring>  //For std::memcpy and std::memmove
+#include "Vector.hpp"
+#include "Allocator.hpp"
+
+template<typename T, size_t N, typename GrowthPolicy = DoublingGrowthPolicy, typename Allocator = std::allocator<T>>
+class SmallVector : private AllocatorStorage<Allocator>
+{
+    static_assert(N > 0, "SmallVector needs at least one inline element, use Vector instead");
+
+    using AllocatorBase = AllocatorStorage<Allocator>;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    using Propagation = AllocatorPropagation<Allocator>;
+    using AllocatorBase::GetAllocatorReference;
+
+public:
+    using iterator = typename Vector<T>::iterator;
+    using const_iterator = typename Vector<T>::const_iterator;
+    using reverse_iterator = typename Vector<T>::reverse_iterator;
+    using const_reverse_iterator = typename Vector<T>::const_reverse_iterator;
+    using allocator_type = Allocator;
+
+    //Modifiers
+public:
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: The heap is only used if the inline storage is full.
+    *
+    * @param: const T& -> Element.
+    *
+    * @return: void.
+    */
+    void PushBack(const T& element)
+    {
+        if (IsFull())
+        {
+            if (IsInside(&element))
+            {
+                T copy(element);
+                Grow(m_Elements + 1);
+                new (m_Data + m_Elements++) T(std::move(copy));
+                return;
+            }
+            Grow(m_Elements + 1);
+        }
+        new (m_Data + m_Elements++) T(element);
+    }
+
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: The heap is only used if the inline storage is full.
+    *
+    * @param: T&& -> Element.
+    *
+    * @return: void.
+    */
+    void PushBack(T&& element)
+    {
+        if (IsFull())
+        {
+            if (IsInside(&element))
+            {
+                T copy(std::move(element));
+                Grow(m_Elements + 1);
+                new (m_Data + m_Elements++) T(std::move(copy));
+                return;
+            }
+            Grow(m_Elements + 1);
+        }
+        new (m_Data + m_Elements++) T(std::move(element));
+    }
+
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: The element is constructed in place.
+    *
+    * @param: Args -> Arguments needed to create the element.
+    *
+    * @return: Iterator -> Iterator to the new element.
+    */
+    template<typename... Args>
+    iterator EmplaceBack(Args&&... args)
+    {
+        if (IsFull()) { Grow(m_Elements + 1); }
+        new (m_Data + m_Elements) T(std::forward<Args>(args)...);
+        return iterator(m_Data + m_Elements++);
+    }
+
+    /**
+    * @brief: Inserts a new element into the container directly before index.
+    * @details: If the index is out of range, the element is inserted at the end.
+    *
+    * @param: size_t -> Index.
+    * @param: const T& -> Element.
+    *
+    * @return: Iterator -> Iterator to the new element.
+    */
+    iterator Insert(size_t index, const T& element)
+    {
+        if (IsInside(&element))
+        {
+            T copy(element);
+            return Emplace(index, std::move(copy));
+        }
+        return Emplace(index, element);
+    }
+
+    /**
+    * @brief: Inserts a new element into the container directly before the position.
+    *
+    * @param: Iterator -> Position.
+    * @param: const T& -> Element.
+    *
+    * @return: Iterator -> Iterator to the new element.
+    */
+    iterator Insert(iterator it, const T& element) { return Insert(IndexOf(it), element); }
+
+    /**
+    * @brief: Inserts a new element into the container directly before index.
+    * @details: If the index is out of range, the element is inserted at the end.
+    *
+    * @param: size_t -> Index.
+    * @param: T&& -> Element.
+    *
+    * @return: Iterator -> Iterator to the new element.
+    */
+    iterator Insert(size_t index, T&& element)
+    {
+        if (IsInside(&element))
+        {
+            T copy(std::move(element));
+            return Emplace(index, std::move(copy));
+        }
+        return Emplace(index, std::move(element));
+    }
+
+    /**
+    * @brief: Inserts a new element into the container directly before the position.
+    *
+    * @param: Iterator -> Position.
+    * @param: T&& -> Element.
+    *
+    * @return: Iterator -> Iterator to the new element.
+    */
+    iterator Insert(iterator it, T&& element) { return Insert(IndexOf(it), std::move(element)); }
+
+    /**
+    * @brief: Inserts a new element into the container directly before index.
+    * @details: The element is constructed in place.
+    * If the index is out of range, the element is inserted at the end.
+    *
+    * @param: size_t -> Index.
+    * @param: Args -> Arguments needed to create the element.
+    *
+    * @return: Iterator -> Iterator to the new element.
+    */
+    template<typename... Args>
+    iterator Emplace(size_t index, Args&&... args)
+    {
+        if (index >= m_Elements) { return EmplaceBack(std::forward<Args>(args)...); }
+
+        T* gap = OpenGap(index);
+        new (gap) T(std::forward<Args>(args)...);
+        ++m_Elements;
+
+        return iterator(gap);
+    }
+
+    /**
+    * @brief: Inserts a new element into the container directly before the position.
+    * @details: The element is constructed in place.
+    *
+    * @param: Iterator -> Position.
+    * @param: Args -> Arguments needed to create the element.
+    *
+    * @return: Iterator -> Iterator to the new element.
+    */
+    template<typename... Args>
+    iterator Emplace(iterator it, Args&&... args) { return Emplace(IndexOf(it), std::forward<Args>(args)...); }
+
+    /**
+    * @brief: Delete the last element of the container.
+    * @details: No reallocations are performed.
+    *
+    * @return: void.
+    */
+    void PopBack() noexcept
+    {
+        if (IsEmpty()) { return; }
+        m_Data[--m_Elements].~T();
+    }
+
+    /**
+    * @brief: Delete the element at the given index.
+    * @details: No reallocations are performed.
+    *
+    * @param: size_t -> Index.
+    *
+    * @return: Iterator -> Iterator to the element at the index position after deleting.
+    */
+    iterator Erase(size_t index) noexcept
+    {
+        if (index >= m_Elements) { return end(); }
+
+        T* position = m_Data + index;
+        T* last = m_Data + m_Elements;
+        if constexpr (IsTriviallyRelocatable<T>::value)
+        {
+            position->~T();
+            std::memmove((void*)position, (const void*)(position + 1), sizeof(T) * (last - position - 1));
+        }
+        else
+        {
+            for (T* ptr = position; ptr + 1 != last; ++ptr)
+            {
+                *ptr = std::move(*(ptr + 1));
+            }
+            (last - 1)->~T();
+        }
+        --m_Elements;
+
+        return iterator(position);
+    }
+
+    /**
+    * @brief: Delete the element at the given position.
+    * @details: No reallocations are performed.
+    *
+    * @param: Iterator -> Position.
+    *
+    * @return: Iterator -> Iterator to the element at the index position after deleting.
+    */
+    iterator Erase(iterator it) noexcept { return Erase(IndexOf(it)); }
+
+    /**
+    * @brief: Clears the content of the container.
+    * @details: By clearing the container, no reallocations are performed.
+    *
+    * @return: void.
+    */
+    void Clear() noexcept
+    {
+        for (size_t i = 0; i < m_Elements; ++i)
+        {
+            m_Data[i].~T();
+        }
+        m_Elements = 0;
+    }
+
+    /**
+    * @brief: Swaps the content of two SmallVectors.
+    * @details: If both containers are on the heap no element is moved, otherwise the inline elements are moved.
+    * The allocators are only swapped if the allocator propagates on swap.
+    * Can throw exceptions (Typically std::bad_alloc) when the elements are moved instead of the memory blocks.
+    *
+    * @param: SmallVector& -> SmallVector to swap.
+    *
+    * @return: void.
+    */
+    void Swap(SmallVector& other)
+    {
+        if (this == &other) { return; }
+        if (!IsInline() && !other.IsInline() && CanSwapMemory(other))
+        {
+            Propagation::OnSwap(GetAllocatorReference(), other.GetAllocatorReference());
+
+            T* aux_data = m_Data;
+            size_t aux_capacity = m_Capacity;
+            size_t aux_elements = m_Elements;
+
+            m_Data = other.m_Data;
+            m_Capacity = other.m_Capacity;
+            m_Elements = other.m_Elements;
+
+            other.m_Data = aux_data;
+            other.m_Capacity = aux_capacity;
+            other.m_Elements = aux_elements;
+            return;
+        }
+
+        SmallVector aux(std::move(other));
+        other = std::move(*this);
+        *this = std::move(aux);
+    }
+
+    //Capacity
+public:
+    /**
+    * @brief: Requests the removal of unused capacity.
+    * @details: If the elements fit in the inline storage, the heap block is released.
+    *
+    * @return: void.
+    */
+    void Shrink()
+    {
+        if (IsInline() || m_Capacity == m_Elements) { return; }
+
+        if (m_Elements <= N) { return Relocate(InlineData(), N); }
+        Relocate(AllocateNewBlock(m_Elements), m_Elements);
+    }
+
+    /**
+    * @brief: Resizes the container to the new capacity.
+    * @details: Causes reallocation, the new capacity must be greater than the current capacity.
+    * Can throw exceptions (Typically std::bad_alloc)
+    *
+    * @param: size_t -> New capacity.
+    *
+    * @return: void.
+    */
+    void Reserve(size_t capacity)
+    {
+        if (capacity <= m_Capacity) { return; }
+        if (capacity > s_MaxSmallVectorSize) { SmallVectorMaxLenghtError(); }
+
+        Relocate(AllocateNewBlock(capacity), capacity);
+    }
+
+    /**
+    * @brief: Checks if the container is empty.
+    *
+    * @return: bool -> True if the container has no elements.
+    */
+    _NODISCARD __forceinline bool IsEmpty() const noexcept { return m_Elements == 0; }
+
+    /**
+    * @brief: Checks if the container is full.
+    *
+    * @return: bool -> True if the container is full.
+    */
+    _NODISCARD __forceinline bool IsFull() const noexcept { return m_Elements == m_Capacity; }
+
+    /**
+    * @brief: Checks if the elements are stored inside the object.
+    *
+    * @return: bool -> True if the container is not using the heap.
+    */
+    _NODISCARD __forceinline bool IsInline() const noexcept { return m_Data == InlineData(); }
+
+    /**
+    * @brief: Current capacity of the container.
+    *
+    * @return: size_t -> Capacity.
+    */
+    _NODISCARD __forceinline size_t Capacity() const noexcept { return m_Capacity; }
+
+    /**
+    * @brief: Number of elements that can be stored without using the heap.
+    *
+    * @return: size_t -> Inline capacity.
+    */
+    _NODISCARD static _CONSTEXPR17 size_t InlineCapacity() noexcept { return N; }
+
+    /**
+    * @brief: Number of elements in the container.
+    *
+    * @return: size_t -> Elements.
+    */
+    _NODISCARD __forceinline size_t Size() const noexcept { return m_Elements; }
+
+    //Element Access
+public:
+    /**
+    * @brief: Return the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Front() noexcept { return m_Data[0]; }
+
+    /**
+    * @brief: Return the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Front() const noexcept { return m_Data[0]; }
+
+    /**
+    * @brief: Return the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Back() noexcept { return m_Data[m_Elements - 1]; }
+
+    /**
+    * @brief: Return the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Back() const noexcept { return m_Data[m_Elements - 1]; }
+
+    /**
+    * @brief: Return the element at the given index.
+    * @details: Calling [] in a empty container is undefined.
+    *
+    * @param: size_t -> Position.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& operator[](size_t index) noexcept { return m_Data[index]; }
+
+    /**
+    * @brief: Return the element at the given index.
+    * @details: Calling [] in a empty container is undefined.
+    *
+    * @param: size_t -> Position.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& operator[](size_t index) const noexcept { return m_Data[index]; }
+
+    /**
+    * @brief: Return the element of the container at the given index.
+    * @details: If the index is out of range, throws std::exception.
+    *
+    * @param: size_t -> Position.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& At(size_t index)
+    {
+        if (index >= m_Elements) { SmallVectorOutOfRangeError(); }
+        return m_Data[index];
+    }
+
+    /**
+    * @brief: Return the element of the container at the given index.
+    * @details: If the index is out of range, throws std::exception.
+    *
+    * @param: size_t -> Position.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& At(size_t index) const
+    {
+        if (index >= m_Elements) { SmallVectorOutOfRangeError(); }
+        return m_Data[index];
+    }
+
+    /**
+    * @brief: Return a pointer to the container data.
+    *
+    * @return: T* -> Data.
+    */
+    _NODISCARD __forceinline T* Data() noexcept { return m_Data; }
+
+    /**
+    * @brief: Return a pointer to the container data.
+    *
+    * @return: const T* -> Data.
+    */
+    _NODISCARD __forceinline const T* Data() const noexcept { return m_Data; }
+
+    //Iterators
+public:
+    _NODISCARD __forceinline iterator begin() noexcept { return iterator(m_Data); }
+
+    _NODISCARD __forceinline const_iterator begin() const noexcept { return const_iterator(m_Data); }
+
+    _NODISCARD __forceinline const_iterator cbegin() const noexcept { return const_iterator(m_Data); }
+
+    _NODISCARD __forceinline iterator end() noexcept { return iterator(m_Data + m_Elements); }
+
+    _NODISCARD __forceinline const_iterator end() const noexcept { return const_iterator(m_Data + m_Elements); }
+
+    _NODISCARD __forceinline const_iterator cend() const noexcept { return const_iterator(m_Data + m_Elements); }
+
+    _NODISCARD __forceinline reverse_iterator rbegin() noexcept { return reverse_iterator(m_Data + m_Elements - 1); }
+
+    _NODISCARD __forceinline const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(m_Data + m_Elements - 1); }
+
+    _NODISCARD __forceinline const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(m_Data + m_Elements - 1); }
+
+    _NODISCARD __forceinline reverse_iterator rend() noexcept { return reverse_iterator(m_Data - 1); }
+
+    _NODISCARD __forceinline const_reverse_iterator rend() const noexcept { return const_reverse_iterator(m_Data - 1); }
+
+    _NODISCARD __forceinline const_reverse_iterator crend() const noexcept { return const_reverse_iterator(m_Data - 1); }
+
+    //Member functions
+public:
+    SmallVector() noexcept :
+        m_Data(InlineData()) {}
+
+    explicit SmallVector(const Allocator& allocator) noexcept :
+        AllocatorBase(allocator),
+        m_Data(InlineData()) {}
+
+    explicit SmallVector(size_t capacity) :
+        m_Data(InlineData())
+    {
+        Reserve(capacity);
+    }
+
+    SmallVector(size_t capacity, const Allocator& allocator) :
+        AllocatorBase(allocator),
+        m_Data(InlineData())
+    {
+        Reserve(capacity);
+    }
+
+    SmallVector(const SmallVector& other) :
+        AllocatorBase(Propagation::OnCopyConstruction(other.GetAllocatorReference())),
+        m_Data(InlineData())
+    {
+        CopyFromSmallVector(other);
+    }
+
+    SmallVector(SmallVector&& other) noexcept :
+        AllocatorBase(std::move(other.GetAllocatorReference())),
+        m_Data(InlineData())
+    {
+        MoveFromSmallVector(std::move(other));
+    }
+
+    SmallVector(std::initializer_list<T>&& list) :
+        m_Data(InlineData())
+    {
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            new (m_Data + m_Elements++) T(std::move(*it));
+        }
+    }
+
+    SmallVector(std::initializer_list<T>&& list, const Allocator& allocator) :
+        AllocatorBase(allocator),
+        m_Data(InlineData())
+    {
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            new (m_Data + m_Elements++) T(std::move(*it));
+        }
+    }
+
+    ~SmallVector() noexcept
+    {
+        Nullify();
+    }
+
+    SmallVector& operator=(const SmallVector& other)
+    {
+        if (this == &other) { return *this; }
+
+        Clear();
+        if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value)
+        {
+            //The heap block must be released by the allocator that created it
+            if (GetAllocatorReference() != other.GetAllocatorReference()) { Nullify(); }
+        }
+        Propagation::OnCopyAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        CopyFromSmallVector(other);
+
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(Propagation::s_AlwaysTakesMemory)
+    {
+        if (this == &other) { return *this; }
+
+        Nullify();
+        if (!other.IsInline() && !Propagation::CanTakeMemory(GetAllocatorReference(), other.GetAllocatorReference()))
+        {
+            //The heap block of other can not be released by this allocator, the elements are moved one by one
+            Reserve(other.m_Elements);
+            RelocateElements(m_Data, other.m_Data, other.m_Elements);
+            m_Elements = other.m_Elements;
+            other.m_Elements = 0;
+            other.Nullify();
+            return *this;
+        }
+
+        Propagation::OnMoveAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        MoveFromSmallVector(std::move(other));
+
+        return *this;
+    }
+
+    /**
+    * @brief: Returns a copy of the allocator used by the container.
+    *
+    * @return: Allocator -> Allocator.
+    */
+    _NODISCARD __forceinline Allocator GetAllocator() const noexcept { return GetAllocatorReference(); }
+
+    //Non-member functions
+public:
+    /**
+    * @brief: Compares the content of two SmallVectors.
+    *
+    * @return: bool -> True if the content of both containers are equal.
+    */
+    _NODISCARD __forceinline bool operator==(const SmallVector& other) const noexcept
+    {
+        if (this == &other) { return true; }
+        if (m_Elements != other.m_Elements) { return false; }
+
+        for (size_t i = 0; i < m_Elements; ++i)
+        {
+            if (m_Data[i] != other.m_Data[i]) { return false; }
+        }
+
+        return true;
+    }
+
+    /**
+    * @brief: Compares the content of two SmallVectors.
+    *
+    * @return: bool -> True if the content of both containers are not equal.
+    */
+    _NODISCARD __forceinline bool operator!=(const SmallVector& other) const noexcept { return !(operator==(other)); }
+
+private:
+    _NODISCARD __forceinline T* InlineData() noexcept { return reinterpret_cast<T*>(m_Inline); }
+
+    _NODISCARD __forceinline const T* InlineData() const noexcept { return reinterpret_cast<const T*>(m_Inline); }
+
+    _NODISCARD __forceinline size_t IndexOf(iterator it) const noexcept { return it.operator->() - m_Data; }
+
+    _NODISCARD __forceinline bool IsInside(const T* ptr) const noexcept { return ptr >= m_Data && ptr < m_Data + m_Elements; }
+
+    __forceinline void CopyFromSmallVector(const SmallVector& other)
+    {
+        Reserve(other.m_Elements);
+        for (size_t i = 0; i < other.m_Elements; ++i)
+        {
+            new (m_Data + i) T(other.m_Data[i]);
+        }
+        m_Elements = other.m_Elements;
+    }
+
+    /**
+    * @brief: Takes the content of other, the current container must be empty and inline.
+    * @details: A heap block is stolen, inline elements are moved one by one.
+    *
+    * @param: SmallVector&& -> SmallVector to move.
+    *
+    * @return: void.
+    */
+    __forceinline void MoveFromSmallVector(SmallVector&& other) noexcept
+    {
+        if (other.IsInline())
+        {
+            RelocateElements(m_Data, other.m_Data, other.m_Elements);
+            m_Elements = other.m_Elements;
+            other.m_Elements = 0;
+            return;
+        }
+
+        m_Data = other.m_Data;
+        m_Capacity = other.m_Capacity;
+        m_Elements = other.m_Elements;
+
+        other.m_Data = other.InlineData();
+        other.m_Capacity = N;
+        other.m_Elements = 0;
+    }
+
+    __forceinline void Nullify() noexcept
+    {
+        Clear();
+        if (!IsInline())
+        {
+            FreeBlock(m_Data, m_Capacity);
+            m_Data = InlineData();
+            m_Capacity = N;
+        }
+    }
+
+    void Grow(size_t required)
+    {
+        size_t capacity = GrowthPolicy::NextCapacity(m_Capacity, sizeof(T));
+        if (capacity < required) { capacity = required; }
+        if (capacity > s_MaxSmallVectorSize && required <= s_MaxSmallVectorSize) { capacity = s_MaxSmallVectorSize; }
+
+        Reserve(capacity);
+    }
+
+    /**
+    * @brief: Opens a gap of one uninitialized element at the given index, growing the storage if needed.
+    * @details: The number of elements is not updated.
+    *
+    * @param: size_t -> Index of the gap.
+    *
+    * @return: T* -> Gap.
+    */
+    T* OpenGap(size_t index)
+    {
+        if (IsFull()) { Grow(m_Elements + 1); }
+
+        T* gap = m_Data + index;
+        T* last = m_Data + m_Elements;
+        if constexpr (IsTriviallyRelocatable<T>::value)
+        {
+            std::memmove((void*)(gap + 1), (const void*)gap, sizeof(T) * (last - gap));
+        }
+        else
+        {
+            new (last) T(std::move(*(last - 1)));
+            for (T* ptr = last - 1; ptr != gap; --ptr)
+            {
+                *ptr = std::move(*(ptr - 1));
+            }
+            gap->~T();
+        }
+
+        return gap;
+    }
+
+    /**
+    * @brief: Moves the elements to the given block and releases the current heap block.
+    *
+    * @param: T* -> New block, inline storage or heap.
+    * @param: size_t -> Capacity of the new block.
+    *
+    * @return: void.
+    */
+    void Relocate(T* memory_block, size_t capacity) noexcept
+    {
+        RelocateElements(memory_block, m_Data, m_Elements);
+        if (!IsInline()) { FreeBlock(m_Data, m_Capacity); }
+
+        m_Data = memory_block;
+        m_Capacity = capacity;
+    }
+
+    static __forceinline void RelocateElements(T* to, T* from, size_t elements) noexcept
+    {
+        if constexpr (IsTriviallyRelocatable<T>::value)
+        {
+            if (elements) { std::memcpy((void*)to, (const void*)from, sizeof(T) * elements); }
+        }
+        else
+        {
+            for (size_t i = 0; i < elements; ++i)
+            {
+                new (to + i) T(std::move(from[i]));
+                from[i].~T();
+            }
+        }
+    }
+
+    _NODISCARD T* AllocateNewBlock(size_t size)
+    {
+        T* memory_block = nullptr;
+        try
+        {
+            memory_block = AllocatorTraits::allocate(GetAllocatorReference(), size);
+        }
+        catch (...)
+        {
+            SmallVectorBadAllocationError();
+        }
+
+        return memory_block;
+    }
+
+    __forceinline void FreeBlock(T* memory_block, size_t size) noexcept
+    {
+        AllocatorTraits::deallocate(GetAllocatorReference(), memory_block, size);
+    }
+
+    _NODISCARD __forceinline bool CanSwapMemory(const SmallVector& other) const noexcept
+    {
+        if constexpr (AllocatorTraits::propagate_on_container_swap::value) { return true; }
+        else { return Propagation::AreEqual(GetAllocatorReference(), other.GetAllocatorReference()); }
+    }
+
+    [[noreturn]] static __forceinline void SmallVectorOutOfRangeError() {
+        throw std::exception("SmallVector index out of range");
+    }
+
+    [[noreturn]] static __forceinline void SmallVectorMaxLenghtError() {
+        throw std::exception("SmallVector too long");
+    }
+
+    [[noreturn]] static __forceinline void SmallVectorBadAllocationError() {
+        throw std::exception("Bad allocation");
+    }
+
+private:
+    T* m_Data = nullptr;
+    size_t m_Capacity = N;
+    size_t m_Elements = 0;
+    alignas(T) unsigned char m_Inline[sizeof(T) * N];
+
+    static _CONSTEXPR17 size_t s_MaxSmallVectorSize = 10000000;
+};
+
+/*
+* SmallVector that takes its heap memory from a std::pmr::memory_resource selected at runtime.
+*/
+template<typename T, size_t N, typename GrowthPolicy = DoublingGrowthPolicy>
+using PmrSmallVector = SmallVector<T, N, GrowthPolicy, std::pmr::polymorphic_allocator<T>>;
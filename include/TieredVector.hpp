@@ -0,0 +1,1850 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header class.
+* TieredVector class is a sequence container with constant time access by index and O(sqrt(n)) insertion and removal at any position.
+* The elements are stored in tiers of the same size, each tier is a circular array and all of them are full except the last one.
+* Inserting shifts the elements of one tier and then moves the last element of each following tier to the front of the next one,
+* which only moves the start of its circular array.
+* The size of the tiers is a power of two close to sqrt(n), when every tier is full the size doubles and the elements are moved to the new tiers.
+* Inserting or erasing elements invalidates the iterators and the references to the elements.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <initializer_list>
+#include <cstring>  //For std::memcpy
+#include "TypeTraits.hpp"
+#include "Allocator.hpp"
+
+template<typename T, typename Allocator = std::allocator<T>>
+class TieredVector : private AllocatorStorage<Allocator>
+{
+    /*
+    * Circular array of TierSize elements, the element at local position i is at Data[(Offset + i) & TierMask].
+    */
+    struct Tier
+    {
+        T* Data;
+        size_t Offset;
+    };
+
+    using AllocatorBase = AllocatorStorage<Allocator>;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    using Propagation = AllocatorPropagation<Allocator>;
+    using AllocatorBase::GetAllocatorReference;
+
+    using TierAllocator = typename AllocatorTraits::template rebind_alloc<Tier>;
+    using TierTraits = std::allocator_traits<TierAllocator>;
+
+public:
+    template<typename ValueType>
+    class Iterator
+    {
+        friend class TieredVector;
+        //Modifiers
+    public:
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Pre increment. The tier is only looked up when the iterator leaves it or wraps around its circular array.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator++() noexcept
+        {
+            ++m_Index;
+            if (m_Ptr != m_Last && (m_Index & m_Vector->TierMask())) { ++m_Ptr; }
+            else { Resolve(); }
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Post increment.
+        *
+        * @return: Iterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline Iterator operator++(int) noexcept
+        {
+            Iterator it(*this);
+            operator++();
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator+=(size_t distance) noexcept
+        {
+            m_Index += distance;
+            Resolve();
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator+=(int distance) noexcept
+        {
+            m_Index += (size_t)distance;
+            Resolve();
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        * @details: By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: void.
+        */
+        void Advance(size_t distance = 1)
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            operator+=(distance);
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        * By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: void.
+        */
+        void Advance(int distance = 1)
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            operator+=(distance);
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Pre increment.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator--() noexcept
+        {
+            if (m_Ptr != m_First && (m_Index & m_Vector->TierMask()))
+            {
+                --m_Index;
+                --m_Ptr;
+                return *this;
+            }
+
+            --m_Index;
+            Resolve();
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Post increment.
+        *
+        * @return: Iterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline Iterator operator--(int) noexcept
+        {
+            Iterator it(*this);
+            operator--();
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator-=(size_t distance) noexcept
+        {
+            m_Index -= distance;
+            Resolve();
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator& -> Iterator.
+        */
+        __forceinline Iterator& operator-=(int distance) noexcept
+        {
+            m_Index -= (size_t)distance;
+            Resolve();
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        * @details: By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: void.
+        */
+        void Retreat(size_t distance = 1)
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            operator-=(distance);
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        * By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: void.
+        */
+        void Retreat(int distance = 1)
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            operator-=(distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator+(size_t distance) const noexcept { return Iterator(m_Vector, m_Index + distance); }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator+(int distance) const noexcept { return Iterator(m_Vector, m_Index + (size_t)distance); }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        * @details: By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD Iterator Next(size_t distance = 1) const
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            return operator+(distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        * @details: By giving a negative number, the iterator will move backward instead.
+        * By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD Iterator Next(int distance = 1) const
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            return operator+(distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator-(size_t distance) const noexcept { return Iterator(m_Vector, m_Index - distance); }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator-(int distance) const noexcept { return Iterator(m_Vector, m_Index - (size_t)distance); }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        * @details: By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD Iterator Prev(size_t distance = 1) const
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            return operator-(distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        * @details: By giving a negative number, the iterator will move forward instead.
+        * By default the distance is 1.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance to move.
+        *
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD Iterator Prev(int distance = 1) const
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            return operator-(distance);
+        }
+
+        //Element access
+    public:
+        /**
+        * @brief: Returns the element to the forward given distance.
+        *
+        * @param: size_t -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD __forceinline ValueType& operator[](size_t index) const noexcept { return *m_Vector->Slot(m_Index + index); }
+
+        /**
+        * @brief: Returns the element to the forward given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD __forceinline ValueType& operator[](int index) const noexcept { return *m_Vector->Slot(m_Index + (size_t)index); }
+
+        /**
+        * @brief: Returns the element to the forward given distance.
+        * @details: If the iterator is not valid, throws std::exception.
+        *
+        * @param: size_t -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD ValueType& At(size_t index) const { return *(Next(index)); }
+
+        /**
+        * @brief: Returns the element to the forward given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: int -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD ValueType& At(int index) const { return *(Next(index)); }
+
+        /**
+        * @brief: Returns the data of the iterator.
+        *
+        * @return: ValueType& -> Data.
+        */
+        _NODISCARD __forceinline ValueType& operator*() const noexcept { return *m_Ptr; }
+
+        /**
+        * @brief: Returns the data of the iterator.
+        * @details: If the iterator is not valid, throws std::exception.
+        *
+        * @return: ValueType& -> Data.
+        */
+        _NODISCARD ValueType& Data() const
+        {
+            if (!m_Ptr) { throw std::exception("Invalid iterator"); }
+            return *m_Ptr;
+        }
+
+        /**
+        * @brief: Returns the Iterator.
+        *
+        * @return: ValueType* -> Iterator.
+        */
+        _NODISCARD __forceinline ValueType* operator->() const noexcept { return m_Ptr; }
+
+        /**
+        * @brief: Returns the Iterator.
+        * @details: If the iterator is not valid, throws std::exception.
+        *
+        * @return: ValueType* -> Iterator.
+        */
+        _NODISCARD ValueType* Get() const
+        {
+            if (!m_Ptr) { throw std::exception("Invalid iterator"); }
+            return m_Ptr;
+        }
+
+        //Non member functions
+    public:
+        /**
+        * @brief: Returns the distance between the iterator and other.
+        * @details: The result is always a positive number.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: size_t -> Distance.
+        */
+        _NODISCARD size_t Distance(const Iterator& other) const
+        {
+            if (!m_Vector) { throw std::exception("Invalid iterator"); }
+            if (!other) { throw std::exception("Invalid parameter"); }
+            if (m_Index > other.m_Index) { return m_Index - other.m_Index; }
+            return other.m_Index - m_Index;
+        }
+
+        /**
+        * @brief: Compares if two iterators are equal.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if both are equal.
+        */
+        _NODISCARD __forceinline bool operator==(const Iterator& other) const noexcept { return m_Index == other.m_Index && m_Vector == other.m_Vector; }
+
+        /**
+        * @brief: Compares if two iterators are not equal.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if both are not equal.
+        */
+        _NODISCARD __forceinline bool operator!=(const Iterator& other) const noexcept { return !(operator==(other)); }
+
+        /**
+        * @brief: Compares if the iterator is lesser than the other.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if the iterator is lesser.
+        */
+        _NODISCARD __forceinline bool operator<(const Iterator& other) const noexcept { return m_Index < other.m_Index; }
+
+        /**
+        * @brief: Compares if the iterator is lesser or equal than the other.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if the iterator is lesser or equal.
+        */
+        _NODISCARD __forceinline bool operator<=(const Iterator& other) const noexcept { return !(operator>(other)); }
+
+        /**
+        * @brief: Compares if the iterator is greater than the other.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if the iterator is greater.
+        */
+        _NODISCARD __forceinline bool operator>(const Iterator& other) const noexcept { return m_Index > other.m_Index; }
+
+        /**
+        * @brief: Compares if the iterator is greater or equal than the other.
+        *
+        * @param: const Iterator& -> Iterator to compare.
+        *
+        * @return: bool -> True if the iterator is greater or equal.
+        */
+        _NODISCARD __forceinline bool operator>=(const Iterator& other) const noexcept { return !(operator<(other)); }
+
+        /**
+        * @brief: Checks if the iterator belongs to a container.
+        *
+        * @return: bool -> True if the iterator is valid.
+        */
+        _NODISCARD __forceinline operator bool() const noexcept { return m_Vector; }
+
+        /**
+        * @brief: Checks if the iterator belongs to a container.
+        *
+        * @return: bool -> True if the iterator is valid.
+        */
+        _NODISCARD __forceinline bool IsValid() const noexcept { return m_Vector; }
+
+        //Member functions
+    public:
+        __forceinline Iterator(const TieredVector* vector = nullptr, size_t index = 0) noexcept :
+            m_Vector(vector),
+            m_Index(index)
+        {
+            Resolve();
+        }
+
+        __forceinline Iterator(const Iterator& other) noexcept = default;
+
+        __forceinline Iterator& operator=(const Iterator& other) noexcept = default;
+
+    private:
+        /**
+        * @brief: Looks up the tier of the index.
+        * @details: The positions of a tier without memory, like the end of a full container, get a null pointer.
+        *
+        * @return: void.
+        */
+        __forceinline void Resolve() noexcept
+        {
+            const Tier* tier = m_Vector ? m_Vector->TierOf(m_Index) : nullptr;
+            if (!tier)
+            {
+                m_Ptr = nullptr;
+                m_First = nullptr;
+                m_Last = nullptr;
+                return;
+            }
+
+            m_First = tier->Data;
+            m_Last = tier->Data + m_Vector->TierMask();
+            m_Ptr = tier->Data + ((tier->Offset + m_Index) & m_Vector->TierMask());
+        }
+
+    private:
+        ValueType* m_Ptr = nullptr;
+        ValueType* m_First = nullptr;
+        ValueType* m_Last = nullptr;
+        const TieredVector* m_Vector;
+        size_t m_Index;
+    };
+
+    template<typename ValueType>
+    class ReverseIterator
+    {
+        friend class TieredVector;
+        //Modifiers
+    public:
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Pre increment.
+        *
+        * @return: ReverseIterator& -> Iterator.
+        */
+        __forceinline ReverseIterator& operator++() noexcept
+        {
+            --m_Iterator;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Post increment.
+        *
+        * @return: ReverseIterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator++(int) noexcept
+        {
+            ReverseIterator it(*this);
+            --m_Iterator;
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: ReverseIterator& -> Iterator.
+        */
+        __forceinline ReverseIterator& operator+=(size_t distance) noexcept
+        {
+            m_Iterator -= distance;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Pre increment.
+        *
+        * @return: ReverseIterator& -> Iterator.
+        */
+        __forceinline ReverseIterator& operator--() noexcept
+        {
+            ++m_Iterator;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Post increment.
+        *
+        * @return: ReverseIterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator--(int) noexcept
+        {
+            ReverseIterator it(*this);
+            ++m_Iterator;
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: ReverseIterator& -> Iterator.
+        */
+        __forceinline ReverseIterator& operator-=(size_t distance) noexcept
+        {
+            m_Iterator += distance;
+            return *this;
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: ReverseIterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator+(size_t distance) const noexcept
+        {
+            ReverseIterator it(*this);
+            it += distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward given distance.
+        *
+        * @param: size_t -> Distance to move.
+        *
+        * @return: ReverseIterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator-(size_t distance) const noexcept
+        {
+            ReverseIterator it(*this);
+            it -= distance;
+            return it;
+        }
+
+        //Element access
+    public:
+        /**
+        * @brief: Returns the element to the forward given distance.
+        *
+        * @param: size_t -> Distance from the Iterator.
+        *
+        * @return: ValueType& -> Element.
+        */
+        _NODISCARD __forceinline ValueType& operator[](size_t index) const noexcept { return *(operator+(index)); }
+
+        /**
+        * @brief: Returns the data of the iterator.
+        *
+        * @return: ValueType& -> Data.
+        */
+        _NODISCARD __forceinline ValueType& operator*() const noexcept { return *m_Iterator; }
+
+        /**
+        * @brief: Returns the Iterator.
+        *
+        * @return: ValueType* -> Iterator.
+        */
+        _NODISCARD __forceinline ValueType* operator->() const noexcept { return m_Iterator.operator->(); }
+
+        //Non member functions
+    public:
+        /**
+        * @brief: Returns the distance between the iterator and other.
+        * @details: The result is always a positive number.
+        * If the iterator is not valid, throws std::exception.
+        *
+        * @param: const ReverseIterator& -> Iterator to compare.
+        *
+        * @return: size_t -> Distance.
+        */
+        _NODISCARD size_t Distance(const ReverseIterator& other) const { return m_Iterator.Distance(other.m_Iterator); }
+
+        _NODISCARD __forceinline bool operator==(const ReverseIterator& other) const noexcept { return m_Iterator == other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator!=(const ReverseIterator& other) const noexcept { return m_Iterator != other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator<(const ReverseIterator& other) const noexcept { return m_Iterator > other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator<=(const ReverseIterator& other) const noexcept { return m_Iterator >= other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator>(const ReverseIterator& other) const noexcept { return m_Iterator < other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator>=(const ReverseIterator& other) const noexcept { return m_Iterator <= other.m_Iterator; }
+
+        _NODISCARD __forceinline operator bool() const noexcept { return m_Iterator.IsValid(); }
+
+        _NODISCARD __forceinline bool IsValid() const noexcept { return m_Iterator.IsValid(); }
+
+        //Member functions
+    public:
+        __forceinline ReverseIterator(const TieredVector* vector = nullptr, size_t index = 0) noexcept :
+            m_Iterator(vector, index) {}
+
+        __forceinline ReverseIterator(const ReverseIterator& other) noexcept = default;
+
+        __forceinline ReverseIterator& operator=(const ReverseIterator& other) noexcept = default;
+
+    private:
+        Iterator<ValueType> m_Iterator;
+    };
+
+public:
+    using value_type = T;
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+    using reverse_iterator = ReverseIterator<T>;
+    using const_reverse_iterator = ReverseIterator<const T>;
+    using allocator_type = Allocator;
+
+    //Modifiers
+public:
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: Amortized constant time.
+    *
+    * @param: const T& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushBack(const T& element) { EmplaceBack(element); }
+
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: Amortized constant time.
+    *
+    * @param: T&& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushBack(T&& element) { EmplaceBack(std::move(element)); }
+
+    /**
+    * @brief: Inserts a new element at the begin of the container.
+    * @details: O(sqrt(n)), one element of each tier is moved.
+    *
+    * @param: const T& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushFront(const T& element) { Emplace(0, element); }
+
+    /**
+    * @brief: Inserts a new element at the begin of the container.
+    * @details: O(sqrt(n)), one element of each tier is moved.
+    *
+    * @param: T&& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushFront(T&& element) { Emplace(0, std::move(element)); }
+
+    /**
+    * @brief: Inserts a new element into the container directly before index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @param: const T& -> Element.
+    * @return: iterator -> Iterator to the new element.
+    */
+    iterator Insert(size_t index, const T& element) { return Emplace(index, element); }
+
+    /**
+    * @brief: Inserts a new element into the container directly before index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @param: T&& -> Element.
+    * @return: iterator -> Iterator to the new element.
+    */
+    iterator Insert(size_t index, T&& element) { return Emplace(index, std::move(element)); }
+
+    /**
+    * @brief: Inserts a new element into the container directly before the iterator.
+    *
+    * @param: iterator -> Position.
+    * @param: const T& -> Element.
+    * @return: iterator -> Iterator to the new element.
+    */
+    iterator Insert(iterator it, const T& element) { return Emplace(it.m_Index, element); }
+
+    /**
+    * @brief: Inserts a new element into the container directly before the iterator.
+    *
+    * @param: iterator -> Position.
+    * @param: T&& -> Element.
+    * @return: iterator -> Iterator to the new element.
+    */
+    iterator Insert(iterator it, T&& element) { return Emplace(it.m_Index, std::move(element)); }
+
+    /**
+    * @brief: Constructs a new element at the end of the container.
+    * @details: Amortized constant time.
+    *
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        if (IsRebuildPending())
+        {
+            //The arguments can refer to an element of the container, the element is built before the rebuild moves the elements
+            T element(std::forward<Args>(args)...);
+            PrepareInsertion();
+            return EmplaceBack(std::move(element));
+        }
+
+        PrepareInsertion();
+
+        T* slot = Slot(m_Elements);
+        new (slot) T(std::forward<Args>(args)...);
+        ++m_Elements;
+
+        return *slot;
+    }
+
+    /**
+    * @brief: Constructs a new element at the begin of the container.
+    * @details: O(sqrt(n)), one element of each tier is moved.
+    *
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& EmplaceFront(Args&&... args) { return *Emplace(0, std::forward<Args>(args)...); }
+
+    /**
+    * @brief: Constructs a new element into the container directly before index.
+    * @details: The elements of the tier of the index are shifted on its shorter side, then the last element of each
+    * following tier moves to the front of the next one by moving the start of its circular array. O(sqrt(n)).
+    * std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: iterator -> Iterator to the new element.
+    */
+    template<typename... Args>
+    iterator Emplace(size_t index, Args&&... args)
+    {
+        if (index > m_Elements) { TieredVectorOutOfRangeError(); }
+        if (index == m_Elements)
+        {
+            EmplaceBack(std::forward<Args>(args)...);
+            return iterator(this, index);
+        }
+
+        T element(std::forward<Args>(args)...);
+        PrepareInsertion();
+
+        const size_t mask = TierMask();
+        const size_t first = index >> m_Shift;
+        const size_t last = m_Elements >> m_Shift;
+        const size_t position = index & mask;
+        Tier& tier = m_Tiers[first];
+
+        if (first == last)
+        {
+            //The last tier has free slots on both sides of its elements
+            const size_t count = m_Elements & mask;
+            if (position == 0)
+            {
+                tier.Offset = (tier.Offset - 1) & mask;
+                new (LocalSlot(tier, 0)) T(std::move(element));
+                ++m_Elements;
+
+                return iterator(this, index);
+            }
+            if (position < (count >> 1))
+            {
+                tier.Offset = (tier.Offset - 1) & mask;
+                new (LocalSlot(tier, 0)) T(std::move(*LocalSlot(tier, 1)));
+                for (size_t i = 1; i < position; ++i)
+                {
+                    *LocalSlot(tier, i) = std::move(*LocalSlot(tier, i + 1));
+                }
+            }
+            else
+            {
+                new (LocalSlot(tier, count)) T(std::move(*LocalSlot(tier, count - 1)));
+                for (size_t i = count - 1; i > position; --i)
+                {
+                    *LocalSlot(tier, i) = std::move(*LocalSlot(tier, i - 1));
+                }
+            }
+        }
+        else
+        {
+            Tier& back = m_Tiers[last];
+            back.Offset = (back.Offset - 1) & mask;
+            new (LocalSlot(back, 0)) T(std::move(*LocalSlot(m_Tiers[last - 1], mask)));
+            for (size_t k = last - 1; k > first; --k)
+            {
+                //The slot of the last element, already moved to the next tier, becomes the front
+                Tier& full = m_Tiers[k];
+                full.Offset = (full.Offset - 1) & mask;
+                *LocalSlot(full, 0) = std::move(*LocalSlot(m_Tiers[k - 1], mask));
+            }
+
+            if (position < (TierSize() >> 1))
+            {
+                tier.Offset = (tier.Offset - 1) & mask;
+                for (size_t i = 0; i < position; ++i)
+                {
+                    *LocalSlot(tier, i) = std::move(*LocalSlot(tier, i + 1));
+                }
+            }
+            else
+            {
+                for (size_t i = mask; i > position; --i)
+                {
+                    *LocalSlot(tier, i) = std::move(*LocalSlot(tier, i - 1));
+                }
+            }
+        }
+
+        *LocalSlot(tier, position) = std::move(element);
+        ++m_Elements;
+
+        return iterator(this, index);
+    }
+
+    /**
+    * @brief: Constructs a new element into the container directly before the iterator.
+    *
+    * @param: iterator -> Position.
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: iterator -> Iterator to the new element.
+    */
+    template<typename... Args>
+    iterator EmplaceAt(iterator it, Args&&... args) { return Emplace(it.m_Index, std::forward<Args>(args)...); }
+
+    /**
+    * @brief: Delete the last element of the container.
+    * @details: The tiers are kept for the next insertions.
+    *
+    * @return: void.
+    */
+    void PopBack() noexcept
+    {
+        if (IsEmpty()) { return; }
+
+        Slot(m_Elements - 1)->~T();
+        --m_Elements;
+    }
+
+    /**
+    * @brief: Delete the first element of the container.
+    * @details: O(sqrt(n)), one element of each tier is moved.
+    *
+    * @return: void.
+    */
+    void PopFront()
+    {
+        if (IsEmpty()) { return; }
+
+        Erase((size_t)0);
+    }
+
+    /**
+    * @brief: Delete the element at the given index.
+    * @details: The elements of the tier of the index are shifted on its shorter side, then the first element of each
+    * following tier moves to the back of the previous one. O(sqrt(n)).
+    * std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: iterator -> Iterator to the element at the index position after deleting.
+    */
+    iterator Erase(size_t index)
+    {
+        if (index >= m_Elements) { TieredVectorOutOfRangeError(); }
+
+        const size_t mask = TierMask();
+        const size_t first = index >> m_Shift;
+        const size_t last = (m_Elements - 1) >> m_Shift;
+        const size_t position = index & mask;
+        Tier& tier = m_Tiers[first];
+
+        if (first == last)
+        {
+            const size_t count = m_Elements - (first << m_Shift);
+            if (position < (count >> 1))
+            {
+                for (size_t i = position; i > 0; --i)
+                {
+                    *LocalSlot(tier, i) = std::move(*LocalSlot(tier, i - 1));
+                }
+                LocalSlot(tier, 0)->~T();
+                tier.Offset = (tier.Offset + 1) & mask;
+            }
+            else
+            {
+                for (size_t i = position + 1; i < count; ++i)
+                {
+                    *LocalSlot(tier, i - 1) = std::move(*LocalSlot(tier, i));
+                }
+                LocalSlot(tier, count - 1)->~T();
+            }
+        }
+        else
+        {
+            //The hole is left at the last slot of the tier
+            if (position < (TierSize() >> 1))
+            {
+                for (size_t i = position; i > 0; --i)
+                {
+                    *LocalSlot(tier, i) = std::move(*LocalSlot(tier, i - 1));
+                }
+                tier.Offset = (tier.Offset + 1) & mask;
+            }
+            else
+            {
+                for (size_t i = position + 1; i <= mask; ++i)
+                {
+                    *LocalSlot(tier, i - 1) = std::move(*LocalSlot(tier, i));
+                }
+            }
+
+            for (size_t k = first + 1; k < last; ++k)
+            {
+                Tier& full = m_Tiers[k];
+                *LocalSlot(m_Tiers[k - 1], mask) = std::move(*LocalSlot(full, 0));
+                full.Offset = (full.Offset + 1) & mask;
+            }
+
+            Tier& back = m_Tiers[last];
+            *LocalSlot(m_Tiers[last - 1], mask) = std::move(*LocalSlot(back, 0));
+            LocalSlot(back, 0)->~T();
+            back.Offset = (back.Offset + 1) & mask;
+        }
+
+        --m_Elements;
+
+        return iterator(this, index);
+    }
+
+    /**
+    * @brief: Delete the element of the given iterator.
+    *
+    * @param: iterator -> Position.
+    * @return: iterator -> Iterator to the element at the iterator position after deleting.
+    */
+    iterator Erase(iterator it) { return Erase(it.m_Index); }
+
+    /**
+    * @brief: Clears the content of the container.
+    * @details: The tiers are kept, use Shrink to release them.
+    *
+    * @return: void.
+    */
+    void Clear() noexcept
+    {
+        DestroyElements();
+        m_Elements = 0;
+    }
+
+    /**
+    * @brief: Swaps the content of two TieredVectors.
+    * @details: Only the tier arrays are exchanged, no element is moved.
+    * The allocators are only swapped if the allocator propagates on swap, otherwise both allocators must be equal.
+    *
+    * @param: TieredVector& -> Other vector.
+    * @return: void.
+    */
+    void Swap(TieredVector& other) noexcept
+    {
+        if (&other == this) { return; }
+
+        Propagation::OnSwap(GetAllocatorReference(), other.GetAllocatorReference());
+
+        Tier* tiers = m_Tiers;
+        size_t shift = m_Shift;
+        size_t allocated = m_Allocated;
+        size_t elements = m_Elements;
+
+        m_Tiers = other.m_Tiers;
+        m_Shift = other.m_Shift;
+        m_Allocated = other.m_Allocated;
+        m_Elements = other.m_Elements;
+
+        other.m_Tiers = tiers;
+        other.m_Shift = shift;
+        other.m_Allocated = allocated;
+        other.m_Elements = elements;
+    }
+
+    /**
+    * @brief: Appends the elements of other at the end of the container.
+    * @details: The elements are copied, other can be the container itself.
+    *
+    * @param: const TieredVector& -> Other vector.
+    * @return: void.
+    */
+    void Append(const TieredVector& other)
+    {
+        const size_t elements = other.m_Elements;
+        Reserve(m_Elements + elements);
+
+        for (size_t i = 0; i < elements; ++i)
+        {
+            EmplaceBack(*other.Slot(i));
+        }
+    }
+
+    /**
+    * @brief: Appends the elements of other at the end of the container.
+    * @details: If the container is empty and both allocators are equal, the tiers of other are taken in constant time.
+    * Otherwise the elements are moved one by one. Other is left empty.
+    *
+    * @param: TieredVector&& -> Other vector.
+    * @return: void.
+    */
+    void Append(TieredVector&& other)
+    {
+        if (&other == this || other.IsEmpty()) { return; }
+        if (IsEmpty() && Propagation::AreEqual(GetAllocatorReference(), other.GetAllocatorReference()))
+        {
+            ReleaseStorage();
+            TakeStorage(other);
+            return;
+        }
+
+        Reserve(m_Elements + other.m_Elements);
+        for (size_t i = 0; i < other.m_Elements; ++i)
+        {
+            EmplaceBack(std::move(*other.Slot(i)));
+        }
+        other.Clear();
+    }
+
+    //Capacity
+public:
+    /**
+    * @brief: Makes room for at least capacity elements.
+    * @details: The tiers grow to the size needed by the capacity and the tiers after the last element are allocated.
+    * std::exception execption will be thrown if the capacity is greater than the maximum size.
+    *
+    * @param: size_t -> Capacity.
+    * @return: void.
+    */
+    void Reserve(size_t capacity)
+    {
+        if (capacity > s_MaxTieredVectorSize) { TieredVectorMaxLenghtError(); }
+        if (capacity == 0) { return; }
+
+        size_t shift = m_Shift;
+        while (capacity > ((size_t)1 << (shift * 2)))
+        {
+            ++shift;
+        }
+
+        if (!m_Tiers)
+        {
+            m_Shift = shift;
+            m_Tiers = AllocateTable(TierSize());
+        }
+        else if (shift > m_Shift) { Rebuild(shift); }
+
+        const size_t tiers = (capacity + TierMask()) >> m_Shift;
+        while (m_Allocated < tiers)
+        {
+            AllocateTier();
+        }
+    }
+
+    /**
+    * @brief: Requests the removal of unused capacity.
+    * @details: The tiers shrink to the smallest size that holds the elements and the tiers without elements are released.
+    * An empty container releases all its memory.
+    *
+    * @return: void.
+    */
+    void Shrink()
+    {
+        if (!m_Tiers) { return; }
+        if (IsEmpty()) { return ReleaseStorage(); }
+
+        size_t shift = s_MinTierShift;
+        while (m_Elements > ((size_t)1 << (shift * 2)))
+        {
+            ++shift;
+        }
+        if (shift < m_Shift) { return Rebuild(shift); }
+
+        const size_t tiers = (m_Elements + TierMask()) >> m_Shift;
+        while (m_Allocated > tiers)
+        {
+            --m_Allocated;
+            FreeTier(m_Tiers[m_Allocated].Data, TierSize());
+            m_Tiers[m_Allocated].Data = nullptr;
+        }
+    }
+
+    /**
+    * @brief: Checks if the container is empty.
+    *
+    * @return: bool -> True if the container has no elements.
+    */
+    _NODISCARD __forceinline bool IsEmpty() const noexcept { return m_Elements == 0; }
+
+    /**
+    * @brief: Number of elements in the container.
+    *
+    * @return: size_t -> Elements.
+    */
+    _NODISCARD __forceinline size_t Size() const noexcept { return m_Elements; }
+
+    /**
+    * @brief: Number of elements that fit in the allocated tiers.
+    *
+    * @return: size_t -> Capacity.
+    */
+    _NODISCARD __forceinline size_t Capacity() const noexcept { return m_Allocated << m_Shift; }
+
+    /**
+    * @brief: Number of allocated tiers.
+    *
+    * @return: size_t -> Tiers.
+    */
+    _NODISCARD __forceinline size_t Tiers() const noexcept { return m_Allocated; }
+
+    /**
+    * @brief: Number of elements of each tier.
+    *
+    * @return: size_t -> Tier size.
+    */
+    _NODISCARD __forceinline size_t TierSize() const noexcept { return (size_t)1 << m_Shift; }
+
+    //Element Access
+public:
+    /**
+    * @brief: Returns a reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Front() noexcept { return *Slot(0); }
+
+    /**
+    * @brief: Returns a const reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Front() const noexcept { return *Slot(0); }
+
+    /**
+    * @brief: Returns a reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& Back() noexcept { return *Slot(m_Elements - 1); }
+
+    /**
+    * @brief: Returns a const reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& Back() const noexcept { return *Slot(m_Elements - 1); }
+
+    /**
+    * @brief: Returns a reference to the element at the given index.
+    * @details: Constant time, the tier is found with a shift and the slot with a mask.
+    * Calling [] in a empty container is undefined.
+    *
+    * @param: size_t -> Index.
+    * @return: T& -> Element.
+    */
+    _NODISCARD __forceinline T& operator[](size_t index) noexcept { return *Slot(index); }
+
+    /**
+    * @brief: Returns a const reference to the element at the given index.
+    * @details: Calling [] in a empty container is undefined.
+    *
+    * @param: size_t -> Index.
+    * @return: const T& -> Element.
+    */
+    _NODISCARD __forceinline const T& operator[](size_t index) const noexcept { return *Slot(index); }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: T& -> Element.
+    */
+    _NODISCARD T& At(size_t index)
+    {
+        if (index >= m_Elements) { TieredVectorOutOfRangeError(); }
+        return *Slot(index);
+    }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @param: size_t -> Index.
+    * @return: const T& -> Element.
+    */
+    _NODISCARD const T& At(size_t index) const
+    {
+        if (index >= m_Elements) { TieredVectorOutOfRangeError(); }
+        return *Slot(index);
+    }
+
+    //Iterators
+public:
+    /**
+    * @brief: Returns an iterator to the begin of the container.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator begin() noexcept { return iterator(this, 0); }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator begin() const noexcept { return const_iterator(this, 0); }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cbegin() const noexcept { return const_iterator(this, 0); }
+
+    /**
+    * @brief: Returns an iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator end() noexcept { return iterator(this, m_Elements); }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator end() const noexcept { return const_iterator(this, m_Elements); }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cend() const noexcept { return const_iterator(this, m_Elements); }
+
+    /**
+    * @brief: Returns a reverse iterator to the end of the container.
+    * @details: The iterator points to the last element.
+    *
+    * @return: reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline reverse_iterator rbegin() noexcept { return reverse_iterator(this, m_Elements - 1); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the end of the container.
+    * @details: The iterator points to the last element.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(this, m_Elements - 1); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the end of the container.
+    * @details: The iterator points to the last element.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(this, m_Elements - 1); }
+
+    /**
+    * @brief: Returns a reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline reverse_iterator rend() noexcept { return reverse_iterator(this, (size_t)-1); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator rend() const noexcept { return const_reverse_iterator(this, (size_t)-1); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator crend() const noexcept { return const_reverse_iterator(this, (size_t)-1); }
+
+    //Member functions
+public:
+    explicit TieredVector() noexcept = default;
+
+    explicit TieredVector(const Allocator& allocator) noexcept :
+        AllocatorBase(allocator) {}
+
+    explicit TieredVector(size_t capacity)
+    {
+        Reserve(capacity);
+    }
+
+    TieredVector(size_t capacity, const Allocator& allocator) :
+        AllocatorBase(allocator)
+    {
+        Reserve(capacity);
+    }
+
+    TieredVector(const TieredVector& other) :
+        AllocatorBase(Propagation::OnCopyConstruction(other.GetAllocatorReference()))
+    {
+        Append(other);
+    }
+
+    TieredVector(TieredVector&& other) noexcept :
+        AllocatorBase(std::move(other.GetAllocatorReference()))
+    {
+        TakeStorage(other);
+    }
+
+    TieredVector(std::initializer_list<T>&& list)
+    {
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+    }
+
+    TieredVector(std::initializer_list<T>&& list, const Allocator& allocator) :
+        AllocatorBase(allocator)
+    {
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+    }
+
+    ~TieredVector() noexcept
+    {
+        Nullify();
+    }
+
+    TieredVector& operator=(const TieredVector& other)
+    {
+        if (&other == this) { return *this; }
+
+        //The tiers are released by the current allocator before it is replaced
+        Nullify();
+        Propagation::OnCopyAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        Append(other);
+
+        return *this;
+    }
+
+    TieredVector& operator=(TieredVector&& other) noexcept(Propagation::s_AlwaysTakesMemory)
+    {
+        if (&other == this) { return *this; }
+
+        Nullify();
+        if (!Propagation::CanTakeMemory(GetAllocatorReference(), other.GetAllocatorReference()))
+        {
+            //The tiers of other can not be released by this allocator, the elements are moved one by one
+            Append(std::move(other));
+            return *this;
+        }
+
+        Propagation::OnMoveAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        TakeStorage(other);
+
+        return *this;
+    }
+
+    TieredVector& operator=(std::initializer_list<T>&& list)
+    {
+        Clear();
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+
+        return *this;
+    }
+
+    /**
+    * @brief: Returns a copy of the allocator used by the container.
+    *
+    * @return: Allocator -> Allocator.
+    */
+    _NODISCARD __forceinline Allocator GetAllocator() const noexcept { return GetAllocatorReference(); }
+
+    //Non-member functions
+public:
+    /**
+    * @brief: Compares the content of two TieredVectors.
+    *
+    * @return: bool -> True if the content of both containers are equal.
+    */
+    _NODISCARD bool operator==(const TieredVector& other) const noexcept
+    {
+        if (m_Elements != other.m_Elements) { return false; }
+
+        const_iterator other_it = other.cbegin();
+        for (const_iterator this_it = cbegin(); this_it != cend(); ++this_it, ++other_it)
+        {
+            if (*this_it != *other_it) { return false; }
+        }
+
+        return true;
+    }
+
+    /**
+    * @brief: Compares the content of two TieredVectors.
+    *
+    * @return: bool -> True if the content of both containers are not equal.
+    */
+    _NODISCARD __forceinline bool operator!=(const TieredVector& other) const noexcept { return !(*this == other); }
+
+private:
+    _NODISCARD __forceinline size_t TierMask() const noexcept { return ((size_t)1 << m_Shift) - 1; }
+
+    /**
+    * @brief: Returns the slot of the element at the given index, its tier must be allocated.
+    *
+    * @param: size_t -> Index.
+    * @return: T* -> Slot.
+    */
+    _NODISCARD __forceinline T* Slot(size_t index) const noexcept
+    {
+        const Tier& tier = m_Tiers[index >> m_Shift];
+        return tier.Data + ((tier.Offset + index) & TierMask());
+    }
+
+    /**
+    * @brief: Returns the slot of the given position inside a tier.
+    *
+    * @param: const Tier& -> Tier.
+    * @param: size_t -> Position inside the tier.
+    * @return: T* -> Slot.
+    */
+    _NODISCARD __forceinline T* LocalSlot(const Tier& tier, size_t position) const noexcept
+    {
+        return tier.Data + ((tier.Offset + position) & TierMask());
+    }
+
+    /**
+    * @brief: Returns the tier that holds the given index, nullptr if the tier is not allocated.
+    *
+    * @param: size_t -> Index.
+    * @return: const Tier* -> Tier.
+    */
+    _NODISCARD __forceinline const Tier* TierOf(size_t index) const noexcept
+    {
+        const size_t tier = index >> m_Shift;
+        return tier < m_Allocated ? m_Tiers + tier : nullptr;
+    }
+
+    _NODISCARD __forceinline bool IsRebuildPending() const noexcept
+    {
+        return m_Tiers && m_Elements == ((size_t)1 << (m_Shift * 2));
+    }
+
+    /**
+    * @brief: Makes room for one more element at the end.
+    * @details: When every tier is full the size of the tiers doubles, so it stays close to the square root of the elements.
+    *
+    * @return: void.
+    */
+    void PrepareInsertion()
+    {
+        if (m_Elements == s_MaxTieredVectorSize) { TieredVectorMaxLenghtError(); }
+
+        if (!m_Tiers) { m_Tiers = AllocateTable(TierSize()); }
+        else if (IsRebuildPending()) { Rebuild(m_Shift + 1); }
+
+        if ((m_Elements >> m_Shift) == m_Allocated) { AllocateTier(); }
+    }
+
+    /**
+    * @brief: Moves the elements to new tiers of 2^shift elements.
+    * @details: The new tiers start at offset 0. The memory is allocated before any element is moved,
+    * if an allocation fails the container is not modified.
+    *
+    * @param: size_t -> Shift of the new tier size.
+    * @return: void.
+    */
+    void Rebuild(size_t shift)
+    {
+        const size_t tier_size = (size_t)1 << shift;
+        const size_t tiers = (m_Elements + tier_size - 1) >> shift;
+
+        Tier* table = AllocateTable(tier_size);
+        size_t allocated = 0;
+        try
+        {
+            for (; allocated < tiers; ++allocated)
+            {
+                table[allocated].Data = AllocateTierMemory(tier_size);
+            }
+        }
+        catch (...)
+        {
+            for (size_t i = 0; i < allocated; ++i)
+            {
+                FreeTier(table[i].Data, tier_size);
+            }
+            FreeTable(table, tier_size);
+            throw;
+        }
+
+        //Each run is contiguous in the old and in the new tier
+        const size_t mask = TierMask();
+        size_t index = 0;
+        while (index < m_Elements)
+        {
+            const Tier& tier = m_Tiers[index >> m_Shift];
+            const size_t physical = (tier.Offset + index) & mask;
+            size_t run = TierSize() - physical;
+            if (run > TierSize() - (index & mask)) { run = TierSize() - (index & mask); }
+            if (run > tier_size - (index & (tier_size - 1))) { run = tier_size - (index & (tier_size - 1)); }
+            if (run > m_Elements - index) { run = m_Elements - index; }
+
+            RelocateElements(table[index >> shift].Data + (index & (tier_size - 1)), tier.Data + physical, run);
+            index += run;
+        }
+
+        const size_t elements = m_Elements;
+        ReleaseStorage();
+        m_Tiers = table;
+        m_Shift = shift;
+        m_Allocated = tiers;
+        m_Elements = elements;
+    }
+
+    /**
+    * @brief: Moves count elements from first to to, the destination is raw storage and the source is left as raw storage.
+    * @details: The ranges must not overlap. Trivially relocatable elements are moved with a single memcpy.
+    *
+    * @param: T* -> Destination.
+    * @param: T* -> First element to move.
+    * @param: size_t -> Number of elements.
+    *
+    * @return: void.
+    */
+    static __forceinline void RelocateElements(T* to, T* first, size_t count) noexcept
+    {
+        if constexpr (IsTriviallyRelocatable<T>::value)
+        {
+            std::memcpy((void*)to, (const void*)first, sizeof(T) * count);
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                new (to + i) T(std::move(first[i]));
+                first[i].~T();
+            }
+        }
+    }
+
+    __forceinline void DestroyElements() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible<T>::value)
+        {
+            for (size_t i = 0; i < m_Elements; ++i)
+            {
+                Slot(i)->~T();
+            }
+        }
+    }
+
+    __forceinline void Nullify() noexcept
+    {
+        if constexpr (s_SkipTeardown)
+        {
+            //The allocator releases all the memory at once and the elements need no destructor
+            return Default();
+        }
+
+        DestroyElements();
+        ReleaseStorage();
+    }
+
+    /**
+    * @brief: Releases every tier and the tier array, the elements must be already destroyed or moved.
+    *
+    * @return: void.
+    */
+    void ReleaseStorage() noexcept
+    {
+        for (size_t i = 0; i < m_Allocated; ++i)
+        {
+            FreeTier(m_Tiers[i].Data, TierSize());
+        }
+        if (m_Tiers) { FreeTable(m_Tiers, TierSize()); }
+
+        Default();
+    }
+
+    /**
+    * @brief: Takes the tiers of other, the container must have no storage.
+    *
+    * @param: TieredVector& -> Other vector.
+    * @return: void.
+    */
+    __forceinline void TakeStorage(TieredVector& other) noexcept
+    {
+        m_Tiers = other.m_Tiers;
+        m_Shift = other.m_Shift;
+        m_Allocated = other.m_Allocated;
+        m_Elements = other.m_Elements;
+
+        other.Default();
+    }
+
+    __forceinline void AllocateTier()
+    {
+        Tier& tier = m_Tiers[m_Allocated];
+        tier.Data = AllocateTierMemory(TierSize());
+        tier.Offset = 0;
+        ++m_Allocated;
+    }
+
+    _NODISCARD T* AllocateTierMemory(size_t tier_size)
+    {
+        T* memory_block = nullptr;
+        try { memory_block = AllocatorTraits::allocate(GetAllocatorReference(), tier_size); }
+        catch (...) { TieredVectorBadAllocationError(); }
+
+        return memory_block;
+    }
+
+    __forceinline void FreeTier(T* memory_block, size_t tier_size) noexcept
+    {
+        AllocatorTraits::deallocate(GetAllocatorReference(), memory_block, tier_size);
+    }
+
+    /**
+    * @brief: Allocates the array of tiers, a container with tiers of n elements holds at most n tiers.
+    *
+    * @param: size_t -> Tier size.
+    * @return: Tier* -> Tier array.
+    */
+    _NODISCARD Tier* AllocateTable(size_t tier_size)
+    {
+        TierAllocator allocator(GetAllocatorReference());
+        Tier* table = nullptr;
+        try { table = TierTraits::allocate(allocator, tier_size); }
+        catch (...) { TieredVectorBadAllocationError(); }
+
+        for (size_t i = 0; i < tier_size; ++i)
+        {
+            table[i].Data = nullptr;
+            table[i].Offset = 0;
+        }
+
+        return table;
+    }
+
+    __forceinline void FreeTable(Tier* table, size_t tier_size) noexcept
+    {
+        TierAllocator allocator(GetAllocatorReference());
+        TierTraits::deallocate(allocator, table, tier_size);
+    }
+
+    __forceinline void Default() noexcept
+    {
+        m_Tiers = nullptr;
+        m_Shift = s_MinTierShift;
+        m_Allocated = 0;
+        m_Elements = 0;
+    }
+
+    [[noreturn]] __forceinline static void TieredVectorOutOfRangeError() {
+        throw std::exception("TieredVector index out of range");
+    }
+
+    [[noreturn]] __forceinline static void TieredVectorMaxLenghtError() {
+        throw std::exception("TieredVector too long");
+    }
+
+    [[noreturn]] __forceinline static void TieredVectorBadAllocationError() {
+        throw std::exception("Bad allocation");
+    }
+
+private:
+    Tier* m_Tiers = nullptr;
+    size_t m_Shift = s_MinTierShift;
+    size_t m_Allocated = 0;
+    size_t m_Elements = 0;
+
+    static _CONSTEXPR17 size_t s_MinTierShift = 4;
+    static _CONSTEXPR17 size_t s_MaxTieredVectorSize = 10000000;
+    static _CONSTEXPR17 bool s_SkipTeardown = IsReleaseAllAllocator<Allocator>::value && std::is_trivially_destructible<T>::value;
+};
+
+/*
+* TieredVector that takes its memory from a std::pmr::memory_resource selected at runtime.
+*/
+template<typename T>
+using PmrTieredVector = TieredVector<T, std::pmr::polymorphic_allocator<T>>;
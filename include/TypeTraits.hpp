@@ -0,0 +1,65 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header file.
+* Type traits used by the containers to select faster code paths.
+* The traits can be specialized by the user for their own types.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <type_traits>
+#include <iterator>  //For std::iterator_traits and std::forward_iterator_tag
+
+/*
+* A type is trivially relocatable when moving an object to a new address and destroying the old one
+* is equivalent to copying its bytes and forgetting the old object.
+* That is true for every trivially copyable type and for most types that only own heap memory
+* (the pointer is still valid after the copy), but not for types that point to themselves.
+*
+* Containers relocate these types with a single memcpy (or realloc) instead of calling the move
+* constructor and the destructor of every element.
+*
+* To opt-in a type specialize the trait:
+* template<> struct IsTriviallyRelocatable<MyType> : std::true_type {};
+*/
+template<typename T>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+/*
+* An iterator is single pass when its range can be traversed only once, like std::istream_iterator.
+* Iterators without an iterator category, like the iterators of the containers of this library, are multi pass.
+*/
+template<typename Iterator, typename = void>
+struct IsSinglePassIterator : std::false_type {};
+
+template<typename Iterator>
+struct IsSinglePassIterator<Iterator, std::void_t<typename std::iterator_traits<Iterator>::iterator_category>> :
+    std::bool_constant<!std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value> {};
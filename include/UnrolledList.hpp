@@ -0,0 +1,1493 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Single header class.
+* UnrolledList class is a sequence container with the same interface as List,
+* that stores up to BlockSize elements contiguously in each node instead of a single one.
+* Traversals touch one node per BlockSize elements and the link overhead is shared by all the elements of a node.
+* A full node is split in two halves when an element is inserted into it, and a node is merged with
+* the next one when an erase leaves both small enough to fit in a single node.
+* Inserting or erasing an element invalidates the iterators to the elements of the affected nodes.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <initializer_list>
+#include <cstring>  //For std::memmove
+#include "TypeTraits.hpp"
+#include "Allocator.hpp"
+
+/*
+* Default number of elements per node, around 1 KiB of elements and never less than 8.
+*/
+template<typename T>
+struct UnrolledBlockSize : std::integral_constant<size_t, sizeof(T) * 8 < 1024 ? 1024 / sizeof(T) : 8> {};
+
+template<typename T, size_t BlockSize = UnrolledBlockSize<T>::value, typename Allocator = std::allocator<T>>
+class UnrolledList : private AllocatorStorage<Allocator>
+{
+    static_assert(BlockSize >= 2, "UnrolledList needs at least two elements per node, use List instead");
+
+    using AllocatorBase = AllocatorStorage<Allocator>;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    using Propagation = AllocatorPropagation<Allocator>;
+    using AllocatorBase::GetAllocatorReference;
+
+    /*
+    * Links of a node, the container owns one without elements that closes the circle of nodes (the sentinel).
+    */
+    struct NodeBase
+    {
+        NodeBase* Prev = nullptr;
+        NodeBase* Next = nullptr;
+        size_t Count = 0;
+    };
+
+    /*
+    * Node with storage for BlockSize elements, only the first Count are constructed.
+    */
+    struct Node : NodeBase
+    {
+        _NODISCARD __forceinline T* Data() noexcept { return reinterpret_cast<T*>(Storage); }
+
+        alignas(T) unsigned char Storage[sizeof(T) * BlockSize];
+    };
+
+    using NodeAllocator = typename AllocatorTraits::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+public:
+    template<typename ValueType>
+    class Iterator
+    {
+        friend class UnrolledList;
+        //Modifiers
+    public:
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Pre increment.
+        *
+        * @return: Iterator& -> Current iterator.
+        */
+        __forceinline Iterator& operator++() noexcept
+        {
+            if (++m_Index == m_Node->Count)
+            {
+                m_Node = m_Node->Next;
+                m_Index = 0;
+            }
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Post increment.
+        *
+        * @return: Iterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline Iterator operator++(int) noexcept
+        {
+            Iterator it(*this);
+            operator++();
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        * @details: Whole nodes are skipped at once.
+        *
+        * @param: size_t -> distance to move.
+        * @return: Iterator& -> Current iterator.
+        */
+        Iterator& operator+=(size_t distance) noexcept
+        {
+            if (distance == 0) { return *this; }
+
+            size_t left = m_Node->Count - m_Index;
+            while (distance >= left)
+            {
+                distance -= left;
+                m_Node = m_Node->Next;
+                m_Index = 0;
+                if (distance == 0) { return *this; }
+                left = m_Node->Count;
+            }
+            m_Index += distance;
+
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> distance to move.
+        * @return: Iterator& -> Current iterator.
+        */
+        __forceinline Iterator& operator+=(int distance) noexcept
+        {
+            if (distance < 0) { return operator-=((size_t)(-distance)); }
+            return operator+=((size_t)distance);
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Pre increment.
+        *
+        * @return: Iterator& -> Current iterator.
+        */
+        __forceinline Iterator& operator--() noexcept
+        {
+            if (m_Index == 0)
+            {
+                m_Node = m_Node->Prev;
+                m_Index = m_Node->Count ? m_Node->Count - 1 : 0;
+            }
+            else { --m_Index; }
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Post increment.
+        *
+        * @return: Iterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline Iterator operator--(int) noexcept
+        {
+            Iterator it(*this);
+            operator--();
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        * @details: Whole nodes are skipped at once.
+        *
+        * @param: size_t -> distance to move.
+        * @return: Iterator& -> Current iterator.
+        */
+        Iterator& operator-=(size_t distance) noexcept
+        {
+            while (distance > m_Index)
+            {
+                distance -= m_Index + 1;
+                m_Node = m_Node->Prev;
+                m_Index = m_Node->Count ? m_Node->Count - 1 : 0;
+            }
+            m_Index -= distance;
+
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        *
+        * @param: int -> distance to move.
+        * @return: Iterator& -> Current iterator.
+        */
+        __forceinline Iterator& operator-=(int distance) noexcept
+        {
+            if (distance < 0) { return operator+=((size_t)(-distance)); }
+            return operator-=((size_t)distance);
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward distance given from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator+(size_t distance) const noexcept
+        {
+            Iterator it(*this);
+            it += distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward distance given from the current iterator.
+        * @details: By giving a negative number, the iterator will move backwards instead.
+        *
+        * @param: int -> distance to move.
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator+(int distance) const noexcept
+        {
+            Iterator it(*this);
+            it += distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward distance given from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator-(size_t distance) const noexcept
+        {
+            Iterator it(*this);
+            it -= distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward distance given from the current iterator.
+        * @details: By giving a negative number, the iterator will move forwards instead.
+        *
+        * @param: int -> distance to move.
+        * @return: Iterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline Iterator operator-(int distance) const noexcept
+        {
+            Iterator it(*this);
+            it -= distance;
+            return it;
+        }
+
+        //Element access
+    public:
+        /**
+        * @brief: Returns the element at the given distance from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ValueType& -> Element in the resulting position.
+        */
+        _NODISCARD __forceinline ValueType& operator[](size_t index) const noexcept { return *(operator+(index)); }
+
+        /**
+        * @brief: Returns the element of the current iterator.
+        *
+        * @return: ValueType& -> Element of the iterator.
+        */
+        _NODISCARD __forceinline ValueType& operator*() const noexcept { return static_cast<Node*>(m_Node)->Data()[m_Index]; }
+
+        /**
+        * @brief: Returns the current iterator.
+        *
+        * @return: ValueType* -> Current iterator.
+        */
+        _NODISCARD __forceinline ValueType* operator->() const noexcept { return static_cast<Node*>(m_Node)->Data() + m_Index; }
+
+        //Non member functions
+    public:
+        /**
+        * @brief: Compares if two iterators are equal.
+        *
+        * @param: const Iterator& -> Given iterator.
+        * @return: bool -> True if both are equal.
+        */
+        _NODISCARD __forceinline bool operator==(const Iterator& other) const noexcept { return m_Node == other.m_Node && m_Index == other.m_Index; }
+
+        /**
+        * @brief: Compares if two iterators are not equal.
+        *
+        * @param: const Iterator& -> Given iterator.
+        * @return: bool -> True if both are not equal.
+        */
+        _NODISCARD __forceinline bool operator!=(const Iterator& other) const noexcept { return !(operator==(other)); }
+
+        /**
+        * @brief: Compares if the current iterator points to a node.
+        *
+        * @return: bool -> True if the current iterator is valid.
+        */
+        _NODISCARD __forceinline operator bool() const noexcept { return m_Node; }
+
+        /**
+        * @brief: Compares if the current iterator points to a node.
+        *
+        * @return: bool -> True if the current iterator is valid.
+        */
+        _NODISCARD __forceinline bool IsValid() const noexcept { return m_Node; }
+
+        //Member functions
+    public:
+        __forceinline Iterator(NodeBase* node = nullptr, size_t index = 0) noexcept :
+            m_Node(node),
+            m_Index(index) {}
+
+        __forceinline Iterator(const Iterator& other) noexcept = default;
+
+        __forceinline Iterator& operator=(const Iterator& other) noexcept = default;
+
+    private:
+        NodeBase* m_Node;
+        size_t m_Index;
+    };
+
+    template<typename ValueType>
+    class ReverseIterator
+    {
+        friend class UnrolledList;
+        //Modifiers
+    public:
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Pre increment.
+        *
+        * @return: ReverseIterator& -> Current iterator.
+        */
+        __forceinline ReverseIterator& operator++() noexcept
+        {
+            --m_Iterator;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the next element.
+        * @details: Post increment.
+        *
+        * @return: ReverseIterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator++(int) noexcept
+        {
+            ReverseIterator it(*this);
+            --m_Iterator;
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator forwards by the given distance.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ReverseIterator& -> Current iterator.
+        */
+        __forceinline ReverseIterator& operator+=(size_t distance) noexcept
+        {
+            m_Iterator -= distance;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Pre increment.
+        *
+        * @return: ReverseIterator& -> Current iterator.
+        */
+        __forceinline ReverseIterator& operator--() noexcept
+        {
+            ++m_Iterator;
+            return *this;
+        }
+
+        /**
+        * @brief: Moves the iterator to the previous element.
+        * @details: Post increment.
+        *
+        * @return: ReverseIterator -> Iterator at previous position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator--(int) noexcept
+        {
+            ReverseIterator it(*this);
+            ++m_Iterator;
+            return it;
+        }
+
+        /**
+        * @brief: Moves the iterator backwards by the given distance.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ReverseIterator& -> Current iterator.
+        */
+        __forceinline ReverseIterator& operator-=(size_t distance) noexcept
+        {
+            m_Iterator += distance;
+            return *this;
+        }
+
+        /**
+        * @brief: Returns an iterator to the forward distance given from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ReverseIterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator+(size_t distance) const noexcept
+        {
+            ReverseIterator it(*this);
+            it += distance;
+            return it;
+        }
+
+        /**
+        * @brief: Returns an iterator to the backward distance given from the current iterator.
+        *
+        * @param: size_t -> distance to move.
+        * @return: ReverseIterator -> Iterator in the resulting position.
+        */
+        _NODISCARD __forceinline ReverseIterator operator-(size_t distance) const noexcept
+        {
+            ReverseIterator it(*this);
+            it -= distance;
+            return it;
+        }
+
+        //Element access
+    public:
+        /**
+        * @brief: Returns the element of the current iterator.
+        *
+        * @return: ValueType& -> Element of the iterator.
+        */
+        _NODISCARD __forceinline ValueType& operator*() const noexcept { return *m_Iterator; }
+
+        /**
+        * @brief: Returns the current iterator.
+        *
+        * @return: ValueType* -> Current iterator.
+        */
+        _NODISCARD __forceinline ValueType* operator->() const noexcept { return m_Iterator.operator->(); }
+
+        //Non member functions
+    public:
+        _NODISCARD __forceinline bool operator==(const ReverseIterator& other) const noexcept { return m_Iterator == other.m_Iterator; }
+
+        _NODISCARD __forceinline bool operator!=(const ReverseIterator& other) const noexcept { return m_Iterator != other.m_Iterator; }
+
+        _NODISCARD __forceinline operator bool() const noexcept { return m_Iterator.IsValid(); }
+
+        _NODISCARD __forceinline bool IsValid() const noexcept { return m_Iterator.IsValid(); }
+
+        //Member functions
+    public:
+        __forceinline ReverseIterator(NodeBase* node = nullptr, size_t index = 0) noexcept :
+            m_Iterator(node, index) {}
+
+        __forceinline ReverseIterator(const ReverseIterator& other) noexcept = default;
+
+        __forceinline ReverseIterator& operator=(const ReverseIterator& other) noexcept = default;
+
+    private:
+        Iterator<ValueType> m_Iterator;
+    };
+
+public:
+    using value_type = T;
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+    using reverse_iterator = ReverseIterator<T>;
+    using const_reverse_iterator = ReverseIterator<const T>;
+    using allocator_type = Allocator;
+
+    //Modifiers
+public:
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: A new node is only created when the last node is full.
+    *
+    * @param: const T& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushBack(const T& element) { EmplaceBack(element); }
+
+    /**
+    * @brief: Inserts a new element at the end of the container.
+    * @details: A new node is only created when the last node is full.
+    *
+    * @param: T&& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushBack(T&& element) { EmplaceBack(std::move(element)); }
+
+    /**
+    * @brief: Inserts a new element at the begin of the container.
+    * @details: A new node is only created when the first node is full.
+    *
+    * @param: const T& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushFront(const T& element) { EmplaceFront(element); }
+
+    /**
+    * @brief: Inserts a new element at the begin of the container.
+    * @details: A new node is only created when the first node is full.
+    *
+    * @param: T&& -> Element.
+    * @return: void.
+    */
+    __forceinline void PushFront(T&& element) { EmplaceFront(std::move(element)); }
+
+    /**
+    * @brief: Inserts a new element at the given index.
+    * @details: An index out of range inserts the element at the end.
+    *
+    * @param: size_t -> Index.
+    * @param: const T& -> Element.
+    * @return: iterator -> Iterator to the inserted element.
+    */
+    iterator Insert(size_t index, const T& element) { return EmplaceAt(GetInsertPosition(index), element); }
+
+    /**
+    * @brief: Inserts a new element before the given iterator.
+    *
+    * @param: iterator -> Position.
+    * @param: const T& -> Element.
+    * @return: iterator -> Iterator to the inserted element.
+    */
+    iterator Insert(iterator it, const T& element) { return EmplaceAt(it, element); }
+
+    /**
+    * @brief: Inserts a new element at the given index.
+    * @details: An index out of range inserts the element at the end.
+    *
+    * @param: size_t -> Index.
+    * @param: T&& -> Element.
+    * @return: iterator -> Iterator to the inserted element.
+    */
+    iterator Insert(size_t index, T&& element) { return EmplaceAt(GetInsertPosition(index), std::move(element)); }
+
+    /**
+    * @brief: Inserts a new element before the given iterator.
+    *
+    * @param: iterator -> Position.
+    * @param: T&& -> Element.
+    * @return: iterator -> Iterator to the inserted element.
+    */
+    iterator Insert(iterator it, T&& element) { return EmplaceAt(it, std::move(element)); }
+
+    /**
+    * @brief: Constructs a new element at the end of the container.
+    * @details: No element is moved to make room at the end, so the element is constructed in place.
+    *
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        iterator it = OpenSlot(iterator(&m_Sentinel, 0));
+        return Construct(it, std::forward<Args>(args)...);
+    }
+
+    /**
+    * @brief: Constructs a new element at the begin of the container.
+    *
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& EmplaceFront(Args&&... args)
+    {
+        return *EmplaceAt(begin(), std::forward<Args>(args)...);
+    }
+
+    /**
+    * @brief: Constructs a new element at the given index.
+    * @details: An index out of range constructs the element at the end.
+    *
+    * @param: size_t -> Index.
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& Emplace(size_t index, Args&&... args)
+    {
+        return *EmplaceAt(GetInsertPosition(index), std::forward<Args>(args)...);
+    }
+
+    /**
+    * @brief: Constructs a new element before the given iterator.
+    *
+    * @param: iterator -> Position.
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    T& Emplace(iterator it, Args&&... args)
+    {
+        return *EmplaceAt(it, std::forward<Args>(args)...);
+    }
+
+    /**
+    * @brief: Constructs a new element before the given iterator.
+    * @details: If the node of the iterator is full it is split in two halves.
+    *
+    * @param: iterator -> Position.
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: iterator -> Iterator to the new element.
+    */
+    template<typename... Args>
+    iterator EmplaceAt(iterator it, Args&&... args)
+    {
+        //The arguments can refer to an element of the container, the element is built before the elements are moved
+        T element(std::forward<Args>(args)...);
+        it = OpenSlot(it);
+        Construct(it, std::move(element));
+        return it;
+    }
+
+    /**
+    * @brief: Removes the last element of the container.
+    * @details: Calling PopBack in a empty container does nothing.
+    *
+    * @return: void.
+    */
+    void PopBack() noexcept
+    {
+        if (IsEmpty()) { return; }
+
+        Node* node = static_cast<Node*>(m_Sentinel.Prev);
+        node->Data()[--node->Count].~T();
+        --m_Elements;
+        if (node->Count == 0) { DeleteNode(node); }
+    }
+
+    /**
+    * @brief: Removes the first element of the container.
+    * @details: Calling PopFront in a empty container does nothing.
+    *
+    * @return: void.
+    */
+    void PopFront() noexcept
+    {
+        if (IsEmpty()) { return; }
+
+        Erase(begin());
+    }
+
+    /**
+    * @brief: Removes the element at the given index.
+    * @details: An index out of range removes the last element, calling it in a empty container does nothing.
+    *
+    * @param: size_t -> Index.
+    * @return: iterator -> Iterator to the element after the erased one.
+    */
+    iterator Erase(size_t index) noexcept
+    {
+        if (IsEmpty()) { return end(); }
+        if (index >= m_Elements) { index = m_Elements - 1; }
+        return Erase(GetIteratorAtIndex(index));
+    }
+
+    /**
+    * @brief: Removes the element of the given iterator.
+    * @details: A node left under half full is merged with a neighbour when both fit in three quarters of a node.
+    *
+    * @param: iterator -> Element to remove.
+    * @return: iterator -> Iterator to the element after the erased one.
+    */
+    iterator Erase(iterator it) noexcept
+    {
+        Node* node = static_cast<Node*>(it.m_Node);
+        size_t index = it.m_Index;
+
+        T* data = node->Data();
+        data[index].~T();
+        RelocateElements(data + index, data + index + 1, node->Count - index - 1);
+        --node->Count;
+        --m_Elements;
+
+        if (node->Count == 0)
+        {
+            NodeBase* next = node->Next;
+            DeleteNode(node);
+            return iterator(next, 0);
+        }
+
+        if (node->Count < BlockSize / 2)
+        {
+            //An underfull node is merged into a neighbour, the result keeps room for a few insertions
+            NodeBase* prev = node->Prev;
+            NodeBase* next = node->Next;
+            if (prev != &m_Sentinel && prev->Count + node->Count <= s_MergeSize)
+            {
+                Node* prev_node = static_cast<Node*>(prev);
+                RelocateElements(prev_node->Data() + prev->Count, data, node->Count);
+                index += prev->Count;
+                prev->Count += node->Count;
+                node->Count = 0;
+                DeleteNode(node);
+                node = prev_node;
+            }
+            else if (next != &m_Sentinel && node->Count + next->Count <= s_MergeSize)
+            {
+                Node* next_node = static_cast<Node*>(next);
+                RelocateElements(data + node->Count, next_node->Data(), next->Count);
+                node->Count += next->Count;
+                next->Count = 0;
+                DeleteNode(next_node);
+            }
+        }
+
+        if (index < node->Count) { return iterator(node, index); }
+        return iterator(node->Next, 0);
+    }
+
+    /**
+    * @brief: Removes all the elements of the container and releases all the nodes.
+    *
+    * @return: void.
+    */
+    void Clear() noexcept
+    {
+        NodeBase* node = m_Sentinel.Next;
+        while (node != &m_Sentinel)
+        {
+            NodeBase* next = node->Next;
+            DestroyNode(static_cast<Node*>(node));
+            node = next;
+        }
+
+        Default();
+    }
+
+    /**
+    * @brief: Exchanges the content of the container by the content of other.
+    * @details: The nodes are exchanged, no element is moved.
+    *
+    * @param: UnrolledList& -> Other container.
+    * @return: void.
+    */
+    void Swap(UnrolledList& other) noexcept
+    {
+        Propagation::OnSwap(GetAllocatorReference(), other.GetAllocatorReference());
+
+        NodeBase* first = m_Sentinel.Next;
+        NodeBase* last = m_Sentinel.Prev;
+        size_t elements = m_Elements;
+        size_t nodes = m_Nodes;
+
+        if (other.IsEmpty()) { Default(); }
+        else { Link(other.m_Sentinel.Next, other.m_Sentinel.Prev, other.m_Elements, other.m_Nodes); }
+
+        if (elements == 0) { other.Default(); }
+        else { other.Link(first, last, elements, nodes); }
+    }
+
+    /**
+    * @brief: Appends the elements of other at the end of the container.
+    *
+    * @param: const UnrolledList& -> Other container.
+    * @return: void.
+    */
+    void Append(const UnrolledList& other)
+    {
+        for (const_iterator it = other.cbegin(); it != other.cend(); ++it)
+        {
+            EmplaceBack(*it);
+        }
+    }
+
+    /**
+    * @brief: Appends the elements of other at the end of the container.
+    * @details: The nodes of other are linked at the end in constant time when both allocators are equal,
+    * otherwise the elements are moved one by one. Other is left empty.
+    *
+    * @param: UnrolledList&& -> Other container.
+    * @return: void.
+    */
+    void Append(UnrolledList&& other)
+    {
+        if (&other == this || other.IsEmpty()) { return; }
+        if (!Propagation::AreEqual(GetAllocatorReference(), other.GetAllocatorReference()))
+        {
+            for (iterator it = other.begin(); it != other.end(); ++it)
+            {
+                EmplaceBack(std::move(*it));
+            }
+            other.Clear();
+            return;
+        }
+
+        if (IsEmpty())
+        {
+            Link(other.m_Sentinel.Next, other.m_Sentinel.Prev, other.m_Elements, other.m_Nodes);
+        }
+        else
+        {
+            NodeBase* last = m_Sentinel.Prev;
+            last->Next = other.m_Sentinel.Next;
+            other.m_Sentinel.Next->Prev = last;
+            other.m_Sentinel.Prev->Next = &m_Sentinel;
+            m_Sentinel.Prev = other.m_Sentinel.Prev;
+            m_Elements += other.m_Elements;
+            m_Nodes += other.m_Nodes;
+        }
+
+        other.Default();
+    }
+
+    //Capacity
+public:
+    /**
+    * @brief: Requests the removal of unused capacity.
+    * @details: The elements are packed so every node but the last one is full, the emptied nodes are released.
+    *
+    * @return: void.
+    */
+    void Shrink() noexcept
+    {
+        NodeBase* node = m_Sentinel.Next;
+        while (node != &m_Sentinel && node->Next != &m_Sentinel)
+        {
+            Node* current = static_cast<Node*>(node);
+            Node* next = static_cast<Node*>(node->Next);
+
+            size_t moved = BlockSize - current->Count;
+            if (moved > next->Count) { moved = next->Count; }
+
+            RelocateElements(current->Data() + current->Count, next->Data(), moved);
+            RelocateElements(next->Data(), next->Data() + moved, next->Count - moved);
+            current->Count += moved;
+            next->Count -= moved;
+
+            if (next->Count == 0) { DeleteNode(next); }
+            else { node = next; }
+        }
+    }
+
+    /**
+    * @brief: Checks if the container is empty.
+    *
+    * @return: bool -> True if the container has no elements.
+    */
+    _NODISCARD __forceinline bool IsEmpty() const noexcept { return m_Elements == 0; }
+
+    /**
+    * @brief: Number of elements in the container.
+    *
+    * @return: size_t -> Elements.
+    */
+    _NODISCARD __forceinline size_t Size() const noexcept { return m_Elements; }
+
+    /**
+    * @brief: Number of elements that fit in the current nodes.
+    *
+    * @return: size_t -> Capacity.
+    */
+    _NODISCARD __forceinline size_t Capacity() const noexcept { return m_Nodes * BlockSize; }
+
+    /**
+    * @brief: Number of nodes of the container.
+    *
+    * @return: size_t -> Nodes.
+    */
+    _NODISCARD __forceinline size_t Nodes() const noexcept { return m_Nodes; }
+
+    //Element Access
+public:
+    /**
+    * @brief: Returns a reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD T& Front() noexcept { return static_cast<Node*>(m_Sentinel.Next)->Data()[0]; }
+
+    /**
+    * @brief: Returns a const reference to the first element in the container.
+    * @details: Calling Front in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD const T& Front() const noexcept { return static_cast<Node*>(m_Sentinel.Next)->Data()[0]; }
+
+    /**
+    * @brief: Returns a reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD T& Back() noexcept { return static_cast<Node*>(m_Sentinel.Prev)->Data()[m_Sentinel.Prev->Count - 1]; }
+
+    /**
+    * @brief: Returns a const reference to the last element in the container.
+    * @details: Calling Back in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD const T& Back() const noexcept { return static_cast<Node*>(m_Sentinel.Prev)->Data()[m_Sentinel.Prev->Count - 1]; }
+
+    /**
+    * @brief: Returns a reference to the element at the given position.
+    * @details: Calling [] in a empty container is undefined.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD T& operator[](size_t index) noexcept { return *GetIteratorAtIndex(index); }
+
+    /**
+    * @brief: Returns a const reference to the element at the given position.
+    * @details: Calling [] in a empty container is undefined.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD const T& operator[](size_t index) const noexcept { return *const_cast<UnrolledList*>(this)->GetIteratorAtIndex(index); }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @return: T& -> Element.
+    */
+    _NODISCARD T& At(size_t index)
+    {
+        if (index >= m_Elements) { UnrolledListOutOfRangeError(); }
+        return *GetIteratorAtIndex(index);
+    }
+
+    /**
+    * @brief: Returns the element of the container at the given index.
+    * @details: std::exception execption will be thrown if the index is out of range.
+    *
+    * @return: const T& -> Element.
+    */
+    _NODISCARD const T& At(size_t index) const
+    {
+        if (index >= m_Elements) { UnrolledListOutOfRangeError(); }
+        return *const_cast<UnrolledList*>(this)->GetIteratorAtIndex(index);
+    }
+
+    /**
+    * @brief: Returns an iterator at the given index.
+    * @details: The walk starts from the closest end and skips whole nodes.
+    * Calling it with an index out of range is undefined.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD iterator GetIteratorAtIndex(size_t index) noexcept
+    {
+        if (index < (m_Elements >> 1))
+        {
+            iterator it = begin();
+            it += index;
+            return it;
+        }
+
+        iterator it = end();
+        it -= m_Elements - index;
+        return it;
+    }
+
+    //Iterators
+public:
+    /**
+    * @brief: Returns an iterator to the begin of the container.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator begin() noexcept { return iterator(m_Sentinel.Next, 0); }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator begin() const noexcept { return const_iterator(m_Sentinel.Next, 0); }
+
+    /**
+    * @brief: Returns a const iterator to the begin of the container.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cbegin() const noexcept { return const_iterator(m_Sentinel.Next, 0); }
+
+    /**
+    * @brief: Returns an iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator end() noexcept { return iterator(&m_Sentinel, 0); }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator end() const noexcept { return const_iterator(const_cast<NodeBase*>(&m_Sentinel), 0); }
+
+    /**
+    * @brief: Returns a const iterator to the end of the container.
+    * @details: The iterator does not point to the last element, points outside the container instead.
+    *
+    * @return: const_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_iterator cend() const noexcept { return end(); }
+
+    /**
+    * @brief: Returns a reverse iterator to the end of the container.
+    * @details: The iterator points to the last element.
+    *
+    * @return: reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline reverse_iterator rbegin() noexcept { return reverse_iterator(m_Sentinel.Prev, LastIndex()); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the end of the container.
+    * @details: The iterator points to the last element.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(m_Sentinel.Prev, LastIndex()); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the end of the container.
+    * @details: The iterator points to the last element.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+    /**
+    * @brief: Returns a reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline reverse_iterator rend() noexcept { return reverse_iterator(&m_Sentinel, 0); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator rend() const noexcept { return const_reverse_iterator(const_cast<NodeBase*>(&m_Sentinel), 0); }
+
+    /**
+    * @brief: Returns a const reverse iterator to the begin of the container.
+    * @details: The iterator does not point to the first element, points outside the container instead.
+    *
+    * @return: const_reverse_iterator -> Iterator.
+    */
+    _NODISCARD __forceinline const_reverse_iterator crend() const noexcept { return rend(); }
+
+    //Member functions
+public:
+    explicit UnrolledList() noexcept
+    {
+        Default();
+    }
+
+    explicit UnrolledList(const Allocator& allocator) noexcept :
+        AllocatorBase(allocator)
+    {
+        Default();
+    }
+
+    UnrolledList(const UnrolledList& other) :
+        AllocatorBase(Propagation::OnCopyConstruction(other.GetAllocatorReference()))
+    {
+        Default();
+        Append(other);
+    }
+
+    UnrolledList(UnrolledList&& other) noexcept :
+        AllocatorBase(std::move(other.GetAllocatorReference()))
+    {
+        Default();
+        Swap(other);
+    }
+
+    UnrolledList(std::initializer_list<T>&& list)
+    {
+        Default();
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+    }
+
+    UnrolledList(std::initializer_list<T>&& list, const Allocator& allocator) :
+        AllocatorBase(allocator)
+    {
+        Default();
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+    }
+
+    ~UnrolledList() noexcept
+    {
+        Clear();
+    }
+
+    UnrolledList& operator=(const UnrolledList& other)
+    {
+        if (&other == this) { return *this; }
+
+        //The nodes are released by the current allocator before it is replaced
+        Clear();
+        Propagation::OnCopyAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        Append(other);
+
+        return *this;
+    }
+
+    UnrolledList& operator=(UnrolledList&& other) noexcept(Propagation::s_AlwaysTakesMemory)
+    {
+        if (&other == this) { return *this; }
+
+        Clear();
+        if (!Propagation::CanTakeMemory(GetAllocatorReference(), other.GetAllocatorReference()))
+        {
+            //The nodes of other can not be released by this allocator, the elements are moved one by one
+            Append(std::move(other));
+            return *this;
+        }
+
+        Propagation::OnMoveAssignment(GetAllocatorReference(), other.GetAllocatorReference());
+        if (!other.IsEmpty())
+        {
+            Link(other.m_Sentinel.Next, other.m_Sentinel.Prev, other.m_Elements, other.m_Nodes);
+            other.Default();
+        }
+
+        return *this;
+    }
+
+    UnrolledList& operator=(std::initializer_list<T>&& list)
+    {
+        Clear();
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            EmplaceBack(std::move(*it));
+        }
+
+        return *this;
+    }
+
+    /**
+    * @brief: Returns a copy of the allocator used by the container.
+    *
+    * @return: Allocator -> Allocator.
+    */
+    _NODISCARD __forceinline Allocator GetAllocator() const noexcept { return GetAllocatorReference(); }
+
+    //Non-member functions
+public:
+    _NODISCARD bool operator==(const UnrolledList& other) const noexcept
+    {
+        if (m_Elements != other.m_Elements) { return false; }
+
+        const_iterator other_it = other.cbegin();
+        for (const_iterator this_it = cbegin(); this_it != cend(); ++this_it, ++other_it)
+        {
+            if (*this_it != *other_it) { return false; }
+        }
+
+        return true;
+    }
+
+    _NODISCARD __forceinline bool operator!=(const UnrolledList& other) const noexcept { return !(*this == other); }
+
+private:
+    /**
+    * @brief: Returns the iterator to insert before the given index.
+    * @details: An index out of range returns the end of the container.
+    *
+    * @return: iterator -> Iterator.
+    */
+    _NODISCARD __forceinline iterator GetInsertPosition(size_t index) noexcept
+    {
+        return index >= m_Elements ? end() : GetIteratorAtIndex(index);
+    }
+
+    /**
+    * @brief: Makes room for one element before the given position.
+    * @details: Inserting at the end of a full node uses the next node or a new one, inserting at the begin of a full node
+    * uses the end of the previous node, so sequential insertions fill the nodes completely.
+    * Any other insertion into a full node splits it in two halves.
+    * The slot is left as raw storage and already counted, the caller must construct the element.
+    *
+    * @param: iterator -> Position.
+    * @return: iterator -> Position of the slot.
+    */
+    iterator OpenSlot(iterator it)
+    {
+        if (m_Elements >= s_MaxUnrolledListSize) { UnrolledListMaxLenghtError(); }
+
+        NodeBase* node = it.m_Node;
+        size_t index = it.m_Index;
+
+        if (node == &m_Sentinel)
+        {
+            node = m_Sentinel.Prev;
+            index = node->Count;
+        }
+
+        if (node == &m_Sentinel || node->Count == BlockSize)
+        {
+            if (node != &m_Sentinel && index == 0 && node->Prev != &m_Sentinel && node->Prev->Count < BlockSize)
+            {
+                node = node->Prev;
+                index = node->Count;
+            }
+            else if (node == &m_Sentinel || index == BlockSize)
+            {
+                NodeBase* next = node == &m_Sentinel ? &m_Sentinel : node->Next;
+                if (next != &m_Sentinel && next->Count < BlockSize) { node = next; }
+                else
+                {
+                    Node* new_node = CreateNode();
+                    LinkBefore(next, new_node);
+                    node = new_node;
+                }
+                index = 0;
+            }
+            else if (index == 0)
+            {
+                Node* new_node = CreateNode();
+                LinkBefore(node, new_node);
+                node = new_node;
+            }
+            else
+            {
+                Node* new_node = SplitNode(static_cast<Node*>(node));
+                if (index > node->Count)
+                {
+                    index -= node->Count;
+                    node = new_node;
+                }
+            }
+        }
+
+        T* data = static_cast<Node*>(node)->Data();
+        RelocateElements(data + index + 1, data + index, node->Count - index);
+        ++node->Count;
+        ++m_Elements;
+
+        return iterator(node, index);
+    }
+
+    /**
+    * @brief: Constructs the element in the slot opened by OpenSlot.
+    * @details: If the constructor throws, the slot is closed again and the exception is rethrown.
+    *
+    * @param: iterator -> Position of the slot.
+    * @param: Args&&... -> Arguments of the element constructor.
+    * @return: T& -> Element.
+    */
+    template<typename... Args>
+    __forceinline T& Construct(iterator it, Args&&... args)
+    {
+        T* slot = it.operator->();
+        if constexpr (std::is_nothrow_constructible<T, Args&&...>::value) { new (slot) T(std::forward<Args>(args)...); }
+        else
+        {
+            try { new (slot) T(std::forward<Args>(args)...); }
+            catch (...)
+            {
+                CloseSlot(it);
+                throw;
+            }
+        }
+        return *slot;
+    }
+
+    /**
+    * @brief: Removes a slot opened by OpenSlot whose element could not be constructed.
+    * @details: The elements after the slot are moved back, a node left empty is released.
+    *
+    * @param: iterator -> Position of the slot.
+    * @return: void.
+    */
+    void CloseSlot(iterator it) noexcept
+    {
+        Node* node = static_cast<Node*>(it.m_Node);
+        T* data = node->Data();
+        RelocateElements(data + it.m_Index, data + it.m_Index + 1, node->Count - it.m_Index - 1);
+        --node->Count;
+        --m_Elements;
+        if (node->Count == 0) { DeleteNode(node); }
+    }
+
+    /**
+    * @brief: Moves the upper half of a full node to a new node linked after it.
+    *
+    * @param: Node* -> Full node.
+    * @return: Node* -> New node.
+    */
+    Node* SplitNode(Node* node)
+    {
+        Node* new_node = CreateNode();
+        LinkBefore(node->Next, new_node);
+
+        const size_t half = node->Count / 2;
+        RelocateElements(new_node->Data(), node->Data() + half, node->Count - half);
+        new_node->Count = node->Count - half;
+        node->Count = half;
+
+        return new_node;
+    }
+
+    /**
+    * @brief: Moves count elements from first to to, the destination is raw storage and the source is left as raw storage.
+    * @details: The ranges may overlap. Trivially relocatable elements are moved with a single memmove.
+    *
+    * @param: T* -> Destination.
+    * @param: T* -> First element to move.
+    * @param: size_t -> Number of elements.
+    *
+    * @return: void.
+    */
+    static __forceinline void RelocateElements(T* to, T* first, size_t count) noexcept
+    {
+        if (to == first || count == 0) { return; }
+
+        if constexpr (IsTriviallyRelocatable<T>::value)
+        {
+            std::memmove((void*)to, (const void*)first, sizeof(T) * count);
+        }
+        else if (to < first)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                new (to + i) T(std::move(first[i]));
+                first[i].~T();
+            }
+        }
+        else
+        {
+            for (size_t i = count; i > 0; --i)
+            {
+                new (to + i - 1) T(std::move(first[i - 1]));
+                first[i - 1].~T();
+            }
+        }
+    }
+
+    _NODISCARD Node* CreateNode()
+    {
+        NodeAllocator allocator(GetAllocatorReference());
+        Node* node = nullptr;
+        try { node = NodeTraits::allocate(allocator, 1); }
+        catch (...) { UnrolledListBadAllocationError(); }
+
+        new (node) Node();
+        ++m_Nodes;
+        return node;
+    }
+
+    /**
+    * @brief: Unlinks and releases a node, its elements must be already destroyed or moved.
+    *
+    * @param: Node* -> Node.
+    * @return: void.
+    */
+    __forceinline void DeleteNode(Node* node) noexcept
+    {
+        node->Prev->Next = node->Next;
+        node->Next->Prev = node->Prev;
+        --m_Nodes;
+
+        FreeNode(node);
+    }
+
+    __forceinline void DestroyNode(Node* node) noexcept
+    {
+        if constexpr (!std::is_trivially_destructible<T>::value)
+        {
+            T* data = node->Data();
+            for (size_t i = 0; i < node->Count; ++i)
+            {
+                data[i].~T();
+            }
+        }
+        FreeNode(node);
+    }
+
+    __forceinline void FreeNode(Node* node) noexcept
+    {
+        (*node).~Node();
+        NodeAllocator allocator(GetAllocatorReference());
+        NodeTraits::deallocate(allocator, node, 1);
+    }
+
+    __forceinline void LinkBefore(NodeBase* position, NodeBase* node) noexcept
+    {
+        node->Prev = position->Prev;
+        node->Next = position;
+        position->Prev->Next = node;
+        position->Prev = node;
+    }
+
+    /**
+    * @brief: Makes the given chain of nodes the content of the container, the previous content is forgotten.
+    *
+    * @param: NodeBase* -> First node.
+    * @param: NodeBase* -> Last node.
+    * @param: size_t -> Number of elements.
+    * @param: size_t -> Number of nodes.
+    *
+    * @return: void.
+    */
+    __forceinline void Link(NodeBase* first, NodeBase* last, size_t elements, size_t nodes) noexcept
+    {
+        m_Sentinel.Next = first;
+        m_Sentinel.Prev = last;
+        first->Prev = &m_Sentinel;
+        last->Next = &m_Sentinel;
+        m_Elements = elements;
+        m_Nodes = nodes;
+    }
+
+    __forceinline void Default() noexcept
+    {
+        m_Sentinel.Prev = &m_Sentinel;
+        m_Sentinel.Next = &m_Sentinel;
+        m_Sentinel.Count = 0;
+        m_Elements = 0;
+        m_Nodes = 0;
+    }
+
+    _NODISCARD __forceinline size_t LastIndex() const noexcept { return m_Sentinel.Prev->Count ? m_Sentinel.Prev->Count - 1 : 0; }
+
+    [[noreturn]] __forceinline static void UnrolledListOutOfRangeError() {
+        throw std::exception("UnrolledList index out of range");
+    }
+
+    [[noreturn]] __forceinline static void UnrolledListMaxLenghtError() {
+        throw std::exception("UnrolledList too long");
+    }
+
+    [[noreturn]] __forceinline static void UnrolledListBadAllocationError() {
+        throw std::exception("Bad allocation");
+    }
+
+private:
+    NodeBase m_Sentinel;
+    size_t m_Elements = 0;
+    size_t m_Nodes = 0;
+
+    static _CONSTEXPR17 size_t s_MaxUnrolledListSize = 10000000;
+    static _CONSTEXPR17 size_t s_MergeSize = BlockSize - BlockSize / 4;
+};
+
+/*
+* UnrolledList that takes its memory from a std::pmr::memory_resource selected at runtime.
+*/
+template<typename T, size_t BlockSize = UnrolledBlockSize<T>::value>
+using PmrUnrolledList = UnrolledList<T, BlockSize, std::pmr::polymorphic_allocator<T>>;
@@ -8,6 +8,7 @@
 * Single header class.
 * Vector class is a sequence container that encapsulates dynamic size Vectors.
 * The storage of the vector is handled automatically, being expanded and contracted as needed.
+* The way the storage is expanded is selected by the GrowthPolicy template parameter (see GrowthPolicy.hpp).
 */
 
 /*
@@ -35,10 +36,20 @@ Copyright (c) 2020 Luis Poveda Cano
 */
 
 #include <initializer_list>
-
-template<typename T>
-class Vector
+#include <cstdlib>  //For std::malloc, std::realloc and std::free
+#include <cstring>  //For std::memcpy
+#include "GrowthPolicy.hpp"
+#include "TypeTraits.hpp"
+#include "Allocator.hpp"
+
+template<typename T, typename GrowthPolicy = DoublingGrowthPolicy, typename Allocator = std::allocator<T>>
+class Vector : private AllocatorStorage<Allocator>
 {
+    using AllocatorBase = AllocatorStorage<Allocator>;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    using Propagation = AllocatorPropagation<Allocator>;
+    using AllocatorBase::GetAllocatorReference;
+
 public:
     template<typename ValueType>
     class Iterator
@@ -1094,6 +1105,7 @@ public:
     using const_iterator = Iterator<const T>;
     using reverse_iterator = ReverseIterator<T>;
     using const_reverse_iterator = ReverseIterator<const T>;
+    using allocator_type = Allocator;
 
     //Modifiers
 public:
@@ -1113,6 +1125,20 @@ public:
         if (capacity == 0) { return Nullify(); }
         if (capacity == m_Capacity) { return; }
 
+        if constexpr (s_Reallocatable)
+        {
+            if (capacity < m_Elements)
+            {
+                for (iterator it = begin() + capacity; it != end(); ++it)
+                {
+                    (*it).~T();
+                }
+                m_Elements = capacity;
+            }
+
+            return ReallocateBlock(capacity);
+        }
+
         T* new_block = AllocateNewBlock(capacity);
 
         if (capacity < m_Elements)
@@ -1144,7 +1170,7 @@ public:
     */
     void PushBack(const T& element)
     {
-        if (IsFull() || !m_Data) { Reserve(m_Capacity << 1); }
+        if (IsFull() || !m_Data) { Grow(m_Elements + 1); }
         new (&m_Data[m_Elements++]) T(element);
     }
 
@@ -1158,7 +1184,7 @@ public:
     */
     void PushBack(T&& element)
     {
-        if (IsFull() || !m_Data) { Reserve(m_Capacity << 1); }
+        if (IsFull() || !m_Data) { Grow(m_Elements + 1); }
         new (&m_Data[m_Elements++]) T(std::move(element));
     }
 
@@ -1179,7 +1205,7 @@ public:
             iterator it = end();
             return --it;
         }
-        if (IsFull()) { Reserve(m_Capacity << 1); }
+        if (IsFull()) { Grow(m_Elements + 1); }
 
         iterator it = begin();
         it += index;
@@ -1209,7 +1235,7 @@ public:
         if (IsFull())
         {
             size_t distance = it.Distance(begin());
-            Reserve(m_Capacity << 1);
+            Grow(m_Elements + 1);
             it = begin();
             it += distance;
         }
@@ -1240,7 +1266,7 @@ public:
         if (IsFull())
         {
             size_t distance = it.Distance(rbegin());
-            Reserve(m_Capacity << 1);
+            Grow(m_Elements + 1);
             it = rbegin();
             it += distance;
         }
@@ -1269,7 +1295,7 @@ public:
             iterator it = end();
             return --it;
         }
-        if (IsFull()) { Reserve(m_Capacity << 1); }
+        if (IsFull()) { Grow(m_Elements + 1); }
 
         iterator it = begin();
         it += index;
@@ -1299,7 +1325,7 @@ public:
         if (IsFull())
         {
             size_t distance = it.Distance(begin());
-            Reserve(m_Capacity << 1);
+            Grow(m_Elements + 1);
             it = begin();
             it += distance;
         }
@@ -1330,7 +1356,7 @@ public:
         if (IsFull())
         {
             size_t distance = it.Distance(rbegin());
-            Reserve(m_Capacity << 1);
+            Grow(m_Elements + 1);
             it = rbegin();
             it += distance;
         }
@@ -1354,7 +1380,7 @@ public:
     template<typename... Args>
     iterator EmplaceBack(Args&&... args)
     {
-        if (IsFull() || !m_Data) { Reserve(m_Capacity << 1); }
+        if (IsFull() || !m_Data) { Grow(m_Elements + 1); }
         iterator it = end();
         new (&m_Data[m_Elements++]) T(std::forward<Args>(args)...);
         return it;
@@ -1379,7 +1405,7 @@ public:
             iterator it = end();
             return --it;
         }
-        if (IsFull()) { Reserve(m_Capacity << 1); }
+        if (IsFull()) { Grow(m_Elements + 1); }
 
         iterator it = begin();
         it += index;
@@ -1412,7 +1438,7 @@ public:
         if (IsFull())
         {
             size_t distance = it.Distance(begin());
-            Reserve(m_Capacity << 1);
+            Grow(m_Elements + 1);
             it = begin();
             it += distance;
         }
@@ -1446,7 +1472,7 @@ public:
         if (IsFull())
         {
             size_t distance = it.Distance(rbegin());
-            Reserve(m_Capacity << 1);
+            Grow(m_Elements + 1);
             it = rbegin();
             it += distance;
         }
@@ -1459,6 +1485,116 @@ public:
         return it;
     }
 
+    /**
+    * @brief: Inserts count copies of the element into the container directly before index.
+    * @details: The storage is reserved once and the elements after the position are shifted only once.
+    * If the index is out of range, the elements are inserted at the end.
+    *
+    * @param: size_t -> Index.
+    * @param: size_t -> Number of copies.
+    * @param: const T& -> Element.
+    * 
+    * @return: Iterator -> Iterator to the first inserted element.
+    */
+    iterator InsertN(size_t index, size_t count, const T& element)
+    {
+        if (index > m_Elements) { index = m_Elements; }
+        if (count == 0) { return begin() + index; }
+        if (IsInside(&element))
+        {
+            T copy(element);
+            return InsertN(index, count, copy);
+        }
+
+        T* gap = OpenGap(index, count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            new (gap + i) T(element);
+        }
+        m_Elements += count;
+
+        return iterator(gap);
+    }
+
+    /**
+    * @brief: Inserts count copies of the element into the container directly before the position.
+    * @details: The storage is reserved once and the elements after the position are shifted only once.
+    *
+    * @param: Iterator -> Position.
+    * @param: size_t -> Number of copies.
+    * @param: const T& -> Element.
+    * 
+    * @return: Iterator -> Iterator to the first inserted element.
+    */
+    iterator InsertN(iterator it, size_t count, const T& element)
+    {
+        return InsertN(m_Data ? (size_t)(it.m_Ptr - m_Data) : 0, count, element);
+    }
+
+    /**
+    * @brief: Inserts the elements of the range [first, last) into the container directly before index.
+    * @details: The storage is reserved once and the elements after the position are shifted only once.
+    * The new elements are copy constructed in place. The range must not belong to the container.
+    * A single pass range is copied to a buffer first, so it is traversed only once.
+    * If the index is out of range, the elements are inserted at the end.
+    *
+    * @param: size_t -> Index.
+    * @param: InputIterator -> First element of the range.
+    * @param: InputIterator -> End of the range.
+    * 
+    * @return: Iterator -> Iterator to the first inserted element.
+    */
+    template<typename InputIterator>
+    iterator InsertRange(size_t index, InputIterator first, InputIterator last)
+    {
+        if (index > m_Elements) { index = m_Elements; }
+
+        if constexpr (IsSinglePassIterator<InputIterator>::value)
+        {
+            Vector buffer(GetAllocator());
+            for (; first != last; ++first)
+            {
+                buffer.EmplaceBack(*first);
+            }
+            return InsertRange(index, std::make_move_iterator(buffer.Data()), std::make_move_iterator(buffer.Data() + buffer.Size()));
+        }
+        else
+        {
+            size_t count = 0;
+            for (InputIterator it = first; it != last; ++it)
+            {
+                ++count;
+            }
+            if (count == 0) { return begin() + index; }
+
+            T* gap = OpenGap(index, count);
+            for (T* ptr = gap; first != last; ++first, ++ptr)
+            {
+                new (ptr) T(*first);
+            }
+            m_Elements += count;
+
+            return iterator(gap);
+        }
+    }
+
+    /**
+    * @brief: Inserts the elements of the range [first, last) into the container directly before the position.
+    * @details: The storage is reserved once and the elements after the position are shifted only once.
+    * The new elements are copy constructed in place. The range must not belong to the container.
+    *
+    * @param: Iterator -> Position.
+    * @param: InputIterator -> First element of the range.
+    * @param: InputIterator -> End of the range.
+    * 
+    * @return: Iterator -> Iterator to the first inserted element.
+    */
+    template<typename InputIterator>
+    iterator InsertRange(iterator it, InputIterator first, InputIterator last)
+    {
+        return InsertRange(m_Data ? (size_t)(it.m_Ptr - m_Data) : 0, first, last);
+    }
+
     /**
     * @brief: Delete the last element of the container.
     * @details: No reallocations are performed.
@@ -1556,6 +1692,157 @@ public:
         return it;
     }
 
+    /**
+    * @brief: Delete the elements in the range [first, last).
+    * @details: No reallocations are performed. The elements after the range are shifted only once.
+    *
+    * @param: Iterator -> First element to delete.
+    * @param: Iterator -> End of the range to delete.
+    * 
+    * @return: Iterator -> Iterator to the element at the first position after deleting.
+    */
+    iterator EraseRange(iterator first, iterator last) noexcept
+    {
+        if (IsEmpty()) { return iterator(); }
+        if (first < begin()) { first = begin(); }
+        if (last > end()) { last = end(); }
+        if (first >= last) { return first; }
+
+        const size_t count = last.m_Ptr - first.m_Ptr;
+        if constexpr (IsTriviallyRelocatable<T>::value)
+        {
+            for (iterator it = first; it != last; ++it)
+            {
+                (*it).~T();
+            }
+            MoveRun(first.m_Ptr, last.m_Ptr, m_Data + m_Elements);
+        }
+        else
+        {
+            MoveRun(first.m_Ptr, last.m_Ptr, m_Data + m_Elements);
+            DestroyRange(m_Data + m_Elements - count, m_Data + m_Elements);
+        }
+        m_Elements -= count;
+
+        return first;
+    }
+
+    /**
+    * @brief: Moves the elements that does not satisfy the predicate to the beginning of the container.
+    * @details: The relative order of the kept elements is preserved, the elements after the returned iterator are left in a valid but unspecified state.
+    * No elements are deleted, use EraseRange from the returned iterator to the end or use EraseIf instead.
+    *
+    * @param: Predicate -> Unary function returning true for the elements to remove.
+    * 
+    * @return: Iterator -> New end of the kept elements.
+    */
+    template<typename Predicate>
+    iterator RemoveIf(Predicate predicate)
+    {
+        T* write = m_Data;
+        for (T* read = m_Data; read != m_Data + m_Elements; ++read)
+        {
+            if (predicate(*read)) { continue; }
+            if (write != read) { *write = std::move(*read); }
+            ++write;
+        }
+
+        return iterator(write);
+    }
+
+    /**
+    * @brief: Delete all the elements that satisfy the predicate.
+    * @details: No reallocations are performed. The container is compacted in a single pass, the predicate is called once per element.
+    * Trivially relocatable elements are moved by runs with memmove.
+    * If the predicate throws, the elements deleted so far stay deleted and the rest are kept.
+    *
+    * @param: Predicate -> Unary function returning true for the elements to delete.
+    * 
+    * @return: size_t -> Number of deleted elements.
+    */
+    template<typename Predicate>
+    size_t EraseIf(Predicate predicate)
+    {
+        if (IsEmpty()) { return 0; }
+
+        T* last = m_Data + m_Elements;
+        T* write = m_Data;
+        if constexpr (IsTriviallyRelocatable<T>::value)
+        {
+            T* read = m_Data;
+            T* run = read;
+            try
+            {
+                while (read != last)
+                {
+                    run = read;
+                    while (read != last && !predicate(*read)) { ++read; }
+                    write = MoveRun(write, run, read);
+
+                    if (read == last) { break; }
+                    (*read).~T();
+                    ++read;
+                }
+            }
+            catch (...)
+            {
+                //The elements not relocated yet close the gap, so the container only holds live elements
+                m_Elements = MoveRun(write, run, last) - m_Data;
+                throw;
+            }
+        }
+        else
+        {
+            write = RemoveIf(predicate).m_Ptr;
+            DestroyRange(write, last);
+        }
+
+        const size_t erased = last - write;
+        m_Elements -= erased;
+
+        return erased;
+    }
+
+    /**
+    * @brief: Delete the elements at the given indices.
+    * @details: No reallocations are performed. The container is compacted in a single pass.
+    * The indices must be sorted in ascending order, repeated indices are ignored and the iteration stops at the first index out of range.
+    *
+    * @param: const IndexContainer& -> Container of sorted indices (Vector<size_t>, Array<size_t, S>, ...).
+    * 
+    * @return: size_t -> Number of deleted elements.
+    */
+    template<typename IndexContainer>
+    size_t EraseIndices(const IndexContainer& indices)
+    {
+        if (IsEmpty()) { return 0; }
+
+        T* write = m_Data;
+        T* read = m_Data;
+        size_t erased = 0;
+        for (auto it = indices.begin(); it != indices.end(); ++it)
+        {
+            const size_t index = *it;
+            if (index >= m_Elements) { break; }
+
+            T* target = m_Data + index;
+            if (target < read) { continue; }
+
+            write = MoveRun(write, read, target);
+            if constexpr (IsTriviallyRelocatable<T>::value) { (*target).~T(); }
+            read = target + 1;
+            ++erased;
+        }
+        if (erased == 0) { return 0; }
+
+        T* last = m_Data + m_Elements;
+        write = MoveRun(write, read, last);
+        if constexpr (!IsTriviallyRelocatable<T>::value) { DestroyRange(write, last); }
+        m_Elements -= erased;
+
+        return erased;
+    }
+
     /**
     * @brief: Clears the content of the container.
     * @details: By clearing the container, no reallocations are performed.
@@ -1615,6 +1902,7 @@ public:
     /**
     * @brief: Swaps the content of two Vectors.
     * @details: If the container is the same as the given, no action will be performed.
+    * The allocators are only swapped if the allocator propagates on swap, otherwise both allocators must be equal.
     *
     * @param: Vector& -> Vector to swap.
     * 
@@ -1624,17 +1912,22 @@ public:
     {
         if (this == &other) { return; }
 
+        Propagation::OnSwap(GetAllocatorReference(), other.GetAllocatorReference());
+
         T* aux_data = m_Data;
         size_t aux_capacity = m_Capacity;
         size_t aux_elements = m_Elements;
+        size_t aux_growth_hint = m_GrowthHint;
 
         m_Data = other.m_Data;
         m_Capacity = other.m_Capacity;
         m_Elements = other.m_Elements;
+        m_GrowthHint = other.m_GrowthHint;
 
         other.m_Data = aux_data;
         other.m_Capacity = aux_capacity;
         other.m_Elements = aux_elements;
+        other.m_GrowthHint = aux_growth_hint;
     }
 
     //Capacity
@@ -1652,6 +1945,7 @@ public:
         if (!m_Data) { return; }
         if (m_Elements == 0) { return DeleteStorage(); }
         if (m_Capacity <= m_Elements) { return; }
+        if constexpr (s_Reallocatable) { return ReallocateBlock(m_Elements); }
 
         T* new_block = AllocateNewBlock(m_Elements);
         TransferData(new_block);
@@ -1680,7 +1974,12 @@ public:
         if (capacity <= m_Capacity)
         {
             if (m_Data) { return; }
-            capacity = 8;
+            capacity = s_DefaultCapacity;
+        }
+
+        if constexpr (s_Reallocatable)
+        {
+            if (m_Data) { return ReallocateBlock(capacity); }
         }
 
         T* new_block = AllocateNewBlock(capacity);
@@ -1690,6 +1989,25 @@ public:
         m_Data = new_block;
     }
 
+    /**
+    * @brief: Gives a hint of the number of elements the container is expected to hold.
+    * @details: No allocation is performed, the next growth of the container allocates at least the hinted elements,
+    * or the capacity given by the growth policy when it is bigger.
+    * Once the hint has been used it is discarded, a hint of 0 removes the current one.
+    *
+    * @param: size_t -> Expected number of elements.
+    * 
+    * @return: void.
+    */
+    __forceinline void SetGrowthHint(size_t elements) noexcept { m_GrowthHint = elements; }
+
+    /**
+    * @brief: Returns the pending growth hint.
+    *
+    * @return: size_t -> Expected number of elements, 0 if there is no hint.
+    */
+    _NODISCARD __forceinline size_t GrowthHint() const noexcept { return m_GrowthHint; }
+
     /**
     * @brief: Checks if the container is empty.
     *
@@ -1913,12 +2231,22 @@ public:
 public:
     explicit Vector() noexcept = default;
 
+    explicit Vector(const Allocator& allocator) noexcept :
+        AllocatorBase(allocator) {}
+
     explicit Vector(size_t capacity) noexcept
     {
         Reserve(capacity);
     }
 
-    Vector(const Vector& other) noexcept
+    Vector(size_t capacity, const Allocator& allocator) noexcept :
+        AllocatorBase(allocator)
+    {
+        Reserve(capacity);
+    }
+
+    Vector(const Vector& other) noexcept :
+        AllocatorBase(Propagation::OnCopyConstruction(other.GetAllocatorReference()))
     {
         if (!other.m_Data || other.m_Capacity == 0) { return; }
 
@@ -1927,12 +2255,15 @@ public:
     }
 
     Vector(Vector&& other) noexcept :
+        AllocatorBase(std::move(other.GetAllocatorReference())),
         m_Capacity(other.m_Capacity),
         m_Elements(other.m_Elements),
+        m_GrowthHint(other.m_GrowthHint),
         m_Data(other.m_Data)
     {
         other.m_Capacity = 0;
         other.m_Elements = 0;
+        other.m_GrowthHint = 0;
         other.m_Data = nullptr;
     }
 
@@ -1945,6 +2276,16 @@ public:
         }
     }
 
+    Vector(std::initializer_list<T>&& list, const Allocator& allocator) noexcept :
+        AllocatorBase(allocator)
+    {
+        Reserve(list.size());
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            PushBack(std::move(*it));
+        }
+    }
+
     ~Vector() noexcept
     {
         Nullify();
@@ -1955,6 +2296,7 @@ public:
         if (&other == this) { return *this; }
         
         Nullify();
+        Propagation::OnCopyAssignment(GetAllocatorReference(), other.GetAllocatorReference());
         if (!other.m_Data) { return *this; }
 
         Reserve(other.m_Capacity);
@@ -1963,10 +2305,20 @@ public:
         return *this;
     }
 
-    Vector& operator=(Vector&& other) noexcept
+    Vector& operator=(Vector&& other) noexcept(Propagation::s_AlwaysTakesMemory)
     {
         if (this == &other) { return *this; }
         Nullify();
+        m_GrowthHint = other.m_GrowthHint;
+        other.m_GrowthHint = 0;
+        if (!Propagation::CanTakeMemory(GetAllocatorReference(), other.GetAllocatorReference()))
+        {
+            //The memory of other can not be released by this allocator, the elements are moved one by one
+            Append(std::move(other));
+            return *this;
+        }
+
+        Propagation::OnMoveAssignment(GetAllocatorReference(), other.GetAllocatorReference());
         if (!other.m_Data) { return *this; }
 
         m_Capacity = other.m_Capacity;
@@ -1994,6 +2346,13 @@ public:
         return *this;
     }
 
+    /**
+    * @brief: Returns a copy of the allocator used by the container.
+    *
+    * @return: Allocator -> Allocator.
+    */
+    _NODISCARD __forceinline Allocator GetAllocator() const noexcept { return GetAllocatorReference(); }
+
     //Non-member functions
 public:
     /**
@@ -2060,6 +2419,15 @@ private:
 
     __forceinline void Nullify() noexcept
     {
+        if constexpr (s_SkipTeardown)
+        {
+            //The allocator releases all the memory at once and the elements need no destructor
+            m_Capacity = 0;
+            m_Elements = 0;
+            m_Data = nullptr;
+            return;
+        }
+
         if (m_Data)
         {
             Clear();
@@ -2069,11 +2437,118 @@ private:
 
     __forceinline void DeleteStorage() noexcept
     {
-        ::operator delete(m_Data, sizeof(T) * m_Capacity);
+        FreeBlock(m_Data, m_Capacity);
         m_Capacity = 0;
         m_Data = nullptr;
     }
 
+    /**
+    * @brief: Expands the storage to hold at least the required number of elements.
+    * @details: The new capacity is given by the growth policy, raised to the growth hint if there is a bigger one.
+    * The capacity is clamped to the maximum size of the container.
+    *
+    * @param: size_t -> Required number of elements.
+    *
+    * @return: void.
+    */
+    void Grow(size_t required)
+    {
+        size_t capacity = m_Data ? GrowthPolicy::NextCapacity(m_Capacity, sizeof(T)) : s_DefaultCapacity;
+        if (capacity < m_GrowthHint) { capacity = m_GrowthHint; }
+        if (capacity < required) { capacity = required; }
+        if (capacity > s_MaxVectorSize && required <= s_MaxVectorSize) { capacity = s_MaxVectorSize; }
+        m_GrowthHint = 0;
+
+        Reserve(capacity);
+    }
+
+    /**
+    * @brief: Moves the elements of the range [first, last) to the position to, which must not be after first.
+    * @details: Trivially relocatable elements are relocated with memmove, the source slots are left as raw storage.
+    * Other elements are move assigned, the destination slots must hold constructed elements.
+    *
+    * @param: T* -> Destination.
+    * @param: T* -> First element to move.
+    * @param: T* -> End of the range to move.
+    *
+    * @return: T* -> End of the moved range at the destination.
+    */
+    __forceinline T* MoveRun(T* to, T* first, T* last) noexcept
+    {
+        const size_t count = last - first;
+        if (to == first || count == 0) { return to + count; }
+
+        if constexpr (IsTriviallyRelocatable<T>::value)
+        {
+            std::memmove((void*)to, (const void*)first, sizeof(T) * count);
+        }
+        else
+        {
+            for (T* ptr = to; first != last; ++first, ++ptr)
+            {
+                *ptr = std::move(*first);
+            }
+        }
+
+        return to + count;
+    }
+
+    __forceinline void DestroyRange(T* first, T* last) noexcept
+    {
+        for (; first != last; ++first)
+        {
+            first->~T();
+        }
+    }
+
+    _NODISCARD __forceinline bool IsInside(const T* ptr) const noexcept
+    {
+        return m_Data && ptr >= m_Data && ptr < m_Data + m_Elements;
+    }
+
+    /**
+    * @brief: Opens a gap of uninitialized storage of count elements at the given index.
+    * @details: Reserves the needed capacity once and shifts the elements after the index only once.
+    * Trivially relocatable types are shifted with a single memmove.
+    * The number of elements is not updated, the caller must construct the elements of the gap.
+    *
+    * @param: size_t -> Index of the gap.
+    * @param: size_t -> Size of the gap.
+    *
+    * @return: T* -> First element of the gap.
+    */
+    T* OpenGap(size_t index, size_t count)
+    {
+        if (!m_Data || m_Elements + count > m_Capacity) { Grow(m_Elements + count); }
+
+        T* gap = m_Data + index;
+        T* last = m_Data + m_Elements;
+        if constexpr (IsTriviallyRelocatable<T>::value)
+        {
+            if (last != gap) { std::memmove((void*)(gap + count), (const void*)gap, sizeof(T) * (last - gap)); }
+        }
+        else
+        {
+            T* from = last;
+            T* to = last + count;
+            while (from != gap)
+            {
+                --from;
+                --to;
+                if (to >= last) { new (to) T(std::move(*from)); }
+                else { *to = std::move(*from); }
+            }
+
+            T* moved_end = gap + count < last ? gap + count : last;
+            for (T* ptr = gap; ptr != moved_end; ++ptr)
+            {
+                ptr->~T();
+            }
+        }
+
+        return gap;
+    }
+
     void LeftMoveVectorData(iterator it) noexcept
     {
         if constexpr (std::is_trivially_copyable<T>::value)
@@ -2121,9 +2596,16 @@ private:
     _NODISCARD T* AllocateNewBlock(size_t size)
     {
         T* memory_block = nullptr;
+        if constexpr (s_Reallocatable)
+        {
+            memory_block = (T*)std::malloc(sizeof(T) * size);
+            if (!memory_block) { VectorBadAllocationError(); }
+            return memory_block;
+        }
+
         try
         {
-            memory_block = (T*)::operator new(sizeof(T) * size);
+            memory_block = AllocatorTraits::allocate(GetAllocatorReference(), size);
         }
         catch (...)
         {
@@ -2133,14 +2615,45 @@ private:
         return memory_block;
     }
 
+    __forceinline void FreeBlock(T* memory_block, size_t size) noexcept
+    {
+        if constexpr (s_Reallocatable) { std::free(memory_block); }
+        else { AllocatorTraits::deallocate(GetAllocatorReference(), memory_block, size); }
+    }
+
+    /**
+    * @brief: Changes the capacity of the current block, growing or shrinking it in place when possible.
+    * @details: Only for trivially relocatable types, the bytes are moved by the C allocator without calling any constructor.
+    * The elements beyond the new capacity must be destroyed before calling it.
+    *
+    * @param: size_t -> New capacity.
+    *
+    * @return: void.
+    */
+    void ReallocateBlock(size_t capacity)
+    {
+        T* memory_block = (T*)std::realloc((void*)m_Data, sizeof(T) * capacity);
+        if (!memory_block) { VectorBadAllocationError(); }
+
+        m_Capacity = capacity;
+        m_Data = memory_block;
+    }
+
     __forceinline void TransferData(T* memory_block) noexcept
     {
-        for (iterator it = begin(); it != end(); ++it, ++memory_block)
+        if constexpr (IsTriviallyRelocatable<T>::value)
         {
-            new (memory_block) T(std::move(*it));
-            (*it).~T();
+            if (m_Elements) { std::memcpy((void*)memory_block, (const void*)m_Data, sizeof(T) * m_Elements); }
         }
-        ::operator delete(m_Data, sizeof(T) * m_Capacity);
+        else
+        {
+            for (iterator it = begin(); it != end(); ++it, ++memory_block)
+            {
+                new (memory_block) T(std::move(*it));
+                (*it).~T();
+            }
+        }
+        FreeBlock(m_Data, m_Capacity);
     }
 
     [[noreturn]] static __forceinline void VectorOutOfRangeError() {
@@ -2158,7 +2671,17 @@ private:
 private:
     size_t m_Capacity = 0;
     size_t m_Elements = 0;
+    size_t m_GrowthHint = 0;
     T* m_Data = nullptr;
 
+    static _CONSTEXPR17 size_t s_DefaultCapacity = 8;
+    static _CONSTEXPR17 bool s_Reallocatable = IsTriviallyRelocatable<T>::value && IsDefaultAllocator<Allocator, T>::value && alignof(T) <= alignof(std::max_align_t);
     static _CONSTEXPR17 size_t s_MaxVectorSize = 10000000;
+    static _CONSTEXPR17 bool s_SkipTeardown = IsReleaseAllAllocator<Allocator>::value && std::is_trivially_destructible<T>::value;
 };
+
+/*
+* Vector that takes its memory from a std::pmr::memory_resource selected at runtime.
+*/
+template<typename T, typename GrowthPolicy = DoublingGrowthPolicy>
+using PmrVector = Vector<T, GrowthPolicy, std::pmr::polymorphic_allocator<T>>;
@@ -0,0 +1,84 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Memory resource that counts the allocations and the bytes requested through it.
+* Used by the tests to check that the containers route their memory through the given allocator.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <memory_resource>  //For std::pmr::memory_resource
+#include <type_traits>  //For std::is_nothrow_move_assignable
+
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept :
+        m_Upstream(upstream) {}
+
+    _NODISCARD size_t Allocations() const noexcept { return m_Allocations; }
+
+    _NODISCARD size_t Deallocations() const noexcept { return m_Deallocations; }
+
+    _NODISCARD size_t BytesInUse() const noexcept { return m_BytesInUse; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        ++m_Allocations;
+        m_BytesInUse += bytes;
+        return m_Upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override
+    {
+        ++m_Deallocations;
+        m_BytesInUse -= bytes;
+        m_Upstream->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    std::pmr::memory_resource* m_Upstream = nullptr;
+    size_t m_Allocations = 0;
+    size_t m_Deallocations = 0;
+    size_t m_BytesInUse = 0;
+};
+
+/*
+* True if the move assignment of a container is noexcept with the default allocator and not with a polymorphic one.
+* A polymorphic allocator does not propagate and can be different, so the move assignment may have to allocate and move the elements one by one.
+*/
+template<class Container, class PmrContainer>
+_NODISCARD constexpr bool IsMoveAssignmentNoexceptOnlyWithEqualAllocators() noexcept
+{
+    return std::is_nothrow_move_assignable<Container>::value && !std::is_nothrow_move_assignable<PmrContainer>::value;
+}
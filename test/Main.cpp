@@ -9,8 +9,31 @@
 #include "data_test/ArrayTest.hpp"
 #include "data_test/VectorTest.hpp"
 #include "data_test/ListTest.hpp"
+#include "data_test/SmallVectorTest.hpp"
+#include "data_test/MonotonicArenaTest.hpp"
+#include "data_test/UnrolledListTest.hpp"
+#include "data_test/CompactListTest.hpp"
+#include "data_test/NodePoolTest.hpp"
+#include "data_test/IntrusiveListTest.hpp"
+#include "data_test/ConcurrentListTest.hpp"
+#include "data_test/DequeTest.hpp"
+#include "data_test/TieredVectorTest.hpp"
+#include "data_test/GapBufferTest.hpp"
+#include "data_test/SegmentedVectorTest.hpp"
+#include "data_test/LargeVectorTest.hpp"
+#include "data_test/MappedVectorTest.hpp"
 #include "performance_test/VectorPerformance.hpp"
 #include "performance_test/ListPerformance.hpp"
+#include "performance_test/SmallVectorPerformance.hpp"
+#include "performance_test/ArenaPerformance.hpp"
+#include "performance_test/CompactListPerformance.hpp"
+#include "performance_test/NodePoolPerformance.hpp"
+#include "performance_test/IntrusiveListPerformance.hpp"
+#include "performance_test/ConcurrentListPerformance.hpp"
+#include "performance_test/GapBufferPerformance.hpp"
+#include "performance_test/SegmentedVectorPerformance.hpp"
+#include "performance_test/LargeVectorPerformance.hpp"
+#include "performance_test/MappedVectorPerformance.hpp"
 #include "performance_test/DataStructuresComparison.hpp"
 
 #define __DATA_STRUCTURES_TESTS__ 1
@@ -24,12 +47,35 @@ int main()
         ArrayTest::RunAllTest();
         VectorTest::RunAllTest();
         ListTest::RunAllTest();
+        SmallVectorTest::RunAllTest();
+        MonotonicArenaTest::RunAllTest();
+        UnrolledListTest::RunAllTest();
+        CompactListTest::RunAllTest();
+        NodePoolTest::RunAllTest();
+        IntrusiveListTest::RunAllTest();
+        ConcurrentListTest::RunAllTest();
+        DequeTest::RunAllTest();
+        TieredVectorTest::RunAllTest();
+        GapBufferTest::RunAllTest();
+        SegmentedVectorTest::RunAllTest();
+        LargeVectorTest::RunAllTest();
+        MappedVectorTest::RunAllTest();
     }
 #endif
 #if __PERFORMANCE_TESTS__
     {
         VectorPerformance::RunAllTest();
         ListPerformance::RunAllTest();
+        SmallVectorPerformance::RunAllTest();
+        ArenaPerformance::RunAllTest();
+        CompactListPerformance::RunAllTest();
+        NodePoolPerformance::RunAllTest();
+        IntrusiveListPerformance::RunAllTest();
+        ConcurrentListPerformance::RunAllTest();
+        GapBufferPerformance::RunAllTest();
+        SegmentedVectorPerformance::RunAllTest();
+        LargeVectorPerformance::RunAllTest();
+        MappedVectorPerformance::RunAllTest();
     }
 #endif
 #if __COMPARE_DATA_STRUCTURES__
@@ -173,4 +173,104 @@ public:
         stream << std::endl;
         stream << std::endl;
     }
+
+    static void WriteContenderResults(std::stringstream& stream, const std::string& container_type, const size_t elements,
+        double best, double worst, double average, double vector_average, double list_average)
+    {
+        constexpr size_t precision = 20;
+
+        stream << container_type << " stats:" << std::endl;
+        stream << "Best time:          " << std::fixed << std::setprecision(precision) << best << " seconds" << std::endl;
+        stream << "Worst time:         " << std::fixed << std::setprecision(precision) << worst << " seconds" << std::endl;
+        stream << "Average time:       " << std::fixed << std::setprecision(precision) << average << " seconds" << std::endl;
+        stream << "Time per operation: " << std::fixed << std::setprecision(precision) << average / (double)elements << " seconds" << std::endl;
+        stream << std::endl;
+        WriteRelativeTime(stream, container_type, "Vector", average, vector_average);
+        WriteRelativeTime(stream, container_type, "List", average, list_average);
+        stream << std::endl;
+    }
+
+    static void WriteRelativeTime(std::stringstream& stream, const std::string& container_type, const std::string& other_type,
+        double average, double other_average)
+    {
+        double percentage = 0.0;
+        if (average <= other_average)
+        {
+            percentage = other_average * 100.0 / average;
+            percentage = percentage - 100.0;
+            stream << other_type << " was " << std::fixed << std::setprecision(2) << percentage << "% slower than " << container_type << "." << std::endl;
+        }
+        else
+        {
+            percentage = average * 100.0 / other_average;
+            percentage = percentage - 100.0;
+            stream << container_type << " was " << std::fixed << std::setprecision(2) << percentage << "% slower than " << other_type << "." << std::endl;
+        }
+    }
+
+    static void WriteHeader(std::stringstream& stream, const std::string& name, const std::string& data_type,
+        const size_t elements, const size_t iterations)
+    {
+        size_t elements_size = 0;
+        size_t iterations_size = 0;
+        {
+            size_t tmp = elements;
+            while (tmp != 0)
+            {
+                ++elements_size;
+                tmp /= 10;
+            }
+
+            tmp = iterations;
+            while (tmp != 0)
+            {
+                ++iterations_size;
+                tmp /= 10;
+            }
+        }
+        const size_t line_size = 31 + elements_size;
+
+        WriteSeparator(line_size, stream);
+        stream << "* " << name.c_str(); WriteSpaceUntilEndOfLine(line_size - (2 + name.size()), stream);
+        stream << "* Number of elements tested: " << elements; WriteSpaceUntilEndOfLine(line_size - (29 + elements_size), stream);
+        stream << "* Number of iterations: " << iterations; WriteSpaceUntilEndOfLine(line_size - (24 + iterations_size), stream);
+        stream << "* Data type: " << data_type.c_str(); WriteSpaceUntilEndOfLine(line_size - (13 + data_type.size()), stream);
+        WriteSeparator(line_size, stream);
+    }
+
+    static void WriteGrowthResults(std::stringstream& stream, const std::string& name, const std::string& data_type,
+        const size_t elements, const size_t iterations,
+        double best, double worst, double average,
+        size_t reallocations, size_t peak_bytes, size_t final_bytes, size_t used_bytes)
+    {
+        constexpr size_t precision = 20;
+
+        WriteHeader(stream, name, data_type, elements, iterations);
+        stream << "Best time:          " << std::fixed << std::setprecision(precision) << best << " seconds" << std::endl;
+        stream << "Worst time:         " << std::fixed << std::setprecision(precision) << worst << " seconds" << std::endl;
+        stream << "Average time:       " << std::fixed << std::setprecision(precision) << average << " seconds" << std::endl;
+        stream << "Time per operation: " << std::fixed << std::setprecision(precision) << average / (double)elements << " seconds" << std::endl;
+        stream << "Reallocations:      " << reallocations << std::endl;
+        stream << "Peak bytes:         " << peak_bytes << std::endl;
+        stream << "Final bytes:        " << final_bytes << std::endl;
+        stream << "Unused bytes:       " << final_bytes - used_bytes << std::endl;
+        stream << std::endl;
+    }
+
+    static void WriteAllocations(std::stringstream& stream, const std::string& first_container_type, const std::string& second_container_type,
+        size_t first_allocations, size_t second_allocations)
+    {
+        stream << first_container_type << " heap allocations: " << first_allocations << std::endl;
+        stream << second_container_type << " heap allocations: " << second_allocations << std::endl;
+        stream << std::endl;
+    }
+
+    static void WriteFootprint(std::stringstream& stream, const std::string& first_container_type, const std::string& second_container_type,
+        const std::string& data_type, const size_t elements, size_t first_bytes, size_t second_bytes)
+    {
+        stream << "Memory footprint of " << elements << " " << data_type.c_str() << " elements:" << std::endl;
+        stream << first_container_type << " bytes: " << first_bytes << " (" << std::fixed << std::setprecision(2) << (double)first_bytes / (double)elements << " per element)" << std::endl;
+        stream << second_container_type << " bytes: " << second_bytes << " (" << std::fixed << std::setprecision(2) << (double)second_bytes / (double)elements << " per element)" << std::endl;
+        stream << std::endl;
+    }
 };
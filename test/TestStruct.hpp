@@ -1,6 +1,7 @@
 #pragma once
 
 #include <iostream>
+#include "TypeTraits.hpp"
 
 struct TestStruct
 {
@@ -142,3 +143,9 @@ public:
     float z = 0.0f;
     int* p = nullptr;
 };
+
+/*
+* TestStruct only owns heap memory, so its bytes can be moved without calling the move constructor.
+*/
+template<>
+struct IsTriviallyRelocatable<TestStruct> : std::true_type {};
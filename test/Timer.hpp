@@ -50,6 +50,15 @@ public:
         return duration.count();
     }
 
+    /*
+    * Keeps a result of the measured code, so the compiler can not remove the work that produced it.
+    */
+    template<typename T>
+    static void Consume(T value) noexcept
+    {
+        s_Sink<T> = value;
+    }
+
 public:
     Timer() noexcept { }
 
@@ -57,4 +66,7 @@ public:
 
 private:
     std::chrono::time_point<std::chrono::steady_clock> m_StartTime;
+
+    template<typename T>
+    static inline volatile T s_Sink = T();
 };
@@ -0,0 +1,801 @@
+#include "CompactListTest.hpp"
+#include "CompactList.hpp"
+#include "Vector.hpp"
+#include "../TestStruct.hpp"
+#include "../CountingResource.hpp"
+#include "../Serializer.hpp"
+
+#include <iostream> //For std::cout and std::fixed
+#include <string>
+#include <sstream>  //For std::stringstream
+
+static std::stringstream s_FileBuffer;
+
+bool CompactListTest::RunAllTest()
+{
+    std::stringstream test_results_buffer;
+    bool test_result = true;
+    size_t passed = 16;
+    s_FileBuffer << "CompactList Bug Tests:" << std::endl;
+    s_FileBuffer << "Total test executed: " << passed << std::endl;
+
+    if (!Iterators()) { test_results_buffer << std::endl << "Iterator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Copy()) { test_results_buffer << std::endl << "Copy Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Move()) { test_results_buffer << std::endl << "Move Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Operators()) { test_results_buffer << std::endl << "Operator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PushBack()) { test_results_buffer << std::endl << "PushBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PushFront()) { test_results_buffer << std::endl << "PushFront Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Insert()) { test_results_buffer << std::endl << "Insert Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Emplace()) { test_results_buffer << std::endl << "Emplace Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PopBack()) { test_results_buffer << std::endl << "PopBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PopFront()) { test_results_buffer << std::endl << "PopFront Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Erase()) { test_results_buffer << std::endl << "Erase Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Clear()) { test_results_buffer << std::endl << "Clear Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Swap()) { test_results_buffer << std::endl << "Swap Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Append()) { test_results_buffer << std::endl << "Append Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Shrink()) { test_results_buffer << std::endl << "Shrink Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Allocators()) { test_results_buffer << std::endl << "Allocator Test Failed" << std::endl; test_result = false; --passed; }
+
+    s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
+    if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
+    else { s_FileBuffer << test_results_buffer.str(); }
+    s_FileBuffer << std::endl << std::endl;
+    Serializer::SerializeResults("CompactList_Results.txt", s_FileBuffer);
+
+    return test_result;
+}
+
+bool CompactListTest::Iterators()
+{
+    //begin()
+    //end()
+    //rbegin()
+    //rend()
+    //operator+=(size_t)
+    //operator-=(size_t)
+
+    {
+        CompactList<size_t> list;
+        if (list.begin() != list.end() || list.rbegin() != list.rend()) { return false; }
+
+        for (size_t i = 0; i < 10; ++i)
+        {
+            list.PushBack(i);
+        }
+
+        size_t i = 0;
+        for (auto it = list.begin(); it != list.end(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+        if (i != 10) { return false; }
+
+        for (auto it = list.rbegin(); it != list.rend(); ++it)
+        {
+            if (*it != --i) { return false; }
+        }
+        if (i != 0) { return false; }
+
+        for (auto it = --list.end(); it != list.begin(); --it)
+        {
+            if (*it != 9 - i++) { return false; }
+        }
+
+        for (size_t distance = 0; distance <= 10; ++distance)
+        {
+            auto it = list.begin() + distance;
+            if (distance == 10) { if (it != list.end()) { return false; } }
+            else if (*it != distance) { return false; }
+
+            if (it - distance != list.begin()) { return false; }
+            if (list.end() - (10 - distance) != it) { return false; }
+        }
+        if (list.begin()[7] != 7) { return false; }
+
+        const CompactList<size_t>& const_list = list;
+        i = 0;
+        for (auto it = const_list.cbegin(); it != const_list.cend(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+    }
+    {
+        //Iterators keep their position when the pool is reallocated
+        CompactList<size_t> list{ 0, 1, 2 };
+        auto it = list.begin() + 1;
+        const size_t capacity = list.Capacity();
+        for (size_t i = 3; i < 100; ++i)
+        {
+            list.PushBack(i);
+        }
+
+        if (list.Capacity() == capacity || *it != 1 || *(it + 50) != 51) { return false; }
+    }
+    {
+        CompactList<std::string> list{ "0", "1", "2", "3", "4" };
+
+        size_t i = 0;
+        for (auto& element : list)
+        {
+            if (element != std::to_string(i++)) { return false; }
+        }
+        if (i != 5) { return false; }
+        if ((list.begin() + 3)->size() != 1) { return false; }
+    }
+    {
+        CompactList<TestStruct> list{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+
+        size_t i = 0;
+        for (auto& element : list)
+        {
+            if (element != TestStruct((float)i++)) { return false; }
+        }
+        if (i != 3) { return false; }
+    }
+
+    return true;
+}
+
+bool CompactListTest::Copy()
+{
+    //CompactList(const CompactList& other)
+    //operator=(const CompactList& other)
+
+    {
+        CompactList<size_t> list0{ 0, 1, 2, 3, 4, 5 };
+        CompactList<size_t> list1(list0);
+
+        if (list1 != list0) { return false; }
+
+        CompactList<size_t> list2{ 7, 8 };
+        list1 = list2;
+
+        if (list1 != list2) { return false; }
+        if (list0.Size() != 6 || list0[5] != 5) { return false; }
+    }
+    {
+        CompactList<std::string> list0{ "0", "1", "2", "3", "4" };
+        CompactList<std::string> list1(list0);
+
+        if (list1 != list0) { return false; }
+
+        list0.Front() = "a";
+        if (list1.Front() != "0") { return false; }
+    }
+    {
+        CompactList<TestStruct> list0{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f), TestStruct(3.0f), TestStruct(4.0f) };
+        CompactList<TestStruct> list1;
+        list1 = list0;
+
+        if (list1 != list0) { return false; }
+    }
+
+    return true;
+}
+
+bool CompactListTest::Move()
+{
+    //CompactList(CompactList&& other)
+    //operator=(CompactList&& other)
+
+    {
+        CompactList<size_t> list0{ 0, 1, 2, 3, 4, 5 };
+        CompactList<size_t> list1(std::move(list0));
+
+        if (!list0.IsEmpty() || list0.begin() != list0.end()) { return false; }
+        if (list1.Size() != 6 || list1.Back() != 5) { return false; }
+
+        list0 = std::move(list1);
+        if (!list1.IsEmpty() || list0.Size() != 6) { return false; }
+
+        //Moved from containers remain usable
+        list1.PushBack(10);
+        if (list1.Size() != 1 || list1.Front() != 10) { return false; }
+    }
+    {
+        CompactList<std::string> list0{ "0", "1", "2", "3", "4" };
+        CompactList<std::string> list1{ "a" };
+        list1 = std::move(list0);
+
+        if (!list0.IsEmpty() || list1.Size() != 5) { return false; }
+        size_t i = 0;
+        for (auto& element : list1)
+        {
+            if (element != std::to_string(i++)) { return false; }
+        }
+    }
+    {
+        CompactList<TestStruct> list0{ TestStruct(0.0f), TestStruct(1.0f) };
+        CompactList<TestStruct> list1(std::move(list0));
+
+        if (list1.Size() != 2 || list1.Back() != TestStruct(1.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool CompactListTest::Operators()
+{
+    //operator==
+    //operator!=
+    //operator[]
+    //At()
+    //Front()
+    //Back()
+
+    {
+        CompactList<size_t> list0{ 0, 1, 2, 3, 4, 5, 6 };
+        CompactList<size_t> list1{ 0, 1, 2, 3, 4, 5, 6 };
+
+        if (list0 != list1) { return false; }
+        list1[3] = 10;
+        if (list0 == list1) { return false; }
+
+        for (size_t i = 0; i < list0.Size(); ++i)
+        {
+            if (list0[i] != i || list0.At(i) != i) { return false; }
+        }
+        if (list0.Front() != 0 || list0.Back() != 6) { return false; }
+
+        try
+        {
+            (void)list0.At(7);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        const CompactList<std::string> list{ "0", "1", "2" };
+        if (list[1] != "1" || list.At(2) != "2") { return false; }
+        if (list.Front() != "0" || list.Back() != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool CompactListTest::PushBack()
+{
+    //PushBack(const T& element)
+    //PushBack(T&& element)
+
+    {
+        CompactList<size_t> list;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            list.PushBack(i);
+        }
+
+        if (list.Size() != 100 || list.Capacity() < 100) { return false; }
+        for (size_t i = 0; i < 100; ++i)
+        {
+            if (list[i] != i) { return false; }
+        }
+    }
+    {
+        CompactList<std::string> list;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            std::string element = std::to_string(i);
+            if (i % 2) { list.PushBack(element); }
+            else { list.PushBack(std::move(element)); }
+        }
+
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (list[i] != std::to_string(i)) { return false; }
+        }
+    }
+    {
+        //The element given may live in the pool that is reallocated
+        CompactList<std::string> list{ "long enough to not fit in the small string buffer" };
+        for (size_t i = 0; i < 20; ++i)
+        {
+            list.PushBack(list.Front());
+        }
+
+        for (auto& element : list)
+        {
+            if (element != list.Front()) { return false; }
+        }
+    }
+    {
+        CompactList<TestStruct> list;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            list.PushBack(TestStruct((float)i));
+        }
+
+        if (list.Back() != TestStruct(9.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool CompactListTest::PushFront()
+{
+    //PushFront(const T& element)
+    //PushFront(T&& element)
+
+    {
+        CompactList<size_t> list;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            list.PushFront(i);
+        }
+
+        if (list.Size() != 100) { return false; }
+        for (size_t i = 0; i < 100; ++i)
+        {
+            if (list[i] != 99 - i) { return false; }
+        }
+    }
+    {
+        CompactList<std::string> list{ "x" };
+        for (size_t i = 0; i < 10; ++i)
+        {
+            list.PushFront(std::to_string(i));
+        }
+
+        if (list.Size() != 11 || list.Front() != "9" || list.Back() != "x") { return false; }
+    }
+    {
+        CompactList<TestStruct> list;
+        TestStruct element(1.0f);
+        list.PushFront(element);
+        list.PushFront(TestStruct(0.0f));
+
+        if (list.Front() != TestStruct(0.0f) || list.Back() != element) { return false; }
+    }
+
+    return true;
+}
+
+bool CompactListTest::Insert()
+{
+    //Insert(iterator it, const T& element)
+    //Insert(iterator it, T&& element)
+    //Insert(size_t index, const T& element)
+    //Insert(size_t index, T&& element)
+
+    {
+        CompactList<size_t> list;
+        Vector<size_t> reference;
+        for (size_t i = 0; i < 50; ++i)
+        {
+            const size_t index = (i * 7) % (list.Size() + 1);
+            list.Insert(index, i);
+            reference.Insert(index, i);
+        }
+
+        if (list.Size() != reference.Size()) { return false; }
+        for (size_t i = 0; i < reference.Size(); ++i)
+        {
+            if (list[i] != reference[i]) { return false; }
+        }
+
+        auto it = list.Insert(list.end(), (size_t)100);
+        if (*it != 100 || list.Back() != 100) { return false; }
+
+        //An index out of range inserts at the end, like List
+        it = list.Insert(list.Size() + 1, (size_t)101);
+        if (*it != 101 || list.Back() != 101) { return false; }
+    }
+    {
+        CompactList<std::string> list{ "0", "2" };
+        const std::string element = "1";
+        auto it = list.Insert(list.begin() + 1, element);
+        list.Insert(0, std::string("-1"));
+
+        if (*it != "1" || list.Size() != 4) { return false; }
+        if (list[0] != "-1" || list[1] != "0" || list[2] != "1" || list[3] != "2") { return false; }
+    }
+    {
+        CompactList<TestStruct> list{ TestStruct(0.0f), TestStruct(2.0f) };
+        list.Insert(1, TestStruct(1.0f));
+
+        if (list[1] != TestStruct(1.0f) || list.Back() != TestStruct(2.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool CompactListTest::Emplace()
+{
+    //EmplaceBack(Args&&... args)
+    //EmplaceFront(Args&&... args)
+    //Emplace(size_t index, Args&&... args)
+    //Emplace(iterator it, Args&&... args)
+    //EmplaceAt(iterator it, Args&&... args)
+
+    {
+        CompactList<size_t> list;
+        list.EmplaceBack(1);
+        list.EmplaceFront(0);
+        list.Emplace(2, 3);
+        list.EmplaceAt(list.end() - 1, 2);
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            if (list[i] != i) { return false; }
+        }
+    }
+    {
+        CompactList<std::string> list;
+        std::string& element = list.EmplaceBack(3, 'a');
+        list.EmplaceFront("b");
+
+        if (element != "aaa" || list.Front() != "b" || list.Back() != "aaa") { return false; }
+    }
+    {
+        CompactList<TestStruct> list;
+        list.EmplaceBack(1.0f, 2.0f, 3.0f);
+        TestStruct& element = list.Emplace(0, 0.0f);
+
+        if (element != TestStruct(0.0f) || list.Back() != TestStruct(1.0f, 2.0f, 3.0f)) { return false; }
+        if (list.Emplace(list.end(), 4.0f) != TestStruct(4.0f) || list.Emplace(10, 5.0f) != TestStruct(5.0f)) { return false; }
+        if (list.Size() != 4 || list.Back() != TestStruct(5.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool CompactListTest::PopBack()
+{
+    //PopBack()
+
+    {
+        CompactList<size_t> list{ 0, 1, 2, 3, 4 };
+        list.PopBack();
+        list.PopBack();
+
+        if (list.Size() != 3 || list.Back() != 2) { return false; }
+
+        //The free nodes are reused before the pool grows
+        const size_t capacity = list.Capacity();
+        list.PushBack(3);
+        list.PushBack(4);
+        if (list.Capacity() != capacity || list.Back() != 4) { return false; }
+    }
+    {
+        CompactList<std::string> list{ "0", "1" };
+        list.PopBack();
+        list.PopBack();
+
+        if (!list.IsEmpty() || list.begin() != list.end()) { return false; }
+    }
+    {
+        CompactList<TestStruct> list{ TestStruct(0.0f), TestStruct(1.0f) };
+        list.PopBack();
+
+        if (list.Size() != 1 || list.Back() != TestStruct(0.0f)) { return false; }
+    }
+    {
+        //Popping an empty container does nothing and keeps the free nodes usable
+        CompactList<std::string> list;
+        list.PopBack();
+        if (!list.IsEmpty()) { return false; }
+
+        list.PushBack("0");
+        list.PopBack();
+        list.PopBack();
+        list.PushBack("1");
+        list.PushBack("2");
+        if (list.Size() != 2 || list.Front() != "1" || list.Back() != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool CompactListTest::PopFront()
+{
+    //PopFront()
+
+    {
+        CompactList<size_t> list{ 0, 1, 2, 3, 4 };
+        list.PopFront();
+        list.PopFront();
+
+        if (list.Size() != 3 || list.Front() != 2) { return false; }
+
+        list.PushFront(1);
+        if (list.Front() != 1 || list.Back() != 4) { return false; }
+    }
+    {
+        CompactList<std::string> list{ "0", "1" };
+        list.PopFront();
+
+        if (list.Size() != 1 || list.Front() != "1") { return false; }
+    }
+    {
+        CompactList<TestStruct> list{ TestStruct(0.0f), TestStruct(1.0f) };
+        list.PopFront();
+
+        if (list.Size() != 1 || list.Front() != TestStruct(1.0f)) { return false; }
+    }
+    {
+        //Popping an empty container does nothing and keeps the free nodes usable
+        CompactList<TestStruct> list;
+        list.PopFront();
+        if (!list.IsEmpty()) { return false; }
+
+        list.PushFront(TestStruct(0.0f));
+        list.PopFront();
+        list.PopFront();
+        list.PushFront(TestStruct(2.0f));
+        list.PushFront(TestStruct(1.0f));
+        if (list.Size() != 2 || list.Front() != TestStruct(1.0f) || list.Back() != TestStruct(2.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool CompactListTest::Erase()
+{
+    //Erase(size_t index)
+    //Erase(iterator it)
+
+    {
+        CompactList<size_t> list;
+        for (size_t i = 0; i < 20; ++i)
+        {
+            list.PushBack(i);
+        }
+
+        for (auto it = list.begin(); it != list.end();)
+        {
+            if (*it % 2) { it = list.Erase(it); }
+            else { ++it; }
+        }
+
+        if (list.Size() != 10) { return false; }
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (list[i] != i * 2) { return false; }
+        }
+
+        auto it = list.Erase(9);
+        if (it != list.end() || list.Back() != 16) { return false; }
+
+        //An index out of range erases the last element, like List
+        it = list.Erase(9);
+        if (it != list.end() || list.Size() != 8 || list.Back() != 14) { return false; }
+
+        list.Clear();
+        if (list.Erase(0) != list.end() || !list.IsEmpty()) { return false; }
+    }
+    {
+        CompactList<std::string> list{ "0", "1", "2" };
+        auto it = list.Erase(list.begin());
+
+        if (*it != "1" || list.Size() != 2) { return false; }
+    }
+    {
+        CompactList<TestStruct> list{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+        list.Erase(1);
+
+        if (list.Size() != 2 || list[1] != TestStruct(2.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool CompactListTest::Clear()
+{
+    //Clear()
+
+    {
+        CompactList<size_t> list{ 0, 1, 2, 3 };
+        const size_t capacity = list.Capacity();
+        list.Clear();
+
+        if (!list.IsEmpty() || list.begin() != list.end()) { return false; }
+        if (list.Capacity() != capacity) { return false; }
+
+        list.PushBack(5);
+        if (list.Size() != 1 || list.Front() != 5) { return false; }
+    }
+    {
+        CompactList<std::string> list{ "0", "1" };
+        list.Clear();
+        list.Clear();
+
+        if (!list.IsEmpty()) { return false; }
+    }
+    {
+        CompactList<TestStruct> list{ TestStruct(0.0f) };
+        list.Clear();
+
+        if (!list.IsEmpty()) { return false; }
+    }
+
+    return true;
+}
+
+bool CompactListTest::Swap()
+{
+    //Swap(CompactList& other)
+
+    {
+        CompactList<size_t> list0{ 0, 1, 2 };
+        CompactList<size_t> list1{ 3, 4 };
+        list0.Swap(list1);
+
+        if (list0.Size() != 2 || list0.Front() != 3) { return false; }
+        if (list1.Size() != 3 || list1.Back() != 2) { return false; }
+    }
+    {
+        CompactList<std::string> list0{ "0" };
+        CompactList<std::string> list1;
+        list0.Swap(list1);
+
+        if (!list0.IsEmpty() || list1.Front() != "0") { return false; }
+    }
+    {
+        CompactList<TestStruct> list0{ TestStruct(0.0f) };
+        CompactList<TestStruct> list1{ TestStruct(1.0f) };
+        list0.Swap(list1);
+
+        if (list0.Front() != TestStruct(1.0f) || list1.Front() != TestStruct(0.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool CompactListTest::Append()
+{
+    //Append(const CompactList& other)
+    //Append(CompactList&& other)
+
+    {
+        CompactList<size_t> list0{ 0, 1, 2, 3, 4 };
+        CompactList<size_t> list1{ 5, 6, 7, 8, 9 };
+        list0.Append(list1);
+
+        if (list0.Size() != 10 || list1.Size() != 5) { return false; }
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (list0[i] != i) { return false; }
+        }
+
+        CompactList<size_t> list3;
+        list3.Append(std::move(list0));
+        if (list3.Size() != 10 || !list0.IsEmpty() || list3.Back() != 9) { return false; }
+    }
+    {
+        CompactList<std::string> list0{ "0" };
+        CompactList<std::string> list1{ "1", "2" };
+        list0.Append(std::move(list1));
+
+        if (list0.Size() != 3 || list0[2] != "2" || !list1.IsEmpty()) { return false; }
+    }
+    {
+        CompactList<TestStruct> list0{ TestStruct(0.0f) };
+        CompactList<TestStruct> list1{ TestStruct(1.0f) };
+        list0.Append(list1);
+
+        if (list0.Size() != 2 || list0.Back() != TestStruct(1.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool CompactListTest::Shrink()
+{
+    //Shrink()
+    //Reserve()
+
+    {
+        CompactList<size_t> list;
+        list.Reserve(100);
+        if (list.Capacity() != 100) { return false; }
+
+        for (size_t i = 0; i < 16; ++i)
+        {
+            list.PushFront(15 - i);
+        }
+        for (size_t i = 0; i < 8; ++i)
+        {
+            list.Insert(list.begin() + i * 3 + 1, 100);
+        }
+        for (auto it = list.begin(); it != list.end();)
+        {
+            if (*it == 100) { it = list.Erase(it); }
+            else { ++it; }
+        }
+
+        list.Shrink();
+        if (list.Size() != 16 || list.Capacity() != 16) { return false; }
+        for (size_t i = 0; i < 16; ++i)
+        {
+            if (list[i] != i) { return false; }
+        }
+
+        //The nodes are placed in the order of the list
+        if (&list[1] - &list[0] != &list[15] - &list[14]) { return false; }
+
+        list.PushBack(16);
+        if (list.Back() != 16 || list.Size() != 17) { return false; }
+
+        list.Clear();
+        list.Shrink();
+        if (list.Capacity() != 0 || list.begin() != list.end()) { return false; }
+    }
+    {
+        CompactList<std::string> list;
+        for (size_t i = 0; i < 6; ++i)
+        {
+            list.PushFront(std::to_string(5 - i));
+            list.Insert(list.begin() + 1, "x");
+        }
+        for (auto it = list.begin(); it != list.end();)
+        {
+            if (*it == "x") { it = list.Erase(it); }
+            else { ++it; }
+        }
+
+        list.Shrink();
+        if (list.Capacity() != 6) { return false; }
+        for (size_t i = 0; i < 6; ++i)
+        {
+            if (list[i] != std::to_string(i)) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool CompactListTest::Allocators()
+{
+    //CompactList(const Allocator& allocator)
+    //GetAllocator()
+
+    if (!IsMoveAssignmentNoexceptOnlyWithEqualAllocators<CompactList<size_t>, PmrCompactList<size_t>>()) { return false; }
+
+    {
+        CountingResource resource;
+        {
+            PmrCompactList<size_t> list(&resource);
+            for (size_t i = 0; i < 7; ++i)
+            {
+                list.PushBack(i);
+            }
+
+            //A single pool for all the nodes
+            if (resource.Allocations() != 1) { return false; }
+
+            PmrCompactList<size_t> moved(std::move(list));
+            if (moved.GetAllocator().resource() != &resource) { return false; }
+            if (moved.Size() != 7 || resource.Allocations() != 1) { return false; }
+
+            moved.PushBack(7);
+            if (resource.Allocations() != 2 || resource.Deallocations() != 1) { return false; }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+    }
+    {
+        CountingResource resource0;
+        CountingResource resource1;
+        {
+            PmrCompactList<std::string> list0(&resource0);
+            PmrCompactList<std::string> list1(&resource1);
+            for (size_t i = 0; i < 5; ++i)
+            {
+                list0.PushBack(std::to_string(i));
+            }
+
+            //The pool can not be taken from other resource, the elements are moved
+            list1 = std::move(list0);
+
+            if (!list0.IsEmpty() || list1.Size() != 5) { return false; }
+            if (resource1.BytesInUse() == 0) { return false; }
+
+            list0.Append(std::move(list1));
+            if (list0.Size() != 5 || !list1.IsEmpty()) { return false; }
+        }
+
+        if (resource0.BytesInUse() != 0 || resource1.BytesInUse() != 0) { return false; }
+    }
+
+    return true;
+}
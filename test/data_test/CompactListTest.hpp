@@ -0,0 +1,25 @@
+#pragma once
+
+class CompactListTest
+{
+public:
+    static bool RunAllTest();
+
+public:
+    static bool Iterators();
+    static bool Copy();
+    static bool Move();
+    static bool Operators();
+    static bool PushBack();
+    static bool PushFront();
+    static bool Insert();
+    static bool Emplace();
+    static bool PopBack();
+    static bool PopFront();
+    static bool Erase();
+    static bool Clear();
+    static bool Swap();
+    static bool Append();
+    static bool Shrink();
+    static bool Allocators();
+};
@@ -0,0 +1,386 @@
+#include "ConcurrentListTest.hpp"
+#include "ConcurrentList.hpp"
+#include "EpochReclamation.hpp"
+#include "Vector.hpp"
+#include "../TestStruct.hpp"
+#include "../Serializer.hpp"
+
+#include <iostream> //For std::cout and std::fixed
+#include <string>
+#include <sstream>  //For std::stringstream
+#include <thread>  //For std::thread
+#include <atomic>  //For std::atomic
+#include <functional>  //For std::greater
+
+static std::stringstream s_FileBuffer;
+
+struct TestStructCompare
+{
+    bool operator()(const TestStruct& a, const TestStruct& b) const { return a.x < b.x; }
+};
+
+/*
+* Copies the elements of the list in order.
+*/
+template<typename T, typename Compare>
+static Vector<T> Elements(const ConcurrentList<T, Compare>& list)
+{
+    Vector<T> elements;
+    list.ForEach([&elements](const T& element) { elements.PushBack(element); });
+    return elements;
+}
+
+bool ConcurrentListTest::RunAllTest()
+{
+    std::stringstream test_results_buffer;
+    bool test_result = true;
+    size_t passed = 9;
+    s_FileBuffer << "ConcurrentList Bug Tests:" << std::endl;
+    s_FileBuffer << "Total test executed: " << passed << std::endl;
+
+    if (!Insert()) { test_results_buffer << std::endl << "Insert Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Emplace()) { test_results_buffer << std::endl << "Emplace Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Erase()) { test_results_buffer << std::endl << "Erase Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Contains()) { test_results_buffer << std::endl << "Contains Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Clear()) { test_results_buffer << std::endl << "Clear Test Failed" << std::endl; test_result = false; --passed; }
+    if (!ForEach()) { test_results_buffer << std::endl << "ForEach Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Reclamation()) { test_results_buffer << std::endl << "Reclamation Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Threads()) { test_results_buffer << std::endl << "Threads Test Failed" << std::endl; test_result = false; --passed; }
+    if (!ThreadsSameElements()) { test_results_buffer << std::endl << "Threads Same Elements Test Failed" << std::endl; test_result = false; --passed; }
+
+    s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
+    if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
+    else { s_FileBuffer << test_results_buffer.str(); }
+    s_FileBuffer << std::endl << std::endl;
+    Serializer::SerializeResults("ConcurrentList_Results.txt", s_FileBuffer);
+
+    return test_result;
+}
+
+bool ConcurrentListTest::Insert()
+{
+    //Insert(const T& value)
+    //Insert(T&& value)
+
+    {
+        ConcurrentList<size_t> list;
+        if (!list.IsEmpty() || list.Size() != 0) { return false; }
+
+        //The elements are kept sorted whatever the order of insertion
+        const size_t values[] = { 5, 1, 9, 3, 7, 0, 8, 2, 6, 4 };
+        for (size_t value : values)
+        {
+            if (!list.Insert(value)) { return false; }
+        }
+        if (list.Insert((size_t)3) || list.Size() != 10) { return false; }
+        if (Elements(list) != Vector<size_t>{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }) { return false; }
+    }
+    {
+        ConcurrentList<std::string> list{ "b", "a" };
+        std::string value("c");
+        if (!list.Insert(std::move(value)) || !value.empty()) { return false; }
+
+        //An element that is already in the list is not moved
+        std::string repeated("a");
+        if (list.Insert(std::move(repeated)) || repeated != "a") { return false; }
+        if (Elements(list) != Vector<std::string>{ "a", "b", "c" }) { return false; }
+    }
+    {
+        ConcurrentList<size_t, std::greater<size_t>> list{ 1, 3, 2 };
+        if (Elements(list) != Vector<size_t>{ 3, 2, 1 }) { return false; }
+    }
+
+    return true;
+}
+
+bool ConcurrentListTest::Emplace()
+{
+    //Emplace(Args&&... args)
+
+    {
+        ConcurrentList<TestStruct, TestStructCompare> list;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (!list.Emplace((float)(9 - i))) { return false; }
+        }
+        if (list.Emplace(5.0f) || list.Size() != 10) { return false; }
+
+        Vector<TestStruct> elements = Elements(list);
+        for (size_t i = 0; i < elements.Size(); ++i)
+        {
+            if (elements[i] != TestStruct((float)i)) { return false; }
+        }
+    }
+    {
+        ConcurrentList<std::string> list;
+        if (!list.Emplace(3, 'a') || list.Emplace("aaa") || !list.Contains("aaa")) { return false; }
+    }
+
+    return true;
+}
+
+bool ConcurrentListTest::Erase()
+{
+    //Erase(const T& value)
+
+    {
+        ConcurrentList<size_t> list{ 0, 1, 2, 3, 4, 5 };
+        if (!list.Erase(0) || !list.Erase(3) || !list.Erase(5)) { return false; }
+        if (list.Erase(3) || list.Erase(10)) { return false; }
+        if (list.Size() != 3 || Elements(list) != Vector<size_t>{ 1, 2, 4 }) { return false; }
+
+        //Erased elements can be inserted again
+        if (!list.Insert(3) || Elements(list) != Vector<size_t>{ 1, 2, 3, 4 }) { return false; }
+
+        list.Erase(1);
+        list.Erase(2);
+        list.Erase(3);
+        list.Erase(4);
+        if (!list.IsEmpty() || !Elements(list).IsEmpty()) { return false; }
+    }
+    {
+        ConcurrentList<std::string> list{ "0", "1", "2" };
+        if (!list.Erase("1") || Elements(list) != Vector<std::string>{ "0", "2" }) { return false; }
+    }
+
+    return true;
+}
+
+bool ConcurrentListTest::Contains()
+{
+    //Contains(const T& value)
+
+    {
+        ConcurrentList<size_t> list;
+        for (size_t i = 0; i < 100; i += 2)
+        {
+            list.Insert(i);
+        }
+        for (size_t i = 0; i < 100; ++i)
+        {
+            if (list.Contains(i) != (i % 2 == 0)) { return false; }
+        }
+
+        list.Erase(50);
+        if (list.Contains(50) || !list.Contains(52)) { return false; }
+    }
+    {
+        ConcurrentList<TestStruct, TestStructCompare> list;
+        list.Emplace(1.0f);
+        if (!list.Contains(TestStruct(1.0f)) || list.Contains(TestStruct(2.0f))) { return false; }
+    }
+
+    return true;
+}
+
+bool ConcurrentListTest::Clear()
+{
+    //Clear()
+
+    {
+        ConcurrentList<std::string> list{ "0", "1", "2", "3" };
+        list.Clear();
+        if (!list.IsEmpty() || !Elements(list).IsEmpty() || list.Contains("0")) { return false; }
+
+        list.Clear();
+        if (!list.Insert("4") || Elements(list) != Vector<std::string>{ "4" }) { return false; }
+    }
+
+    return true;
+}
+
+bool ConcurrentListTest::ForEach()
+{
+    //ForEach(Function function)
+
+    {
+        ConcurrentList<size_t> list;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            list.Insert(999 - i);
+        }
+
+        size_t sum = 0;
+        size_t expected = 0;
+        bool sorted = true;
+        list.ForEach([&](const size_t& element)
+        {
+            if (element != expected++) { sorted = false; }
+            sum += element;
+        });
+        if (!sorted || sum != 999 * 1000 / 2) { return false; }
+    }
+
+    return true;
+}
+
+bool ConcurrentListTest::Reclamation()
+{
+    //EpochReclamation::Guard
+    //EpochReclamation::Retire(void* object, void (*deleter)(void*))
+    //EpochReclamation::Collect()
+
+    {
+        static std::atomic<size_t> s_Freed;
+        s_Freed = 0;
+        auto deleter = [](void* object) { delete static_cast<size_t*>(object); ++s_Freed; };
+
+        EpochReclamation::Collect();
+        EpochReclamation::Collect();
+        EpochReclamation::Collect();
+        if (EpochReclamation::PendingObjects() != 0) { return false; }
+
+        //A thread inside a critical section keeps the retired objects alive
+        std::atomic<bool> entered(false);
+        std::atomic<bool> release(false);
+        std::thread reader([&]()
+        {
+            EpochReclamation::Guard guard;
+            entered = true;
+            while (!release) { std::this_thread::yield(); }
+        });
+        while (!entered) { std::this_thread::yield(); }
+
+        {
+            EpochReclamation::Guard guard;
+            if (!EpochReclamation::IsInCriticalSection()) { return false; }
+            EpochReclamation::Retire(new size_t(0), deleter);
+        }
+        if (EpochReclamation::IsInCriticalSection()) { return false; }
+
+        for (size_t i = 0; i < 10; ++i)
+        {
+            EpochReclamation::Collect();
+        }
+        if (s_Freed != 0 || EpochReclamation::PendingObjects() != 1) { return false; }
+
+        release = true;
+        reader.join();
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            EpochReclamation::Collect();
+        }
+        if (s_Freed != 1 || EpochReclamation::PendingObjects() != 0) { return false; }
+    }
+    {
+        //Erased nodes are freed once they can not be reached
+        ConcurrentList<std::string> list;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            list.Insert(std::to_string(i));
+        }
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            list.Erase(std::to_string(i));
+        }
+        for (size_t i = 0; i < 3; ++i)
+        {
+            EpochReclamation::Collect();
+        }
+        if (EpochReclamation::PendingObjects() != 0 || !list.IsEmpty()) { return false; }
+    }
+
+    return true;
+}
+
+bool ConcurrentListTest::Threads()
+{
+    //Each thread inserts and erases its own elements while the others do the same
+
+    {
+        constexpr size_t threads = 4;
+        constexpr size_t elements = 2000;
+        ConcurrentList<size_t> list;
+        bool results[threads] = {};
+
+        Vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers.EmplaceBack([&list, &results, t]()
+            {
+                for (size_t i = 0; i < elements; ++i)
+                {
+                    if (!list.Insert(i * threads + t)) { return; }
+                }
+                for (size_t i = 0; i < elements; ++i)
+                {
+                    if (!list.Contains(i * threads + t)) { return; }
+                }
+
+                //The odd elements of the thread are erased
+                for (size_t i = 1; i < elements; i += 2)
+                {
+                    if (!list.Erase(i * threads + t)) { return; }
+                }
+                results[t] = true;
+            });
+        }
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers[t].join();
+        }
+        for (size_t t = 0; t < threads; ++t)
+        {
+            if (!results[t]) { return false; }
+        }
+
+        if (list.Size() != threads * elements / 2) { return false; }
+
+        size_t expected = 0;
+        bool valid = true;
+        list.ForEach([&](const size_t& element)
+        {
+            if (element != expected) { valid = false; }
+            ++expected;
+            if ((expected / threads) % 2 == 1) { expected += threads; }
+        });
+        if (!valid) { return false; }
+    }
+
+    return true;
+}
+
+bool ConcurrentListTest::ThreadsSameElements()
+{
+    //Every thread inserts and erases the same elements, each insertion and erase succeeds in only one thread
+
+    {
+        constexpr size_t threads = 4;
+        constexpr size_t elements = 500;
+        constexpr size_t rounds = 20;
+        ConcurrentList<size_t> list;
+        std::atomic<size_t> inserted(0);
+        std::atomic<size_t> erased(0);
+
+        Vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers.EmplaceBack([&list, &inserted, &erased, t]()
+            {
+                for (size_t round = 0; round < rounds; ++round)
+                {
+                    for (size_t i = 0; i < elements; ++i)
+                    {
+                        const size_t value = (i * 7 + t) % elements;
+                        if (list.Insert(value)) { ++inserted; }
+                        if (list.Erase((value + round) % elements)) { ++erased; }
+                    }
+                }
+            });
+        }
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers[t].join();
+        }
+
+        const Vector<size_t> remaining = Elements(list);
+        if (inserted - erased != list.Size() || remaining.Size() != list.Size()) { return false; }
+        for (size_t i = 1; i < remaining.Size(); ++i)
+        {
+            if (remaining[i - 1] >= remaining[i]) { return false; }
+        }
+    }
+
+    return true;
+}
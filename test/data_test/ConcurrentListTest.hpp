@@ -0,0 +1,18 @@
+#pragma once
+
+class ConcurrentListTest
+{
+public:
+    static bool RunAllTest();
+
+public:
+    static bool Insert();
+    static bool Emplace();
+    static bool Erase();
+    static bool Contains();
+    static bool Clear();
+    static bool ForEach();
+    static bool Reclamation();
+    static bool Threads();
+    static bool ThreadsSameElements();
+};
@@ -0,0 +1,854 @@
+#include "DequeTest.hpp"
+#include "Deque.hpp"
+#include "Vector.hpp"
+#include "../TestStruct.hpp"
+#include "../CountingResource.hpp"
+#include "../Serializer.hpp"
+
+#include <iostream> //For std::cout and std::fixed
+#include <string>
+#include <sstream>  //For std::stringstream
+
+static std::stringstream s_FileBuffer;
+
+bool DequeTest::RunAllTest()
+{
+    std::stringstream test_results_buffer;
+    bool test_result = true;
+    size_t passed = 17;
+    s_FileBuffer << "Deque Bug Tests:" << std::endl;
+    s_FileBuffer << "Total test executed: " << passed << std::endl;
+
+    if (!Iterators()) { test_results_buffer << std::endl << "Iterator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Copy()) { test_results_buffer << std::endl << "Copy Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Move()) { test_results_buffer << std::endl << "Move Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Operators()) { test_results_buffer << std::endl << "Operator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PushBack()) { test_results_buffer << std::endl << "PushBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PushFront()) { test_results_buffer << std::endl << "PushFront Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Insert()) { test_results_buffer << std::endl << "Insert Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Emplace()) { test_results_buffer << std::endl << "Emplace Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PopBack()) { test_results_buffer << std::endl << "PopBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PopFront()) { test_results_buffer << std::endl << "PopFront Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Erase()) { test_results_buffer << std::endl << "Erase Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Clear()) { test_results_buffer << std::endl << "Clear Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Swap()) { test_results_buffer << std::endl << "Swap Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Append()) { test_results_buffer << std::endl << "Append Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Reserve()) { test_results_buffer << std::endl << "Reserve Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Wrap()) { test_results_buffer << std::endl << "Wrap Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Allocators()) { test_results_buffer << std::endl << "Allocator Test Failed" << std::endl; test_result = false; --passed; }
+
+    s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
+    if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
+    else { s_FileBuffer << test_results_buffer.str(); }
+    s_FileBuffer << std::endl << std::endl;
+    Serializer::SerializeResults("Deque_Results.txt", s_FileBuffer);
+
+    return test_result;
+}
+
+bool DequeTest::Iterators()
+{
+    //begin()
+    //end()
+    //rbegin()
+    //rend()
+    //operator+=(size_t)
+    //operator-=(size_t)
+
+    {
+        Deque<size_t, 4> deque;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            deque.PushBack(i);
+        }
+
+        size_t i = 0;
+        for (auto it = deque.begin(); it != deque.end(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+        if (i != 10) { return false; }
+
+        for (auto it = deque.rbegin(); it != deque.rend(); ++it)
+        {
+            if (*it != --i) { return false; }
+        }
+        if (i != 0) { return false; }
+
+        for (auto it = --deque.end(); it != deque.begin(); --it)
+        {
+            if (*it != 9 - i++) { return false; }
+        }
+
+        //Jumps across whole blocks in both directions
+        for (size_t distance = 0; distance <= 10; ++distance)
+        {
+            auto it = deque.begin() + distance;
+            if (distance == 10) { if (it != deque.end()) { return false; } }
+            else if (*it != distance) { return false; }
+
+            if (it - distance != deque.begin()) { return false; }
+            if (deque.end() - (10 - distance) != it) { return false; }
+            if (it.Distance(deque.begin()) != distance) { return false; }
+        }
+        if (deque.begin()[7] != 7 || deque.begin().At(3) != 3) { return false; }
+        if (!(deque.begin() < deque.end()) || deque.begin() >= deque.end()) { return false; }
+
+        const Deque<size_t, 4>& const_deque = deque;
+        i = 0;
+        for (auto it = const_deque.cbegin(); it != const_deque.cend(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+
+        try
+        {
+            Deque<size_t, 4>::iterator it;
+            it.Advance(1);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        Deque<std::string, 2> deque{ "0", "1", "2", "3", "4" };
+
+        size_t i = 0;
+        for (auto& element : deque)
+        {
+            if (element != std::to_string(i++)) { return false; }
+        }
+        if (i != 5) { return false; }
+        if ((deque.begin() + 3)->size() != 1) { return false; }
+    }
+    {
+        Deque<TestStruct, 2> deque{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+
+        size_t i = 0;
+        for (auto& element : deque)
+        {
+            if (element != TestStruct((float)i++)) { return false; }
+        }
+        if (i != 3) { return false; }
+    }
+
+    return true;
+}
+
+bool DequeTest::Copy()
+{
+    //Deque(const Deque& other)
+    //operator=(const Deque& other)
+
+    {
+        Deque<size_t, 4> deque0{ 0, 1, 2, 3, 4, 5 };
+        Deque<size_t, 4> deque1(deque0);
+
+        if (deque1 != deque0) { return false; }
+
+        Deque<size_t, 4> deque2{ 7, 8 };
+        deque1 = deque2;
+
+        if (deque1 != deque2) { return false; }
+        if (deque0.Size() != 6 || deque0[5] != 5) { return false; }
+    }
+    {
+        Deque<std::string, 4> deque0{ "0", "1", "2", "3", "4" };
+        Deque<std::string, 4> deque1(deque0);
+
+        if (deque1 != deque0) { return false; }
+
+        deque0.Front() = "a";
+        if (deque1.Front() != "0") { return false; }
+    }
+    {
+        Deque<TestStruct, 4> deque0{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f), TestStruct(3.0f), TestStruct(4.0f) };
+        Deque<TestStruct, 4> deque1;
+        deque1 = deque0;
+
+        if (deque1 != deque0) { return false; }
+    }
+
+    return true;
+}
+
+bool DequeTest::Move()
+{
+    //Deque(Deque&& other)
+    //operator=(Deque&& other)
+
+    {
+        Deque<size_t, 4> deque0{ 0, 1, 2, 3, 4, 5 };
+        Deque<size_t, 4> deque1(std::move(deque0));
+
+        if (!deque0.IsEmpty() || deque0.begin() != deque0.end()) { return false; }
+        if (deque1.Size() != 6 || deque1.Back() != 5) { return false; }
+
+        deque0 = std::move(deque1);
+        if (!deque1.IsEmpty() || deque0.Size() != 6) { return false; }
+
+        //Moved from containers remain usable
+        deque1.PushBack(10);
+        if (deque1.Size() != 1 || deque1.Front() != 10) { return false; }
+    }
+    {
+        Deque<std::string, 4> deque0{ "0", "1", "2", "3", "4" };
+        Deque<std::string, 4> deque1{ "a" };
+        deque1 = std::move(deque0);
+
+        if (!deque0.IsEmpty() || deque1.Size() != 5) { return false; }
+        size_t i = 0;
+        for (auto& element : deque1)
+        {
+            if (element != std::to_string(i++)) { return false; }
+        }
+    }
+    {
+        Deque<TestStruct, 4> deque0{ TestStruct(0.0f), TestStruct(1.0f) };
+        Deque<TestStruct, 4> deque1(std::move(deque0));
+
+        if (deque1.Size() != 2 || deque1.Back() != TestStruct(1.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool DequeTest::Operators()
+{
+    //operator==
+    //operator!=
+    //operator[]
+    //At()
+    //Front()
+    //Back()
+
+    {
+        Deque<size_t, 4> deque0{ 0, 1, 2, 3, 4, 5, 6 };
+        Deque<size_t, 4> deque1{ 0, 1, 2, 3, 4, 5, 6 };
+
+        if (deque0 != deque1) { return false; }
+        deque1[3] = 10;
+        if (deque0 == deque1) { return false; }
+
+        for (size_t i = 0; i < deque0.Size(); ++i)
+        {
+            if (deque0[i] != i || deque0.At(i) != i) { return false; }
+        }
+        if (deque0.Front() != 0 || deque0.Back() != 6) { return false; }
+
+        try
+        {
+            (void)deque0.At(7);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        const Deque<std::string, 2> deque{ "0", "1", "2" };
+        if (deque[1] != "1" || deque.At(2) != "2") { return false; }
+        if (deque.Front() != "0" || deque.Back() != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool DequeTest::PushBack()
+{
+    //PushBack(const T& element)
+    //PushBack(T&& element)
+
+    {
+        Deque<size_t, 4> deque;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            deque.PushBack(i);
+        }
+
+        //Sequential insertions fill the blocks completely
+        if (deque.Size() != 100 || deque.Blocks() != 25 || deque.Capacity() != 100) { return false; }
+        for (size_t i = 0; i < 100; ++i)
+        {
+            if (deque[i] != i) { return false; }
+        }
+    }
+    {
+        //The references stay valid while the map grows
+        Deque<size_t, 4> deque{ 0 };
+        const size_t* first = &deque.Front();
+        for (size_t i = 1; i < 1000; ++i)
+        {
+            deque.PushBack(i);
+        }
+        if (first != &deque.Front() || *first != 0) { return false; }
+    }
+    {
+        Deque<std::string, 4> deque;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            std::string element = std::to_string(i);
+            if (i % 2) { deque.PushBack(element); }
+            else { deque.PushBack(std::move(element)); }
+        }
+
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (deque[i] != std::to_string(i)) { return false; }
+        }
+    }
+    {
+        Deque<TestStruct> deque;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            deque.PushBack(TestStruct((float)i));
+        }
+
+        if (deque.Back() != TestStruct(9.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool DequeTest::PushFront()
+{
+    //PushFront(const T& element)
+    //PushFront(T&& element)
+
+    {
+        Deque<size_t, 4> deque;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            deque.PushFront(i);
+        }
+
+        if (deque.Size() != 100 || deque.Blocks() != 25) { return false; }
+        for (size_t i = 0; i < 100; ++i)
+        {
+            if (deque[i] != 99 - i) { return false; }
+        }
+    }
+    {
+        Deque<std::string, 4> deque{ "x" };
+        for (size_t i = 0; i < 10; ++i)
+        {
+            deque.PushFront(std::to_string(i));
+        }
+
+        if (deque.Size() != 11 || deque.Front() != "9" || deque.Back() != "x") { return false; }
+    }
+    {
+        Deque<TestStruct, 4> deque;
+        TestStruct element(1.0f);
+        deque.PushFront(element);
+        deque.PushFront(TestStruct(0.0f));
+
+        if (deque.Front() != TestStruct(0.0f) || deque.Back() != element) { return false; }
+    }
+
+    return true;
+}
+
+bool DequeTest::Insert()
+{
+    //Insert(iterator it, const T& element)
+    //Insert(iterator it, T&& element)
+    //Insert(size_t index, const T& element)
+    //Insert(size_t index, T&& element)
+
+    {
+        Deque<size_t, 4> deque{ 0, 1, 2, 3 };
+
+        auto it = deque.Insert(deque.begin() + 2, 10);
+        if (*it != 10) { return false; }
+
+        size_t expected[] = { 0, 1, 10, 2, 3 };
+        for (size_t i = 0; i < 5; ++i)
+        {
+            if (deque[i] != expected[i]) { return false; }
+        }
+
+        deque.Insert(deque.end(), 20);
+        deque.Insert((size_t)0, 30);
+        if (deque.Front() != 30 || deque.Back() != 20 || deque.Size() != 7) { return false; }
+
+        try
+        {
+            deque.Insert(8, 40);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        //Random insertions keep the order of a reference Vector
+        Deque<size_t, 8> deque;
+        Vector<size_t> reference;
+        for (size_t i = 0; i < 500; ++i)
+        {
+            size_t index = (i * 7919) % (i + 1);
+            deque.Insert(deque.begin() + index, i);
+            reference.Insert(index, i);
+        }
+
+        if (deque.Size() != reference.Size()) { return false; }
+        size_t i = 0;
+        for (auto it = deque.begin(); it != deque.end(); ++it, ++i)
+        {
+            if (*it != reference[i]) { return false; }
+        }
+    }
+    {
+        Deque<std::string, 2> deque{ "0", "2" };
+        std::string element("1");
+        deque.Insert(1, element);
+        deque.Insert(deque.end(), std::string("3"));
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            if (deque[i] != std::to_string(i)) { return false; }
+        }
+    }
+    {
+        Deque<TestStruct, 2> deque{ TestStruct(0.0f), TestStruct(2.0f) };
+        deque.Insert(deque.begin() + 1, TestStruct(1.0f));
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            if (deque[i] != TestStruct((float)i)) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool DequeTest::Emplace()
+{
+    //EmplaceBack(Args&&... args)
+    //EmplaceFront(Args&&... args)
+    //Emplace(size_t index, Args&&... args)
+    //EmplaceAt(iterator it, Args&&... args)
+
+    {
+        Deque<std::string, 4> deque;
+        deque.EmplaceBack(3, 'b');
+        deque.EmplaceFront(3, 'a');
+        deque.Emplace(1, 3, 'c');
+        deque.EmplaceAt(deque.end(), 3, 'd');
+
+        if (deque[0] != "aaa" || deque[1] != "ccc" || deque[2] != "bbb" || deque[3] != "ddd") { return false; }
+    }
+    {
+        Deque<TestStruct, 4> deque;
+        TestStruct& element = deque.EmplaceBack(1.0f, 2.0f, 3.0f);
+
+        if (element != TestStruct(1.0f, 2.0f, 3.0f) || deque.Size() != 1) { return false; }
+    }
+
+    return true;
+}
+
+bool DequeTest::PopBack()
+{
+    //PopBack()
+
+    {
+        Deque<size_t, 4> deque{ 0, 1, 2, 3, 4 };
+        deque.PopBack();
+        if (deque.Size() != 4 || deque.Back() != 3) { return false; }
+
+        while (!deque.IsEmpty())
+        {
+            deque.PopBack();
+        }
+        //The blocks are kept for the next insertions
+        if (deque.begin() != deque.end() || deque.Blocks() != 2) { return false; }
+        deque.PopBack();
+    }
+    {
+        Deque<std::string, 2> deque{ "0", "1", "2" };
+        deque.PopBack();
+        if (deque.Size() != 2 || deque.Back() != "1") { return false; }
+    }
+
+    return true;
+}
+
+bool DequeTest::PopFront()
+{
+    //PopFront()
+
+    {
+        Deque<size_t, 4> deque{ 0, 1, 2, 3, 4, 5, 6, 7 };
+        for (size_t i = 0; i < 8; ++i)
+        {
+            if (deque.Front() != i) { return false; }
+            deque.PopFront();
+        }
+        if (!deque.IsEmpty()) { return false; }
+    }
+    {
+        Deque<TestStruct, 2> deque{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+        deque.PopFront();
+        if (deque.Size() != 2 || deque.Front() != TestStruct(1.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool DequeTest::Erase()
+{
+    //Erase(iterator it)
+    //Erase(size_t index)
+
+    {
+        Deque<size_t, 4> deque;
+        for (size_t i = 0; i < 16; ++i)
+        {
+            deque.PushBack(i);
+        }
+
+        for (auto it = deque.begin(); it != deque.end();)
+        {
+            if (*it % 4) { it = deque.Erase(it); }
+            else { ++it; }
+        }
+
+        if (deque.Size() != 4) { return false; }
+        for (size_t i = 0; i < 4; ++i)
+        {
+            if (deque[i] != i * 4) { return false; }
+        }
+
+        auto it = deque.Erase(3);
+        if (it != deque.end() || deque.Back() != 8) { return false; }
+
+        try
+        {
+            deque.Erase(3);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        Deque<std::string, 4> deque{ "0", "1", "2", "3", "4", "5" };
+        auto it = deque.Erase(deque.begin() + 2);
+        if (*it != "3" || deque.Size() != 5) { return false; }
+
+        it = deque.Erase(deque.begin());
+        if (*it != "1" || deque.Front() != "1") { return false; }
+    }
+    {
+        Deque<TestStruct, 2> deque{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+        deque.Erase(1);
+        if (deque.Size() != 2 || deque[1] != TestStruct(2.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool DequeTest::Clear()
+{
+    //Clear()
+
+    {
+        Deque<size_t, 4> deque{ 0, 1, 2, 3, 4 };
+        deque.Clear();
+
+        if (!deque.IsEmpty() || deque.begin() != deque.end() || deque.Capacity() != 8) { return false; }
+
+        deque.PushBack(1);
+        if (deque.Size() != 1 || deque.Blocks() != 2) { return false; }
+    }
+    {
+        Deque<std::string, 2> deque{ "0", "1", "2" };
+        deque.Clear();
+        if (!deque.IsEmpty()) { return false; }
+    }
+
+    return true;
+}
+
+bool DequeTest::Swap()
+{
+    //Swap(Deque& other)
+
+    {
+        Deque<size_t, 4> deque0{ 0, 1, 2, 3, 4 };
+        Deque<size_t, 4> deque1{ 5 };
+        deque0.Swap(deque1);
+
+        if (deque0.Size() != 1 || deque0.Front() != 5) { return false; }
+        if (deque1.Size() != 5 || deque1.Back() != 4) { return false; }
+
+        Deque<size_t, 4> deque2;
+        deque2.Swap(deque1);
+        if (!deque1.IsEmpty() || deque1.begin() != deque1.end() || deque2.Size() != 5) { return false; }
+
+        size_t i = 0;
+        for (auto it = deque2.begin(); it != deque2.end(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+    }
+    {
+        Deque<std::string, 2> deque0{ "0", "1", "2" };
+        Deque<std::string, 2> deque1{ "a" };
+        deque0.Swap(deque1);
+
+        if (deque0.Size() != 1 || deque1.Size() != 3 || deque1.Back() != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool DequeTest::Append()
+{
+    //Append(const Deque& other)
+    //Append(Deque&& other)
+
+    {
+        Deque<size_t, 4> deque0{ 0, 1, 2 };
+        Deque<size_t, 4> deque1{ 3, 4, 5, 6, 7 };
+
+        deque0.Append(deque1);
+        if (deque0.Size() != 8 || deque1.Size() != 5) { return false; }
+
+        Deque<size_t, 4> deque2{ 8, 9 };
+        deque0.Append(std::move(deque2));
+        if (deque0.Size() != 10 || !deque2.IsEmpty()) { return false; }
+
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (deque0[i] != i) { return false; }
+        }
+
+        Deque<size_t, 4> deque3;
+        deque3.Append(std::move(deque0));
+        if (deque3.Size() != 10 || !deque0.IsEmpty() || deque3.Back() != 9) { return false; }
+
+        //Appending a deque to itself doubles it
+        deque3.Append(deque3);
+        if (deque3.Size() != 20 || deque3[10] != 0 || deque3.Back() != 9) { return false; }
+    }
+    {
+        Deque<std::string, 2> deque0{ "0" };
+        Deque<std::string, 2> deque1{ "1", "2" };
+        deque0.Append(std::move(deque1));
+
+        if (deque0.Size() != 3 || deque0[2] != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool DequeTest::Reserve()
+{
+    //Reserve(size_t capacity)
+    //Shrink()
+
+    {
+        Deque<size_t, 4> deque;
+        deque.Reserve(100);
+        if (deque.Capacity() != 100 || !deque.IsEmpty()) { return false; }
+
+        const size_t* first = nullptr;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            deque.PushBack(i);
+            if (i == 0) { first = &deque.Front(); }
+        }
+        if (deque.Blocks() != 25 || first != &deque.Front()) { return false; }
+
+        for (size_t i = 0; i < 90; ++i)
+        {
+            deque.PopBack();
+        }
+        deque.Shrink();
+        if (deque.Size() != 10 || deque.Blocks() != 3) { return false; }
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (deque[i] != i) { return false; }
+        }
+
+        deque.Clear();
+        deque.Shrink();
+        if (deque.Blocks() != 0 || deque.Capacity() != 0) { return false; }
+
+        deque.PushFront(1);
+        if (deque.Size() != 1 || deque.Front() != 1) { return false; }
+    }
+    {
+        Deque<std::string, 4> deque(10);
+        if (deque.Capacity() < 10) { return false; }
+
+        try
+        {
+            deque.Reserve(100000000);
+            return false;
+        }
+        catch (...) {}
+    }
+
+    return true;
+}
+
+bool DequeTest::Wrap()
+{
+    //The elements start anywhere in the ring of blocks and wrap around its end
+
+    {
+        //A deque used as a queue reuses its blocks
+        Deque<size_t, 4> deque;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            deque.PushBack(i);
+        }
+        size_t blocks = 0;
+        for (size_t i = 10; i < 1000; ++i)
+        {
+            deque.PushBack(i);
+            deque.PopFront();
+            if (deque.Front() != i - 9) { return false; }
+
+            //After the first turn around the ring no block is allocated
+            if (i == 100) { blocks = deque.Blocks(); }
+        }
+        if (deque.Size() != 10 || deque.Blocks() != blocks || blocks > 8) { return false; }
+    }
+    {
+        //Mixed operations at both ends and in the middle, the map grows while the elements wrap
+        Deque<std::string, 2> deque;
+        Vector<std::string> reference;
+        size_t seed = 1;
+        for (size_t i = 0; i < 3000; ++i)
+        {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            const size_t operation = (seed >> 33) % 10;
+            const std::string element = std::to_string(i);
+
+            if (operation < 3)
+            {
+                deque.PushFront(element);
+                reference.Insert((size_t)0, element);
+            }
+            else if (operation < 6)
+            {
+                deque.PushBack(element);
+                reference.PushBack(element);
+            }
+            else if (operation == 6 && !reference.IsEmpty())
+            {
+                deque.PopFront();
+                reference.Erase((size_t)0);
+            }
+            else if (operation == 7 && !reference.IsEmpty())
+            {
+                deque.PopBack();
+                reference.PopBack();
+            }
+            else if (operation == 8)
+            {
+                const size_t index = (seed >> 17) % (reference.Size() + 1);
+                deque.Insert(index, element);
+                reference.Insert(index, element);
+            }
+            else if (!reference.IsEmpty())
+            {
+                const size_t index = (seed >> 17) % reference.Size();
+                deque.Erase(index);
+                reference.Erase(index);
+            }
+
+            if (deque.Size() != reference.Size()) { return false; }
+        }
+
+        size_t i = 0;
+        for (auto it = deque.begin(); it != deque.end(); ++it, ++i)
+        {
+            if (*it != reference[i]) { return false; }
+        }
+        for (auto it = deque.rbegin(); it != deque.rend(); ++it)
+        {
+            if (*it != reference[--i]) { return false; }
+        }
+    }
+    {
+        //The element pushed is an end of the deque while the map grows and relocates the wrapped elements
+        Deque<std::string, 2> deque{ "a", "b" };
+        Vector<std::string> reference{ "a", "b" };
+        for (size_t i = 0; i < 200; ++i)
+        {
+            if (i % 2 == 0)
+            {
+                deque.PushFront(deque.Back());
+                reference.Insert((size_t)0, std::string(reference.Back()));
+            }
+            else
+            {
+                deque.PushBack(deque.Front());
+                reference.PushBack(std::string(reference.Front()));
+            }
+            deque.Back() += std::to_string(i);
+            reference.Back() += std::to_string(i);
+        }
+
+        size_t i = 0;
+        for (auto it = deque.begin(); it != deque.end(); ++it, ++i)
+        {
+            if (*it != reference[i]) { return false; }
+        }
+        if (i != reference.Size()) { return false; }
+    }
+
+    return true;
+}
+
+bool DequeTest::Allocators()
+{
+    //Deque(const Allocator& allocator)
+    //GetAllocator()
+
+    if (!IsMoveAssignmentNoexceptOnlyWithEqualAllocators<Deque<size_t>, PmrDeque<size_t>>()) { return false; }
+
+    {
+        CountingResource resource;
+        {
+            PmrDeque<size_t, 4> deque(&resource);
+            for (size_t i = 0; i < 8; ++i)
+            {
+                deque.PushBack(i);
+            }
+
+            //One allocation for the map and one per block
+            if (resource.Allocations() != 3) { return false; }
+
+            PmrDeque<size_t, 4> moved(std::move(deque));
+            if (moved.GetAllocator().resource() != &resource) { return false; }
+            if (moved.Size() != 8 || resource.Allocations() != 3) { return false; }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+    }
+    {
+        CountingResource resource0;
+        CountingResource resource1;
+        {
+            PmrDeque<std::string, 2> deque0(&resource0);
+            PmrDeque<std::string, 2> deque1(&resource1);
+            for (size_t i = 0; i < 5; ++i)
+            {
+                deque0.PushBack(std::to_string(i));
+            }
+
+            //The blocks can not be taken from other resource, the elements are moved
+            deque1 = std::move(deque0);
+
+            if (!deque0.IsEmpty() || deque1.Size() != 5) { return false; }
+            if (resource1.BytesInUse() == 0) { return false; }
+
+            deque0.Append(std::move(deque1));
+            if (deque0.Size() != 5 || !deque1.IsEmpty()) { return false; }
+        }
+
+        if (resource0.BytesInUse() != 0 || resource1.BytesInUse() != 0) { return false; }
+    }
+
+    return true;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+class DequeTest
+{
+public:
+    static bool RunAllTest();
+
+public:
+    static bool Iterators();
+    static bool Copy();
+    static bool Move();
+    static bool Operators();
+    static bool PushBack();
+    static bool PushFront();
+    static bool Insert();
+    static bool Emplace();
+    static bool PopBack();
+    static bool PopFront();
+    static bool Erase();
+    static bool Clear();
+    static bool Swap();
+    static bool Append();
+    static bool Reserve();
+    static bool Wrap();
+    static bool Allocators();
+};
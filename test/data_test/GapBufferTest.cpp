@@ -0,0 +1,611 @@
+#include "GapBufferTest.hpp"
+#include "GapBuffer.hpp"
+#include "Vector.hpp"
+#include "../TestStruct.hpp"
+#include "../CountingResource.hpp"
+#include "../Serializer.hpp"
+
+#include <iostream> //For std::cout and std::fixed
+#include <string>
+#include <sstream>  //For std::stringstream
+#include <random>  //For std::mt19937
+#include <iterator>  //For std::istream_iterator
+
+static std::stringstream s_FileBuffer;
+
+bool GapBufferTest::RunAllTest()
+{
+    std::stringstream test_results_buffer;
+    bool test_result = true;
+    size_t passed = 13;
+    s_FileBuffer << "GapBuffer Bug Tests:" << std::endl;
+    s_FileBuffer << "Total test executed: " << passed << std::endl;
+
+    if (!Copy()) { test_results_buffer << std::endl << "Copy Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Move()) { test_results_buffer << std::endl << "Move Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Operators()) { test_results_buffer << std::endl << "Operator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Cursor()) { test_results_buffer << std::endl << "Cursor Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Insert()) { test_results_buffer << std::endl << "Insert Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Emplace()) { test_results_buffer << std::endl << "Emplace Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Erase()) { test_results_buffer << std::endl << "Erase Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Spans()) { test_results_buffer << std::endl << "Spans Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Clear()) { test_results_buffer << std::endl << "Clear Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Swap()) { test_results_buffer << std::endl << "Swap Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Reserve()) { test_results_buffer << std::endl << "Reserve Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Trace()) { test_results_buffer << std::endl << "Trace Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Allocators()) { test_results_buffer << std::endl << "Allocator Test Failed" << std::endl; test_result = false; --passed; }
+
+    s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
+    if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
+    else { s_FileBuffer << test_results_buffer.str(); }
+    s_FileBuffer << std::endl << std::endl;
+    Serializer::SerializeResults("GapBuffer_Results.txt", s_FileBuffer);
+
+    return test_result;
+}
+
+bool GapBufferTest::Copy()
+{
+    //GapBuffer(const GapBuffer& other)
+    //operator=(const GapBuffer& other)
+
+    {
+        GapBuffer<size_t> buffer0{ 0, 1, 2, 3, 4, 5 };
+        buffer0.MoveCursor(2);
+        GapBuffer<size_t> buffer1(buffer0);
+
+        //The copy keeps the cursor
+        if (buffer1 != buffer0 || buffer1.Cursor() != 2) { return false; }
+
+        GapBuffer<size_t> buffer2{ 7, 8 };
+        buffer1 = buffer2;
+
+        if (buffer1 != buffer2 || buffer1.Cursor() != 2) { return false; }
+        if (buffer0.Size() != 6 || buffer0[5] != 5) { return false; }
+    }
+    {
+        GapBuffer<std::string> buffer0{ "0", "1", "2", "3", "4" };
+        buffer0.MoveCursor(1);
+        GapBuffer<std::string> buffer1(buffer0);
+
+        if (buffer1 != buffer0) { return false; }
+
+        buffer0.Front() = "a";
+        if (buffer1.Front() != "0") { return false; }
+    }
+    {
+        GapBuffer<TestStruct> buffer0{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f), TestStruct(3.0f) };
+        buffer0.MoveCursor(3);
+        GapBuffer<TestStruct> buffer1;
+        buffer1 = buffer0;
+
+        if (buffer1 != buffer0 || buffer1.Cursor() != 3) { return false; }
+    }
+
+    return true;
+}
+
+bool GapBufferTest::Move()
+{
+    //GapBuffer(GapBuffer&& other)
+    //operator=(GapBuffer&& other)
+
+    {
+        GapBuffer<size_t> buffer0{ 0, 1, 2, 3, 4, 5 };
+        buffer0.MoveCursor(4);
+        GapBuffer<size_t> buffer1(std::move(buffer0));
+
+        if (!buffer0.IsEmpty() || buffer0.Capacity() != 0) { return false; }
+        if (buffer1.Size() != 6 || buffer1.Cursor() != 4 || buffer1[4] != 4) { return false; }
+
+        buffer0 = std::move(buffer1);
+        if (!buffer1.IsEmpty() || buffer0.Size() != 6 || buffer0.Cursor() != 4) { return false; }
+    }
+    {
+        GapBuffer<std::string> buffer0{ "0", "1", "2" };
+        GapBuffer<std::string> buffer1{ "3" };
+        buffer1 = std::move(buffer0);
+
+        if (!buffer0.IsEmpty() || buffer1.Size() != 3 || buffer1[2] != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool GapBufferTest::Operators()
+{
+    //operator==(const GapBuffer& other)
+    //operator!=(const GapBuffer& other)
+    //operator[](size_t index)
+    //operator=(std::initializer_list<T>&& list)
+
+    {
+        GapBuffer<size_t> buffer0{ 0, 1, 2, 3 };
+        GapBuffer<size_t> buffer1{ 0, 1, 2, 3 };
+
+        //The position of the cursor is not compared
+        buffer1.MoveCursor(1);
+        if (buffer0 != buffer1) { return false; }
+
+        buffer1[3] = 7;
+        if (buffer0 == buffer1) { return false; }
+
+        buffer1 = { 0, 1, 2 };
+        if (buffer0 == buffer1 || buffer1.Size() != 3 || buffer1.Cursor() != 3) { return false; }
+
+        for (size_t i = 0; i < buffer1.Size(); ++i)
+        {
+            if (buffer1[i] != i) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool GapBufferTest::Cursor()
+{
+    //MoveCursor(size_t position)
+    //Cursor()
+    //GapSize()
+
+    {
+        GapBuffer<size_t> buffer{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        buffer.Reserve(16);
+
+        const size_t gap = buffer.GapSize();
+        if (buffer.Cursor() != 10 || gap != 6) { return false; }
+
+        for (size_t position : { 0, 10, 5, 7, 3, 3, 9 })
+        {
+            buffer.MoveCursor(position);
+            if (buffer.Cursor() != position || buffer.GapSize() != gap) { return false; }
+
+            for (size_t i = 0; i < buffer.Size(); ++i)
+            {
+                if (buffer[i] != i) { return false; }
+            }
+        }
+
+        try
+        {
+            buffer.MoveCursor(11);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        GapBuffer<std::string> buffer{ "0", "1", "2", "3", "4" };
+        buffer.MoveCursor(0);
+        buffer.MoveCursor(4);
+        buffer.MoveCursor(2);
+
+        for (size_t i = 0; i < buffer.Size(); ++i)
+        {
+            if (buffer[i] != std::to_string(i)) { return false; }
+        }
+    }
+    {
+        GapBuffer<TestStruct> buffer;
+        for (size_t i = 0; i < 50; ++i)
+        {
+            buffer.Insert(TestStruct((float)i));
+        }
+        buffer.MoveCursor(13);
+        buffer.MoveCursor(41);
+        buffer.MoveCursor(0);
+
+        for (size_t i = 0; i < buffer.Size(); ++i)
+        {
+            if (buffer[i] != TestStruct((float)i)) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool GapBufferTest::Insert()
+{
+    //Insert(const T& element)
+    //Insert(T&& element)
+    //Insert(size_t index, const T& element)
+    //Insert(size_t index, T&& element)
+    //InsertRange(InputIterator first, InputIterator last)
+
+    {
+        GapBuffer<size_t> buffer;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            buffer.Insert(i);
+        }
+        if (buffer.Size() != 100 || buffer.Cursor() != 100) { return false; }
+
+        //The cursor moves after the inserted element
+        buffer.MoveCursor(50);
+        buffer.Insert((size_t)1000);
+        buffer.Insert((size_t)1001);
+        if (buffer.Cursor() != 52 || buffer[50] != 1000 || buffer[51] != 1001 || buffer[52] != 50) { return false; }
+
+        buffer.Insert(0, (size_t)2000);
+        if (buffer.Front() != 2000 || buffer.Cursor() != 1 || buffer.Back() != 99) { return false; }
+
+        buffer.Insert(buffer.Size(), (size_t)3000);
+        if (buffer.Back() != 3000 || buffer.Size() != 104) { return false; }
+    }
+    {
+        GapBuffer<std::string> buffer{ "a", "d" };
+        buffer.MoveCursor(1);
+
+        const Vector<std::string> range{ "b", "c" };
+        buffer.InsertRange(range.begin(), range.end());
+
+        if (buffer.Size() != 4 || buffer.Cursor() != 3) { return false; }
+        if (buffer[0] != "a" || buffer[1] != "b" || buffer[2] != "c" || buffer[3] != "d") { return false; }
+
+        //The inserted element belongs to the full buffer
+        GapBuffer<std::string> full{ "x", "y" };
+        full.Shrink();
+        full.MoveCursor(1);
+        full.Insert(full[1]);
+        if (full.Size() != 3 || full[1] != "y" || full[2] != "y") { return false; }
+
+        //The inserted element belongs to the buffer and is moved with the cursor
+        GapBuffer<std::string> aliased{ "a", "b", "c", "d" };
+        aliased.Reserve(8);
+        aliased.MoveCursor(0);
+        aliased.Insert(3, aliased[0]);
+        if (aliased.Size() != 5 || aliased[0] != "a" || aliased[3] != "a" || aliased[4] != "d") { return false; }
+
+        aliased.Insert(1, std::move(aliased[4]));
+        if (aliased.Size() != 6 || aliased[1] != "d" || aliased[2] != "b" || aliased[4] != "a") { return false; }
+    }
+    {
+        //A single pass range is read only once
+        GapBuffer<size_t> buffer{ 0, 4 };
+        buffer.MoveCursor(1);
+        std::istringstream stream("1 2 3");
+
+        buffer.InsertRange(std::istream_iterator<size_t>(stream), std::istream_iterator<size_t>());
+        if (buffer.Size() != 5 || buffer.Cursor() != 4) { return false; }
+        for (size_t i = 0; i < 5; ++i)
+        {
+            if (buffer[i] != i) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool GapBufferTest::Emplace()
+{
+    //Emplace(Args&&... args)
+
+    {
+        GapBuffer<TestStruct> buffer;
+        for (size_t i = 0; i < 20; ++i)
+        {
+            TestStruct& element = buffer.Emplace((float)i);
+            if (element != TestStruct((float)i)) { return false; }
+        }
+
+        buffer.MoveCursor(10);
+        buffer.Emplace(100.0f);
+        if (buffer[10] != TestStruct(100.0f) || buffer[11] != TestStruct(10.0f) || buffer.Size() != 21) { return false; }
+    }
+    {
+        GapBuffer<std::string> buffer;
+        buffer.Emplace(3, 'a');
+        buffer.MoveCursor(0);
+        buffer.Emplace("b");
+
+        if (buffer[0] != "b" || buffer[1] != "aaa") { return false; }
+    }
+
+    return true;
+}
+
+bool GapBufferTest::Erase()
+{
+    //EraseBefore(size_t count)
+    //EraseAfter(size_t count)
+    //Erase(size_t index)
+
+    {
+        GapBuffer<size_t> buffer{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        buffer.MoveCursor(5);
+
+        buffer.EraseBefore();
+        if (buffer.Size() != 9 || buffer.Cursor() != 4 || buffer[4] != 5) { return false; }
+
+        buffer.EraseAfter(2);
+        if (buffer.Size() != 7 || buffer.Cursor() != 4 || buffer[4] != 7) { return false; }
+
+        buffer.EraseBefore(4);
+        if (buffer.Size() != 3 || buffer.Cursor() != 0 || buffer.Front() != 7) { return false; }
+
+        buffer.Erase(2);
+        if (buffer.Size() != 2 || buffer.Cursor() != 2 || buffer.Back() != 8) { return false; }
+
+        try
+        {
+            buffer.EraseAfter();
+            return false;
+        }
+        catch (...) {}
+        try
+        {
+            buffer.EraseBefore(3);
+            return false;
+        }
+        catch (...) {}
+        try
+        {
+            buffer.Erase(2);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        GapBuffer<std::string> buffer{ "0", "1", "2", "3", "4" };
+        buffer.Erase(1);
+        buffer.EraseAfter(2);
+
+        if (buffer.Size() != 2 || buffer[0] != "0" || buffer[1] != "4") { return false; }
+    }
+
+    return true;
+}
+
+bool GapBufferTest::Spans()
+{
+    //BeforeCursor()
+    //AfterCursor()
+    //AppendTo(Vector& vector)
+    //ToVector()
+
+    {
+        GapBuffer<size_t> buffer{ 0, 1, 2, 3, 4, 5, 6 };
+        buffer.MoveCursor(3);
+
+        GapBuffer<size_t>::span before = buffer.BeforeCursor();
+        GapBuffer<size_t>::span after = buffer.AfterCursor();
+        if (before.Size != 3 || after.Size != 4) { return false; }
+        if (before[2] != 2 || after[0] != 3) { return false; }
+
+        //Both spans are contiguous
+        if (&after[3] - &after[0] != 3 || &before[2] - &before[0] != 2) { return false; }
+
+        size_t expected = 0;
+        for (size_t element : before)
+        {
+            if (element != expected++) { return false; }
+        }
+        for (size_t element : after)
+        {
+            if (element != expected++) { return false; }
+        }
+
+        Vector<size_t> vector = buffer.ToVector();
+        if (vector != Vector<size_t>{ 0, 1, 2, 3, 4, 5, 6 }) { return false; }
+
+        buffer.AppendTo(vector);
+        if (vector.Size() != 14 || vector[7] != 0 || vector[13] != 6) { return false; }
+    }
+    {
+        const GapBuffer<std::string> buffer{ "0", "1" };
+        GapBuffer<std::string>::const_span before = buffer.BeforeCursor();
+        if (before.Size != 2 || buffer.AfterCursor().Size != 0) { return false; }
+
+        Vector<std::string> vector = buffer.ToVector();
+        if (vector.Size() != 2 || vector[1] != "1") { return false; }
+    }
+    {
+        GapBuffer<size_t> buffer;
+        if (!buffer.ToVector().IsEmpty()) { return false; }
+    }
+
+    return true;
+}
+
+bool GapBufferTest::Clear()
+{
+    //Clear()
+    //Shrink()
+
+    {
+        GapBuffer<std::string> buffer{ "0", "1", "2", "3" };
+        buffer.MoveCursor(2);
+        const size_t capacity = buffer.Capacity();
+
+        buffer.Clear();
+        if (!buffer.IsEmpty() || buffer.Cursor() != 0 || buffer.Capacity() != capacity) { return false; }
+
+        buffer.Insert("a");
+        if (buffer.Size() != 1 || buffer.Front() != "a") { return false; }
+
+        buffer.Clear();
+        buffer.Shrink();
+        if (buffer.Capacity() != 0) { return false; }
+    }
+    {
+        GapBuffer<size_t> buffer;
+        for (size_t i = 0; i < 20; ++i)
+        {
+            buffer.Insert(i);
+        }
+        buffer.MoveCursor(7);
+        buffer.Shrink();
+
+        if (buffer.Capacity() != 20 || buffer.GapSize() != 0 || buffer.Cursor() != 7) { return false; }
+        for (size_t i = 0; i < buffer.Size(); ++i)
+        {
+            if (buffer[i] != i) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool GapBufferTest::Swap()
+{
+    //Swap(GapBuffer& other)
+
+    {
+        GapBuffer<size_t> buffer0{ 0, 1, 2 };
+        GapBuffer<size_t> buffer1{ 3, 4, 5, 6 };
+        buffer0.MoveCursor(1);
+
+        buffer0.Swap(buffer1);
+
+        if (buffer0.Size() != 4 || buffer0.Cursor() != 4 || buffer0[0] != 3) { return false; }
+        if (buffer1.Size() != 3 || buffer1.Cursor() != 1 || buffer1[2] != 2) { return false; }
+    }
+
+    return true;
+}
+
+bool GapBufferTest::Reserve()
+{
+    //Reserve(size_t capacity)
+
+    {
+        GapBuffer<size_t> buffer{ 0, 1, 2, 3, 4, 5 };
+        buffer.MoveCursor(2);
+        buffer.Reserve(100);
+
+        //The elements after the cursor go to the end of the new block
+        if (buffer.Capacity() != 100 || buffer.GapSize() != 94 || buffer.Cursor() != 2) { return false; }
+        for (size_t i = 0; i < buffer.Size(); ++i)
+        {
+            if (buffer[i] != i) { return false; }
+        }
+
+        buffer.Reserve(10);
+        if (buffer.Capacity() != 100) { return false; }
+
+        try
+        {
+            buffer.Reserve(100000000);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        GapBuffer<std::string> buffer(4);
+        if (buffer.Capacity() != 4 || !buffer.IsEmpty()) { return false; }
+
+        for (size_t i = 0; i < 5; ++i)
+        {
+            buffer.Insert(0, std::to_string(i));
+        }
+        if (buffer.Capacity() != 8 || buffer[0] != "4" || buffer[4] != "0") { return false; }
+    }
+
+    return true;
+}
+
+bool GapBufferTest::Trace()
+{
+    //Random edits replayed against a Vector
+
+    {
+        std::mt19937 generator(7);
+        GapBuffer<std::string> buffer;
+        Vector<std::string> reference;
+
+        for (size_t i = 0; i < 3000; ++i)
+        {
+            const size_t operation = generator() % 6;
+            const size_t size = reference.Size();
+
+            if (operation == 0)
+            {
+                buffer.MoveCursor(generator() % (size + 1));
+            }
+            else if (operation <= 2)
+            {
+                const std::string element = std::to_string(i);
+                reference.Insert(buffer.Cursor(), element);
+                buffer.Insert(element);
+            }
+            else if (operation == 3 && buffer.Cursor() > 0)
+            {
+                reference.Erase(buffer.Cursor() - 1);
+                buffer.EraseBefore();
+            }
+            else if (operation == 4 && buffer.Cursor() < size)
+            {
+                reference.Erase(buffer.Cursor());
+                buffer.EraseAfter();
+            }
+            else if (operation == 5 && size > 0)
+            {
+                const size_t index = generator() % size;
+                reference.Erase(index);
+                buffer.Erase(index);
+            }
+
+            if (buffer.Size() != reference.Size()) { return false; }
+        }
+
+        if (buffer.ToVector() != reference) { return false; }
+        for (size_t i = 0; i < reference.Size(); ++i)
+        {
+            if (buffer.At(i) != reference[i]) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool GapBufferTest::Allocators()
+{
+    //GapBuffer(const Allocator& allocator)
+    //GetAllocator()
+
+    if (!IsMoveAssignmentNoexceptOnlyWithEqualAllocators<GapBuffer<size_t>, PmrGapBuffer<size_t>>()) { return false; }
+
+    {
+        CountingResource resource;
+        {
+            PmrGapBuffer<size_t> buffer(&resource);
+            for (size_t i = 0; i < 8; ++i)
+            {
+                buffer.Insert(i);
+            }
+
+            //Moving the cursor does not allocate
+            buffer.MoveCursor(0);
+            buffer.MoveCursor(8);
+            if (resource.Allocations() != 1) { return false; }
+
+            PmrGapBuffer<size_t> moved(std::move(buffer));
+            if (moved.GetAllocator().resource() != &resource) { return false; }
+            if (moved.Size() != 8 || resource.Allocations() != 1) { return false; }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+    }
+    {
+        CountingResource resource0;
+        CountingResource resource1;
+        {
+            PmrGapBuffer<std::string> buffer0(&resource0);
+            PmrGapBuffer<std::string> buffer1(&resource1);
+            for (size_t i = 0; i < 5; ++i)
+            {
+                buffer0.Insert(std::to_string(i));
+            }
+            buffer0.MoveCursor(2);
+
+            //The memory can not be taken from other resource, the elements are moved
+            buffer1 = std::move(buffer0);
+
+            if (!buffer0.IsEmpty() || buffer1.Size() != 5 || buffer1.Cursor() != 2) { return false; }
+            if (resource1.BytesInUse() == 0 || buffer1[4] != "4") { return false; }
+        }
+
+        if (resource0.BytesInUse() != 0 || resource1.BytesInUse() != 0) { return false; }
+    }
+
+    return true;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+class GapBufferTest
+{
+public:
+    static bool RunAllTest();
+
+public:
+    static bool Copy();
+    static bool Move();
+    static bool Operators();
+    static bool Cursor();
+    static bool Insert();
+    static bool Emplace();
+    static bool Erase();
+    static bool Spans();
+    static bool Clear();
+    static bool Swap();
+    static bool Reserve();
+    static bool Trace();
+    static bool Allocators();
+};
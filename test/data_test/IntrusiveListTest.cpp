@@ -0,0 +1,621 @@
+#include "IntrusiveListTest.hpp"
+#include "IntrusiveList.hpp"
+#include "Vector.hpp"
+#include "../TestStruct.hpp"
+#include "../Serializer.hpp"
+
+#include <iostream> //For std::cout and std::fixed
+#include <string>
+#include <sstream>  //For std::stringstream
+
+static std::stringstream s_FileBuffer;
+
+/*
+* Element that can be in two lists at the same time, like a connection that is both in a bucket and in a timeout queue.
+*/
+template<typename T>
+struct IntrusiveElement
+{
+    IntrusiveElement(const T& value = T()) : Value(value) {}
+
+    bool operator==(const IntrusiveElement& other) const { return Value == other.Value; }
+    bool operator!=(const IntrusiveElement& other) const { return Value != other.Value; }
+
+    T Value;
+    IntrusiveListHook Hook;
+    IntrusiveListHook TimerHook;
+};
+
+/*
+* Polymorphic element with its hook in a derived class, the hook is found after the base and the virtual table pointer.
+*/
+struct IntrusiveBase
+{
+    virtual ~IntrusiveBase() = default;
+
+    size_t Value = 0;
+};
+
+struct IntrusiveDerived : IntrusiveBase
+{
+    IntrusiveListHook Hook;
+};
+
+template<typename T>
+using TestIntrusiveList = IntrusiveList<IntrusiveElement<T>, &IntrusiveElement<T>::Hook>;
+
+template<typename T>
+using TimerIntrusiveList = IntrusiveList<IntrusiveElement<T>, &IntrusiveElement<T>::TimerHook>;
+
+/*
+* Checks the values of the list in both directions.
+*/
+template<typename T, typename ListType>
+static bool Equals(const ListType& list, const Vector<T>& values)
+{
+    if (list.Size() != values.Size()) { return false; }
+
+    size_t i = 0;
+    for (auto it = list.cbegin(); it != list.cend(); ++it, ++i)
+    {
+        if (it->Value != values[i]) { return false; }
+    }
+    for (auto it = list.crbegin(); it != list.crend(); ++it)
+    {
+        if (it->Value != values[--i]) { return false; }
+    }
+
+    return true;
+}
+
+bool IntrusiveListTest::RunAllTest()
+{
+    std::stringstream test_results_buffer;
+    bool test_result = true;
+    size_t passed = 13;
+    s_FileBuffer << "IntrusiveList Bug Tests:" << std::endl;
+    s_FileBuffer << "Total test executed: " << passed << std::endl;
+
+    if (!Iterators()) { test_results_buffer << std::endl << "Iterator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Move()) { test_results_buffer << std::endl << "Move Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Operators()) { test_results_buffer << std::endl << "Operator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PushBack()) { test_results_buffer << std::endl << "PushBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PushFront()) { test_results_buffer << std::endl << "PushFront Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Insert()) { test_results_buffer << std::endl << "Insert Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PopBack()) { test_results_buffer << std::endl << "PopBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PopFront()) { test_results_buffer << std::endl << "PopFront Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Erase()) { test_results_buffer << std::endl << "Erase Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Clear()) { test_results_buffer << std::endl << "Clear Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Swap()) { test_results_buffer << std::endl << "Swap Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Splice()) { test_results_buffer << std::endl << "Splice Test Failed" << std::endl; test_result = false; --passed; }
+    if (!MultipleHooks()) { test_results_buffer << std::endl << "Multiple Hooks Test Failed" << std::endl; test_result = false; --passed; }
+
+    s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
+    if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
+    else { s_FileBuffer << test_results_buffer.str(); }
+    s_FileBuffer << std::endl << std::endl;
+    Serializer::SerializeResults("IntrusiveList_Results.txt", s_FileBuffer);
+
+    return test_result;
+}
+
+bool IntrusiveListTest::Iterators()
+{
+    //begin()
+    //end()
+    //rbegin()
+    //rend()
+    //operator+=(size_t)
+    //operator-=(size_t)
+
+    {
+        Vector<IntrusiveElement<size_t>> elements;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            elements.EmplaceBack(i);
+        }
+
+        TestIntrusiveList<size_t> list;
+        if (list.begin() != list.end() || list.rbegin() != list.rend()) { return false; }
+
+        for (size_t i = 0; i < elements.Size(); ++i)
+        {
+            list.PushBack(elements[i]);
+        }
+
+        size_t i = 0;
+        for (auto it = list.begin(); it != list.end(); ++it, ++i)
+        {
+            if (it->Value != i || &*it != &elements[i]) { return false; }
+        }
+        if (i != 10) { return false; }
+
+        for (auto it = list.rbegin(); it != list.rend(); ++it)
+        {
+            if (it->Value != --i) { return false; }
+        }
+        if (i != 0) { return false; }
+
+        for (auto it = --list.end(); it != list.begin(); --it)
+        {
+            if (it->Value != 9 - i++) { return false; }
+        }
+
+        for (size_t distance = 0; distance <= 10; ++distance)
+        {
+            auto it = list.begin() + distance;
+            if (distance == 10) { if (it != list.end()) { return false; } }
+            else if (it->Value != distance) { return false; }
+
+            if (it - distance != list.begin()) { return false; }
+            if (list.end() - (10 - distance) != it) { return false; }
+        }
+        if (list.begin()[7].Value != 7) { return false; }
+        if (list.GetIterator(elements[4]) != list.begin() + 4) { return false; }
+    }
+    {
+        IntrusiveElement<std::string> elements[] = { std::string("0"), std::string("1"), std::string("2") };
+        IntrusiveList<IntrusiveElement<std::string>, &IntrusiveElement<std::string>::Hook> list;
+        for (auto& element : elements)
+        {
+            list.PushBack(element);
+        }
+
+        size_t i = 0;
+        for (auto& element : list)
+        {
+            if (element.Value != std::to_string(i++)) { return false; }
+        }
+        if (i != 3) { return false; }
+    }
+
+    return true;
+}
+
+bool IntrusiveListTest::Move()
+{
+    //IntrusiveList(IntrusiveList&& other)
+    //operator=(IntrusiveList&& other)
+
+    {
+        IntrusiveElement<size_t> elements[] = { 0, 1, 2 };
+        TestIntrusiveList<size_t> list0;
+        for (auto& element : elements)
+        {
+            list0.PushBack(element);
+        }
+
+        //The elements are relinked to the sentinel of the new list
+        TestIntrusiveList<size_t> list1(std::move(list0));
+        if (!list0.IsEmpty() || !Equals(list1, Vector<size_t>{ 0, 1, 2 })) { return false; }
+
+        TestIntrusiveList<size_t> list2;
+        list2 = std::move(list1);
+        if (!list1.IsEmpty() || !Equals(list2, Vector<size_t>{ 0, 1, 2 })) { return false; }
+
+        list1 = std::move(list0);
+        if (!list1.IsEmpty() || list1.begin() != list1.end()) { return false; }
+
+        list2.PopFront();
+        if (!Equals(list2, Vector<size_t>{ 1, 2 })) { return false; }
+    }
+    {
+        IntrusiveElement<TestStruct> elements[] = { TestStruct(0.0f), TestStruct(1.0f) };
+        TestIntrusiveList<TestStruct> list0;
+        TestIntrusiveList<TestStruct> list1;
+        list0.PushBack(elements[0]);
+        list1.PushBack(elements[1]);
+
+        //The elements of the assigned list are unlinked
+        list1 = std::move(list0);
+        if (TestIntrusiveList<TestStruct>::IsLinked(elements[1]) || list1.Size() != 1 || &list1.Front() != &elements[0]) { return false; }
+    }
+
+    return true;
+}
+
+bool IntrusiveListTest::Operators()
+{
+    //operator==(const IntrusiveList& other)
+    //operator!=(const IntrusiveList& other)
+
+    {
+        IntrusiveElement<std::string> elements0[] = { std::string("a"), std::string("b") };
+        IntrusiveElement<std::string> elements1[] = { std::string("a"), std::string("b") };
+        TestIntrusiveList<std::string> list0;
+        TestIntrusiveList<std::string> list1;
+        for (size_t i = 0; i < 2; ++i)
+        {
+            list0.PushBack(elements0[i]);
+            list1.PushBack(elements1[i]);
+        }
+
+        if (list0 != list1) { return false; }
+
+        list1.PopBack();
+        if (list0 == list1) { return false; }
+    }
+
+    return true;
+}
+
+bool IntrusiveListTest::PushBack()
+{
+    //PushBack(T& element)
+
+    {
+        Vector<IntrusiveElement<size_t>> elements;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            elements.EmplaceBack(i);
+        }
+
+        Vector<size_t> values;
+        TestIntrusiveList<size_t> list;
+        for (size_t i = 0; i < elements.Size(); ++i)
+        {
+            list.PushBack(elements[i]);
+            values.PushBack(i);
+            if (&list.Back() != &elements[i] || !TestIntrusiveList<size_t>::IsLinked(elements[i])) { return false; }
+        }
+        if (!Equals(list, values) || &list.Front() != &elements[0]) { return false; }
+    }
+    {
+        IntrusiveElement<TestStruct> elements[] = { TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+        TestIntrusiveList<TestStruct> list;
+        for (auto& element : elements)
+        {
+            list.PushBack(element);
+        }
+        if (!Equals(list, Vector<TestStruct>{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) })) { return false; }
+    }
+
+    return true;
+}
+
+bool IntrusiveListTest::PushFront()
+{
+    //PushFront(T& element)
+
+    {
+        IntrusiveElement<size_t> elements[] = { 0, 1, 2, 3 };
+        TestIntrusiveList<size_t> list;
+        for (auto& element : elements)
+        {
+            list.PushFront(element);
+            if (&list.Front() != &element) { return false; }
+        }
+        if (!Equals(list, Vector<size_t>{ 3, 2, 1, 0 })) { return false; }
+    }
+    {
+        IntrusiveElement<std::string> elements[] = { std::string("0"), std::string("1") };
+        TestIntrusiveList<std::string> list;
+        list.PushFront(elements[0]);
+        list.PushFront(elements[1]);
+        if (!Equals(list, Vector<std::string>{ "1", "0" })) { return false; }
+    }
+
+    return true;
+}
+
+bool IntrusiveListTest::Insert()
+{
+    //Insert(iterator position, T& element)
+
+    {
+        IntrusiveElement<size_t> elements[] = { 0, 1, 2, 3, 4 };
+        TestIntrusiveList<size_t> list;
+        list.PushBack(elements[0]);
+        list.PushBack(elements[4]);
+
+        auto it = list.Insert(list.begin() + 1, elements[2]);
+        if (&*it != &elements[2]) { return false; }
+
+        list.Insert(it, elements[1]);
+        list.Insert(list.end() - 1, elements[3]);
+        if (!Equals(list, Vector<size_t>{ 0, 1, 2, 3, 4 })) { return false; }
+    }
+    {
+        IntrusiveElement<TestStruct> elements[] = { TestStruct(0.0f), TestStruct(1.0f) };
+        TestIntrusiveList<TestStruct> list;
+        list.Insert(list.end(), elements[1]);
+        list.Insert(list.begin(), elements[0]);
+        if (!Equals(list, Vector<TestStruct>{ TestStruct(0.0f), TestStruct(1.0f) })) { return false; }
+    }
+
+    return true;
+}
+
+bool IntrusiveListTest::PopBack()
+{
+    //PopBack()
+
+    {
+        IntrusiveElement<size_t> elements[] = { 0, 1, 2 };
+        TestIntrusiveList<size_t> list;
+        for (auto& element : elements)
+        {
+            list.PushBack(element);
+        }
+
+        list.PopBack();
+        if (!Equals(list, Vector<size_t>{ 0, 1 }) || TestIntrusiveList<size_t>::IsLinked(elements[2])) { return false; }
+
+        list.PopBack();
+        list.PopBack();
+        if (!list.IsEmpty() || list.begin() != list.end()) { return false; }
+
+        //An unlinked element can be linked again
+        list.PushBack(elements[2]);
+        if (!Equals(list, Vector<size_t>{ 2 })) { return false; }
+    }
+    {
+        //Popping an empty container does nothing
+        IntrusiveElement<size_t> element(0);
+        TestIntrusiveList<size_t> list;
+        list.PopBack();
+        if (!list.IsEmpty() || list.begin() != list.end()) { return false; }
+
+        list.PushBack(element);
+        list.PopBack();
+        list.PopBack();
+        list.PushBack(element);
+        if (!Equals(list, Vector<size_t>{ 0 })) { return false; }
+    }
+
+    return true;
+}
+
+bool IntrusiveListTest::PopFront()
+{
+    //PopFront()
+
+    {
+        IntrusiveElement<std::string> elements[] = { std::string("0"), std::string("1"), std::string("2") };
+        TestIntrusiveList<std::string> list;
+        for (auto& element : elements)
+        {
+            list.PushBack(element);
+        }
+
+        list.PopFront();
+        if (!Equals(list, Vector<std::string>{ "1", "2" }) || TestIntrusiveList<std::string>::IsLinked(elements[0])) { return false; }
+
+        list.PopFront();
+        list.PopFront();
+        if (!list.IsEmpty()) { return false; }
+    }
+    {
+        //Popping an empty container does nothing
+        IntrusiveElement<std::string> element(std::string("0"));
+        TestIntrusiveList<std::string> list;
+        list.PopFront();
+        if (!list.IsEmpty() || list.begin() != list.end()) { return false; }
+
+        list.PushFront(element);
+        list.PopFront();
+        list.PopFront();
+        list.PushFront(element);
+        if (!Equals(list, Vector<std::string>{ "0" })) { return false; }
+    }
+
+    return true;
+}
+
+bool IntrusiveListTest::Erase()
+{
+    //Erase(iterator position)
+    //Erase(T& element)
+
+    {
+        Vector<IntrusiveElement<size_t>> elements;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            elements.EmplaceBack(i);
+        }
+
+        TestIntrusiveList<size_t> list;
+        for (size_t i = 0; i < elements.Size(); ++i)
+        {
+            list.PushBack(elements[i]);
+        }
+
+        auto it = list.Erase(list.begin());
+        if (it != list.begin() || it->Value != 1) { return false; }
+
+        //Erase by reference does not need to search the element
+        it = list.Erase(elements[5]);
+        if (it->Value != 6 || TestIntrusiveList<size_t>::IsLinked(elements[5])) { return false; }
+
+        it = list.Erase(elements[9]);
+        if (it != list.end()) { return false; }
+
+        if (!Equals(list, Vector<size_t>{ 1, 2, 3, 4, 6, 7, 8 })) { return false; }
+
+        for (auto it = list.begin(); it != list.end();)
+        {
+            it = list.Erase(it);
+        }
+        if (!list.IsEmpty()) { return false; }
+    }
+    {
+        IntrusiveElement<TestStruct> elements[] = { TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+        TestIntrusiveList<TestStruct> list;
+        for (auto& element : elements)
+        {
+            list.PushBack(element);
+        }
+
+        list.Erase(elements[1]);
+        if (!Equals(list, Vector<TestStruct>{ TestStruct(0.0f), TestStruct(2.0f) })) { return false; }
+    }
+
+    return true;
+}
+
+bool IntrusiveListTest::Clear()
+{
+    //Clear()
+
+    {
+        IntrusiveElement<size_t> elements[] = { 0, 1, 2 };
+        TestIntrusiveList<size_t> list;
+        for (auto& element : elements)
+        {
+            list.PushBack(element);
+        }
+
+        list.Clear();
+        if (!list.IsEmpty() || list.begin() != list.end()) { return false; }
+        for (auto& element : elements)
+        {
+            if (TestIntrusiveList<size_t>::IsLinked(element)) { return false; }
+        }
+
+        list.PushBack(elements[1]);
+        if (!Equals(list, Vector<size_t>{ 1 })) { return false; }
+    }
+    {
+        //The destructor unlinks the elements that outlive the list
+        IntrusiveElement<std::string> element(std::string("0"));
+        {
+            TestIntrusiveList<std::string> list;
+            list.PushBack(element);
+        }
+        if (TestIntrusiveList<std::string>::IsLinked(element)) { return false; }
+    }
+
+    return true;
+}
+
+bool IntrusiveListTest::Swap()
+{
+    //Swap(IntrusiveList& other)
+
+    {
+        IntrusiveElement<size_t> elements[] = { 0, 1, 2, 3, 4 };
+        TestIntrusiveList<size_t> list0;
+        TestIntrusiveList<size_t> list1;
+        list0.PushBack(elements[0]);
+        list0.PushBack(elements[1]);
+        list1.PushBack(elements[2]);
+        list1.PushBack(elements[3]);
+        list1.PushBack(elements[4]);
+
+        list0.Swap(list1);
+        if (!Equals(list0, Vector<size_t>{ 2, 3, 4 }) || !Equals(list1, Vector<size_t>{ 0, 1 })) { return false; }
+
+        TestIntrusiveList<size_t> list2;
+        list2.Swap(list0);
+        if (!list0.IsEmpty() || !Equals(list2, Vector<size_t>{ 2, 3, 4 })) { return false; }
+
+        list2.Swap(list2);
+        if (!Equals(list2, Vector<size_t>{ 2, 3, 4 })) { return false; }
+    }
+
+    return true;
+}
+
+bool IntrusiveListTest::Splice()
+{
+    //Splice(iterator position, IntrusiveList& other)
+    //Splice(iterator position, IntrusiveList& other, iterator it)
+    //Append(IntrusiveList& other)
+
+    {
+        IntrusiveElement<size_t> elements[] = { 0, 1, 2, 3, 4, 5 };
+        TestIntrusiveList<size_t> list0;
+        TestIntrusiveList<size_t> list1;
+        list0.PushBack(elements[0]);
+        list0.PushBack(elements[3]);
+        list1.PushBack(elements[1]);
+        list1.PushBack(elements[2]);
+
+        list0.Splice(list0.begin() + 1, list1);
+        if (!list1.IsEmpty() || !Equals(list0, Vector<size_t>{ 0, 1, 2, 3 })) { return false; }
+
+        list1.PushBack(elements[4]);
+        list1.PushBack(elements[5]);
+        list0.Append(list1);
+        if (!list1.IsEmpty() || !Equals(list0, Vector<size_t>{ 0, 1, 2, 3, 4, 5 })) { return false; }
+
+        list0.Splice(list0.end(), list1);
+        if (!Equals(list0, Vector<size_t>{ 0, 1, 2, 3, 4, 5 })) { return false; }
+    }
+    {
+        //Moving a single element, inside the same list and between lists
+        IntrusiveElement<std::string> elements[] = { std::string("0"), std::string("1"), std::string("2") };
+        TestIntrusiveList<std::string> list0;
+        TestIntrusiveList<std::string> list1;
+        for (auto& element : elements)
+        {
+            list0.PushBack(element);
+        }
+
+        list0.Splice(list0.end(), list0, list0.begin());
+        if (!Equals(list0, Vector<std::string>{ "1", "2", "0" })) { return false; }
+
+        list0.Splice(list0.begin(), list0, list0.begin());
+        if (!Equals(list0, Vector<std::string>{ "1", "2", "0" })) { return false; }
+
+        list1.Splice(list1.end(), list0, list0.GetIterator(elements[2]));
+        if (!Equals(list0, Vector<std::string>{ "1", "0" }) || !Equals(list1, Vector<std::string>{ "2" })) { return false; }
+    }
+
+    return true;
+}
+
+bool IntrusiveListTest::MultipleHooks()
+{
+    //Elements linked in several lists at the same time
+
+    {
+        Vector<IntrusiveElement<size_t>> elements;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            elements.EmplaceBack(i);
+        }
+
+        TestIntrusiveList<size_t> even;
+        TestIntrusiveList<size_t> odd;
+        TimerIntrusiveList<size_t> timers;
+        for (size_t i = 0; i < elements.Size(); ++i)
+        {
+            if (i % 2 == 0) { even.PushBack(elements[i]); }
+            else { odd.PushBack(elements[i]); }
+            timers.PushFront(elements[i]);
+        }
+
+        if (!Equals(even, Vector<size_t>{ 0, 2, 4, 6, 8 }) || !Equals(odd, Vector<size_t>{ 1, 3, 5, 7, 9 })) { return false; }
+        if (!Equals(timers, Vector<size_t>{ 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 })) { return false; }
+
+        //Touching an element moves it to the back of the timers without changing its bucket
+        timers.Erase(elements[4]);
+        timers.PushBack(elements[4]);
+        if (&timers.Back() != &elements[4] || !Equals(even, Vector<size_t>{ 0, 2, 4, 6, 8 })) { return false; }
+
+        //Expiring the oldest timer also removes the element from its bucket
+        IntrusiveElement<size_t>& expired = timers.Front();
+        timers.PopFront();
+        odd.Erase(expired);
+        if (expired.Value != 9 || !Equals(odd, Vector<size_t>{ 1, 3, 5, 7 }) || timers.Size() != 9) { return false; }
+        if (TimerIntrusiveList<size_t>::IsLinked(expired) || TestIntrusiveList<size_t>::IsLinked(expired)) { return false; }
+
+        //Copies of the elements start unlinked
+        IntrusiveElement<size_t> copy(elements[0]);
+        if (TestIntrusiveList<size_t>::IsLinked(copy) || TimerIntrusiveList<size_t>::IsLinked(copy) || copy.Value != 0) { return false; }
+    }
+    {
+        IntrusiveDerived elements[3];
+        IntrusiveList<IntrusiveDerived, &IntrusiveDerived::Hook> list;
+        for (size_t i = 0; i < 3; ++i)
+        {
+            elements[i].Value = i;
+            list.PushFront(elements[i]);
+        }
+
+        if (&list.Front() != &elements[2] || &list.Back() != &elements[0] || list.Front().Value != 2) { return false; }
+    }
+
+    return true;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+class IntrusiveListTest
+{
+public:
+    static bool RunAllTest();
+
+public:
+    static bool Iterators();
+    static bool Move();
+    static bool Operators();
+    static bool PushBack();
+    static bool PushFront();
+    static bool Insert();
+    static bool PopBack();
+    static bool PopFront();
+    static bool Erase();
+    static bool Clear();
+    static bool Swap();
+    static bool Splice();
+    static bool MultipleHooks();
+};
@@ -0,0 +1,449 @@
+#include "LargeVectorTest.hpp"
+#include "LargeVector.hpp"
+#include "../TestStruct.hpp"
+#include "../Serializer.hpp"
+
+#include <iostream> //For std::cout and std::fixed
+#include <string>
+#include <sstream>  //For std::stringstream
+
+static std::stringstream s_FileBuffer;
+
+bool LargeVectorTest::RunAllTest()
+{
+    std::stringstream test_results_buffer;
+    bool test_result = true;
+    size_t passed = 12;
+    s_FileBuffer << "LargeVector Bug Tests:" << std::endl;
+    s_FileBuffer << "Total test executed: " << passed << std::endl;
+
+    if (!Iterators()) { test_results_buffer << std::endl << "Iterator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Copy()) { test_results_buffer << std::endl << "Copy Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Move()) { test_results_buffer << std::endl << "Move Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Operators()) { test_results_buffer << std::endl << "Operator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PushBack()) { test_results_buffer << std::endl << "PushBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Emplace()) { test_results_buffer << std::endl << "Emplace Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PopBack()) { test_results_buffer << std::endl << "PopBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Clear()) { test_results_buffer << std::endl << "Clear Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Swap()) { test_results_buffer << std::endl << "Swap Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Reserve()) { test_results_buffer << std::endl << "Reserve Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Stability()) { test_results_buffer << std::endl << "Stability Test Failed" << std::endl; test_result = false; --passed; }
+    if (!HugePages()) { test_results_buffer << std::endl << "HugePages Test Failed" << std::endl; test_result = false; --passed; }
+
+    s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
+    if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
+    else { s_FileBuffer << test_results_buffer.str(); }
+    s_FileBuffer << std::endl << std::endl;
+    Serializer::SerializeResults("LargeVector_Results.txt", s_FileBuffer);
+
+    return test_result;
+}
+
+bool LargeVectorTest::Iterators()
+{
+    //begin()
+    //end()
+    //cbegin()
+    //cend()
+
+    {
+        LargeVector<size_t> vector;
+        if (vector.begin() != vector.end()) { return false; }
+
+        for (size_t i = 0; i < 100; ++i)
+        {
+            vector.PushBack(i);
+        }
+
+        size_t i = 0;
+        for (auto it = vector.begin(); it != vector.end(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+        if (i != 100 || vector.end() - vector.begin() != 100) { return false; }
+
+        const LargeVector<size_t>& const_vector = vector;
+        i = 0;
+        for (auto it = const_vector.cbegin(); it != const_vector.cend(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+    }
+    {
+        LargeVector<std::string> vector{ "0", "1", "2", "3", "4" };
+
+        size_t i = 0;
+        for (auto& element : vector)
+        {
+            if (element != std::to_string(i++)) { return false; }
+        }
+        if (i != 5) { return false; }
+    }
+
+    return true;
+}
+
+bool LargeVectorTest::Copy()
+{
+    //LargeVector(const LargeVector& other)
+    //operator=(const LargeVector& other)
+
+    {
+        LargeVector<size_t> vector0{ 0, 1, 2, 3, 4, 5 };
+        LargeVector<size_t> vector1(vector0);
+
+        if (vector1 != vector0 || vector1.Data() == vector0.Data()) { return false; }
+
+        LargeVector<size_t> vector2{ 7, 8 };
+        vector1 = vector2;
+
+        if (vector1 != vector2) { return false; }
+        if (vector0.Size() != 6 || vector0[5] != 5) { return false; }
+    }
+    {
+        LargeVector<std::string> vector0{ "0", "1", "2", "3", "4" };
+        LargeVector<std::string> vector1(vector0);
+
+        if (vector1 != vector0) { return false; }
+
+        vector0.Front() = "a";
+        if (vector1.Front() != "0") { return false; }
+    }
+    {
+        LargeVector<TestStruct> vector0{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+        LargeVector<TestStruct> vector1;
+        vector1 = vector0;
+
+        if (vector1 != vector0) { return false; }
+    }
+
+    return true;
+}
+
+bool LargeVectorTest::Move()
+{
+    //LargeVector(LargeVector&& other)
+    //operator=(LargeVector&& other)
+
+    {
+        LargeVector<size_t> vector0{ 0, 1, 2, 3, 4, 5 };
+        const size_t* data = vector0.Data();
+        LargeVector<size_t> vector1(std::move(vector0));
+
+        //The range is taken, the elements keep their addresses
+        if (!vector0.IsEmpty() || vector0.Capacity() != 0 || vector0.Data()) { return false; }
+        if (vector1.Size() != 6 || vector1.Data() != data) { return false; }
+
+        vector0 = std::move(vector1);
+        if (!vector1.IsEmpty() || vector0.Size() != 6 || vector0.Data() != data) { return false; }
+
+        //The moved container reserves a new range
+        vector1.PushBack(1);
+        if (vector1.Size() != 1 || vector1.Front() != 1) { return false; }
+    }
+    {
+        LargeVector<std::string> vector0{ "0", "1", "2" };
+        LargeVector<std::string> vector1{ "3" };
+        vector1 = std::move(vector0);
+
+        if (!vector0.IsEmpty() || vector1.Size() != 3 || vector1[2] != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool LargeVectorTest::Operators()
+{
+    //operator==(const LargeVector& other)
+    //operator!=(const LargeVector& other)
+    //operator[](size_t index)
+    //operator=(std::initializer_list<T>&& list)
+
+    {
+        LargeVector<size_t> vector0{ 0, 1, 2, 3 };
+        LargeVector<size_t> vector1{ 0, 1, 2, 3 };
+        if (vector0 != vector1) { return false; }
+
+        vector1[3] = 7;
+        if (vector0 == vector1) { return false; }
+
+        vector1 = { 0, 1, 2 };
+        if (vector0 == vector1 || vector1.Size() != 3) { return false; }
+
+        for (size_t i = 0; i < vector1.Size(); ++i)
+        {
+            if (vector1[i] != i || vector1.At(i) != i) { return false; }
+        }
+
+        try
+        {
+            (void)vector1.At(3);
+            return false;
+        }
+        catch (...) {}
+    }
+
+    return true;
+}
+
+bool LargeVectorTest::PushBack()
+{
+    //PushBack(const T& element)
+    //PushBack(T&& element)
+
+    {
+        LargeVector<size_t> vector;
+        for (size_t i = 0; i < 100000; ++i)
+        {
+            vector.PushBack(i);
+        }
+
+        //The memory is committed in chunks of 2 MB
+        if (vector.Size() != 100000 || vector.Capacity() != 262144) { return false; }
+        for (size_t i = 0; i < 100000; ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+    }
+    {
+        LargeVector<std::string> vector;
+        for (size_t i = 0; i < 50; ++i)
+        {
+            std::string element = std::to_string(i);
+            if (i % 2) { vector.PushBack(element); }
+            else { vector.PushBack(std::move(element)); }
+        }
+
+        for (size_t i = 0; i < 50; ++i)
+        {
+            if (vector[i] != std::to_string(i)) { return false; }
+        }
+    }
+    {
+        //The maximum size is the size of the reserved range
+        LargeVector<size_t> vector(10);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            vector.PushBack(i);
+        }
+        if (vector.Capacity() != 10 || vector.MaxSize() != 10) { return false; }
+
+        try
+        {
+            vector.PushBack(10);
+            return false;
+        }
+        catch (...) {}
+        if (vector.Size() != 10 || vector.Back() != 9) { return false; }
+    }
+
+    return true;
+}
+
+bool LargeVectorTest::Emplace()
+{
+    //EmplaceBack(Args&&... args)
+
+    {
+        LargeVector<TestStruct> vector;
+        for (size_t i = 0; i < 40; ++i)
+        {
+            TestStruct& element = vector.EmplaceBack((float)i);
+            if (&element != &vector.Back() || element != TestStruct((float)i)) { return false; }
+        }
+    }
+    {
+        LargeVector<std::string> vector;
+        vector.EmplaceBack(3, 'a');
+        vector.EmplaceBack("b");
+
+        if (vector.Size() != 2 || vector[0] != "aaa" || vector[1] != "b") { return false; }
+    }
+
+    return true;
+}
+
+bool LargeVectorTest::PopBack()
+{
+    //PopBack()
+
+    {
+        LargeVector<size_t> vector{ 0, 1, 2, 3, 4 };
+        vector.PopBack();
+        if (vector.Size() != 4 || vector.Back() != 3) { return false; }
+
+        while (!vector.IsEmpty())
+        {
+            vector.PopBack();
+        }
+        //The memory stays committed for the next insertions
+        if (vector.begin() != vector.end() || vector.Capacity() == 0) { return false; }
+        vector.PopBack();
+    }
+    {
+        LargeVector<std::string> vector{ "0", "1", "2" };
+        vector.PopBack();
+        if (vector.Size() != 2 || vector.Back() != "1") { return false; }
+    }
+
+    return true;
+}
+
+bool LargeVectorTest::Clear()
+{
+    //Clear()
+
+    {
+        LargeVector<size_t> vector{ 0, 1, 2, 3, 4 };
+        const size_t capacity = vector.Capacity();
+        vector.Clear();
+
+        if (!vector.IsEmpty() || vector.begin() != vector.end() || vector.Capacity() != capacity) { return false; }
+
+        vector.PushBack(1);
+        if (vector.Size() != 1 || vector.Front() != 1) { return false; }
+    }
+    {
+        LargeVector<std::string> vector{ "0", "1", "2" };
+        vector.Clear();
+        if (!vector.IsEmpty()) { return false; }
+    }
+
+    return true;
+}
+
+bool LargeVectorTest::Swap()
+{
+    //Swap(LargeVector& other)
+
+    {
+        LargeVector<size_t> vector0{ 0, 1, 2, 3, 4 };
+        LargeVector<size_t> vector1(100);
+        vector1.PushBack(5);
+        const size_t* data = vector0.Data();
+        vector0.Swap(vector1);
+
+        if (vector0.Size() != 1 || vector0.Front() != 5 || vector0.MaxSize() != 100) { return false; }
+        if (vector1.Size() != 5 || vector1.Back() != 4 || vector1.Data() != data) { return false; }
+    }
+    {
+        LargeVector<std::string> vector0{ "0", "1", "2" };
+        LargeVector<std::string> vector1;
+        vector0.Swap(vector1);
+
+        if (!vector0.IsEmpty() || vector1.Size() != 3 || vector1.Back() != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool LargeVectorTest::Reserve()
+{
+    //Reserve(size_t capacity)
+    //Shrink()
+
+    {
+        LargeVector<size_t> vector;
+        if (vector.Capacity() != 0 || vector.Data()) { return false; }
+
+        vector.Reserve(300000);
+        if (vector.Capacity() != 524288 || !vector.IsEmpty()) { return false; }
+
+        for (size_t i = 0; i < 300000; ++i)
+        {
+            vector.PushBack(i);
+        }
+        for (size_t i = 0; i < 290000; ++i)
+        {
+            vector.PopBack();
+        }
+
+        //The chunks after the last element are decommitted
+        const size_t* data = vector.Data();
+        vector.Shrink();
+        if (vector.Size() != 10000 || vector.Capacity() != 262144 || vector.Data() != data) { return false; }
+        for (size_t i = 0; i < 10000; ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+
+        vector.Clear();
+        vector.Shrink();
+        if (vector.Capacity() != 0 || vector.Data()) { return false; }
+
+        vector.PushBack(1);
+        if (vector.Size() != 1 || vector.Front() != 1) { return false; }
+
+        try
+        {
+            vector.Reserve(vector.MaxSize() + 1);
+            return false;
+        }
+        catch (...) {}
+    }
+
+    return true;
+}
+
+bool LargeVectorTest::Stability()
+{
+    //Growing past the maximum size of Vector without moving the elements
+
+    {
+        LargeVector<unsigned int> vector;
+        const size_t elements = 10000001;
+        for (size_t i = 0; i < elements; ++i)
+        {
+            vector.PushBack((unsigned int)i);
+            if (i == 0 && vector.Data() != &vector.Front()) { return false; }
+        }
+        const unsigned int* first = &vector.Front();
+
+        if (vector.Size() != elements || vector.Back() != elements - 1) { return false; }
+        if (vector[elements / 2] != elements / 2 || first != vector.Data()) { return false; }
+    }
+    {
+        LargeVector<std::string> vector;
+        vector.PushBack("first");
+        const std::string* first = &vector.Front();
+        for (size_t i = 0; i < 100000; ++i)
+        {
+            vector.PushBack(std::to_string(i));
+        }
+
+        if (&vector.Front() != first || vector.Front() != "first") { return false; }
+    }
+
+    return true;
+}
+
+bool LargeVectorTest::HugePages()
+{
+    //LargeVector(size_t max_size, bool huge_pages)
+    //UsesHugePages()
+
+    {
+        //The system can ignore the advice, the container works the same way
+        LargeVector<size_t> vector((size_t)1 << 24, true);
+        if (vector.UsesHugePages()) { return false; }
+
+        for (size_t i = 0; i < 1000000; ++i)
+        {
+            vector.PushBack(i);
+        }
+        for (size_t i = 0; i < 1000000; ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+
+        LargeVector<size_t> copy(vector);
+        if (copy != vector || copy.MaxSize() != vector.MaxSize()) { return false; }
+    }
+    {
+        LargeVector<size_t> vector;
+        vector.PushBack(0);
+        if (vector.UsesHugePages()) { return false; }
+    }
+
+    return true;
+}
@@ -1,10 +1,14 @@
 #include "ListTest.hpp"
 #include "List.hpp"
+#include "NodePool.hpp"
+#include "Vector.hpp"
 #include "../TestStruct.hpp"
+#include "../CountingResource.hpp"
 #include "../Serializer.hpp"
 
 #include <iostream> //For std::cout and std::fixed
 #include <string>
+#include <algorithm>  //For std::sort
 #include <sstream>  //For std::stringstream
 
 static std::stringstream s_FileBuffer;
@@ -13,7 +17,7 @@ bool ListTest::RunAllTest()
 {
     std::stringstream test_results_buffer;
     bool test_result = true;
-    size_t passed = 18;
+    size_t passed = 26;
     s_FileBuffer << "List Bug Tests:" << std::endl;
     s_FileBuffer << "Total test executed: " << passed << std::endl;
 
@@ -35,6 +39,14 @@ bool ListTest::RunAllTest()
     if (!Reserve()) { test_results_buffer << std::endl << "Reserve Test Failed" << std::endl; test_result = false; --passed; }
     if (!Resize()) { test_results_buffer << std::endl << "Resize Test Failed" << std::endl; test_result = false; --passed; }
     if (!Shrink()) { test_results_buffer << std::endl << "Shrink Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Allocators()) { test_results_buffer << std::endl << "Allocator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Slabs()) { test_results_buffer << std::endl << "Slabs Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Indexed()) { test_results_buffer << std::endl << "Indexed Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Splice()) { test_results_buffer << std::endl << "Splice Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Sort()) { test_results_buffer << std::endl << "Sort Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Defragment()) { test_results_buffer << std::endl << "Defragment Test Failed" << std::endl; test_result = false; --passed; }
+    if (!ForEach()) { test_results_buffer << std::endl << "ForEach Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Finger()) { test_results_buffer << std::endl << "Finger Test Failed" << std::endl; test_result = false; --passed; }
 
     s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
     if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
@@ -1399,6 +1411,16 @@ bool ListTest::Copy()
         }
     }
 
+    {
+        //Copies compare equal until one of them changes
+        List<size_t> list0{ 0, 1, 2 };
+        List<size_t> list1(list0);
+        if (list1 != list0 || !(list1 == list0)) { return false; }
+
+        list1[2] = 3;
+        if (!(list1 != list0) || list1 == list0) { return false; }
+    }
+
     return true;
 }
 
@@ -3398,3 +3420,896 @@ bool ListTest::Shrink()
 
     return true;
 }
+
+bool ListTest::Allocators()
+{
+    //List(const Allocator& allocator)
+    //GetAllocator()
+
+    if (!IsMoveAssignmentNoexceptOnlyWithEqualAllocators<List<size_t>, PmrList<size_t>>()) { return false; }
+
+    {
+        CountingResource resource;
+        {
+            PmrList<size_t> list(&resource);
+            list.Reserve(10);
+
+            //Two sentinel nodes, the slab pool and one slab for the reserved nodes
+            if (resource.Allocations() != 4) { return false; }
+
+            for (size_t i = 0; i < 20; ++i)
+            {
+                list.PushBack(i);
+            }
+
+            PmrList<size_t> moved(std::move(list));
+            if (moved.GetAllocator().resource() != &resource) { return false; }
+
+            size_t i = 0;
+            for (auto it = moved.begin(); it != moved.end(); ++it, ++i)
+            {
+                if (*it != i) { return false; }
+            }
+            if (i != 20) { return false; }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+        if (resource.Allocations() != resource.Deallocations()) { return false; }
+    }
+    {
+        CountingResource resource0;
+        CountingResource resource1;
+        {
+            PmrList<std::string> list0(&resource0);
+            PmrList<std::string> list1(&resource1);
+            for (size_t i = 0; i < 10; ++i)
+            {
+                list0.PushBack(std::to_string(i));
+            }
+            list1.PushBack("-1");
+
+            //The nodes of list0 can not be taken, the elements are moved into nodes of resource1
+            list1.Append(std::move(list0));
+
+            if (!list0.IsEmpty() || list1.Size() != 11) { return false; }
+            if (list1.Front() != "-1" || list1.Back() != "9") { return false; }
+
+            PmrList<std::string> list2(&resource0);
+            list2 = std::move(list1);
+
+            if (list2.GetAllocator().resource() != &resource0) { return false; }
+            if (list2.Size() != 11 || list2.Back() != "9") { return false; }
+        }
+
+        if (resource0.BytesInUse() != 0 || resource1.BytesInUse() != 0) { return false; }
+    }
+    {
+        CountingResource resource;
+        {
+            PmrList<TestStruct> list({ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) }, &resource);
+            list.PopBack();
+            list.Shrink();
+
+            if (list.Size() != 2 || list.Back() != TestStruct(1.0f)) { return false; }
+            //Two sentinel nodes, the slab pool and the slab of the remaining nodes
+            if (resource.Allocations() - resource.Deallocations() != 4) { return false; }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+    }
+
+    return true;
+}
+
+bool ListTest::Slabs()
+{
+    //Reserve(size_t)
+    //PushBack(const T&)
+    //PopBack()
+    //Erase(const_iterator)
+    //Shrink()
+
+    {
+        List<size_t> list;
+        list.Reserve(16);
+        for (size_t i = 0; i < 16; ++i)
+        {
+            list.PushBack(i);
+        }
+
+        //The reserved nodes are carved one after the other from the same slab
+        const char* previous = reinterpret_cast<const char*>(&list.Front());
+        ptrdiff_t stride = 0;
+        for (auto it = list.begin() + 1; it != list.end(); ++it)
+        {
+            const char* current = reinterpret_cast<const char*>(&*it);
+            const ptrdiff_t distance = current > previous ? current - previous : previous - current;
+            if (stride == 0) { stride = distance; }
+            if (distance != stride || stride > 64) { return false; }
+            previous = current;
+        }
+    }
+    {
+        CountingResource resource;
+        {
+            PmrList<size_t> list(&resource);
+            for (size_t i = 0; i < 10000; ++i)
+            {
+                list.PushBack(i);
+            }
+
+            //A few slabs instead of one allocation per node
+            if (resource.Allocations() > 200) { return false; }
+
+            const size_t bytes = resource.BytesInUse();
+            for (size_t i = 0; i < 9000; ++i)
+            {
+                list.PopBack();
+            }
+            list.Shrink();
+
+            //The emptied slabs are returned
+            if (resource.BytesInUse() >= bytes / 2) { return false; }
+            if (list.Size() != 1000 || list.Back() != 999) { return false; }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+        if (resource.Allocations() != resource.Deallocations()) { return false; }
+    }
+    {
+        CountingResource resource;
+        {
+            PmrList<std::string> list(&resource);
+            for (size_t i = 0; i < 1000; ++i)
+            {
+                list.PushBack(std::to_string(i));
+            }
+
+            //Free every other node and reuse the holes
+            auto it = list.begin();
+            while (it != list.end())
+            {
+                it = list.Erase(it);
+                if (it != list.end()) { ++it; }
+            }
+            list.Shrink();
+
+            const size_t allocations = resource.Allocations();
+            for (size_t i = 0; i < 500; ++i)
+            {
+                list.PushFront(std::to_string(i));
+            }
+            if (resource.Allocations() > allocations + 500) { return false; }
+
+            if (list.Size() != 1000) { return false; }
+            if (list.Front() != "499" || list.Back() != "999") { return false; }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+    }
+    {
+        List<TestStruct> list0;
+        List<TestStruct> list1;
+        for (size_t i = 0; i < 300; ++i)
+        {
+            list0.PushBack(TestStruct((float)i));
+            list1.PushBack(TestStruct((float)(i + 300)));
+        }
+        for (size_t i = 0; i < 100; ++i)
+        {
+            list0.PopFront();
+        }
+
+        //The slabs of list1 are taken along with its nodes
+        list0.Append(std::move(list1));
+        if (!list1.IsEmpty() || list0.Size() != 500) { return false; }
+
+        float value = 100.0f;
+        for (auto it = list0.begin(); it != list0.end(); ++it, value += 1.0f)
+        {
+            if (*it != TestStruct(value)) { return false; }
+        }
+
+        list0.Clear();
+        for (size_t i = 0; i < 600; ++i)
+        {
+            list0.PushBack(TestStruct((float)i));
+        }
+        if (list0.Size() != 600 || list0.Back() != TestStruct(599.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool ListTest::Indexed()
+{
+    //IndexedList
+    //operator[](size_t)
+    //Insert(size_t, const T&)
+    //Erase(size_t)
+
+    {
+        //The position tree is only stored when the list is indexed
+        if (sizeof(List<size_t>) != sizeof(IndexedList<size_t>)) { return false; }
+
+        IndexedList<size_t> list;
+        Vector<size_t> reference;
+        for (size_t i = 0; i < 200; ++i)
+        {
+            list.PushBack(i);
+            reference.PushBack(i);
+            if (i % 3 == 0)
+            {
+                list.PushFront(i + 1000);
+                reference.Insert(reference.begin(), i + 1000);
+            }
+        }
+
+        for (size_t i = 0; i < 500; ++i)
+        {
+            const size_t index = (i * 7919) % reference.Size();
+            if (i % 2)
+            {
+                list.Insert(index, i);
+                reference.Insert(index, i);
+            }
+            else
+            {
+                list.Erase(index);
+                reference.Erase(index);
+            }
+        }
+
+        if (list.Size() != reference.Size()) { return false; }
+        for (size_t i = 0; i < reference.Size(); ++i)
+        {
+            if (list[i] != reference[i] || list.At(i) != reference[i]) { return false; }
+        }
+
+        size_t i = 0;
+        for (auto it = list.begin(); it != list.end(); ++it, ++i)
+        {
+            if (*it != reference[i]) { return false; }
+        }
+    }
+    {
+        //The tree is rebuilt after operations that relink many nodes
+        IndexedList<std::string> list0{ "0", "1", "2" };
+        IndexedList<std::string> list1{ "3", "4", "5", "6" };
+        list0.Append(std::move(list1));
+
+        for (size_t i = 0; i < 7; ++i)
+        {
+            if (list0[i] != std::to_string(i)) { return false; }
+        }
+    }
+    {
+        IndexedList<std::string> list0{ "0", "1", "2", "3", "4", "5", "6" };
+
+        list0.Erase(list0.begin() + 1);
+        list0.PopFront();
+        list0.PopBack();
+        if (list0.Size() != 4 || list0[0] != "2" || list0[3] != "5") { return false; }
+
+        list0.Resize(2);
+        if (list0.Size() != 2 || list0[1] != "3") { return false; }
+
+        list0.Clear();
+        list0.Insert((size_t)0, "a");
+        list0.Insert((size_t)0, "b");
+        if (list0[0] != "b" || list0[1] != "a") { return false; }
+
+        try
+        {
+            (void)list0.At(2);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        IndexedList<TestStruct> list;
+        for (size_t i = 0; i < 64; ++i)
+        {
+            list.Insert(i / 2, TestStruct((float)i));
+        }
+
+        IndexedList<TestStruct> copy(list);
+        for (size_t i = 0; i < 64; ++i)
+        {
+            if (copy[i] != list[i]) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool ListTest::Splice()
+{
+    //Splice(iterator, List&)
+    //Splice(iterator, List&, iterator)
+    //Splice(iterator, List&, iterator, iterator)
+    //Append(List&&)
+
+    {
+        List<size_t> list0{ 0, 1, 2 };
+        List<size_t> list1{ 3, 4, 5, 6 };
+        list1.Reserve(10);
+
+        //The nodes are relinked, other keeps its unused nodes
+        list0.Splice(list0.end(), list1);
+        if (list0.Size() != 7 || !list1.IsEmpty() || list1.Capacity() != 6) { return false; }
+
+        size_t i = 0;
+        for (auto it = list0.begin(); it != list0.end(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+        for (auto it = list1.begin(); it != list1.end(); ++it)
+        {
+            return false;
+        }
+
+        list0.PopBack();
+        list1.PushBack(10);
+        list1.Splice(list1.begin(), list0, list0.begin() + 2);
+        list1.Splice(list1.end(), list0, list0.begin(), list0.begin() + 2);
+        if (list0.Size() != 3 || list0.Front() != 3 || list0.Back() != 5) { return false; }
+        if (list1.Size() != 4 || list1.Front() != 2 || list1[1] != 10 || list1.Back() != 1) { return false; }
+
+        //Splicing inside the same list
+        list0.Splice(list0.begin(), list0, list0.begin() + 2);
+        list0.Splice(list0.end(), list0, list0.begin(), list0.begin() + 2);
+        if (list0[0] != 4 || list0[1] != 5 || list0[2] != 3) { return false; }
+    }
+    {
+        List<std::string> list0;
+        List<std::string> list1{ "0", "1", "2" };
+        List<std::string> list2{ "3", "4" };
+
+        list0.Splice(list0.begin(), list1, list1.begin(), list1.end());
+        list0.Splice(list0.end(), std::move(list2));
+        list0.Append(std::move(list1));
+        if (list0.Size() != 5 || list0.Back() != "4") { return false; }
+
+        list0.PopBack();
+        list0.PushBack("4");
+        list2.PushBack("5");
+        if (list0.Back() != "4" || list2.Front() != "5") { return false; }
+
+        //A list destroyed while others use its nodes
+        {
+            List<std::string> list3{ "a", "b", "c" };
+            list3.Splice(list3.begin(), list0, list0.begin());
+            list1.Splice(list1.end(), list3, list3.begin() + 1);
+        }
+        if (list0.Front() != "1" || list1.Size() != 1 || list1.Front() != "a") { return false; }
+    }
+    {
+        CountingResource resource0;
+        CountingResource resource1;
+        {
+            PmrList<TestStruct> list0({ TestStruct(0.0f), TestStruct(1.0f) }, &resource0);
+            PmrList<TestStruct> list1({ TestStruct(2.0f), TestStruct(3.0f) }, &resource1);
+
+            //The nodes of list1 can not be taken, the elements are moved into nodes of resource0
+            list0.Splice(list0.end(), list1, list1.begin());
+            list0.Splice(list0.end(), list1);
+            if (list0.Size() != 4 || !list1.IsEmpty() || list0.Back() != TestStruct(3.0f)) { return false; }
+        }
+
+        if (resource0.BytesInUse() != 0 || resource1.BytesInUse() != 0) { return false; }
+    }
+    {
+        CountingResource resource;
+        {
+            PmrList<size_t> list1(&resource);
+            {
+                PmrList<size_t> list0(&resource);
+                for (size_t i = 0; i < 10000; ++i)
+                {
+                    list0.PushBack(i);
+                }
+
+                //Each list keeps its own slabs, the spliced node only keeps its slab alive
+                list1.Splice(list1.end(), list0, list0.begin() + 5000);
+                list1.PushBack(1);
+                if (list1.Size() != 2 || list1.Front() != 5000) { return false; }
+            }
+            if (resource.BytesInUse() > 65536 * 2) { return false; }
+
+            list1.PopFront();
+            list1.Shrink();
+            if (list1.Size() != 1 || list1.Front() != 1) { return false; }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+    }
+    {
+        IndexedList<size_t> list0{ 0, 1, 2, 3 };
+        IndexedList<size_t> list1{ 4, 5, 6 };
+
+        list0.Splice(list0.begin() + 1, list1, list1.begin() + 1);
+        list0.Splice(list0.end(), list1, list1.begin(), list1.end());
+        if (list0.Size() != 7 || !list1.IsEmpty()) { return false; }
+
+        const size_t expected[] = { 0, 5, 1, 2, 3, 4, 6 };
+        for (size_t i = 0; i < 7; ++i)
+        {
+            if (list0[i] != expected[i]) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool ListTest::Sort()
+{
+    //Sort(Compare)
+    //Merge(List&&, Compare)
+    //Unique(Predicate)
+    //Reverse()
+
+    {
+        List<size_t> list;
+        Vector<size_t> reference;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            list.PushBack((i * 7919) % 257);
+            reference.PushBack((i * 7919) % 257);
+        }
+        std::sort(reference.Data(), reference.Data() + reference.Size());
+
+        const size_t* first = &list.Front();
+        list.Sort();
+        if (list.Size() != reference.Size()) { return false; }
+
+        size_t i = 0;
+        for (auto it = list.begin(); it != list.end(); ++it, ++i)
+        {
+            if (*it != reference[i]) { return false; }
+        }
+        for (auto it = list.rbegin(); it != list.rend(); ++it)
+        {
+            if (*it != reference[--i]) { return false; }
+        }
+
+        //The nodes are relinked, not copied
+        bool found = false;
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            if (&*it == first) { found = true; }
+        }
+        if (!found) { return false; }
+
+        const size_t capacity = list.Capacity();
+        if (list.Unique() != 1000 - 257 || list.Size() != 257 || list.Capacity() != capacity) { return false; }
+        for (size_t j = 0; j < 257; ++j)
+        {
+            if (list[j] != j) { return false; }
+        }
+
+        list.Reverse();
+        if (list.Front() != 256 || list.Back() != 0 || list[100] != 156) { return false; }
+    }
+    {
+        //The sort and the merge are stable
+        List<TestStruct> list0;
+        List<TestStruct> list1;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            list0.PushBack(TestStruct((float)(i % 10), (float)i, 0.0f));
+            list1.PushBack(TestStruct((float)(i % 5), (float)i, 1.0f));
+        }
+
+        auto compare = [](const TestStruct& a, const TestStruct& b) -> bool { return a.x < b.x; };
+        list0.Sort(compare);
+        list1.Sort(compare);
+        list0.Merge(std::move(list1), compare);
+        if (list0.Size() != 200 || !list1.IsEmpty()) { return false; }
+
+        auto prev = list0.begin();
+        for (auto it = prev + 1; it != list0.end(); ++it, ++prev)
+        {
+            if (it->x < prev->x) { return false; }
+            if (it->x == prev->x && it->z == prev->z && it->y < prev->y) { return false; }
+            if (it->x == prev->x && it->z < prev->z) { return false; }
+        }
+
+        auto equal = [](const TestStruct& a, const TestStruct& b) -> bool { return a.x == b.x; };
+        if (list0.Unique(equal) != 190 || list0.Size() != 10) { return false; }
+    }
+    {
+        List<std::string> list{ "c" };
+        list.Reverse();
+        list.Sort();
+        list.Merge(List<std::string>{ "a", "b", "d" });
+        if (list.Size() != 4 || list[0] != "a" || list[2] != "c" || list.Back() != "d") { return false; }
+    }
+    {
+        //Lists that already gave nodes to other lists are still merged by relinking
+        CountingResource resource;
+        PmrList<size_t> list0({ 0, 2, 4 }, &resource);
+        PmrList<size_t> list1({ 1, 3, 5, 7 }, &resource);
+        PmrList<size_t> list2(&resource);
+        PmrList<size_t> list3(&resource);
+        list2.Splice(list2.end(), list0, list0.begin() + 2);
+        list3.Splice(list3.end(), list1, list1.begin() + 3);
+
+        const size_t* first = &list1.Front();
+        const size_t allocations = resource.Allocations();
+        list0.Merge(list1);
+        if (resource.Allocations() != allocations || list0.Size() != 5 || !list1.IsEmpty()) { return false; }
+        if (&list0[1] != first || list0[3] != 3 || list0.Back() != 5) { return false; }
+
+        IndexedList<std::string> indexed{ "3", "1", "2", "0" };
+        indexed.Sort();
+        indexed.Reverse();
+        if (indexed[0] != "3" || indexed[3] != "0") { return false; }
+    }
+
+    return true;
+}
+
+bool ListTest::Defragment()
+{
+    //Defragment()
+    //Defragment(iterator, size_t)
+
+    auto in_memory_order = [](const PmrList<size_t>& list) -> bool
+    {
+        //Consecutive elements are at the same distance, except where a new slab starts
+        size_t jumps = 0;
+        const char* previous = reinterpret_cast<const char*>(&list.Front());
+        ptrdiff_t stride = 0;
+        for (auto it = list.cbegin() + 1; it != list.cend(); ++it)
+        {
+            const char* current = reinterpret_cast<const char*>(&*it);
+            if (stride == 0) { stride = current - previous; }
+            if (current - previous != stride) { ++jumps; }
+            previous = current;
+        }
+        return stride > 0 && jumps <= list.Size() / 512;
+    };
+
+    {
+        CountingResource resource;
+        {
+            PmrList<size_t> list(&resource);
+            for (size_t i = 0; i < 10000; ++i)
+            {
+                list.PushBack((i * 7919) % 10000);
+            }
+            list.Sort();
+            for (auto it = list.begin(); it != list.end();)
+            {
+                it = list.Erase(it);
+                if (it != list.end()) { ++it; }
+            }
+            if (list.Capacity() == list.Size()) { return false; }
+
+            //After sorting, the order of the elements does not follow the memory of the nodes
+            Vector<size_t> copy;
+            for (auto it = list.begin(); it != list.end(); ++it)
+            {
+                copy.PushBack(*it);
+            }
+            auto equals_copy = [&list, &copy]() -> bool
+            {
+                size_t i = 0;
+                for (auto it = list.begin(); it != list.end(); ++it, ++i)
+                {
+                    if (*it != copy[i]) { return false; }
+                }
+                return i == copy.Size();
+            };
+            if (in_memory_order(list)) { return false; }
+
+            const size_t bytes = resource.BytesInUse();
+            list.Defragment();
+
+            //The unused nodes and the old slabs are returned
+            if (!in_memory_order(list) || list.Capacity() != list.Size() || !equals_copy()) { return false; }
+            if (resource.BytesInUse() >= bytes) { return false; }
+
+            list.PushBack(10000);
+            list.PushFront(10001);
+            if (list.Size() != 5002 || list.Back() != 10000 || list.Front() != 10001) { return false; }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+    }
+    {
+        List<std::string> list;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            list.PushFront(std::to_string(i));
+        }
+        list.Sort();
+
+        List<std::string> copy(list);
+
+        //Budgeted steps until the whole list is done, the list can be modified between the steps
+        size_t steps = 0;
+        auto it = list.Defragment(list.begin(), 0);
+        if (it != list.begin()) { return false; }
+        while (it != list.end())
+        {
+            it = list.Defragment(it, 64);
+            ++steps;
+        }
+        if (steps != 16 || list != copy) { return false; }
+
+        it = list.Defragment(list.begin(), 10);
+        list.Erase(list.begin());
+        list.PushBack("last");
+        it = list.Defragment(it, 2000);
+        if (it != list.end() || list.Size() != 1000 || list.Back() != "last" || list.Front() != copy[1]) { return false; }
+
+        list.Defragment();
+        list.Clear();
+        list.Defragment();
+        if (!list.IsEmpty() || list.Defragment(list.begin(), 10) != list.end()) { return false; }
+    }
+    {
+        IndexedList<TestStruct> list;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            list.EmplaceBack((float)i);
+        }
+
+        list.Defragment();
+        for (size_t i = 0; i < 100; ++i)
+        {
+            if (list[i] != TestStruct((float)i)) { return false; }
+        }
+        list.Erase(50);
+        if (list[50] != TestStruct(51.0f) || list.Size() != 99) { return false; }
+    }
+    {
+        //Without slabs each node is allocated on its own
+        List<size_t, NodePoolAllocator<size_t>> list;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            list.PushBack(i);
+        }
+        list.Defragment();
+        size_t i = 0;
+        for (auto it = list.begin(); it != list.end(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+        if (i != 100) { return false; }
+    }
+
+    return true;
+}
+
+bool ListTest::ForEach()
+{
+    //ForEach(Function)
+    //ForEachBatch(Function, size_t)
+    //ForEachInterleaved(Function, const iterator*, size_t)
+
+    {
+        List<size_t> list;
+        size_t visited = 0;
+        list.ForEach([&visited](size_t&) { ++visited; });
+        list.ForEachBatch([&visited](size_t* const*, size_t) { ++visited; });
+        list.ForEachInterleaved([&visited](size_t&) { ++visited; }, nullptr, 0);
+        if (visited != 0) { return false; }
+
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            list.PushBack(i);
+        }
+
+        size_t expected = 0;
+        bool ordered = true;
+        list.ForEach([&](size_t& element) { if (element != expected++) { ordered = false; } element *= 2; });
+        if (!ordered || expected != 1000 || list.Back() != 1998) { return false; }
+
+        const List<size_t>& const_list = list;
+        size_t sum = 0;
+        const_list.ForEach([&sum](const size_t& element) { sum += element; });
+        if (sum != 999 * 1000) { return false; }
+
+        //Batches keep the order, the last one has the remaining elements
+        for (size_t batch : { (size_t)0, (size_t)1, (size_t)7, (size_t)64, (size_t)1000 })
+        {
+            expected = 0;
+            size_t batches = 0;
+            size_t largest = 0;
+            list.ForEachBatch([&](size_t* const* elements, size_t count)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (*elements[i] != 2 * expected++) { ordered = false; }
+                }
+                if (count > largest) { largest = count; }
+                ++batches;
+            }, batch);
+
+            const size_t clamped = batch == 0 ? 1 : (batch > 64 ? 64 : batch);
+            if (!ordered || expected != 1000 || largest != clamped || batches != (1000 + clamped - 1) / clamped) { return false; }
+        }
+    }
+    {
+        List<std::string> list;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            list.PushBack(std::to_string(i));
+        }
+
+        //Each sub-range is visited in order, every element exactly once
+        Vector<List<std::string>::iterator> starts;
+        for (size_t i = 0; i < 100; i += 5)
+        {
+            starts.PushBack(list.begin() + i);
+        }
+        starts.PushBack(list.end());
+
+        Vector<size_t> visits;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            visits.PushBack(0);
+        }
+        Vector<size_t> last_in_range;
+        for (size_t i = 0; i < starts.Size(); ++i)
+        {
+            last_in_range.PushBack((size_t)-1);
+        }
+
+        bool ordered = true;
+        list.ForEachInterleaved([&](std::string& element)
+        {
+            const size_t value = (size_t)std::stoul(element);
+            const size_t range = value / 5;
+            if (last_in_range[range] != (size_t)-1 && last_in_range[range] + 1 != value) { ordered = false; }
+            last_in_range[range] = value;
+            ++visits[value];
+        }, starts.Data(), starts.Size());
+
+        if (!ordered) { return false; }
+        for (size_t i = 0; i < 100; ++i)
+        {
+            if (visits[i] != 1) { return false; }
+        }
+
+        //A single start is a plain visit in order
+        size_t expected = 0;
+        List<std::string>::iterator begin = list.begin();
+        list.ForEachInterleaved([&](std::string& element) { if (element != std::to_string(expected++)) { ordered = false; } }, &begin, 1);
+        if (!ordered || expected != 100) { return false; }
+    }
+    {
+        List<TestStruct> list;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            list.EmplaceBack((float)i);
+        }
+
+        float sum = 0.0f;
+        list.ForEachBatch([&sum](TestStruct* const* elements, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                sum += elements[i]->x;
+            }
+        }, 3);
+        if (sum != 45.0f) { return false; }
+    }
+
+    return true;
+}
+
+bool ListTest::Finger()
+{
+    //EnableFinger(bool enable)
+    //IsFingerEnabled()
+
+    {
+        List<size_t> list;
+        if (list.IsFingerEnabled()) { return false; }
+        list.EnableFinger();
+        if (!list.IsFingerEnabled()) { return false; }
+
+        for (size_t i = 0; i < 100; ++i)
+        {
+            list.PushBack(i);
+        }
+
+        //Sequential access in both directions
+        for (size_t i = 0; i < 100; ++i)
+        {
+            if (list[i] != i) { return false; }
+        }
+        for (size_t i = 100; i > 0; --i)
+        {
+            if (list[i - 1] != i - 1) { return false; }
+        }
+
+        //Inserts and erases by index next to the finger keep it valid
+        Vector<size_t> model;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            model.PushBack(i);
+        }
+        for (size_t i = 10; i < 60; i += 2)
+        {
+            list.Insert(i, 1000 + i);
+            model.Insert(i, 1000 + i);
+            list.Erase(i + 1);
+            model.Erase(i + 1);
+            if (list[i + 1] != model[i + 1] || list[i - 1] != model[i - 1]) { return false; }
+        }
+
+        //Modifications at the ends and away from the finger
+        list.PushFront(2000);
+        model.Insert((size_t)0, 2000);
+        list.PopBack();
+        model.PopBack();
+        if (list[50] != model[50]) { return false; }
+        list.Erase(list.begin() + 5);
+        model.Erase(5);
+        list.Insert(list.begin() + 80, 3000);
+        model.Insert(80, 3000);
+        list.PopFront();
+        model.Erase((size_t)0);
+
+        if (list.Size() != model.Size()) { return false; }
+        for (size_t i = 0; i < model.Size(); ++i)
+        {
+            if (list[i] != model[i]) { return false; }
+        }
+
+        list.EnableFinger(false);
+        if (list.IsFingerEnabled() || list[40] != model[40]) { return false; }
+    }
+    {
+        //The finger goes with the nodes and is dropped by bulk modifications
+        List<size_t> list0;
+        List<size_t> list1{ 5, 4, 3, 2, 1 };
+        list0.EnableFinger();
+        for (size_t i = 0; i < 10; ++i)
+        {
+            list0.PushBack(i);
+        }
+        if (list0[7] != 7) { return false; }
+
+        list0.Swap(list1);
+        if (list0.IsFingerEnabled() || !list1.IsFingerEnabled()) { return false; }
+        if (list1[6] != 6 || list0[3] != 2) { return false; }
+
+        list1.Reverse();
+        if (list1[6] != 3 || list1[0] != 9) { return false; }
+        list1.Sort();
+        if (list1[6] != 6) { return false; }
+        list1.Splice(list1.end(), list0);
+        if (list1[12] != 3 || list1[13] != 2 || list1.Size() != 15) { return false; }
+
+        List<size_t> list2(list1);
+        if (!list2.IsFingerEnabled() || list2[14] != 1) { return false; }
+
+        list1.Clear();
+        list1.PushBack(7);
+        if (list1[0] != 7) { return false; }
+    }
+    {
+        List<TestStruct> list;
+        list.EnableFinger();
+        for (size_t i = 0; i < 50; ++i)
+        {
+            list.EmplaceBack((float)i);
+        }
+        for (size_t i = 0; i < 25; ++i)
+        {
+            list.Erase(i);
+        }
+        for (size_t i = 0; i < 25; ++i)
+        {
+            if (list[i].x != (float)(2 * i + 1)) { return false; }
+        }
+    }
+
+    return true;
+}
@@ -24,4 +24,12 @@ public:
     static bool Reserve();
     static bool Resize();
     static bool Shrink();
+    static bool Allocators();
+    static bool Slabs();
+    static bool Indexed();
+    static bool Splice();
+    static bool Sort();
+    static bool Defragment();
+    static bool ForEach();
+    static bool Finger();
 };
@@ -0,0 +1,512 @@
+#include "MappedVectorTest.hpp"
+#include "MappedVector.hpp"
+#include "../Serializer.hpp"
+
+#include <iostream> //For std::cout and std::fixed
+#include <string>
+#include <sstream>  //For std::stringstream
+#include <cstdio>  //For std::remove
+#include <fstream>  //For std::ofstream
+
+static std::stringstream s_FileBuffer;
+
+static const char* s_TestFile = "data/MappedVector_Test.bin";
+static const char* s_OtherTestFile = "data/MappedVector_Other_Test.bin";
+
+struct MappedPoint
+{
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+
+    MappedPoint() = default;
+    MappedPoint(float x, float y, float z) : x(x), y(y), z(z) {}
+
+    bool operator==(const MappedPoint& other) const { return x == other.x && y == other.y && z == other.z; }
+    bool operator!=(const MappedPoint& other) const { return !(*this == other); }
+};
+
+bool MappedVectorTest::RunAllTest()
+{
+    std::stringstream test_results_buffer;
+    bool test_result = true;
+    size_t passed = 12;
+    s_FileBuffer << "MappedVector Bug Tests:" << std::endl;
+    s_FileBuffer << "Total test executed: " << passed << std::endl;
+
+    if (!Iterators()) { test_results_buffer << std::endl << "Iterator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Move()) { test_results_buffer << std::endl << "Move Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Operators()) { test_results_buffer << std::endl << "Operator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PushBack()) { test_results_buffer << std::endl << "PushBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Emplace()) { test_results_buffer << std::endl << "Emplace Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PopBack()) { test_results_buffer << std::endl << "PopBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Clear()) { test_results_buffer << std::endl << "Clear Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Swap()) { test_results_buffer << std::endl << "Swap Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Reserve()) { test_results_buffer << std::endl << "Reserve Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Persistence()) { test_results_buffer << std::endl << "Persistence Test Failed" << std::endl; test_result = false; --passed; }
+    if (!ReadOnly()) { test_results_buffer << std::endl << "ReadOnly Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Format()) { test_results_buffer << std::endl << "Format Test Failed" << std::endl; test_result = false; --passed; }
+
+    std::remove(s_TestFile);
+    std::remove(s_OtherTestFile);
+
+    s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
+    if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
+    else { s_FileBuffer << test_results_buffer.str(); }
+    s_FileBuffer << std::endl << std::endl;
+    Serializer::SerializeResults("MappedVector_Results.txt", s_FileBuffer);
+
+    return test_result;
+}
+
+bool MappedVectorTest::Iterators()
+{
+    //begin()
+    //end()
+    //cbegin()
+    //cend()
+
+    std::remove(s_TestFile);
+    {
+        MappedVector<size_t> vector(s_TestFile);
+        for (size_t i = 0; i < 100; ++i)
+        {
+            vector.PushBack(i);
+        }
+
+        size_t index = 0;
+        for (MappedVector<size_t>::iterator it = vector.begin(); it != vector.end(); ++it, ++index)
+        {
+            if (*it != index) { return false; }
+        }
+        if (index != 100) { return false; }
+
+        index = 0;
+        for (MappedVector<size_t>::const_iterator it = vector.cbegin(); it != vector.cend(); ++it, ++index)
+        {
+            if (*it != index) { return false; }
+        }
+
+        index = 0;
+        for (size_t element : vector)
+        {
+            if (element != index++) { return false; }
+        }
+    }
+    {
+        MappedVector<size_t> vector;
+        if (vector.begin() != vector.end() || vector.IsOpen()) { return false; }
+    }
+
+    return true;
+}
+
+bool MappedVectorTest::Move()
+{
+    //MappedVector(MappedVector&& other)
+    //operator=(MappedVector&& other)
+
+    std::remove(s_TestFile);
+    {
+        MappedVector<size_t> vector0(s_TestFile);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            vector0.PushBack(i);
+        }
+
+        MappedVector<size_t> vector1(std::move(vector0));
+        if (vector1.Size() != 10 || vector1[9] != 9) { return false; }
+        if (vector0.IsOpen() || vector0.Size() != 0 || vector0.Capacity() != 0) { return false; }
+
+        MappedVector<size_t> vector2;
+        vector2 = std::move(vector1);
+        if (vector2.Size() != 10 || vector2.Back() != 9 || vector1.IsOpen()) { return false; }
+
+        vector2 = std::move(vector2);
+        if (vector2.Size() != 10) { return false; }
+    }
+
+    return true;
+}
+
+bool MappedVectorTest::Operators()
+{
+    //operator[](size_t index)
+    //At(size_t index)
+    //operator==(const MappedVector& other)
+    //operator!=(const MappedVector& other)
+
+    std::remove(s_TestFile);
+    std::remove(s_OtherTestFile);
+    {
+        MappedVector<size_t> vector0(s_TestFile);
+        MappedVector<size_t> vector1(s_OtherTestFile);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            vector0.PushBack(i);
+            vector1.PushBack(i);
+        }
+        if (vector0 != vector1) { return false; }
+
+        vector0[5] = 50;
+        if (vector0.At(5) != 50 || vector0 == vector1) { return false; }
+
+        try
+        {
+            (void)vector0.At(10);
+            return false;
+        }
+        catch (const std::exception&) {}
+    }
+
+    return true;
+}
+
+bool MappedVectorTest::PushBack()
+{
+    //PushBack(const T& element)
+
+    std::remove(s_TestFile);
+    {
+        MappedVector<size_t> vector(s_TestFile);
+        for (size_t i = 0; i < 10000; ++i)
+        {
+            vector.PushBack(i);
+        }
+        if (vector.Size() != 10000 || vector.Capacity() < 10000) { return false; }
+
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+    }
+    {
+        //An element of the container is pushed while the file grows
+        MappedVector<size_t> vector(s_TestFile);
+        vector.Shrink();
+        vector.PushBack(vector.Front());
+        vector.PushBack(vector[9999]);
+        if (vector.Size() != 10002 || vector[10000] != 0 || vector[10001] != 9999) { return false; }
+    }
+
+    return true;
+}
+
+bool MappedVectorTest::Emplace()
+{
+    //EmplaceBack(Args&&... args)
+
+    std::remove(s_TestFile);
+    {
+        MappedVector<MappedPoint> vector(s_TestFile);
+        for (size_t i = 0; i < 2000; ++i)
+        {
+            MappedPoint& point = vector.EmplaceBack((float)i, 1.0f, 2.0f);
+            if (point.x != (float)i) { return false; }
+        }
+        if (vector.Size() != 2000 || vector.Back() != MappedPoint(1999.0f, 1.0f, 2.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool MappedVectorTest::PopBack()
+{
+    //PopBack()
+
+    std::remove(s_TestFile);
+    {
+        MappedVector<size_t> vector(s_TestFile);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            vector.PushBack(i);
+        }
+
+        vector.PopBack();
+        if (vector.Size() != 9 || vector.Back() != 8) { return false; }
+
+        for (size_t i = 0; i < 20; ++i)
+        {
+            vector.PopBack();
+        }
+        if (!vector.IsEmpty()) { return false; }
+    }
+
+    return true;
+}
+
+bool MappedVectorTest::Clear()
+{
+    //Clear()
+    //Resize(size_t size)
+
+    std::remove(s_TestFile);
+    {
+        MappedVector<size_t> vector(s_TestFile);
+        for (size_t i = 0; i < 100; ++i)
+        {
+            vector.PushBack(i + 1);
+        }
+
+        const size_t capacity = vector.Capacity();
+        vector.Clear();
+        if (!vector.IsEmpty() || vector.Capacity() != capacity) { return false; }
+
+        //The old elements are replaced with zeros
+        vector.Resize(5000);
+        if (vector.Size() != 5000 || vector.Capacity() < 5000) { return false; }
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != 0) { return false; }
+        }
+
+        vector.Resize(10);
+        if (vector.Size() != 10) { return false; }
+    }
+
+    return true;
+}
+
+bool MappedVectorTest::Swap()
+{
+    //Swap(MappedVector& other)
+
+    std::remove(s_TestFile);
+    std::remove(s_OtherTestFile);
+    {
+        MappedVector<size_t> vector0(s_TestFile);
+        MappedVector<size_t> vector1(s_OtherTestFile);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            vector0.PushBack(i);
+        }
+        vector1.PushBack(100);
+
+        vector0.Swap(vector1);
+        if (vector0.Size() != 1 || vector0[0] != 100 || vector1.Size() != 10 || vector1[9] != 9) { return false; }
+
+        vector0.Swap(vector0);
+        if (vector0.Size() != 1) { return false; }
+    }
+    {
+        //Each container keeps writing to the file it took
+        MappedVector<size_t> vector0(s_TestFile);
+        MappedVector<size_t> vector1(s_OtherTestFile);
+        if (vector0.Size() != 10 || vector1.Size() != 1) { return false; }
+    }
+
+    return true;
+}
+
+bool MappedVectorTest::Reserve()
+{
+    //Reserve(size_t capacity)
+    //Shrink()
+    //Capacity()
+
+    std::remove(s_TestFile);
+    {
+        MappedVector<size_t> vector(s_TestFile);
+        vector.Reserve(100000);
+        if (vector.Capacity() != 100000 || !vector.IsEmpty()) { return false; }
+
+        vector.Reserve(10);
+        if (vector.Capacity() != 100000) { return false; }
+
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            vector.PushBack(i);
+        }
+
+        vector.Shrink();
+        if (vector.Capacity() != 1000 || vector.Size() != 1000 || vector[999] != 999) { return false; }
+    }
+    {
+        //The file keeps the capacity
+        MappedVector<size_t> vector(s_TestFile);
+        if (vector.Capacity() != 1000 || vector.Size() != 1000) { return false; }
+    }
+
+    return true;
+}
+
+bool MappedVectorTest::Persistence()
+{
+    //Open(const char* path)
+    //Close()
+    //Flush()
+
+    std::remove(s_TestFile);
+    {
+        MappedVector<size_t> vector(s_TestFile);
+        for (size_t i = 0; i < 100000; ++i)
+        {
+            vector.PushBack(i * 3);
+        }
+        vector.Flush();
+        vector.Close();
+        if (vector.IsOpen() || vector.Size() != 0) { return false; }
+
+        vector.Open(s_TestFile);
+        if (vector.Size() != 100000) { return false; }
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != i * 3) { return false; }
+        }
+        vector.PushBack(7);
+    }
+    {
+        //Destroying the container without Flush keeps the elements
+        MappedVector<size_t> vector(s_TestFile);
+        if (vector.Size() != 100001 || vector.Back() != 7) { return false; }
+    }
+    {
+        //Two writable containers share the same file
+        MappedVector<size_t> vector0(s_TestFile);
+        MappedVector<size_t> vector1(s_TestFile);
+        vector0[0] = 42;
+        if (vector1[0] != 42) { return false; }
+    }
+
+    return true;
+}
+
+bool MappedVectorTest::ReadOnly()
+{
+    //OpenReadOnly(const char* path)
+    //IsReadOnly()
+
+    std::remove(s_TestFile);
+    {
+        MappedVector<size_t> vector(s_TestFile);
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            vector.PushBack(i);
+        }
+    }
+    {
+        MappedVector<size_t> vector0(s_TestFile, true);
+        MappedVector<size_t> vector1;
+        vector1.OpenReadOnly(s_TestFile);
+        if (!vector0.IsReadOnly() || !vector1.IsReadOnly() || vector0 != vector1 || vector0.Size() != 1000) { return false; }
+
+        //The modifiers throw and leave the file as it was
+        try
+        {
+            vector0.PushBack(0);
+            return false;
+        }
+        catch (const std::exception&) {}
+        try
+        {
+            vector0.Reserve(100000);
+            return false;
+        }
+        catch (const std::exception&) {}
+        try
+        {
+            vector1.Clear();
+            return false;
+        }
+        catch (const std::exception&) {}
+        if (vector0.Size() != 1000 || vector1.Size() != 1000) { return false; }
+
+        vector0.Flush();
+    }
+    {
+        //A writer grows the file while it is open, the others only see the elements of their own mapping
+        MappedVector<size_t> reader(s_TestFile, true);
+        MappedVector<size_t> other_writer(s_TestFile);
+        MappedVector<size_t> writer(s_TestFile);
+        const size_t capacity = other_writer.Capacity();
+        for (size_t i = 1000; i < 10000; ++i)
+        {
+            writer.PushBack(i);
+        }
+        if (writer.Size() != 10000 || writer.Capacity() <= capacity) { return false; }
+        if (reader.Size() != 1000 || other_writer.Size() != capacity || other_writer.Capacity() != capacity) { return false; }
+
+        size_t i = 0;
+        for (const size_t element : reader)
+        {
+            if (element != i++) { return false; }
+        }
+        if (i != 1000 || reader.end() - reader.begin() != 1000) { return false; }
+        i = 0;
+        for (const size_t element : other_writer)
+        {
+            if (element != i++) { return false; }
+        }
+        if (i != capacity) { return false; }
+
+        MappedVector<size_t> new_reader(s_TestFile, true);
+        if (new_reader.Size() != 10000 || new_reader != writer) { return false; }
+    }
+    {
+        //A missing file is not created when it is opened as read only
+        std::remove(s_OtherTestFile);
+        MappedVector<size_t> vector;
+        try
+        {
+            vector.OpenReadOnly(s_OtherTestFile);
+            return false;
+        }
+        catch (const std::exception&) {}
+        if (vector.IsOpen()) { return false; }
+
+        try
+        {
+            vector.PushBack(0);
+            return false;
+        }
+        catch (const std::exception&) {}
+    }
+
+    return true;
+}
+
+bool MappedVectorTest::Format()
+{
+    //The header is checked against the element type
+
+    std::remove(s_TestFile);
+    {
+        MappedVector<size_t> vector(s_TestFile);
+        vector.PushBack(1);
+    }
+    {
+        MappedVector<MappedPoint> vector;
+        try
+        {
+            vector.Open(s_TestFile);
+            return false;
+        }
+        catch (const std::exception&) {}
+        if (vector.IsOpen()) { return false; }
+    }
+    {
+        std::ofstream file(s_OtherTestFile, std::ios::out | std::ios::trunc | std::ios::binary);
+        file << "This file is not a MappedVector, but it is longer than the header of a MappedVector file.";
+    }
+    {
+        MappedVector<size_t> vector;
+        try
+        {
+            vector.Open(s_OtherTestFile);
+            return false;
+        }
+        catch (const std::exception&) {}
+        try
+        {
+            vector.OpenReadOnly(s_OtherTestFile);
+            return false;
+        }
+        catch (const std::exception&) {}
+
+        //The valid file still opens
+        vector.OpenReadOnly(s_TestFile);
+        if (vector.Size() != 1 || vector[0] != 1) { return false; }
+    }
+
+    return true;
+}
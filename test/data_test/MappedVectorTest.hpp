@@ -0,0 +1,21 @@
+#pragma once
+
+class MappedVectorTest
+{
+public:
+    static bool RunAllTest();
+
+public:
+    static bool Iterators();
+    static bool Move();
+    static bool Operators();
+    static bool PushBack();
+    static bool Emplace();
+    static bool PopBack();
+    static bool Clear();
+    static bool Swap();
+    static bool Reserve();
+    static bool Persistence();
+    static bool ReadOnly();
+    static bool Format();
+};
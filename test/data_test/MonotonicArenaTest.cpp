@@ -0,0 +1,220 @@
+#include "MonotonicArenaTest.hpp"
+#include "MonotonicArena.hpp"
+#include "Vector.hpp"
+#include "List.hpp"
+#include "../TestStruct.hpp"
+#include "../CountingResource.hpp"
+#include "../Serializer.hpp"
+
+#include <iostream> //For std::cout and std::fixed
+#include <string>
+#include <sstream>  //For std::stringstream
+
+static std::stringstream s_FileBuffer;
+
+bool MonotonicArenaTest::RunAllTest()
+{
+    std::stringstream test_results_buffer;
+    bool test_result = true;
+    size_t passed = 4;
+    s_FileBuffer << "MonotonicArena Bug Tests:" << std::endl;
+    s_FileBuffer << "Total test executed: " << passed << std::endl;
+
+    if (!Allocate()) { test_results_buffer << std::endl << "Allocate Test Failed" << std::endl; test_result = false; --passed; }
+    if (!InitialBuffer()) { test_results_buffer << std::endl << "InitialBuffer Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Release()) { test_results_buffer << std::endl << "Release Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Containers()) { test_results_buffer << std::endl << "Containers Test Failed" << std::endl; test_result = false; --passed; }
+
+    s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
+    if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
+    else { s_FileBuffer << test_results_buffer.str(); }
+    s_FileBuffer << std::endl << std::endl;
+    Serializer::SerializeResults("MonotonicArena_Results.txt", s_FileBuffer);
+
+    return test_result;
+}
+
+bool MonotonicArenaTest::Allocate()
+{
+    //Allocate(size_t bytes, size_t alignment)
+
+    {
+        CountingResource upstream;
+        {
+            MonotonicArena arena(1024, &upstream);
+
+            if (!arena.Allocate(1, 1)) { return false; }
+            for (size_t i = 0; i < 100; ++i)
+            {
+                unsigned char* block = static_cast<unsigned char*>(arena.Allocate(8, 8));
+                if (reinterpret_cast<uintptr_t>(block) % 8 != 0) { return false; }
+            }
+
+            //The blocks of the same chunk are contiguous
+            unsigned char* block0 = static_cast<unsigned char*>(arena.Allocate(8, 8));
+            unsigned char* block1 = static_cast<unsigned char*>(arena.Allocate(8, 8));
+            if (arena.BytesAvailable() > 0 && block1 != block0 + 8) { return false; }
+
+            void* aligned = arena.Allocate(64, 64);
+            if (reinterpret_cast<uintptr_t>(aligned) % 64 != 0) { return false; }
+
+            //Blocks bigger than the chunk size get their own chunk
+            const size_t allocations = upstream.Allocations();
+            void* big = arena.Allocate(100000, 16);
+            if (!big || upstream.Allocations() != allocations + 1) { return false; }
+        }
+
+        if (upstream.BytesInUse() != 0) { return false; }
+        if (upstream.Allocations() != upstream.Deallocations()) { return false; }
+    }
+    {
+        MonotonicArena arena;
+        std::pmr::memory_resource* resource = &arena;
+
+        void* block0 = resource->allocate(32, 8);
+        void* block1 = resource->allocate(32, 8);
+        resource->deallocate(block0, 32, 8);
+
+        if (static_cast<unsigned char*>(block1) != static_cast<unsigned char*>(block0) + 32) { return false; }
+        if (!resource->is_equal(arena)) { return false; }
+    }
+    {
+        MonotonicArena arena;
+        TestStruct* element = new (arena.Allocate(sizeof(TestStruct), alignof(TestStruct))) TestStruct(1.0f);
+
+        if (*element != TestStruct(1.0f)) { return false; }
+        element->~TestStruct();
+    }
+    {
+        //Empty blocks of a fresh arena are valid and distinct, as memory_resource requires
+        MonotonicArena arena;
+        std::pmr::memory_resource* resource = &arena;
+
+        void* block0 = resource->allocate(0, 1);
+        void* block1 = arena.Allocate(0, 1);
+        if (!block0 || !block1 || block0 == block1) { return false; }
+    }
+
+    return true;
+}
+
+bool MonotonicArenaTest::InitialBuffer()
+{
+    //MonotonicArena(void* buffer, size_t size)
+
+    {
+        CountingResource upstream;
+        alignas(std::max_align_t) unsigned char buffer[512];
+        {
+            MonotonicArena arena(buffer, sizeof(buffer), 1024, &upstream);
+
+            for (size_t i = 0; i < 512 / 16; ++i)
+            {
+                unsigned char* block = static_cast<unsigned char*>(arena.Allocate(16, 16));
+                if (block < buffer || block >= buffer + sizeof(buffer)) { return false; }
+            }
+
+            if (arena.HasChunks() || upstream.Allocations() != 0) { return false; }
+            if (arena.BytesAvailable() != 0) { return false; }
+
+            if (!arena.Allocate(16, 16)) { return false; }
+            if (!arena.HasChunks() || upstream.Allocations() != 1) { return false; }
+        }
+
+        if (upstream.BytesInUse() != 0) { return false; }
+    }
+
+    return true;
+}
+
+bool MonotonicArenaTest::Release()
+{
+    //Release()
+
+    {
+        CountingResource upstream;
+        alignas(std::max_align_t) unsigned char buffer[256];
+        MonotonicArena arena(buffer, sizeof(buffer), 256, &upstream);
+
+        for (size_t i = 0; i < 100; ++i)
+        {
+            if (!arena.Allocate(64, 8)) { return false; }
+        }
+
+        if (upstream.Allocations() == 0) { return false; }
+        if (arena.BytesReserved() <= sizeof(buffer)) { return false; }
+
+        arena.Release();
+
+        if (upstream.BytesInUse() != 0) { return false; }
+        if (arena.HasChunks() || arena.BytesReserved() != sizeof(buffer)) { return false; }
+        if (arena.Allocate(8, 8) != buffer) { return false; }
+    }
+
+    return true;
+}
+
+bool MonotonicArenaTest::Containers()
+{
+    //ArenaAllocator<T>
+
+    {
+        CountingResource upstream;
+        MonotonicArena arena(4096, &upstream);
+        {
+            List<size_t, ArenaAllocator<size_t>> list(&arena);
+            for (size_t i = 0; i < 1000; ++i)
+            {
+                list.PushBack(i);
+            }
+
+            size_t i = 0;
+            for (auto it = list.begin(); it != list.end(); ++it, ++i)
+            {
+                if (*it != i) { return false; }
+            }
+            if (list.GetAllocator().Arena() != &arena) { return false; }
+
+            Vector<size_t, DoublingGrowthPolicy, ArenaAllocator<size_t>> vector(&arena);
+            for (size_t j = 0; j < 1000; ++j)
+            {
+                vector.PushBack(j);
+            }
+            if (vector[999] != 999) { return false; }
+        }
+
+        //The containers return nothing, the memory is released with the arena
+        if (upstream.Deallocations() != 0) { return false; }
+        arena.Release();
+        if (upstream.BytesInUse() != 0) { return false; }
+    }
+    {
+        MonotonicArena arena;
+        {
+            List<std::string, ArenaAllocator<std::string>> list(&arena);
+            for (size_t i = 0; i < 100; ++i)
+            {
+                list.PushBack(std::to_string(i) + " is a string too long for the small string buffer");
+            }
+            list.PopFront();
+
+            if (list.Front() != "1 is a string too long for the small string buffer") { return false; }
+        }
+    }
+    {
+        MonotonicArena arena;
+        {
+            PmrList<TestStruct> list(&arena);
+            PmrVector<TestStruct> vector(&arena);
+            for (size_t i = 0; i < 100; ++i)
+            {
+                list.EmplaceBack((float)i);
+                vector.EmplaceBack((float)i);
+            }
+
+            if (list.Back() != TestStruct(99.0f) || vector.Back() != TestStruct(99.0f)) { return false; }
+        }
+    }
+
+    return true;
+}
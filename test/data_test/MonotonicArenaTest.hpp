@@ -0,0 +1,13 @@
+#pragma once
+
+class MonotonicArenaTest
+{
+public:
+    static bool RunAllTest();
+
+public:
+    static bool Allocate();
+    static bool InitialBuffer();
+    static bool Release();
+    static bool Containers();
+};
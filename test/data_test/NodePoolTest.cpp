@@ -0,0 +1,330 @@
+#include "NodePoolTest.hpp"
+#include "NodePool.hpp"
+#include "Vector.hpp"
+#include "List.hpp"
+#include "../TestStruct.hpp"
+#include "../Serializer.hpp"
+
+#include <iostream> //For std::cout and std::fixed
+#include <string>
+#include <sstream>  //For std::stringstream
+#include <algorithm>  //For std::sort and std::binary_search
+#include <functional>  //For std::less
+#include <thread>  //For std::thread
+#include <cstdint>  //For uintptr_t
+
+static std::stringstream s_FileBuffer;
+
+bool NodePoolTest::RunAllTest()
+{
+    std::stringstream test_results_buffer;
+    bool test_result = true;
+    size_t passed = 5;
+    s_FileBuffer << "NodePool Bug Tests:" << std::endl;
+    s_FileBuffer << "Total test executed: " << passed << std::endl;
+
+    if (!Allocate()) { test_results_buffer << std::endl << "Allocate Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Batches()) { test_results_buffer << std::endl << "Batches Test Failed" << std::endl; test_result = false; --passed; }
+    if (!HighWater()) { test_results_buffer << std::endl << "HighWater Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Containers()) { test_results_buffer << std::endl << "Containers Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Threads()) { test_results_buffer << std::endl << "Threads Test Failed" << std::endl; test_result = false; --passed; }
+
+    s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
+    if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
+    else { s_FileBuffer << test_results_buffer.str(); }
+    s_FileBuffer << std::endl << std::endl;
+    Serializer::SerializeResults("NodePool_Results.txt", s_FileBuffer);
+
+    return test_result;
+}
+
+bool NodePoolTest::Allocate()
+{
+    //Allocate()
+    //Deallocate(void* memory)
+
+    {
+        using Pool = NodePool<40, 8>;
+        Pool::Trim();
+        const size_t upstream = Pool::UpstreamAllocations();
+
+        if (Pool::s_BlockSize < 40 || Pool::s_BlockSize % 8 != 0) { return false; }
+
+        void* block0 = Pool::Allocate();
+        Pool::Deallocate(block0);
+        void* block1 = Pool::Allocate();
+
+        //The last block returned is the first one reused
+        if (block1 != block0 || Pool::UpstreamAllocations() != upstream + 1) { return false; }
+        Pool::Deallocate(block1);
+        Pool::Trim();
+    }
+    {
+        using Pool = NodePool<64, 64>;
+        Vector<void*> blocks;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            blocks.PushBack(Pool::Allocate());
+            if (reinterpret_cast<uintptr_t>(blocks.Back()) % 64 != 0) { return false; }
+        }
+        for (size_t i = 0; i < blocks.Size(); ++i)
+        {
+            Pool::Deallocate(blocks[i]);
+        }
+        Pool::Trim();
+    }
+
+    return true;
+}
+
+bool NodePoolTest::Batches()
+{
+    //Trim(size_t blocks)
+    //GlobalBlocks()
+    //ThreadBlocks()
+
+    {
+        using Pool = NodePool<48, 8>;
+        Pool::Trim();
+        const size_t upstream = Pool::UpstreamAllocations();
+
+        Vector<void*> blocks;
+        for (size_t i = 0; i < 500; ++i)
+        {
+            blocks.PushBack(Pool::Allocate());
+        }
+        if (Pool::UpstreamAllocations() != upstream + 500) { return false; }
+
+        for (size_t i = 0; i < blocks.Size(); ++i)
+        {
+            Pool::Deallocate(blocks[i]);
+        }
+
+        //The full caches of the thread gave batches to the global tier
+        if (Pool::GlobalBlocks() == 0 || Pool::ThreadBlocks() + Pool::GlobalBlocks() != 500) { return false; }
+
+        for (size_t i = 0; i < blocks.Size(); ++i)
+        {
+            blocks[i] = Pool::Allocate();
+        }
+        if (Pool::UpstreamAllocations() != upstream + 500) { return false; }
+
+        for (size_t i = 0; i < blocks.Size(); ++i)
+        {
+            Pool::Deallocate(blocks[i]);
+        }
+
+        Pool::Trim(100);
+        if (Pool::ThreadBlocks() != 0 || Pool::GlobalBlocks() > 100) { return false; }
+
+        Pool::Trim();
+        if (Pool::ThreadBlocks() != 0 || Pool::GlobalBlocks() != 0) { return false; }
+    }
+
+    return true;
+}
+
+bool NodePoolTest::HighWater()
+{
+    //SetHighWater(size_t blocks)
+    //HighWater()
+
+    {
+        using Pool = NodePool<56, 8>;
+        Pool::Trim();
+        const size_t high_water = Pool::HighWater();
+        Pool::SetHighWater(64);
+
+        Vector<void*> blocks;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            blocks.PushBack(Pool::Allocate());
+        }
+        for (size_t i = 0; i < blocks.Size(); ++i)
+        {
+            Pool::Deallocate(blocks[i]);
+        }
+
+        //The batches above the high water mark went back to the system
+        if (Pool::GlobalBlocks() > 64) { return false; }
+
+        const size_t upstream = Pool::UpstreamAllocations();
+        for (size_t i = 0; i < blocks.Size(); ++i)
+        {
+            blocks[i] = Pool::Allocate();
+        }
+        if (Pool::UpstreamAllocations() == upstream) { return false; }
+
+        for (size_t i = 0; i < blocks.Size(); ++i)
+        {
+            Pool::Deallocate(blocks[i]);
+        }
+
+        Pool::SetHighWater(high_water);
+        if (Pool::HighWater() != high_water) { return false; }
+        Pool::Trim();
+    }
+
+    return true;
+}
+
+bool NodePoolTest::Containers()
+{
+    //List<T, NodePoolAllocator<T>>
+
+    {
+        //The nodes of a destroyed list are reused by the next one
+        Vector<const size_t*> addresses;
+        {
+            List<size_t, NodePoolAllocator<size_t>> list;
+            for (size_t i = 0; i < 100; ++i)
+            {
+                list.PushBack(i);
+                addresses.PushBack(&list.Back());
+            }
+        }
+
+        List<size_t, NodePoolAllocator<size_t>> list;
+        list.PushBack(0);
+        bool reused = false;
+        for (size_t i = 0; i < addresses.Size(); ++i)
+        {
+            if (addresses[i] == &list.Back()) { reused = true; }
+        }
+        if (!reused) { return false; }
+    }
+    {
+        //The nodes erased from a list go back to the pool at once, not when the list is shrunk or destroyed
+        List<size_t, NodePoolAllocator<size_t>> list0;
+        Vector<const size_t*> addresses;
+        for (size_t i = 0; i < 10000; ++i)
+        {
+            list0.PushBack(i);
+            addresses.PushBack(&list0.Back());
+        }
+        while (list0.Size() > 10)
+        {
+            list0.PopBack();
+        }
+        if (list0.Capacity() != 10) { return false; }
+
+        std::sort(addresses.Data(), addresses.Data() + addresses.Size(), std::less<const size_t*>());
+        List<size_t, NodePoolAllocator<size_t>> list1;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            list1.PushBack(i);
+            if (!std::binary_search(addresses.Data(), addresses.Data() + addresses.Size(), &list1.Back(), std::less<const size_t*>())) { return false; }
+        }
+
+        list1.Clear();
+        list0.Erase(list0.begin());
+        if (list1.Capacity() != 0 || list0.Capacity() != 9) { return false; }
+    }
+    {
+        List<std::string, NodePoolAllocator<std::string>> list0{ "0", "1", "2" };
+        List<std::string, NodePoolAllocator<std::string>> list1{ "3", "4" };
+
+        list0.Splice(list0.end(), list1);
+        if (list0.Size() != 5 || !list1.IsEmpty()) { return false; }
+
+        list0.PopBack();
+        list0.PopBack();
+        list0.Shrink();
+        if (list0.Size() != 3 || list0.Capacity() != 3) { return false; }
+
+        List<std::string, NodePoolAllocator<std::string>> list2(list0);
+        list1 = std::move(list0);
+        if (list1 != list2 || !list0.IsEmpty()) { return false; }
+    }
+    {
+        List<TestStruct, NodePoolAllocator<TestStruct>> list;
+        for (size_t i = 0; i < 300; ++i)
+        {
+            list.EmplaceBack((float)i);
+        }
+        list.Clear();
+        list.Shrink();
+
+        if (!list.IsEmpty() || list.Capacity() != 0) { return false; }
+    }
+    {
+        //Requests of more than one object go to the system allocator
+        Vector<size_t, DoublingGrowthPolicy, NodePoolAllocator<size_t>> vector;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            vector.PushBack(i);
+        }
+        if (vector.Size() != 100 || vector[99] != 99) { return false; }
+    }
+
+    return true;
+}
+
+bool NodePoolTest::Threads()
+{
+    //Blocks allocated by one thread and released by another
+
+    {
+        constexpr size_t threads = 4;
+        constexpr size_t elements = 2000;
+        bool results[threads] = {};
+        List<size_t, NodePoolAllocator<size_t>> lists[threads];
+
+        //Each thread fills a list, then empties the list filled by the previous thread
+        Vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers.EmplaceBack([&lists, &results, t]()
+            {
+                for (size_t round = 0; round < 10; ++round)
+                {
+                    List<size_t, NodePoolAllocator<size_t>> list;
+                    for (size_t i = 0; i < elements; ++i)
+                    {
+                        list.PushBack(i + t);
+                    }
+
+                    size_t sum = 0;
+                    for (auto it = list.begin(); it != list.end(); ++it)
+                    {
+                        sum += *it;
+                    }
+                    if (sum != elements * (elements - 1) / 2 + elements * t) { return; }
+                }
+
+                for (size_t i = 0; i < elements; ++i)
+                {
+                    lists[t].PushBack(i);
+                }
+                results[t] = true;
+            });
+        }
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers[t].join();
+        }
+        for (size_t t = 0; t < threads; ++t)
+        {
+            if (!results[t] || lists[t].Size() != elements) { return false; }
+        }
+
+        workers.Clear();
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers.EmplaceBack([&lists, t]()
+            {
+                List<size_t, NodePoolAllocator<size_t>> list(std::move(lists[(t + 1) % threads]));
+            });
+        }
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers[t].join();
+        }
+        for (size_t t = 0; t < threads; ++t)
+        {
+            if (!lists[t].IsEmpty()) { return false; }
+        }
+    }
+
+    return true;
+}
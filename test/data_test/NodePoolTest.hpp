@@ -0,0 +1,14 @@
+#pragma once
+
+class NodePoolTest
+{
+public:
+    static bool RunAllTest();
+
+public:
+    static bool Allocate();
+    static bool Batches();
+    static bool HighWater();
+    static bool Containers();
+    static bool Threads();
+};
@@ -0,0 +1,604 @@
+#include "SegmentedVectorTest.hpp"
+#include "SegmentedVector.hpp"
+#include "Vector.hpp"
+#include "../TestStruct.hpp"
+#include "../CountingResource.hpp"
+#include "../Serializer.hpp"
+
+#include <iostream> //For std::cout and std::fixed
+#include <string>
+#include <sstream>  //For std::stringstream
+
+static std::stringstream s_FileBuffer;
+
+bool SegmentedVectorTest::RunAllTest()
+{
+    std::stringstream test_results_buffer;
+    bool test_result = true;
+    size_t passed = 13;
+    s_FileBuffer << "SegmentedVector Bug Tests:" << std::endl;
+    s_FileBuffer << "Total test executed: " << passed << std::endl;
+
+    if (!Iterators()) { test_results_buffer << std::endl << "Iterator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Copy()) { test_results_buffer << std::endl << "Copy Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Move()) { test_results_buffer << std::endl << "Move Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Operators()) { test_results_buffer << std::endl << "Operator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PushBack()) { test_results_buffer << std::endl << "PushBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Emplace()) { test_results_buffer << std::endl << "Emplace Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PopBack()) { test_results_buffer << std::endl << "PopBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Clear()) { test_results_buffer << std::endl << "Clear Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Swap()) { test_results_buffer << std::endl << "Swap Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Append()) { test_results_buffer << std::endl << "Append Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Reserve()) { test_results_buffer << std::endl << "Reserve Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Segments()) { test_results_buffer << std::endl << "Segments Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Allocators()) { test_results_buffer << std::endl << "Allocator Test Failed" << std::endl; test_result = false; --passed; }
+
+    s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
+    if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
+    else { s_FileBuffer << test_results_buffer.str(); }
+    s_FileBuffer << std::endl << std::endl;
+    Serializer::SerializeResults("SegmentedVector_Results.txt", s_FileBuffer);
+
+    return test_result;
+}
+
+bool SegmentedVectorTest::Iterators()
+{
+    //begin()
+    //end()
+    //rbegin()
+    //rend()
+    //operator+=(size_t)
+    //operator-=(size_t)
+
+    {
+        //The iterators cross the borders of the segments of 16, 32 and 64 elements
+        SegmentedVector<size_t> vector;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            vector.PushBack(i);
+        }
+
+        size_t i = 0;
+        for (auto it = vector.begin(); it != vector.end(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+        if (i != 100) { return false; }
+
+        for (auto it = vector.rbegin(); it != vector.rend(); ++it)
+        {
+            if (*it != --i) { return false; }
+        }
+        if (i != 0) { return false; }
+
+        for (auto it = --vector.end(); it != vector.begin(); --it)
+        {
+            if (*it != 99 - i++) { return false; }
+        }
+
+        for (size_t distance = 0; distance <= 100; ++distance)
+        {
+            auto it = vector.begin() + distance;
+            if (distance == 100) { if (it != vector.end()) { return false; } }
+            else if (*it != distance) { return false; }
+
+            if (it - distance != vector.begin()) { return false; }
+            if (vector.end() - (100 - distance) != it) { return false; }
+            if (it.Distance(vector.begin()) != distance) { return false; }
+        }
+        if (vector.begin()[47] != 47 || vector.begin().At(48) != 48) { return false; }
+        if (!(vector.begin() < vector.end()) || vector.begin() >= vector.end()) { return false; }
+
+        const SegmentedVector<size_t>& const_vector = vector;
+        i = 0;
+        for (auto it = const_vector.cbegin(); it != const_vector.cend(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+
+        try
+        {
+            SegmentedVector<size_t>::iterator it;
+            it.Advance(1);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        //The end of a full container is outside the allocated segments
+        SegmentedVector<size_t> vector;
+        for (size_t i = 0; i < 48; ++i)
+        {
+            vector.PushBack(i);
+        }
+        if (vector.Size() != vector.Capacity()) { return false; }
+
+        size_t i = 0;
+        for (auto it = vector.begin(); it != vector.end(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+        if (i != 48 || *--vector.end() != 47) { return false; }
+    }
+    {
+        SegmentedVector<std::string> vector{ "0", "1", "2", "3", "4" };
+
+        size_t i = 0;
+        for (auto& element : vector)
+        {
+            if (element != std::to_string(i++)) { return false; }
+        }
+        if (i != 5) { return false; }
+        if ((vector.begin() + 3)->size() != 1) { return false; }
+    }
+
+    return true;
+}
+
+bool SegmentedVectorTest::Copy()
+{
+    //SegmentedVector(const SegmentedVector& other)
+    //operator=(const SegmentedVector& other)
+
+    {
+        SegmentedVector<size_t> vector0;
+        for (size_t i = 0; i < 40; ++i)
+        {
+            vector0.PushBack(i);
+        }
+        SegmentedVector<size_t> vector1(vector0);
+
+        if (vector1 != vector0) { return false; }
+
+        SegmentedVector<size_t> vector2{ 7, 8 };
+        vector1 = vector2;
+
+        if (vector1 != vector2) { return false; }
+        if (vector0.Size() != 40 || vector0[39] != 39) { return false; }
+    }
+    {
+        SegmentedVector<std::string> vector0{ "0", "1", "2", "3", "4" };
+        SegmentedVector<std::string> vector1(vector0);
+
+        if (vector1 != vector0) { return false; }
+
+        vector0.Front() = "a";
+        if (vector1.Front() != "0") { return false; }
+    }
+    {
+        SegmentedVector<TestStruct> vector0{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f), TestStruct(3.0f) };
+        SegmentedVector<TestStruct> vector1;
+        vector1 = vector0;
+
+        if (vector1 != vector0) { return false; }
+    }
+
+    return true;
+}
+
+bool SegmentedVectorTest::Move()
+{
+    //SegmentedVector(SegmentedVector&& other)
+    //operator=(SegmentedVector&& other)
+
+    {
+        SegmentedVector<size_t> vector0;
+        for (size_t i = 0; i < 40; ++i)
+        {
+            vector0.PushBack(i);
+        }
+        const size_t* first = &vector0.Front();
+        SegmentedVector<size_t> vector1(std::move(vector0));
+
+        //The segments are taken, the elements keep their addresses
+        if (!vector0.IsEmpty() || vector0.Capacity() != 0) { return false; }
+        if (vector1.Size() != 40 || &vector1.Front() != first) { return false; }
+
+        vector0 = std::move(vector1);
+        if (!vector1.IsEmpty() || vector0.Size() != 40 || &vector0.Front() != first) { return false; }
+
+        vector0.PushBack(40);
+        if (vector0.Back() != 40) { return false; }
+    }
+    {
+        SegmentedVector<std::string> vector0{ "0", "1", "2" };
+        SegmentedVector<std::string> vector1{ "3" };
+        vector1 = std::move(vector0);
+
+        if (!vector0.IsEmpty() || vector1.Size() != 3 || vector1[2] != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool SegmentedVectorTest::Operators()
+{
+    //operator==(const SegmentedVector& other)
+    //operator!=(const SegmentedVector& other)
+    //operator[](size_t index)
+    //operator=(std::initializer_list<T>&& list)
+
+    {
+        SegmentedVector<size_t> vector0{ 0, 1, 2, 3 };
+        SegmentedVector<size_t> vector1{ 0, 1, 2, 3 };
+        if (vector0 != vector1) { return false; }
+
+        vector1[3] = 7;
+        if (vector0 == vector1) { return false; }
+
+        vector1 = { 0, 1, 2 };
+        if (vector0 == vector1 || vector1.Size() != 3) { return false; }
+
+        for (size_t i = 0; i < vector1.Size(); ++i)
+        {
+            if (vector1[i] != i || vector1.At(i) != i) { return false; }
+        }
+
+        try
+        {
+            (void)vector1.At(3);
+            return false;
+        }
+        catch (...) {}
+    }
+
+    return true;
+}
+
+bool SegmentedVectorTest::PushBack()
+{
+    //PushBack(const T& element)
+    //PushBack(T&& element)
+
+    {
+        SegmentedVector<size_t> vector;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            vector.PushBack(i);
+        }
+
+        //Segments of 16, 32, 64, 128, 256 and 512 elements
+        if (vector.Size() != 1000 || vector.Segments() != 6 || vector.Capacity() != 1008) { return false; }
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+    }
+    {
+        SegmentedVector<std::string> vector;
+        for (size_t i = 0; i < 50; ++i)
+        {
+            std::string element = std::to_string(i);
+            if (i % 2) { vector.PushBack(element); }
+            else { vector.PushBack(std::move(element)); }
+        }
+
+        for (size_t i = 0; i < 50; ++i)
+        {
+            if (vector[i] != std::to_string(i)) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool SegmentedVectorTest::Emplace()
+{
+    //EmplaceBack(Args&&... args)
+
+    {
+        SegmentedVector<TestStruct> vector;
+        for (size_t i = 0; i < 40; ++i)
+        {
+            TestStruct& element = vector.EmplaceBack((float)i);
+            if (&element != &vector.Back() || element != TestStruct((float)i)) { return false; }
+        }
+    }
+    {
+        SegmentedVector<std::string> vector;
+        vector.EmplaceBack(3, 'a');
+        vector.EmplaceBack("b");
+
+        if (vector.Size() != 2 || vector[0] != "aaa" || vector[1] != "b") { return false; }
+    }
+
+    return true;
+}
+
+bool SegmentedVectorTest::PopBack()
+{
+    //PopBack()
+
+    {
+        SegmentedVector<size_t> vector{ 0, 1, 2, 3, 4 };
+        vector.PopBack();
+        if (vector.Size() != 4 || vector.Back() != 3) { return false; }
+
+        while (!vector.IsEmpty())
+        {
+            vector.PopBack();
+        }
+        //The segments are kept for the next insertions
+        if (vector.begin() != vector.end() || vector.Segments() != 1) { return false; }
+        vector.PopBack();
+    }
+    {
+        SegmentedVector<std::string> vector;
+        for (size_t i = 0; i < 20; ++i)
+        {
+            vector.PushBack(std::to_string(i));
+        }
+        vector.PopBack();
+        vector.PopBack();
+        vector.PopBack();
+        vector.PopBack();
+
+        if (vector.Size() != 16 || vector.Back() != "15" || vector.Segments() != 2) { return false; }
+    }
+
+    return true;
+}
+
+bool SegmentedVectorTest::Clear()
+{
+    //Clear()
+
+    {
+        SegmentedVector<size_t> vector{ 0, 1, 2, 3, 4 };
+        vector.Clear();
+
+        if (!vector.IsEmpty() || vector.begin() != vector.end() || vector.Capacity() != 16) { return false; }
+
+        vector.PushBack(1);
+        if (vector.Size() != 1 || vector.Segments() != 1) { return false; }
+    }
+    {
+        SegmentedVector<std::string> vector{ "0", "1", "2" };
+        vector.Clear();
+        if (!vector.IsEmpty()) { return false; }
+    }
+
+    return true;
+}
+
+bool SegmentedVectorTest::Swap()
+{
+    //Swap(SegmentedVector& other)
+
+    {
+        SegmentedVector<size_t> vector0;
+        for (size_t i = 0; i < 30; ++i)
+        {
+            vector0.PushBack(i);
+        }
+        SegmentedVector<size_t> vector1{ 5 };
+        const size_t* last = &vector0.Back();
+        vector0.Swap(vector1);
+
+        if (vector0.Size() != 1 || vector0.Front() != 5) { return false; }
+        if (vector1.Size() != 30 || &vector1.Back() != last) { return false; }
+
+        SegmentedVector<size_t> vector2;
+        vector2.Swap(vector1);
+        if (!vector1.IsEmpty() || vector1.begin() != vector1.end() || vector2.Size() != 30) { return false; }
+
+        size_t i = 0;
+        for (auto it = vector2.begin(); it != vector2.end(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+    }
+    {
+        SegmentedVector<std::string> vector0{ "0", "1", "2" };
+        SegmentedVector<std::string> vector1{ "a" };
+        vector0.Swap(vector1);
+
+        if (vector0.Size() != 1 || vector1.Size() != 3 || vector1.Back() != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool SegmentedVectorTest::Append()
+{
+    //Append(const SegmentedVector& other)
+    //Append(SegmentedVector&& other)
+
+    {
+        SegmentedVector<size_t> vector0{ 0, 1, 2 };
+        SegmentedVector<size_t> vector1{ 3, 4, 5, 6, 7 };
+
+        vector0.Append(vector1);
+        if (vector0.Size() != 8 || vector1.Size() != 5) { return false; }
+
+        SegmentedVector<size_t> vector2{ 8, 9 };
+        vector0.Append(std::move(vector2));
+        if (vector0.Size() != 10 || !vector2.IsEmpty()) { return false; }
+
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (vector0[i] != i) { return false; }
+        }
+
+        SegmentedVector<size_t> vector3;
+        vector3.Append(std::move(vector0));
+        if (vector3.Size() != 10 || !vector0.IsEmpty() || vector3.Back() != 9) { return false; }
+
+        //Appending a vector to itself doubles it, the source segments are not moved by the growth
+        vector3.Append(vector3);
+        vector3.Append(vector3);
+        if (vector3.Size() != 40 || vector3[10] != 0 || vector3[39] != 9) { return false; }
+    }
+    {
+        SegmentedVector<std::string> vector0{ "0" };
+        SegmentedVector<std::string> vector1{ "1", "2" };
+        vector0.Append(std::move(vector1));
+
+        if (vector0.Size() != 3 || vector0[2] != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool SegmentedVectorTest::Reserve()
+{
+    //Reserve(size_t capacity)
+    //Shrink()
+
+    {
+        SegmentedVector<size_t> vector;
+        vector.Reserve(100);
+        if (vector.Capacity() != 112 || vector.Segments() != 3 || !vector.IsEmpty()) { return false; }
+
+        for (size_t i = 0; i < 100; ++i)
+        {
+            vector.PushBack(i);
+        }
+        if (vector.Segments() != 3) { return false; }
+
+        for (size_t i = 0; i < 90; ++i)
+        {
+            vector.PopBack();
+        }
+        vector.Shrink();
+        if (vector.Size() != 10 || vector.Segments() != 1 || vector.Capacity() != 16) { return false; }
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+
+        vector.Clear();
+        vector.Shrink();
+        if (vector.Segments() != 0 || vector.Capacity() != 0) { return false; }
+
+        vector.PushBack(1);
+        if (vector.Size() != 1 || vector.Front() != 1) { return false; }
+
+        try
+        {
+            vector.Reserve(100000000);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        SegmentedVector<std::string> vector(20);
+        if (vector.Capacity() != 48 || !vector.IsEmpty()) { return false; }
+    }
+
+    return true;
+}
+
+bool SegmentedVectorTest::Segments()
+{
+    //ForEachSegment(Function function)
+    //ForEach(Function function)
+
+    {
+        //Growing never moves the elements
+        SegmentedVector<std::string> vector;
+        Vector<const std::string*> addresses;
+        for (size_t i = 0; i < 2000; ++i)
+        {
+            vector.PushBack(std::to_string(i));
+            addresses.PushBack(&vector.Back());
+        }
+        for (size_t i = 0; i < 2000; ++i)
+        {
+            if (&vector[i] != addresses[i] || vector[i] != std::to_string(i)) { return false; }
+        }
+    }
+    {
+        SegmentedVector<size_t> vector;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            vector.PushBack(i);
+        }
+
+        //Runs of 16, 32 and 52 contiguous elements
+        Vector<size_t> runs;
+        size_t expected = 0;
+        bool contiguous = true;
+        vector.ForEachSegment([&](size_t* data, size_t count)
+        {
+            runs.PushBack(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (data[i] != expected || &data[i] != &vector[expected]) { contiguous = false; }
+                ++expected;
+            }
+        });
+        if (!contiguous || expected != 100) { return false; }
+        if (runs.Size() != 3 || runs[0] != 16 || runs[1] != 32 || runs[2] != 52) { return false; }
+
+        size_t sum = 0;
+        const SegmentedVector<size_t>& const_vector = vector;
+        const_vector.ForEach([&sum](const size_t& element) { sum += element; });
+        if (sum != 4950) { return false; }
+
+        vector.ForEach([](size_t& element) { element *= 2; });
+        if (vector[99] != 198) { return false; }
+    }
+    {
+        SegmentedVector<size_t> vector;
+        size_t calls = 0;
+        vector.ForEachSegment([&calls](size_t*, size_t) { ++calls; });
+        if (calls != 0) { return false; }
+    }
+
+    return true;
+}
+
+bool SegmentedVectorTest::Allocators()
+{
+    //SegmentedVector(const Allocator& allocator)
+    //GetAllocator()
+
+    if (!IsMoveAssignmentNoexceptOnlyWithEqualAllocators<SegmentedVector<size_t>, PmrSegmentedVector<size_t>>()) { return false; }
+
+    {
+        CountingResource resource;
+        {
+            PmrSegmentedVector<size_t> vector(&resource);
+            for (size_t i = 0; i < 100; ++i)
+            {
+                vector.PushBack(i);
+            }
+
+            //One allocation per segment and no table
+            if (resource.Allocations() != 3) { return false; }
+
+            PmrSegmentedVector<size_t> moved(std::move(vector));
+            if (moved.GetAllocator().resource() != &resource) { return false; }
+            if (moved.Size() != 100 || resource.Allocations() != 3) { return false; }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+    }
+    {
+        CountingResource resource0;
+        CountingResource resource1;
+        {
+            PmrSegmentedVector<std::string> vector0(&resource0);
+            PmrSegmentedVector<std::string> vector1(&resource1);
+            for (size_t i = 0; i < 5; ++i)
+            {
+                vector0.PushBack(std::to_string(i));
+            }
+
+            //The segments can not be taken from other resource, the elements are moved
+            vector1 = std::move(vector0);
+
+            if (!vector0.IsEmpty() || vector1.Size() != 5) { return false; }
+            if (resource1.BytesInUse() == 0) { return false; }
+
+            vector0.Append(std::move(vector1));
+            if (vector0.Size() != 5 || !vector1.IsEmpty()) { return false; }
+        }
+
+        if (resource0.BytesInUse() != 0 || resource1.BytesInUse() != 0) { return false; }
+    }
+
+    return true;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+class SegmentedVectorTest
+{
+public:
+    static bool RunAllTest();
+
+public:
+    static bool Iterators();
+    static bool Copy();
+    static bool Move();
+    static bool Operators();
+    static bool PushBack();
+    static bool Emplace();
+    static bool PopBack();
+    static bool Clear();
+    static bool Swap();
+    static bool Append();
+    static bool Reserve();
+    static bool Segments();
+    static bool Allocators();
+};
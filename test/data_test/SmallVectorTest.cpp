@@ -0,0 +1,718 @@
+#include "SmallVectorTest.hpp"
+#include "SmallVector.hpp"
+#include "../TestStruct.hpp"
+#include "../CountingResource.hpp"
+#include "../Serializer.hpp"
+
+#include <iostream> //For std::cout and std::fixed
+#include <string>
+#include <sstream>  //For std::stringstream
+
+static std::stringstream s_FileBuffer;
+
+bool SmallVectorTest::RunAllTest()
+{
+    std::stringstream test_results_buffer;
+    bool test_result = true;
+    size_t passed = 15;
+    s_FileBuffer << "SmallVector Bug Tests:" << std::endl;
+    s_FileBuffer << "Total test executed: " << passed << std::endl;
+
+    if (!Iterators()) { test_results_buffer << std::endl << "Iterator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Copy()) { test_results_buffer << std::endl << "Copy Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Move()) { test_results_buffer << std::endl << "Move Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Operators()) { test_results_buffer << std::endl << "Operator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Reserve()) { test_results_buffer << std::endl << "Reserve Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Shrink()) { test_results_buffer << std::endl << "Shrink Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PushBack()) { test_results_buffer << std::endl << "PushBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Insert()) { test_results_buffer << std::endl << "Insert Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Emplace()) { test_results_buffer << std::endl << "Emplace Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PopBack()) { test_results_buffer << std::endl << "PopBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Erase()) { test_results_buffer << std::endl << "Erase Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Clear()) { test_results_buffer << std::endl << "Clear Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Swap()) { test_results_buffer << std::endl << "Swap Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Spill()) { test_results_buffer << std::endl << "Spill Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Allocators()) { test_results_buffer << std::endl << "Allocator Test Failed" << std::endl; test_result = false; --passed; }
+
+    s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
+    if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
+    else { s_FileBuffer << test_results_buffer.str(); }
+    s_FileBuffer << std::endl << std::endl;
+    Serializer::SerializeResults("SmallVector_Results.txt", s_FileBuffer);
+
+    return test_result;
+}
+
+bool SmallVectorTest::Iterators()
+{
+    //begin()
+    //end()
+    //rbegin()
+    //rend()
+
+    {
+        SmallVector<size_t, 4> vector{ 0, 1, 2 };
+
+        size_t i = 0;
+        for (auto it = vector.begin(); it != vector.end(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+        if (i != 3) { return false; }
+
+        for (auto it = vector.rbegin(); it != vector.rend(); ++it)
+        {
+            if (*it != --i) { return false; }
+        }
+        if (i != 0) { return false; }
+
+        const SmallVector<size_t, 4>& const_vector = vector;
+        for (auto it = const_vector.cbegin(); it != const_vector.cend(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+    }
+    {
+        SmallVector<std::string, 2> vector{ "0", "1", "2", "3" };
+
+        size_t i = 0;
+        for (auto& element : vector)
+        {
+            if (element != std::to_string(i++)) { return false; }
+        }
+        if (i != 4) { return false; }
+    }
+    {
+        SmallVector<TestStruct, 2> vector{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+
+        size_t i = 0;
+        for (auto& element : vector)
+        {
+            if (element != TestStruct((float)i++)) { return false; }
+        }
+        if (i != 3) { return false; }
+    }
+
+    return true;
+}
+
+bool SmallVectorTest::Copy()
+{
+    //SmallVector(const SmallVector& other)
+    //operator=(const SmallVector& other)
+
+    {
+        SmallVector<size_t, 4> vector0{ 0, 1, 2 };
+        SmallVector<size_t, 4> vector1(vector0);
+
+        if (!vector1.IsInline()) { return false; }
+        if (vector1 != vector0) { return false; }
+
+        SmallVector<size_t, 4> vector2{ 5, 6, 7, 8, 9, 10 };
+        vector1 = vector2;
+
+        if (vector1.IsInline()) { return false; }
+        if (vector1 != vector2) { return false; }
+
+        vector2 = vector0;
+        if (vector2 != vector0) { return false; }
+    }
+    {
+        SmallVector<std::string, 4> vector0{ "0", "1", "2", "3", "4" };
+        SmallVector<std::string, 4> vector1(vector0);
+
+        if (vector1 != vector0) { return false; }
+
+        SmallVector<std::string, 4> vector2{ "5", "6" };
+        vector1 = vector2;
+
+        if (vector1 != vector2) { return false; }
+        if (vector0.Size() != 5 || vector0[4] != "4") { return false; }
+    }
+    {
+        SmallVector<TestStruct, 4> vector0{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f), TestStruct(3.0f), TestStruct(4.0f) };
+        SmallVector<TestStruct, 4> vector1(vector0);
+
+        if (vector1 != vector0) { return false; }
+
+        SmallVector<TestStruct, 4> vector2{ TestStruct(5.0f) };
+        vector1 = vector2;
+
+        if (vector1 != vector2) { return false; }
+    }
+
+    return true;
+}
+
+bool SmallVectorTest::Move()
+{
+    //SmallVector(SmallVector&& other)
+    //operator=(SmallVector&& other)
+
+    {
+        SmallVector<size_t, 4> vector0{ 0, 1, 2 };
+        SmallVector<size_t, 4> vector1(std::move(vector0));
+
+        if (!vector0.IsEmpty()) { return false; }
+        if (!vector1.IsInline() || vector1.Size() != 3) { return false; }
+        for (size_t i = 0; i < vector1.Size(); ++i)
+        {
+            if (vector1[i] != i) { return false; }
+        }
+
+        SmallVector<size_t, 4> vector2{ 0, 1, 2, 3, 4, 5 };
+        const size_t* data = vector2.Data();
+        vector1 = std::move(vector2);
+
+        if (vector1.Data() != data) { return false; }
+        if (!vector2.IsEmpty() || !vector2.IsInline()) { return false; }
+        if (vector2.Capacity() != 4) { return false; }
+        for (size_t i = 0; i < vector1.Size(); ++i)
+        {
+            if (vector1[i] != i) { return false; }
+        }
+    }
+    {
+        SmallVector<std::string, 4> vector0{ "0", "1", "2" };
+        SmallVector<std::string, 4> vector1(std::move(vector0));
+
+        if (!vector0.IsEmpty()) { return false; }
+        for (size_t i = 0; i < vector1.Size(); ++i)
+        {
+            if (vector1[i] != std::to_string(i)) { return false; }
+        }
+
+        SmallVector<std::string, 4> vector2{ "0", "1", "2", "3", "4" };
+        vector1 = std::move(vector2);
+
+        if (!vector2.IsEmpty()) { return false; }
+        if (vector1.Size() != 5) { return false; }
+        for (size_t i = 0; i < vector1.Size(); ++i)
+        {
+            if (vector1[i] != std::to_string(i)) { return false; }
+        }
+    }
+    {
+        SmallVector<TestStruct, 4> vector0{ TestStruct(0.0f), TestStruct(1.0f) };
+        SmallVector<TestStruct, 4> vector1(std::move(vector0));
+
+        if (!vector0.IsEmpty()) { return false; }
+        if (vector1[1] != TestStruct(1.0f)) { return false; }
+
+        vector0 = std::move(vector1);
+        if (!vector1.IsEmpty()) { return false; }
+        if (vector0.Size() != 2 || vector0[0] != TestStruct(0.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool SmallVectorTest::Operators()
+{
+    //operator==(const SmallVector& other)
+    //operator!=(const SmallVector& other)
+    //operator[](size_t index)
+    //At(size_t index)
+
+    {
+        SmallVector<size_t, 4> vector0{ 0, 1, 2 };
+        SmallVector<size_t, 4> vector1{ 0, 1, 2 };
+        SmallVector<size_t, 4> vector2{ 0, 1, 3 };
+
+        if (vector0 != vector1) { return false; }
+        if (vector0 == vector2) { return false; }
+        if (vector0[2] != 2 || vector0.At(1) != 1) { return false; }
+        if (vector0.Front() != 0 || vector0.Back() != 2) { return false; }
+
+        bool thrown = false;
+        try { (void)vector0.At(3); }
+        catch (...) { thrown = true; }
+        if (!thrown) { return false; }
+    }
+    {
+        SmallVector<std::string, 2> vector0{ "0", "1", "2" };
+        SmallVector<std::string, 2> vector1{ "0", "1" };
+
+        if (vector0 == vector1) { return false; }
+        vector1.PushBack("2");
+        if (vector0 != vector1) { return false; }
+    }
+    {
+        SmallVector<TestStruct, 2> vector0{ TestStruct(0.0f) };
+        SmallVector<TestStruct, 2> vector1{ TestStruct(0.0f) };
+
+        if (vector0 != vector1) { return false; }
+        vector1[0] = TestStruct(1.0f);
+        if (vector0 == vector1) { return false; }
+    }
+
+    return true;
+}
+
+bool SmallVectorTest::Reserve()
+{
+    //Reserve(size_t capacity)
+
+    {
+        SmallVector<size_t, 4> vector;
+
+        if (vector.Capacity() != 4 || !vector.IsInline()) { return false; }
+
+        vector.Reserve(2);
+        if (vector.Capacity() != 4 || !vector.IsInline()) { return false; }
+
+        vector.PushBack(7);
+        vector.Reserve(20);
+        if (vector.Capacity() != 20 || vector.IsInline()) { return false; }
+        if (vector.Size() != 1 || vector[0] != 7) { return false; }
+    }
+    {
+        SmallVector<std::string, 4> vector{ "0", "1", "2" };
+        vector.Reserve(10);
+
+        if (vector.Capacity() != 10) { return false; }
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != std::to_string(i)) { return false; }
+        }
+    }
+    {
+        SmallVector<TestStruct, 4> vector(16);
+
+        if (vector.Capacity() != 16 || !vector.IsEmpty()) { return false; }
+    }
+
+    return true;
+}
+
+bool SmallVectorTest::Shrink()
+{
+    //Shrink()
+
+    {
+        SmallVector<size_t, 4> vector{ 0, 1, 2, 3, 4, 5 };
+        vector.Reserve(32);
+        vector.Shrink();
+
+        if (vector.Capacity() != 6 || vector.IsInline()) { return false; }
+
+        vector.PopBack();
+        vector.PopBack();
+        vector.PopBack();
+        vector.Shrink();
+
+        if (!vector.IsInline() || vector.Capacity() != 4) { return false; }
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+    }
+    {
+        SmallVector<std::string, 4> vector{ "0", "1", "2", "3", "4" };
+        vector.PopBack();
+        vector.Shrink();
+
+        if (!vector.IsInline()) { return false; }
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != std::to_string(i)) { return false; }
+        }
+    }
+    {
+        SmallVector<TestStruct, 2> vector{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+        vector.Clear();
+        vector.Shrink();
+
+        if (!vector.IsInline() || !vector.IsEmpty()) { return false; }
+    }
+
+    return true;
+}
+
+bool SmallVectorTest::PushBack()
+{
+    //PushBack(const T& element)
+    //PushBack(T&& element)
+    //EmplaceBack(Args&&... args)
+
+    {
+        SmallVector<size_t, 4> vector;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            vector.PushBack(i);
+        }
+
+        if (vector.Size() != 100) { return false; }
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+    }
+    {
+        SmallVector<std::string, 4> vector;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            vector.EmplaceBack(std::to_string(i));
+        }
+
+        //The element is inside the full container and must survive the reallocation
+        vector.PushBack(vector[0]);
+        vector.PushBack(std::move(vector[1]));
+
+        if (vector.Size() != 6) { return false; }
+        if (vector[4] != "0" || vector[5] != "1") { return false; }
+    }
+    {
+        SmallVector<TestStruct, 4> vector;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            TestStruct aux((float)i);
+            vector.PushBack(aux);
+        }
+
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != TestStruct((float)i)) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool SmallVectorTest::Insert()
+{
+    //Insert(size_t index, const T& element)
+    //Insert(iterator it, const T& element)
+    //Insert(size_t index, T&& element)
+
+    {
+        SmallVector<size_t, 4> vector{ 1, 3 };
+        vector.Insert(0, 0);
+        vector.Insert(vector.begin() + 2, 2);
+        vector.Insert(10, 4);
+        vector.Insert(vector.end(), 5);
+
+        if (vector.Size() != 6) { return false; }
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+    }
+    {
+        SmallVector<std::string, 4> vector{ "1", "2", "3", "4" };
+        vector.Insert((size_t)0, vector[3]);
+        std::string aux = "0";
+        vector.Insert((size_t)1, std::move(aux));
+
+        if (vector.Size() != 6) { return false; }
+        if (vector[0] != "4" || vector[1] != "0" || vector[5] != "4") { return false; }
+    }
+    {
+        SmallVector<TestStruct, 2> vector{ TestStruct(0.0f), TestStruct(2.0f) };
+        auto it = vector.Insert(1, TestStruct(1.0f));
+
+        if (*it != TestStruct(1.0f)) { return false; }
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != TestStruct((float)i)) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool SmallVectorTest::Emplace()
+{
+    //Emplace(size_t index, Args&&... args)
+    //Emplace(iterator it, Args&&... args)
+
+    {
+        SmallVector<size_t, 2> vector;
+        vector.Emplace(0, (size_t)2);
+        vector.Emplace(0, (size_t)0);
+        vector.Emplace(vector.begin() + 1, (size_t)1);
+
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+    }
+    {
+        SmallVector<std::string, 2> vector{ "0", "2" };
+        auto it = vector.Emplace(1, 1, '1');
+
+        if (*it != "1") { return false; }
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != std::to_string(i)) { return false; }
+        }
+    }
+    {
+        SmallVector<TestStruct, 2> vector{ TestStruct(0.0f), TestStruct(2.0f) };
+        vector.Emplace(1, 1.0f, 1.0f, 1.0f);
+
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != TestStruct((float)i)) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool SmallVectorTest::PopBack()
+{
+    //PopBack()
+
+    {
+        SmallVector<size_t, 4> vector{ 0, 1, 2, 3, 4 };
+        const size_t capacity = vector.Capacity();
+        while (!vector.IsEmpty())
+        {
+            vector.PopBack();
+        }
+        vector.PopBack();
+
+        if (vector.Capacity() != capacity) { return false; }
+    }
+    {
+        SmallVector<std::string, 4> vector{ "0", "1", "2" };
+        vector.PopBack();
+
+        if (vector.Size() != 2 || vector.Back() != "1") { return false; }
+    }
+    {
+        SmallVector<TestStruct, 4> vector{ TestStruct(0.0f), TestStruct(1.0f) };
+        vector.PopBack();
+
+        if (vector.Size() != 1 || vector.Back() != TestStruct(0.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool SmallVectorTest::Erase()
+{
+    //Erase(size_t index)
+    //Erase(iterator it)
+
+    {
+        SmallVector<size_t, 4> vector{ 0, 1, 2, 3, 4, 5 };
+        auto it = vector.Erase(1);
+
+        if (*it != 2) { return false; }
+        vector.Erase(vector.begin());
+        vector.Erase(10);
+
+        if (vector.Size() != 4) { return false; }
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != i + 2) { return false; }
+        }
+    }
+    {
+        SmallVector<std::string, 4> vector{ "0", "1", "2" };
+        vector.Erase(vector.end() - 1);
+        vector.Erase((size_t)0);
+
+        if (vector.Size() != 1 || vector[0] != "1") { return false; }
+    }
+    {
+        SmallVector<TestStruct, 4> vector{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+        vector.Erase(1);
+
+        if (vector[0] != TestStruct(0.0f) || vector[1] != TestStruct(2.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool SmallVectorTest::Clear()
+{
+    //Clear()
+
+    {
+        SmallVector<size_t, 4> vector{ 0, 1, 2, 3, 4 };
+        const size_t capacity = vector.Capacity();
+        vector.Clear();
+
+        if (!vector.IsEmpty() || vector.Capacity() != capacity) { return false; }
+    }
+    {
+        SmallVector<std::string, 4> vector{ "0", "1" };
+        vector.Clear();
+
+        if (!vector.IsEmpty() || !vector.IsInline()) { return false; }
+        vector.PushBack("2");
+        if (vector[0] != "2") { return false; }
+    }
+    {
+        SmallVector<TestStruct, 4> vector{ TestStruct(0.0f) };
+        vector.Clear();
+
+        if (!vector.IsEmpty()) { return false; }
+    }
+
+    return true;
+}
+
+bool SmallVectorTest::Swap()
+{
+    //Swap(SmallVector& other)
+
+    {
+        SmallVector<size_t, 4> vector0{ 0, 1, 2 };
+        SmallVector<size_t, 4> vector1{ 9, 8, 7, 6, 5 };
+        vector0.Swap(vector1);
+
+        if (vector0.Size() != 5 || vector1.Size() != 3) { return false; }
+        if (vector0[0] != 9 || vector1[2] != 2) { return false; }
+        if (!vector1.IsInline()) { return false; }
+    }
+    {
+        SmallVector<std::string, 2> vector0{ "0", "1", "2" };
+        SmallVector<std::string, 2> vector1{ "3", "4", "5", "6" };
+        const std::string* data0 = vector0.Data();
+        vector0.Swap(vector1);
+
+        if (vector1.Data() != data0) { return false; }
+        if (vector0[3] != "6" || vector1[2] != "2") { return false; }
+    }
+    {
+        SmallVector<TestStruct, 4> vector0{ TestStruct(0.0f) };
+        SmallVector<TestStruct, 4> vector1{ TestStruct(1.0f), TestStruct(2.0f) };
+        vector0.Swap(vector1);
+
+        if (vector0.Size() != 2 || vector1.Size() != 1) { return false; }
+        if (vector0[1] != TestStruct(2.0f) || vector1[0] != TestStruct(0.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool SmallVectorTest::Spill()
+{
+    //The elements are stored inline until the capacity is exceeded
+
+    {
+        SmallVector<size_t, 8> vector;
+        const size_t* inline_data = vector.Data();
+        for (size_t i = 0; i < 8; ++i)
+        {
+            vector.PushBack(i);
+            if (vector.Data() != inline_data) { return false; }
+        }
+
+        vector.PushBack(8);
+        if (vector.IsInline() || vector.Data() == inline_data) { return false; }
+        if (vector.Capacity() != 16) { return false; }
+
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+    }
+    {
+        SmallVector<std::string, 1> vector;
+        for (size_t i = 0; i < 50; ++i)
+        {
+            vector.PushBack(std::to_string(i));
+        }
+
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != std::to_string(i)) { return false; }
+        }
+    }
+    {
+        SmallVector<TestStruct, 16, OneAndHalfGrowthPolicy> vector;
+        for (size_t i = 0; i < 17; ++i)
+        {
+            vector.EmplaceBack((float)i);
+        }
+
+        if (vector.Capacity() != 24) { return false; }
+        for (size_t i = 0; i < vector.Size(); ++i)
+        {
+            if (vector[i] != TestStruct((float)i)) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool SmallVectorTest::Allocators()
+{
+    //SmallVector(const Allocator& allocator)
+    //GetAllocator()
+
+    if (!IsMoveAssignmentNoexceptOnlyWithEqualAllocators<SmallVector<size_t, 4>, PmrSmallVector<size_t, 4>>()) { return false; }
+
+    {
+        CountingResource resource;
+        {
+            PmrSmallVector<size_t, 4> vector(&resource);
+            for (size_t i = 0; i < 4; ++i)
+            {
+                vector.PushBack(i);
+            }
+
+            //The inline elements never use the allocator
+            if (resource.Allocations() != 0) { return false; }
+
+            vector.PushBack(4);
+            if (resource.Allocations() != 1) { return false; }
+            if (resource.BytesInUse() != vector.Capacity() * sizeof(size_t)) { return false; }
+
+            PmrSmallVector<size_t, 4> moved(std::move(vector));
+            if (moved.GetAllocator().resource() != &resource) { return false; }
+            if (moved.Size() != 5 || moved[4] != 4) { return false; }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+    }
+    {
+        CountingResource resource0;
+        CountingResource resource1;
+        {
+            PmrSmallVector<std::string, 2> vector0(&resource0);
+            PmrSmallVector<std::string, 2> vector1(&resource1);
+            for (size_t i = 0; i < 5; ++i)
+            {
+                vector0.PushBack(std::to_string(i));
+            }
+
+            vector1 = std::move(vector0);
+
+            if (!vector0.IsEmpty() || vector1.Size() != 5) { return false; }
+            if (resource0.BytesInUse() != 0 || resource1.BytesInUse() == 0) { return false; }
+            for (size_t i = 0; i < vector1.Size(); ++i)
+            {
+                if (vector1[i] != std::to_string(i)) { return false; }
+            }
+
+            vector0.PushBack("a");
+            vector0.Swap(vector1);
+
+            if (vector0.Size() != 5 || vector1.Size() != 1 || vector1[0] != "a") { return false; }
+        }
+
+        if (resource0.BytesInUse() != 0 || resource1.BytesInUse() != 0) { return false; }
+    }
+    {
+        //The default allocator does not increase the size of the container
+        if (sizeof(SmallVector<TestStruct, 2>) != 2 * sizeof(size_t) + sizeof(TestStruct*) + 2 * sizeof(TestStruct)) { return false; }
+
+        CountingResource resource;
+        {
+            PmrSmallVector<TestStruct, 2> vector({ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) }, &resource);
+            vector.PopBack();
+            vector.Shrink();
+
+            if (!vector.IsInline() || resource.BytesInUse() != 0) { return false; }
+            if (vector[1] != TestStruct(1.0f)) { return false; }
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+class SmallVectorTest
+{
+public:
+    static bool RunAllTest();
+
+public:
+    static bool Iterators();
+    static bool Copy();
+    static bool Move();
+    static bool Operators();
+    static bool Reserve();
+    static bool Shrink();
+    static bool PushBack();
+    static bool Insert();
+    static bool Emplace();
+    static bool PopBack();
+    static bool Erase();
+    static bool Clear();
+    static bool Swap();
+    static bool Spill();
+    static bool Allocators();
+};
@@ -0,0 +1,865 @@
+#include "TieredVectorTest.hpp"
+#include "TieredVector.hpp"
+#include "Vector.hpp"
+#include "../TestStruct.hpp"
+#include "../CountingResource.hpp"
+#include "../Serializer.hpp"
+
+#include <iostream> //For std::cout and std::fixed
+#include <string>
+#include <sstream>  //For std::stringstream
+
+static std::stringstream s_FileBuffer;
+
+bool TieredVectorTest::RunAllTest()
+{
+    std::stringstream test_results_buffer;
+    bool test_result = true;
+    size_t passed = 17;
+    s_FileBuffer << "TieredVector Bug Tests:" << std::endl;
+    s_FileBuffer << "Total test executed: " << passed << std::endl;
+
+    if (!Iterators()) { test_results_buffer << std::endl << "Iterator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Copy()) { test_results_buffer << std::endl << "Copy Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Move()) { test_results_buffer << std::endl << "Move Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Operators()) { test_results_buffer << std::endl << "Operator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PushBack()) { test_results_buffer << std::endl << "PushBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PushFront()) { test_results_buffer << std::endl << "PushFront Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Insert()) { test_results_buffer << std::endl << "Insert Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Emplace()) { test_results_buffer << std::endl << "Emplace Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PopBack()) { test_results_buffer << std::endl << "PopBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PopFront()) { test_results_buffer << std::endl << "PopFront Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Erase()) { test_results_buffer << std::endl << "Erase Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Clear()) { test_results_buffer << std::endl << "Clear Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Swap()) { test_results_buffer << std::endl << "Swap Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Append()) { test_results_buffer << std::endl << "Append Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Reserve()) { test_results_buffer << std::endl << "Reserve Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Tiers()) { test_results_buffer << std::endl << "Tiers Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Allocators()) { test_results_buffer << std::endl << "Allocator Test Failed" << std::endl; test_result = false; --passed; }
+
+    s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
+    if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
+    else { s_FileBuffer << test_results_buffer.str(); }
+    s_FileBuffer << std::endl << std::endl;
+    Serializer::SerializeResults("TieredVector_Results.txt", s_FileBuffer);
+
+    return test_result;
+}
+
+bool TieredVectorTest::Iterators()
+{
+    //begin()
+    //end()
+    //rbegin()
+    //rend()
+    //operator+=(size_t)
+    //operator-=(size_t)
+
+    {
+        //Pushing at the front rotates every tier, the iterators cross tiers and the end of the circular arrays
+        TieredVector<size_t> vector;
+        for (size_t i = 0; i < 50; ++i)
+        {
+            vector.PushFront(49 - i);
+        }
+
+        size_t i = 0;
+        for (auto it = vector.begin(); it != vector.end(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+        if (i != 50) { return false; }
+
+        for (auto it = vector.rbegin(); it != vector.rend(); ++it)
+        {
+            if (*it != --i) { return false; }
+        }
+        if (i != 0) { return false; }
+
+        for (auto it = --vector.end(); it != vector.begin(); --it)
+        {
+            if (*it != 49 - i++) { return false; }
+        }
+
+        for (size_t distance = 0; distance <= 50; ++distance)
+        {
+            auto it = vector.begin() + distance;
+            if (distance == 50) { if (it != vector.end()) { return false; } }
+            else if (*it != distance) { return false; }
+
+            if (it - distance != vector.begin()) { return false; }
+            if (vector.end() - (50 - distance) != it) { return false; }
+            if (it.Distance(vector.begin()) != distance) { return false; }
+        }
+        if (vector.begin()[37] != 37 || vector.begin().At(3) != 3) { return false; }
+        if (!(vector.begin() < vector.end()) || vector.begin() >= vector.end()) { return false; }
+
+        const TieredVector<size_t>& const_vector = vector;
+        i = 0;
+        for (auto it = const_vector.cbegin(); it != const_vector.cend(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+
+        try
+        {
+            TieredVector<size_t>::iterator it;
+            it.Advance(1);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        TieredVector<std::string> vector{ "0", "1", "2", "3", "4" };
+
+        size_t i = 0;
+        for (auto& element : vector)
+        {
+            if (element != std::to_string(i++)) { return false; }
+        }
+        if (i != 5) { return false; }
+        if ((vector.begin() + 3)->size() != 1) { return false; }
+    }
+    {
+        TieredVector<TestStruct> vector{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+
+        size_t i = 0;
+        for (auto& element : vector)
+        {
+            if (element != TestStruct((float)i++)) { return false; }
+        }
+        if (i != 3) { return false; }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::Copy()
+{
+    //TieredVector(const TieredVector& other)
+    //operator=(const TieredVector& other)
+
+    {
+        TieredVector<size_t> vector0{ 0, 1, 2, 3, 4, 5 };
+        TieredVector<size_t> vector1(vector0);
+
+        if (vector1 != vector0) { return false; }
+
+        TieredVector<size_t> vector2{ 7, 8 };
+        vector1 = vector2;
+
+        if (vector1 != vector2) { return false; }
+        if (vector0.Size() != 6 || vector0[5] != 5) { return false; }
+    }
+    {
+        TieredVector<std::string> vector0{ "0", "1", "2", "3", "4" };
+        TieredVector<std::string> vector1(vector0);
+
+        if (vector1 != vector0) { return false; }
+
+        vector0.Front() = "a";
+        if (vector1.Front() != "0") { return false; }
+    }
+    {
+        TieredVector<TestStruct> vector0{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f), TestStruct(3.0f), TestStruct(4.0f) };
+        TieredVector<TestStruct> vector1;
+        vector1 = vector0;
+
+        if (vector1 != vector0) { return false; }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::Move()
+{
+    //TieredVector(TieredVector&& other)
+    //operator=(TieredVector&& other)
+
+    {
+        TieredVector<size_t> vector0{ 0, 1, 2, 3, 4, 5 };
+        TieredVector<size_t> vector1(std::move(vector0));
+
+        if (!vector0.IsEmpty() || vector0.begin() != vector0.end()) { return false; }
+        if (vector1.Size() != 6 || vector1.Back() != 5) { return false; }
+
+        vector0 = std::move(vector1);
+        if (!vector1.IsEmpty() || vector0.Size() != 6) { return false; }
+
+        //Moved from containers remain usable
+        vector1.PushBack(10);
+        if (vector1.Size() != 1 || vector1.Front() != 10) { return false; }
+    }
+    {
+        TieredVector<std::string> vector0{ "0", "1", "2", "3", "4" };
+        TieredVector<std::string> vector1{ "a" };
+        vector1 = std::move(vector0);
+
+        if (!vector0.IsEmpty() || vector1.Size() != 5) { return false; }
+        size_t i = 0;
+        for (auto& element : vector1)
+        {
+            if (element != std::to_string(i++)) { return false; }
+        }
+    }
+    {
+        TieredVector<TestStruct> vector0{ TestStruct(0.0f), TestStruct(1.0f) };
+        TieredVector<TestStruct> vector1(std::move(vector0));
+
+        if (vector1.Size() != 2 || vector1.Back() != TestStruct(1.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::Operators()
+{
+    //operator==
+    //operator!=
+    //operator[]
+    //At()
+    //Front()
+    //Back()
+
+    {
+        TieredVector<size_t> vector0{ 0, 1, 2, 3, 4, 5, 6 };
+        TieredVector<size_t> vector1{ 0, 1, 2, 3, 4, 5, 6 };
+
+        if (vector0 != vector1) { return false; }
+        vector1[3] = 10;
+        if (vector0 == vector1) { return false; }
+
+        for (size_t i = 0; i < vector0.Size(); ++i)
+        {
+            if (vector0[i] != i || vector0.At(i) != i) { return false; }
+        }
+        if (vector0.Front() != 0 || vector0.Back() != 6) { return false; }
+
+        try
+        {
+            (void)vector0.At(7);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        const TieredVector<std::string> vector{ "0", "1", "2" };
+        if (vector[1] != "1" || vector.At(2) != "2") { return false; }
+        if (vector.Front() != "0" || vector.Back() != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::PushBack()
+{
+    //PushBack(const T& element)
+    //PushBack(T&& element)
+
+    {
+        TieredVector<size_t> vector;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            vector.PushBack(i);
+        }
+
+        //Every tier is full except the last one
+        if (vector.Size() != 100 || vector.TierSize() != 16 || vector.Tiers() != 7 || vector.Capacity() != 112) { return false; }
+        for (size_t i = 0; i < 100; ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+    }
+    {
+        //The tier size doubles when every tier is full
+        TieredVector<size_t> vector;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            vector.PushBack(i);
+            if (vector.TierSize() * vector.TierSize() < vector.Size()) { return false; }
+        }
+        if (vector.TierSize() != 32 || vector.Tiers() != 32) { return false; }
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+    }
+    {
+        TieredVector<std::string> vector;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            std::string element = std::to_string(i);
+            if (i % 2) { vector.PushBack(element); }
+            else { vector.PushBack(std::move(element)); }
+        }
+
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (vector[i] != std::to_string(i)) { return false; }
+        }
+
+        //The element pushed belongs to the container when the tiers are rebuilt at 16 * 16 elements
+        for (size_t i = 10; i < 256; ++i)
+        {
+            vector.PushBack(std::to_string(i));
+        }
+        vector.PushBack(vector[0]);
+        if (vector.Size() != 257 || vector.TierSize() != 32 || vector.Back() != "0" || vector[0] != "0") { return false; }
+    }
+    {
+        TieredVector<TestStruct> vector;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            vector.PushBack(TestStruct((float)i));
+        }
+
+        if (vector.Back() != TestStruct(9.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::PushFront()
+{
+    //PushFront(const T& element)
+    //PushFront(T&& element)
+
+    {
+        TieredVector<size_t> vector;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            vector.PushFront(i);
+        }
+
+        if (vector.Size() != 100 || vector.Tiers() != 7) { return false; }
+        for (size_t i = 0; i < 100; ++i)
+        {
+            if (vector[i] != 99 - i) { return false; }
+        }
+    }
+    {
+        TieredVector<std::string> vector{ "x" };
+        for (size_t i = 0; i < 10; ++i)
+        {
+            vector.PushFront(std::to_string(i));
+        }
+
+        if (vector.Size() != 11 || vector.Front() != "9" || vector.Back() != "x") { return false; }
+    }
+    {
+        TieredVector<TestStruct> vector;
+        TestStruct element(1.0f);
+        vector.PushFront(element);
+        vector.PushFront(TestStruct(0.0f));
+
+        if (vector.Front() != TestStruct(0.0f) || vector.Back() != element) { return false; }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::Insert()
+{
+    //Insert(iterator it, const T& element)
+    //Insert(iterator it, T&& element)
+    //Insert(size_t index, const T& element)
+    //Insert(size_t index, T&& element)
+
+    {
+        TieredVector<size_t> vector{ 0, 1, 2, 3 };
+
+        auto it = vector.Insert(vector.begin() + 2, 10);
+        if (*it != 10) { return false; }
+
+        size_t expected[] = { 0, 1, 10, 2, 3 };
+        for (size_t i = 0; i < 5; ++i)
+        {
+            if (vector[i] != expected[i]) { return false; }
+        }
+
+        vector.Insert(vector.end(), 20);
+        vector.Insert((size_t)0, 30);
+        if (vector.Front() != 30 || vector.Back() != 20 || vector.Size() != 7) { return false; }
+
+        try
+        {
+            vector.Insert(8, 40);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        //Random insertions keep the order of a reference Vector
+        TieredVector<size_t> vector;
+        Vector<size_t> reference;
+        for (size_t i = 0; i < 500; ++i)
+        {
+            size_t index = (i * 7919) % (i + 1);
+            vector.Insert(vector.begin() + index, i);
+            reference.Insert(index, i);
+        }
+
+        if (vector.Size() != reference.Size()) { return false; }
+        size_t i = 0;
+        for (auto it = vector.begin(); it != vector.end(); ++it, ++i)
+        {
+            if (*it != reference[i]) { return false; }
+        }
+    }
+    {
+        TieredVector<std::string> vector{ "0", "2" };
+        std::string element("1");
+        vector.Insert(1, element);
+        vector.Insert(vector.end(), std::string("3"));
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            if (vector[i] != std::to_string(i)) { return false; }
+        }
+    }
+    {
+        TieredVector<TestStruct> vector{ TestStruct(0.0f), TestStruct(2.0f) };
+        vector.Insert(vector.begin() + 1, TestStruct(1.0f));
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            if (vector[i] != TestStruct((float)i)) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::Emplace()
+{
+    //EmplaceBack(Args&&... args)
+    //EmplaceFront(Args&&... args)
+    //Emplace(size_t index, Args&&... args)
+    //EmplaceAt(iterator it, Args&&... args)
+
+    {
+        TieredVector<std::string> vector;
+        vector.EmplaceBack(3, 'b');
+        vector.EmplaceFront(3, 'a');
+        vector.Emplace(1, 3, 'c');
+        vector.EmplaceAt(vector.end(), 3, 'd');
+
+        if (vector[0] != "aaa" || vector[1] != "ccc" || vector[2] != "bbb" || vector[3] != "ddd") { return false; }
+    }
+    {
+        TieredVector<TestStruct> vector;
+        TestStruct& element = vector.EmplaceBack(1.0f, 2.0f, 3.0f);
+
+        if (element != TestStruct(1.0f, 2.0f, 3.0f) || vector.Size() != 1) { return false; }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::PopBack()
+{
+    //PopBack()
+
+    {
+        TieredVector<size_t> vector{ 0, 1, 2, 3, 4 };
+        vector.PopBack();
+        if (vector.Size() != 4 || vector.Back() != 3) { return false; }
+
+        while (!vector.IsEmpty())
+        {
+            vector.PopBack();
+        }
+        //The tiers are kept for the next insertions
+        if (vector.begin() != vector.end() || vector.Tiers() != 1) { return false; }
+        vector.PopBack();
+    }
+    {
+        TieredVector<std::string> vector{ "0", "1", "2" };
+        vector.PopBack();
+        if (vector.Size() != 2 || vector.Back() != "1") { return false; }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::PopFront()
+{
+    //PopFront()
+
+    {
+        TieredVector<size_t> vector{ 0, 1, 2, 3, 4, 5, 6, 7 };
+        for (size_t i = 0; i < 8; ++i)
+        {
+            if (vector.Front() != i) { return false; }
+            vector.PopFront();
+        }
+        if (!vector.IsEmpty()) { return false; }
+    }
+    {
+        TieredVector<TestStruct> vector{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+        vector.PopFront();
+        if (vector.Size() != 2 || vector.Front() != TestStruct(1.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::Erase()
+{
+    //Erase(iterator it)
+    //Erase(size_t index)
+
+    {
+        TieredVector<size_t> vector;
+        for (size_t i = 0; i < 16; ++i)
+        {
+            vector.PushBack(i);
+        }
+
+        for (auto it = vector.begin(); it != vector.end();)
+        {
+            if (*it % 4) { it = vector.Erase(it); }
+            else { ++it; }
+        }
+
+        if (vector.Size() != 4) { return false; }
+        for (size_t i = 0; i < 4; ++i)
+        {
+            if (vector[i] != i * 4) { return false; }
+        }
+
+        auto it = vector.Erase(3);
+        if (it != vector.end() || vector.Back() != 8) { return false; }
+
+        try
+        {
+            vector.Erase(3);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        TieredVector<std::string> vector{ "0", "1", "2", "3", "4", "5" };
+        auto it = vector.Erase(vector.begin() + 2);
+        if (*it != "3" || vector.Size() != 5) { return false; }
+
+        it = vector.Erase(vector.begin());
+        if (*it != "1" || vector.Front() != "1") { return false; }
+    }
+    {
+        TieredVector<TestStruct> vector{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+        vector.Erase(1);
+        if (vector.Size() != 2 || vector[1] != TestStruct(2.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::Clear()
+{
+    //Clear()
+
+    {
+        TieredVector<size_t> vector{ 0, 1, 2, 3, 4 };
+        vector.Clear();
+
+        if (!vector.IsEmpty() || vector.begin() != vector.end() || vector.Capacity() != 16) { return false; }
+
+        vector.PushBack(1);
+        if (vector.Size() != 1 || vector.Tiers() != 1) { return false; }
+    }
+    {
+        TieredVector<std::string> vector{ "0", "1", "2" };
+        vector.Clear();
+        if (!vector.IsEmpty()) { return false; }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::Swap()
+{
+    //Swap(TieredVector& other)
+
+    {
+        TieredVector<size_t> vector0{ 0, 1, 2, 3, 4 };
+        TieredVector<size_t> vector1{ 5 };
+        vector0.Swap(vector1);
+
+        if (vector0.Size() != 1 || vector0.Front() != 5) { return false; }
+        if (vector1.Size() != 5 || vector1.Back() != 4) { return false; }
+
+        TieredVector<size_t> vector2;
+        vector2.Swap(vector1);
+        if (!vector1.IsEmpty() || vector1.begin() != vector1.end() || vector2.Size() != 5) { return false; }
+
+        size_t i = 0;
+        for (auto it = vector2.begin(); it != vector2.end(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+    }
+    {
+        TieredVector<std::string> vector0{ "0", "1", "2" };
+        TieredVector<std::string> vector1{ "a" };
+        vector0.Swap(vector1);
+
+        if (vector0.Size() != 1 || vector1.Size() != 3 || vector1.Back() != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::Append()
+{
+    //Append(const TieredVector& other)
+    //Append(TieredVector&& other)
+
+    {
+        TieredVector<size_t> vector0{ 0, 1, 2 };
+        TieredVector<size_t> vector1{ 3, 4, 5, 6, 7 };
+
+        vector0.Append(vector1);
+        if (vector0.Size() != 8 || vector1.Size() != 5) { return false; }
+
+        TieredVector<size_t> vector2{ 8, 9 };
+        vector0.Append(std::move(vector2));
+        if (vector0.Size() != 10 || !vector2.IsEmpty()) { return false; }
+
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (vector0[i] != i) { return false; }
+        }
+
+        TieredVector<size_t> vector3;
+        vector3.Append(std::move(vector0));
+        if (vector3.Size() != 10 || !vector0.IsEmpty() || vector3.Back() != 9) { return false; }
+
+        //Appending a vector to itself doubles it
+        vector3.Append(vector3);
+        if (vector3.Size() != 20 || vector3[10] != 0 || vector3.Back() != 9) { return false; }
+    }
+    {
+        TieredVector<std::string> vector0{ "0" };
+        TieredVector<std::string> vector1{ "1", "2" };
+        vector0.Append(std::move(vector1));
+
+        if (vector0.Size() != 3 || vector0[2] != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::Reserve()
+{
+    //Reserve(size_t capacity)
+    //Shrink()
+
+    {
+        TieredVector<size_t> vector;
+        vector.Reserve(100);
+        if (vector.Capacity() != 112 || !vector.IsEmpty()) { return false; }
+
+        const size_t* first = nullptr;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            vector.PushBack(i);
+            if (i == 0) { first = &vector.Front(); }
+        }
+        if (vector.Tiers() != 7 || first != &vector.Front()) { return false; }
+
+        for (size_t i = 0; i < 90; ++i)
+        {
+            vector.PopBack();
+        }
+        vector.Shrink();
+        if (vector.Size() != 10 || vector.Tiers() != 1) { return false; }
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+
+        vector.Clear();
+        vector.Shrink();
+        if (vector.Tiers() != 0 || vector.Capacity() != 0) { return false; }
+
+        vector.PushFront(1);
+        if (vector.Size() != 1 || vector.Front() != 1) { return false; }
+    }
+    {
+        //Shrinking a container that lost most of its elements makes its tiers smaller
+        TieredVector<size_t> vector;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            vector.PushBack(i);
+        }
+        while (vector.Size() > 100)
+        {
+            vector.Erase(vector.Size() / 2);
+        }
+
+        vector.Shrink();
+        if (vector.TierSize() != 16 || vector.Tiers() != 7) { return false; }
+        for (size_t i = 0; i < 50; ++i)
+        {
+            if (vector[i] != i || vector[99 - i] != 999 - i) { return false; }
+        }
+    }
+    {
+        TieredVector<std::string> vector(10);
+        if (vector.Capacity() < 10) { return false; }
+
+        try
+        {
+            vector.Reserve(100000000);
+            return false;
+        }
+        catch (...) {}
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::Tiers()
+{
+    //The insertions and removals move elements between tiers and rotate their circular arrays
+
+    {
+        //Inserting in the middle keeps every tier but the last one full
+        TieredVector<size_t> vector;
+        Vector<size_t> reference;
+        for (size_t i = 0; i < 2000; ++i)
+        {
+            vector.Insert(vector.Size() / 2, i);
+            reference.Insert(reference.Size() / 2, i);
+        }
+
+        if (vector.TierSize() != 64 || vector.Tiers() != 32) { return false; }
+        for (size_t i = 0; i < 2000; ++i)
+        {
+            if (vector[i] != reference[i]) { return false; }
+        }
+
+        for (size_t i = 0; i < 1990; ++i)
+        {
+            vector.Erase(i % vector.Size());
+            reference.Erase(i % reference.Size());
+        }
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (vector[i] != reference[i]) { return false; }
+        }
+    }
+    {
+        //Mixed operations at both ends and in the middle, the tiers grow while the elements rotate
+        TieredVector<std::string> vector;
+        Vector<std::string> reference;
+        size_t seed = 1;
+        for (size_t i = 0; i < 3000; ++i)
+        {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            const size_t operation = (seed >> 33) % 10;
+            const std::string element = std::to_string(i);
+
+            if (operation < 3)
+            {
+                vector.PushFront(element);
+                reference.Insert((size_t)0, element);
+            }
+            else if (operation < 6)
+            {
+                vector.PushBack(element);
+                reference.PushBack(element);
+            }
+            else if (operation == 6 && !reference.IsEmpty())
+            {
+                vector.PopFront();
+                reference.Erase((size_t)0);
+            }
+            else if (operation == 7 && !reference.IsEmpty())
+            {
+                vector.PopBack();
+                reference.PopBack();
+            }
+            else if (operation == 8)
+            {
+                const size_t index = (seed >> 17) % (reference.Size() + 1);
+                vector.Insert(index, element);
+                reference.Insert(index, element);
+            }
+            else if (!reference.IsEmpty())
+            {
+                const size_t index = (seed >> 17) % reference.Size();
+                vector.Erase(index);
+                reference.Erase(index);
+            }
+
+            if (vector.Size() != reference.Size()) { return false; }
+        }
+
+        size_t i = 0;
+        for (auto it = vector.begin(); it != vector.end(); ++it, ++i)
+        {
+            if (*it != reference[i]) { return false; }
+        }
+        for (auto it = vector.rbegin(); it != vector.rend(); ++it)
+        {
+            if (*it != reference[--i]) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool TieredVectorTest::Allocators()
+{
+    //TieredVector(const Allocator& allocator)
+    //GetAllocator()
+
+    if (!IsMoveAssignmentNoexceptOnlyWithEqualAllocators<TieredVector<size_t>, PmrTieredVector<size_t>>()) { return false; }
+
+    {
+        CountingResource resource;
+        {
+            PmrTieredVector<size_t> vector(&resource);
+            for (size_t i = 0; i < 20; ++i)
+            {
+                vector.PushBack(i);
+            }
+
+            //One allocation for the tier array and one per tier
+            if (resource.Allocations() != 3) { return false; }
+
+            PmrTieredVector<size_t> moved(std::move(vector));
+            if (moved.GetAllocator().resource() != &resource) { return false; }
+            if (moved.Size() != 20 || resource.Allocations() != 3) { return false; }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+    }
+    {
+        CountingResource resource0;
+        CountingResource resource1;
+        {
+            PmrTieredVector<std::string> vector0(&resource0);
+            PmrTieredVector<std::string> vector1(&resource1);
+            for (size_t i = 0; i < 5; ++i)
+            {
+                vector0.PushBack(std::to_string(i));
+            }
+
+            //The tiers can not be taken from other resource, the elements are moved
+            vector1 = std::move(vector0);
+
+            if (!vector0.IsEmpty() || vector1.Size() != 5) { return false; }
+            if (resource1.BytesInUse() == 0) { return false; }
+
+            vector0.Append(std::move(vector1));
+            if (vector0.Size() != 5 || !vector1.IsEmpty()) { return false; }
+        }
+
+        if (resource0.BytesInUse() != 0 || resource1.BytesInUse() != 0) { return false; }
+    }
+
+    return true;
+}
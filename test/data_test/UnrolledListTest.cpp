@@ -0,0 +1,772 @@
+#include "UnrolledListTest.hpp"
+#include "UnrolledList.hpp"
+#include "Vector.hpp"
+#include "../TestStruct.hpp"
+#include "../CountingResource.hpp"
+#include "../Serializer.hpp"
+
+#include <iostream> //For std::cout and std::fixed
+#include <string>
+#include <sstream>  //For std::stringstream
+
+static std::stringstream s_FileBuffer;
+
+bool UnrolledListTest::RunAllTest()
+{
+    std::stringstream test_results_buffer;
+    bool test_result = true;
+    size_t passed = 16;
+    s_FileBuffer << "UnrolledList Bug Tests:" << std::endl;
+    s_FileBuffer << "Total test executed: " << passed << std::endl;
+
+    if (!Iterators()) { test_results_buffer << std::endl << "Iterator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Copy()) { test_results_buffer << std::endl << "Copy Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Move()) { test_results_buffer << std::endl << "Move Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Operators()) { test_results_buffer << std::endl << "Operator Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PushBack()) { test_results_buffer << std::endl << "PushBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PushFront()) { test_results_buffer << std::endl << "PushFront Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Insert()) { test_results_buffer << std::endl << "Insert Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Emplace()) { test_results_buffer << std::endl << "Emplace Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PopBack()) { test_results_buffer << std::endl << "PopBack Test Failed" << std::endl; test_result = false; --passed; }
+    if (!PopFront()) { test_results_buffer << std::endl << "PopFront Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Erase()) { test_results_buffer << std::endl << "Erase Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Clear()) { test_results_buffer << std::endl << "Clear Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Swap()) { test_results_buffer << std::endl << "Swap Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Append()) { test_results_buffer << std::endl << "Append Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Shrink()) { test_results_buffer << std::endl << "Shrink Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Allocators()) { test_results_buffer << std::endl << "Allocator Test Failed" << std::endl; test_result = false; --passed; }
+
+    s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
+    if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
+    else { s_FileBuffer << test_results_buffer.str(); }
+    s_FileBuffer << std::endl << std::endl;
+    Serializer::SerializeResults("UnrolledList_Results.txt", s_FileBuffer);
+
+    return test_result;
+}
+
+bool UnrolledListTest::Iterators()
+{
+    //begin()
+    //end()
+    //rbegin()
+    //rend()
+    //operator+=(size_t)
+    //operator-=(size_t)
+
+    {
+        UnrolledList<size_t, 4> list;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            list.PushBack(i);
+        }
+
+        size_t i = 0;
+        for (auto it = list.begin(); it != list.end(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+        if (i != 10) { return false; }
+
+        for (auto it = list.rbegin(); it != list.rend(); ++it)
+        {
+            if (*it != --i) { return false; }
+        }
+        if (i != 0) { return false; }
+
+        for (auto it = --list.end(); it != list.begin(); --it)
+        {
+            if (*it != 9 - i++) { return false; }
+        }
+
+        //Jumps across whole nodes in both directions
+        for (size_t distance = 0; distance <= 10; ++distance)
+        {
+            auto it = list.begin() + distance;
+            if (distance == 10) { if (it != list.end()) { return false; } }
+            else if (*it != distance) { return false; }
+
+            if (it - distance != list.begin()) { return false; }
+            if (list.end() - (10 - distance) != it) { return false; }
+        }
+        if (list.begin()[7] != 7) { return false; }
+
+        const UnrolledList<size_t, 4>& const_list = list;
+        i = 0;
+        for (auto it = const_list.cbegin(); it != const_list.cend(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+    }
+    {
+        UnrolledList<std::string, 2> list{ "0", "1", "2", "3", "4" };
+
+        size_t i = 0;
+        for (auto& element : list)
+        {
+            if (element != std::to_string(i++)) { return false; }
+        }
+        if (i != 5) { return false; }
+        if ((list.begin() + 3)->size() != 1) { return false; }
+    }
+    {
+        UnrolledList<TestStruct, 2> list{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+
+        size_t i = 0;
+        for (auto& element : list)
+        {
+            if (element != TestStruct((float)i++)) { return false; }
+        }
+        if (i != 3) { return false; }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::Copy()
+{
+    //UnrolledList(const UnrolledList& other)
+    //operator=(const UnrolledList& other)
+
+    {
+        UnrolledList<size_t, 4> list0{ 0, 1, 2, 3, 4, 5 };
+        UnrolledList<size_t, 4> list1(list0);
+
+        if (list1 != list0) { return false; }
+
+        UnrolledList<size_t, 4> list2{ 7, 8 };
+        list1 = list2;
+
+        if (list1 != list2) { return false; }
+        if (list0.Size() != 6 || list0[5] != 5) { return false; }
+    }
+    {
+        UnrolledList<std::string, 4> list0{ "0", "1", "2", "3", "4" };
+        UnrolledList<std::string, 4> list1(list0);
+
+        if (list1 != list0) { return false; }
+
+        list0.Front() = "a";
+        if (list1.Front() != "0") { return false; }
+    }
+    {
+        UnrolledList<TestStruct, 4> list0{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f), TestStruct(3.0f), TestStruct(4.0f) };
+        UnrolledList<TestStruct, 4> list1;
+        list1 = list0;
+
+        if (list1 != list0) { return false; }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::Move()
+{
+    //UnrolledList(UnrolledList&& other)
+    //operator=(UnrolledList&& other)
+
+    {
+        UnrolledList<size_t, 4> list0{ 0, 1, 2, 3, 4, 5 };
+        UnrolledList<size_t, 4> list1(std::move(list0));
+
+        if (!list0.IsEmpty() || list0.begin() != list0.end()) { return false; }
+        if (list1.Size() != 6 || list1.Back() != 5) { return false; }
+
+        list0 = std::move(list1);
+        if (!list1.IsEmpty() || list0.Size() != 6) { return false; }
+
+        //Moved from containers remain usable
+        list1.PushBack(10);
+        if (list1.Size() != 1 || list1.Front() != 10) { return false; }
+    }
+    {
+        UnrolledList<std::string, 4> list0{ "0", "1", "2", "3", "4" };
+        UnrolledList<std::string, 4> list1{ "a" };
+        list1 = std::move(list0);
+
+        if (!list0.IsEmpty() || list1.Size() != 5) { return false; }
+        size_t i = 0;
+        for (auto& element : list1)
+        {
+            if (element != std::to_string(i++)) { return false; }
+        }
+    }
+    {
+        UnrolledList<TestStruct, 4> list0{ TestStruct(0.0f), TestStruct(1.0f) };
+        UnrolledList<TestStruct, 4> list1(std::move(list0));
+
+        if (list1.Size() != 2 || list1.Back() != TestStruct(1.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::Operators()
+{
+    //operator==
+    //operator!=
+    //operator[]
+    //At()
+    //Front()
+    //Back()
+
+    {
+        UnrolledList<size_t, 4> list0{ 0, 1, 2, 3, 4, 5, 6 };
+        UnrolledList<size_t, 4> list1{ 0, 1, 2, 3, 4, 5, 6 };
+
+        if (list0 != list1) { return false; }
+        list1[3] = 10;
+        if (list0 == list1) { return false; }
+
+        for (size_t i = 0; i < list0.Size(); ++i)
+        {
+            if (list0[i] != i || list0.At(i) != i) { return false; }
+        }
+        if (list0.Front() != 0 || list0.Back() != 6) { return false; }
+
+        try
+        {
+            (void)list0.At(7);
+            return false;
+        }
+        catch (...) {}
+    }
+    {
+        const UnrolledList<std::string, 2> list{ "0", "1", "2" };
+        if (list[1] != "1" || list.At(2) != "2") { return false; }
+        if (list.Front() != "0" || list.Back() != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::PushBack()
+{
+    //PushBack(const T& element)
+    //PushBack(T&& element)
+
+    {
+        UnrolledList<size_t, 4> list;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            list.PushBack(i);
+        }
+
+        //Sequential insertions fill the nodes completely
+        if (list.Size() != 100 || list.Nodes() != 25 || list.Capacity() != 100) { return false; }
+        for (size_t i = 0; i < 100; ++i)
+        {
+            if (list[i] != i) { return false; }
+        }
+    }
+    {
+        UnrolledList<std::string, 4> list;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            std::string element = std::to_string(i);
+            if (i % 2) { list.PushBack(element); }
+            else { list.PushBack(std::move(element)); }
+        }
+
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (list[i] != std::to_string(i)) { return false; }
+        }
+    }
+    {
+        UnrolledList<TestStruct, 4> list;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            list.PushBack(TestStruct((float)i));
+        }
+
+        if (list.Back() != TestStruct(9.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::PushFront()
+{
+    //PushFront(const T& element)
+    //PushFront(T&& element)
+
+    {
+        UnrolledList<size_t, 4> list;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            list.PushFront(i);
+        }
+
+        if (list.Size() != 100 || list.Nodes() != 25) { return false; }
+        for (size_t i = 0; i < 100; ++i)
+        {
+            if (list[i] != 99 - i) { return false; }
+        }
+    }
+    {
+        UnrolledList<std::string, 4> list{ "x" };
+        for (size_t i = 0; i < 10; ++i)
+        {
+            list.PushFront(std::to_string(i));
+        }
+
+        if (list.Size() != 11 || list.Front() != "9" || list.Back() != "x") { return false; }
+    }
+    {
+        UnrolledList<TestStruct, 4> list;
+        TestStruct element(1.0f);
+        list.PushFront(element);
+        list.PushFront(TestStruct(0.0f));
+
+        if (list.Front() != TestStruct(0.0f) || list.Back() != element) { return false; }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::Insert()
+{
+    //Insert(iterator it, const T& element)
+    //Insert(iterator it, T&& element)
+    //Insert(size_t index, const T& element)
+    //Insert(size_t index, T&& element)
+
+    {
+        UnrolledList<size_t, 4> list{ 0, 1, 2, 3 };
+
+        //Inserting in the middle of a full node splits it
+        auto it = list.Insert(list.begin() + 2, 10);
+        if (*it != 10 || list.Nodes() != 2) { return false; }
+
+        size_t expected[] = { 0, 1, 10, 2, 3 };
+        for (size_t i = 0; i < 5; ++i)
+        {
+            if (list[i] != expected[i]) { return false; }
+        }
+
+        list.Insert(list.end(), 20);
+        list.Insert((size_t)0, 30);
+        if (list.Front() != 30 || list.Back() != 20 || list.Size() != 7) { return false; }
+
+        //An index out of range inserts at the end, like List
+        auto last = list.Insert(8, 40);
+        if (*last != 40 || list.Back() != 40 || list.Size() != 8) { return false; }
+    }
+    {
+        //Random insertions keep the order of a reference Vector
+        UnrolledList<size_t, 8> list;
+        Vector<size_t> reference;
+        for (size_t i = 0; i < 500; ++i)
+        {
+            size_t index = (i * 7919) % (i + 1);
+            list.Insert(list.begin() + index, i);
+            reference.Insert(index, i);
+        }
+
+        if (list.Size() != reference.Size()) { return false; }
+        size_t i = 0;
+        for (auto it = list.begin(); it != list.end(); ++it, ++i)
+        {
+            if (*it != reference[i]) { return false; }
+        }
+    }
+    {
+        UnrolledList<std::string, 2> list{ "0", "2" };
+        std::string element("1");
+        list.Insert(1, element);
+        list.Insert(list.end(), std::string("3"));
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            if (list[i] != std::to_string(i)) { return false; }
+        }
+
+        //The inserted element belongs to the node whose elements are moved
+        UnrolledList<std::string, 4> aliased{ "a", "b", "c" };
+        aliased.Insert(1, aliased[2]);
+        aliased.PushFront(aliased[0]);
+        aliased.Insert(aliased.begin() + 2, std::move(aliased[4]));
+        if (aliased.Size() != 6 || aliased[0] != "a" || aliased[1] != "a" || aliased[2] != "c" || aliased[3] != "c" || aliased[4] != "b") { return false; }
+    }
+    {
+        UnrolledList<TestStruct, 2> list{ TestStruct(0.0f), TestStruct(2.0f) };
+        list.Insert(list.begin() + 1, TestStruct(1.0f));
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            if (list[i] != TestStruct((float)i)) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::Emplace()
+{
+    //EmplaceBack(Args&&... args)
+    //EmplaceFront(Args&&... args)
+    //Emplace(size_t index, Args&&... args)
+    //Emplace(iterator it, Args&&... args)
+    //EmplaceAt(iterator it, Args&&... args)
+
+    {
+        UnrolledList<std::string, 4> list;
+        list.EmplaceBack(3, 'b');
+        list.EmplaceFront(3, 'a');
+        std::string& element = list.Emplace(1, 3, 'c');
+        list.EmplaceAt(list.end(), 3, 'd');
+
+        if (element != "ccc") { return false; }
+        if (list[0] != "aaa" || list[1] != "ccc" || list[2] != "bbb" || list[3] != "ddd") { return false; }
+
+        if (list.Emplace(list.begin() + 1, 3, 'e') != "eee" || list[1] != "eee") { return false; }
+        if (list.Emplace(100, 3, 'f') != "fff" || list.Back() != "fff" || list.Size() != 6) { return false; }
+    }
+    {
+        UnrolledList<TestStruct, 4> list;
+        TestStruct& element = list.EmplaceBack(1.0f, 2.0f, 3.0f);
+
+        if (element != TestStruct(1.0f, 2.0f, 3.0f) || list.Size() != 1) { return false; }
+    }
+    {
+        //A constructor that throws leaves no slot behind
+        UnrolledList<std::string, 4> list{ "a" };
+        const size_t length = std::string().max_size() + 1;
+        try
+        {
+            list.EmplaceBack(length, 'x');
+            return false;
+        }
+        catch (...) {}
+        try
+        {
+            list.Emplace(0, length, 'x');
+            return false;
+        }
+        catch (...) {}
+
+        if (list.Size() != 1 || list.Nodes() != 1 || list.Front() != "a") { return false; }
+        list.PushBack("b");
+        if (list.Size() != 2 || list.Back() != "b") { return false; }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::PopBack()
+{
+    //PopBack()
+
+    {
+        UnrolledList<size_t, 4> list{ 0, 1, 2, 3, 4 };
+        list.PopBack();
+        if (list.Size() != 4 || list.Back() != 3 || list.Nodes() != 1) { return false; }
+
+        while (!list.IsEmpty())
+        {
+            list.PopBack();
+        }
+        if (list.Nodes() != 0 || list.begin() != list.end()) { return false; }
+    }
+    {
+        UnrolledList<std::string, 2> list{ "0", "1", "2" };
+        list.PopBack();
+        if (list.Size() != 2 || list.Back() != "1") { return false; }
+    }
+    {
+        //Popping an empty container does nothing
+        UnrolledList<std::string, 2> list;
+        list.PopBack();
+        if (!list.IsEmpty() || list.Nodes() != 0) { return false; }
+
+        list.PushBack("0");
+        list.PopBack();
+        list.PopBack();
+        if (!list.IsEmpty() || list.begin() != list.end()) { return false; }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::PopFront()
+{
+    //PopFront()
+
+    {
+        UnrolledList<size_t, 4> list{ 0, 1, 2, 3, 4, 5, 6, 7 };
+        for (size_t i = 0; i < 8; ++i)
+        {
+            if (list.Front() != i) { return false; }
+            list.PopFront();
+        }
+        if (!list.IsEmpty() || list.Nodes() != 0) { return false; }
+    }
+    {
+        UnrolledList<TestStruct, 2> list{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+        list.PopFront();
+        if (list.Size() != 2 || list.Front() != TestStruct(1.0f)) { return false; }
+    }
+    {
+        //Popping an empty container does nothing
+        UnrolledList<TestStruct, 2> list;
+        list.PopFront();
+        if (!list.IsEmpty() || list.Nodes() != 0) { return false; }
+
+        list.PushFront(TestStruct(0.0f));
+        list.PopFront();
+        list.PopFront();
+        if (!list.IsEmpty() || list.begin() != list.end()) { return false; }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::Erase()
+{
+    //Erase(iterator it)
+    //Erase(size_t index)
+
+    {
+        UnrolledList<size_t, 4> list;
+        for (size_t i = 0; i < 16; ++i)
+        {
+            list.PushBack(i);
+        }
+
+        //Keeping one element of each node leaves them underfull, so they are merged
+        for (auto it = list.begin(); it != list.end();)
+        {
+            if (*it % 4) { it = list.Erase(it); }
+            else { ++it; }
+        }
+
+        if (list.Size() != 4) { return false; }
+        for (size_t i = 0; i < 4; ++i)
+        {
+            if (list[i] != i * 4) { return false; }
+        }
+        if (list.Nodes() != 2) { return false; }
+
+        auto it = list.Erase(3);
+        if (it != list.end() || list.Back() != 8) { return false; }
+
+        //An index out of range erases the last element, like List
+        it = list.Erase(10);
+        if (it != list.end() || list.Size() != 2 || list.Back() != 4) { return false; }
+
+        list.Clear();
+        if (list.Erase(0) != list.end() || !list.IsEmpty()) { return false; }
+    }
+    {
+        UnrolledList<std::string, 4> list{ "0", "1", "2", "3", "4", "5" };
+        auto it = list.Erase(list.begin() + 2);
+        if (*it != "3" || list.Size() != 5) { return false; }
+
+        it = list.Erase(list.begin());
+        if (*it != "1" || list.Front() != "1") { return false; }
+    }
+    {
+        UnrolledList<TestStruct, 2> list{ TestStruct(0.0f), TestStruct(1.0f), TestStruct(2.0f) };
+        list.Erase(1);
+        if (list.Size() != 2 || list[1] != TestStruct(2.0f)) { return false; }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::Clear()
+{
+    //Clear()
+
+    {
+        UnrolledList<size_t, 4> list{ 0, 1, 2, 3, 4 };
+        list.Clear();
+
+        if (!list.IsEmpty() || list.Nodes() != 0 || list.begin() != list.end()) { return false; }
+
+        list.PushBack(1);
+        if (list.Size() != 1) { return false; }
+    }
+    {
+        UnrolledList<std::string, 2> list{ "0", "1", "2" };
+        list.Clear();
+        if (!list.IsEmpty()) { return false; }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::Swap()
+{
+    //Swap(UnrolledList& other)
+
+    {
+        UnrolledList<size_t, 4> list0{ 0, 1, 2, 3, 4 };
+        UnrolledList<size_t, 4> list1{ 5 };
+        list0.Swap(list1);
+
+        if (list0.Size() != 1 || list0.Front() != 5) { return false; }
+        if (list1.Size() != 5 || list1.Back() != 4) { return false; }
+
+        UnrolledList<size_t, 4> list2;
+        list2.Swap(list1);
+        if (!list1.IsEmpty() || list1.begin() != list1.end() || list2.Size() != 5) { return false; }
+
+        //The end of the swapped content points to its new container
+        size_t i = 0;
+        for (auto it = list2.begin(); it != list2.end(); ++it, ++i)
+        {
+            if (*it != i) { return false; }
+        }
+    }
+    {
+        UnrolledList<std::string, 2> list0{ "0", "1", "2" };
+        UnrolledList<std::string, 2> list1{ "a" };
+        list0.Swap(list1);
+
+        if (list0.Size() != 1 || list1.Size() != 3 || list1.Back() != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::Append()
+{
+    //Append(const UnrolledList& other)
+    //Append(UnrolledList&& other)
+
+    {
+        UnrolledList<size_t, 4> list0{ 0, 1, 2 };
+        UnrolledList<size_t, 4> list1{ 3, 4, 5, 6, 7 };
+
+        list0.Append(list1);
+        if (list0.Size() != 8 || list1.Size() != 5) { return false; }
+
+        UnrolledList<size_t, 4> list2{ 8, 9 };
+        list0.Append(std::move(list2));
+        if (list0.Size() != 10 || !list2.IsEmpty()) { return false; }
+
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (list0[i] != i) { return false; }
+        }
+
+        UnrolledList<size_t, 4> list3;
+        list3.Append(std::move(list0));
+        if (list3.Size() != 10 || !list0.IsEmpty() || list3.Back() != 9) { return false; }
+    }
+    {
+        UnrolledList<std::string, 2> list0{ "0" };
+        UnrolledList<std::string, 2> list1{ "1", "2" };
+        list0.Append(std::move(list1));
+
+        if (list0.Size() != 3 || list0[2] != "2") { return false; }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::Shrink()
+{
+    //Shrink()
+
+    {
+        UnrolledList<size_t, 4> list;
+        for (size_t i = 0; i < 16; ++i)
+        {
+            list.PushBack(i);
+        }
+        for (size_t i = 0; i < 8; ++i)
+        {
+            list.Insert(list.begin() + i * 3 + 1, 100);
+        }
+        for (auto it = list.begin(); it != list.end();)
+        {
+            if (*it == 100) { it = list.Erase(it); }
+            else { ++it; }
+        }
+
+        list.Shrink();
+        if (list.Size() != 16 || list.Nodes() != 4 || list.Capacity() != 16) { return false; }
+        for (size_t i = 0; i < 16; ++i)
+        {
+            if (list[i] != i) { return false; }
+        }
+    }
+    {
+        UnrolledList<std::string, 4> list;
+        for (size_t i = 0; i < 6; ++i)
+        {
+            list.PushFront(std::to_string(5 - i));
+            list.Insert(list.begin() + 1, "x");
+        }
+        for (auto it = list.begin(); it != list.end();)
+        {
+            if (*it == "x") { it = list.Erase(it); }
+            else { ++it; }
+        }
+
+        list.Shrink();
+        if (list.Nodes() != 2) { return false; }
+        for (size_t i = 0; i < 6; ++i)
+        {
+            if (list[i] != std::to_string(i)) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool UnrolledListTest::Allocators()
+{
+    //UnrolledList(const Allocator& allocator)
+    //GetAllocator()
+
+    if (!IsMoveAssignmentNoexceptOnlyWithEqualAllocators<UnrolledList<size_t>, PmrUnrolledList<size_t>>()) { return false; }
+
+    {
+        CountingResource resource;
+        {
+            PmrUnrolledList<size_t, 4> list(&resource);
+            for (size_t i = 0; i < 8; ++i)
+            {
+                list.PushBack(i);
+            }
+
+            //One allocation per node
+            if (resource.Allocations() != 2) { return false; }
+
+            PmrUnrolledList<size_t, 4> moved(std::move(list));
+            if (moved.GetAllocator().resource() != &resource) { return false; }
+            if (moved.Size() != 8 || resource.Allocations() != 2) { return false; }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+    }
+    {
+        CountingResource resource0;
+        CountingResource resource1;
+        {
+            PmrUnrolledList<std::string, 2> list0(&resource0);
+            PmrUnrolledList<std::string, 2> list1(&resource1);
+            for (size_t i = 0; i < 5; ++i)
+            {
+                list0.PushBack(std::to_string(i));
+            }
+
+            //The nodes can not be taken from other resource, the elements are moved
+            list1 = std::move(list0);
+
+            if (!list0.IsEmpty() || list1.Size() != 5) { return false; }
+            if (resource0.BytesInUse() != 0 || resource1.BytesInUse() == 0) { return false; }
+
+            list0.Append(std::move(list1));
+            if (list0.Size() != 5 || resource1.BytesInUse() != 0) { return false; }
+        }
+
+        if (resource0.BytesInUse() != 0 || resource1.BytesInUse() != 0) { return false; }
+    }
+
+    return true;
+}
@@ -1,19 +1,40 @@
 #include "VectorTest.hpp"
 #include "Vector.hpp"
 #include "../TestStruct.hpp"
+#include "../CountingResource.hpp"
 #include "../Serializer.hpp"
 
 #include <iostream> //For std::cout and std::fixed
 #include <string>
 #include <sstream>  //For std::stringstream
+#include <iterator>  //For std::istream_iterator
+#include <stdexcept>  //For std::runtime_error
 
 static std::stringstream s_FileBuffer;
 
+/*
+* Counts the calls to its move constructor, to check the relocation fast path.
+*/
+struct RelocationCounter
+{
+    RelocationCounter(size_t value) : Value(value) {}
+    RelocationCounter(const RelocationCounter& other) : Value(other.Value) {}
+    RelocationCounter(RelocationCounter&& other) noexcept : Value(other.Value) { ++s_Moves; }
+    RelocationCounter& operator=(const RelocationCounter& other) { Value = other.Value; return *this; }
+    RelocationCounter& operator=(RelocationCounter&& other) noexcept { Value = other.Value; ++s_Moves; return *this; }
+
+    size_t Value = 0;
+    static inline size_t s_Moves = 0;
+};
+
+template<>
+struct IsTriviallyRelocatable<RelocationCounter> : std::true_type {};
+
 bool VectorTest::RunAllTest()
 {
     std::stringstream test_results_buffer;
     bool test_result = true;
-    size_t passed = 16;
+    size_t passed = 21;
     s_FileBuffer << "Vector Bug Tests:" << std::endl;
     s_FileBuffer << "Total test executed: " << passed << std::endl;
 
@@ -33,6 +54,11 @@ bool VectorTest::RunAllTest()
     if (!Clear()) { test_results_buffer << std::endl << "Clear Test Failed" << std::endl; test_result = false; --passed;}
     if (!Append()) { test_results_buffer << std::endl << "Append Test Failed" << std::endl; test_result = false; --passed;}
     if (!Swap()) { test_results_buffer << std::endl << "Swap Test Failed" << std::endl; test_result = false; --passed;}
+    if (!Growth()) { test_results_buffer << std::endl << "Growth Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Relocation()) { test_results_buffer << std::endl << "Relocation Test Failed" << std::endl; test_result = false; --passed; }
+    if (!InsertRange()) { test_results_buffer << std::endl << "InsertRange Test Failed" << std::endl; test_result = false; --passed; }
+    if (!EraseRange()) { test_results_buffer << std::endl << "EraseRange Test Failed" << std::endl; test_result = false; --passed; }
+    if (!Allocators()) { test_results_buffer << std::endl << "Allocator Test Failed" << std::endl; test_result = false; --passed; }
 
     s_FileBuffer << "Total test passed: " << passed << std::endl << std::endl;
     if (test_result) { s_FileBuffer << "No errors found" << std::endl; }
@@ -1565,6 +1591,20 @@ bool VectorTest::Move()
             if (vector0[i] != TestStruct((float)(i + 5))) { return false; }
         }
     }
+    {
+        //The pending growth hint goes with the elements
+        Vector<size_t> vector0{ 0, 1, 2, 3, 4 };
+        vector0.SetGrowthHint(100);
+        Vector<size_t> vector1(std::move(vector0));
+
+        if (vector1.GrowthHint() != 100 || vector0.GrowthHint() != 0) { return false; }
+
+        vector0 = std::move(vector1);
+        if (vector0.GrowthHint() != 100 || vector1.GrowthHint() != 0) { return false; }
+
+        vector0.PushBack(5);
+        if (vector0.Capacity() != 100 || vector0.GrowthHint() != 0) { return false; }
+    }
 
     return true;
 }
@@ -2926,6 +2966,449 @@ bool VectorTest::Swap()
             if (vector1[i] != TestStruct((float)i)) { return false; }
         }
     }
+    {
+        Vector<size_t> vector0{ 0, 1, 2 };
+        Vector<size_t> vector1;
+        vector0.SetGrowthHint(50);
+
+        vector0.Swap(vector1);
+        if (vector0.GrowthHint() != 0 || vector1.GrowthHint() != 50) { return false; }
+
+        vector1.PushBack(3);
+        if (vector1.Capacity() != 50) { return false; }
+    }
+
+    return true;
+}
+
+bool VectorTest::Growth()
+{
+    //Growth policies
+    //SetGrowthHint(size_t elements)
+
+    {
+        Vector<size_t, OneAndHalfGrowthPolicy> vector;
+        for (size_t i = 0; i < 9; ++i)
+        {
+            vector.PushBack(i);
+        }
+        if (vector.Capacity() != 12) { return false; }
+        for (size_t i = 0; i < 9; ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+    }
+    {
+        Vector<size_t, FixedStepGrowthPolicy<5>> vector;
+        for (size_t i = 0; i < 14; ++i)
+        {
+            vector.Insert(vector.begin(), i);
+        }
+        if (vector.Capacity() != 18) { return false; }
+        for (size_t i = 0; i < 14; ++i)
+        {
+            if (vector[i] != 13 - i) { return false; }
+        }
+    }
+    {
+        Vector<TestStruct, SizeClassGrowthPolicy> vector;
+        size_t previous_capacity = 0;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            vector.EmplaceBack((float)i);
+            if (vector.Capacity() == previous_capacity) { continue; }
+
+            const size_t bytes = vector.Capacity() * sizeof(TestStruct);
+            if (previous_capacity != 0 && SizeClassGrowthPolicy::RoundToSizeClass(bytes) - bytes >= sizeof(TestStruct)) { return false; }
+            previous_capacity = vector.Capacity();
+        }
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            if (vector[i] != TestStruct((float)i)) { return false; }
+        }
+    }
+    {
+        Vector<std::string> vector;
+        vector.SetGrowthHint(100);
+        if (vector.Capacity() != 0) { return false; }
+        if (vector.GrowthHint() != 100) { return false; }
+
+        vector.PushBack("0");
+        if (vector.Capacity() != 100) { return false; }
+        if (vector.GrowthHint() != 0) { return false; }
+
+        for (size_t i = 1; i < 101; ++i)
+        {
+            vector.PushBack(std::to_string(i));
+        }
+        if (vector.Capacity() != 200) { return false; }
+
+        vector.SetGrowthHint(50);
+        vector.Shrink();
+        vector.PushBack("101");
+        if (vector.Capacity() != 202) { return false; }
+        if (vector.GrowthHint() != 0) { return false; }
+        if (vector[101] != "101") { return false; }
+    }
+
+    return true;
+}
+
+bool VectorTest::Relocation()
+{
+    //Trivially relocatable types are relocated without calling constructors.
+
+    {
+        Vector<RelocationCounter> vector;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            vector.EmplaceBack(i);
+        }
+        RelocationCounter::s_Moves = 0;
+
+        vector.Reserve(1000);
+        if (vector.Capacity() != 1000) { return false; }
+        vector.Shrink();
+        if (vector.Capacity() != 100) { return false; }
+        vector.Resize(50);
+        if (vector.Capacity() != 50 || vector.Size() != 50) { return false; }
+        vector.Resize(70);
+        if (vector.Capacity() != 70 || vector.Size() != 50) { return false; }
+
+        if (RelocationCounter::s_Moves != 0) { return false; }
+        for (size_t i = 0; i < 50; ++i)
+        {
+            if (vector[i].Value != i) { return false; }
+        }
+    }
+    {
+        Vector<TestStruct> vector;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            vector.PushBack(TestStruct((float)i));
+        }
+        int* data = vector[10].p;
+        vector.Reserve(5000);
+        if (vector[10].p != data) { return false; }
+
+        vector.Resize(20);
+        vector.Insert(vector.begin(), TestStruct(-1.0f));
+        vector.Shrink();
+        if (vector.Size() != 21 || vector.Capacity() != 21) { return false; }
+        if (vector[0] != TestStruct(-1.0f)) { return false; }
+        for (size_t i = 1; i < 21; ++i)
+        {
+            if (vector[i] != TestStruct((float)(i - 1))) { return false; }
+        }
+        if (vector[11].p != data) { return false; }
+    }
+    {
+        Vector<size_t> vector;
+        for (size_t i = 0; i < 10000; ++i)
+        {
+            vector.PushBack(i);
+        }
+        vector.Resize(10);
+        vector.Shrink();
+        for (size_t i = 0; i < 10; ++i)
+        {
+            if (vector[i] != i) { return false; }
+        }
+        vector.Resize(0);
+        if (vector.Capacity() != 0 || vector.Data()) { return false; }
+        vector.PushBack(1);
+        if (vector.Capacity() != 8) { return false; }
+    }
+
+    return true;
+}
+
+bool VectorTest::InsertRange()
+{
+    //InsertN(size_t index, size_t count, const T& element)
+    //InsertN(iterator position, size_t count, const T& element)
+    //InsertRange(size_t index, InputIterator first, InputIterator last)
+    //InsertRange(iterator position, InputIterator first, InputIterator last)
+
+    {
+        Vector<size_t> vector;
+        vector.InsertN(vector.begin(), 3, 7);
+        if (vector.Size() != 3 || vector[0] != 7 || vector[2] != 7) { return false; }
+
+        Vector<size_t> range;
+        for (size_t i = 0; i < 20; ++i)
+        {
+            range.PushBack(i);
+        }
+        Vector<size_t>::iterator it = vector.InsertRange(1, range.begin(), range.end());
+        if (*it != 0 || vector.Size() != 23) { return false; }
+        if (vector[0] != 7 || vector[21] != 7 || vector[22] != 7) { return false; }
+        for (size_t i = 0; i < 20; ++i)
+        {
+            if (vector[i + 1] != i) { return false; }
+        }
+
+        vector.InsertN(100, 2, 9);
+        if (vector.Size() != 25 || vector[23] != 9 || vector[24] != 9) { return false; }
+        vector.InsertN(0, 4, vector[5]);
+        if (vector[0] != 4 || vector[3] != 4 || vector[4] != 7 || vector[9] != 4) { return false; }
+    }
+    {
+        Vector<std::string> vector;
+        for (size_t i = 0; i < 6; ++i)
+        {
+            vector.PushBack(std::to_string(i));
+        }
+        std::string range[] = { "a", "b", "c", "d", "e", "f", "g", "h", "i", "j" };
+
+        Vector<std::string>::iterator it = vector.InsertRange(vector.begin() + 4, range, range + 2);
+        if (*it != "a" || vector.Size() != 8) { return false; }
+        const char* expected0[] = { "0", "1", "2", "3", "a", "b", "4", "5" };
+        for (size_t i = 0; i < 8; ++i)
+        {
+            if (vector[i] != expected0[i]) { return false; }
+        }
+
+        vector.InsertRange(vector.begin() + 1, range, range + 10);
+        if (vector.Size() != 18 || vector[0] != "0" || vector[1] != "a" || vector[10] != "j" || vector[11] != "1" || vector[17] != "5") { return false; }
+
+        vector.InsertN(vector.begin() + 17, 3, std::string("x"));
+        if (vector.Size() != 21 || vector[16] != "4" || vector[17] != "x" || vector[19] != "x" || vector[20] != "5") { return false; }
+
+        vector.InsertN(vector.begin(), 2, vector[20]);
+        if (vector[0] != "5" || vector[1] != "5" || vector[2] != "0" || vector.Back() != "5") { return false; }
+    }
+    {
+        Vector<TestStruct> vector(32);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            vector.PushBack(TestStruct((float)i));
+        }
+        TestStruct range[] = { TestStruct(100.0f), TestStruct(101.0f), TestStruct(102.0f) };
+
+        vector.InsertRange(5, range, range + 3);
+        if (vector.Capacity() != 32 || vector.Size() != 13) { return false; }
+        for (size_t i = 0; i < 13; ++i)
+        {
+            const float expected = i < 5 ? (float)i : (i < 8 ? 95.0f + i : (float)(i - 3));
+            if (vector[i] != TestStruct(expected)) { return false; }
+        }
+
+        vector.InsertN(vector.end(), 30, TestStruct(-1.0f));
+        if (vector.Size() != 43 || vector[12] != TestStruct(9.0f) || vector[42] != TestStruct(-1.0f)) { return false; }
+    }
+    {
+        //A single pass range is read only once
+        Vector<std::string> vector{ "0", "4" };
+        std::istringstream stream("1 2 3");
+
+        Vector<std::string>::iterator it = vector.InsertRange(1, std::istream_iterator<std::string>(stream), std::istream_iterator<std::string>());
+        if (*it != "1" || vector.Size() != 5) { return false; }
+        for (size_t i = 0; i < 5; ++i)
+        {
+            if (vector[i] != std::to_string(i)) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool VectorTest::EraseRange()
+{
+    //EraseRange(iterator first, iterator last)
+    //RemoveIf(Predicate predicate)
+    //EraseIf(Predicate predicate)
+    //EraseIndices(const IndexContainer& indices)
+
+    {
+        Vector<size_t> vector;
+        for (size_t i = 0; i < 20; ++i)
+        {
+            vector.PushBack(i);
+        }
+        Vector<size_t>::iterator it = vector.EraseRange(vector.begin() + 2, vector.begin() + 5);
+        if (*it != 5 || vector.Size() != 17 || vector[1] != 1 || vector[16] != 19) { return false; }
+
+        size_t erased = vector.EraseIf([](size_t value) { return value % 2 == 0; });
+        if (erased != 8 || vector.Size() != 9) { return false; }
+        if (vector[0] != 1) { return false; }
+        for (size_t i = 1; i < 9; ++i)
+        {
+            if (vector[i] != 2 * i + 3) { return false; }
+        }
+
+        Vector<size_t> indices = { 0, 3, 3, 4, 9, 42 };
+        erased = vector.EraseIndices(indices);
+        if (erased != 3 || vector.Size() != 6) { return false; }
+        const size_t expected[] = { 5, 7, 13, 15, 17, 19 };
+        for (size_t i = 0; i < 6; ++i)
+        {
+            if (vector[i] != expected[i]) { return false; }
+        }
+
+        vector.EraseRange(vector.begin(), vector.end());
+        if (!vector.IsEmpty()) { return false; }
+        if (vector.EraseIf([](size_t) { return true; }) != 0) { return false; }
+    }
+    {
+        Vector<std::string> vector;
+        for (size_t i = 0; i < 20; ++i)
+        {
+            vector.PushBack(std::to_string(i));
+        }
+        vector.EraseRange(vector.begin() + 15, vector.end());
+        if (vector.Size() != 15 || vector.Back() != "14") { return false; }
+
+        Vector<std::string>::iterator new_end = vector.RemoveIf([](const std::string& value) { return value.size() > 1; });
+        if (new_end != vector.begin() + 10 || vector[9] != "9") { return false; }
+        vector.EraseRange(new_end, vector.end());
+        if (vector.Size() != 10) { return false; }
+
+        size_t erased = vector.EraseIf([](const std::string& value) { return value == "0" || value == "5"; });
+        if (erased != 2 || vector.Size() != 8 || vector[0] != "1" || vector[4] != "6") { return false; }
+
+        Vector<size_t> indices = { 1, 2, 7 };
+        erased = vector.EraseIndices(indices);
+        if (erased != 3 || vector.Size() != 5) { return false; }
+        const char* expected[] = { "1", "4", "6", "7", "8" };
+        for (size_t i = 0; i < 5; ++i)
+        {
+            if (vector[i] != expected[i]) { return false; }
+        }
+    }
+    {
+        Vector<TestStruct> vector;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            vector.PushBack(TestStruct((float)i));
+        }
+        size_t erased = vector.EraseIf([](const TestStruct& value) { return ((size_t)value.x) % 10 == 0; });
+        if (erased != 10 || vector.Size() != 90) { return false; }
+        if (vector[0] != TestStruct(1.0f) || vector[9] != TestStruct(11.0f) || vector.Back() != TestStruct(99.0f)) { return false; }
+
+        vector.EraseRange(vector.begin(), vector.begin() + 9);
+        if (vector.Size() != 81 || vector.Front() != TestStruct(11.0f)) { return false; }
+
+        Vector<size_t> indices;
+        for (size_t i = 0; i < 81; i += 3)
+        {
+            indices.PushBack(i);
+        }
+        erased = vector.EraseIndices(indices);
+        if (erased != 27 || vector.Size() != 54) { return false; }
+        if (vector[0] != TestStruct(12.0f) || vector[1] != TestStruct(13.0f) || vector[2] != TestStruct(15.0f)) { return false; }
+
+        vector.PushBack(TestStruct(1000.0f));
+        if (vector.Back() != TestStruct(1000.0f)) { return false; }
+    }
+    {
+        //A predicate that throws keeps the elements it did not delete
+        Vector<TestStruct> vector;
+        for (size_t i = 0; i < 8; ++i)
+        {
+            vector.PushBack(TestStruct((float)i));
+        }
+        try
+        {
+            vector.EraseIf([](const TestStruct& value)
+            {
+                if (value.x == 5.0f) { throw std::runtime_error("Predicate"); }
+                return value.x == 1.0f || value.x == 4.0f;
+            });
+            return false;
+        }
+        catch (const std::runtime_error&) {}
+
+        const float expected[] = { 0.0f, 2.0f, 3.0f, 5.0f, 6.0f, 7.0f };
+        if (vector.Size() != 6) { return false; }
+        for (size_t i = 0; i < 6; ++i)
+        {
+            if (vector[i] != TestStruct(expected[i])) { return false; }
+        }
+    }
+
+    return true;
+}
+
+bool VectorTest::Allocators()
+{
+    //Vector(const Allocator& allocator)
+    //GetAllocator()
+
+    if (!IsMoveAssignmentNoexceptOnlyWithEqualAllocators<Vector<size_t>, PmrVector<size_t>>()) { return false; }
+
+    {
+        CountingResource resource;
+        {
+            PmrVector<size_t> vector(&resource);
+            for (size_t i = 0; i < 100; ++i)
+            {
+                vector.PushBack(i);
+            }
+
+            if (resource.Allocations() == 0) { return false; }
+            if (resource.BytesInUse() != vector.Capacity() * sizeof(size_t)) { return false; }
+
+            PmrVector<size_t> copy(vector);
+            if (copy.GetAllocator().resource() == &resource) { return false; }
+            if (copy != vector) { return false; }
+
+            PmrVector<size_t> moved(std::move(vector));
+            if (moved.GetAllocator().resource() != &resource) { return false; }
+            if (moved.Size() != 100 || moved[99] != 99) { return false; }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+        if (resource.Allocations() != resource.Deallocations()) { return false; }
+    }
+    {
+        CountingResource resource0;
+        CountingResource resource1;
+        {
+            PmrVector<std::string> vector0(&resource0);
+            PmrVector<std::string> vector1(&resource1);
+            for (size_t i = 0; i < 10; ++i)
+            {
+                vector0.PushBack(std::to_string(i));
+            }
+
+            //The allocator does not propagate, the elements are moved into memory of resource1
+            vector1 = std::move(vector0);
+
+            if (vector1.GetAllocator().resource() != &resource1) { return false; }
+            if (!vector0.IsEmpty() || vector1.Size() != 10) { return false; }
+            if (resource0.BytesInUse() != 0 || resource1.BytesInUse() == 0) { return false; }
+            for (size_t i = 0; i < vector1.Size(); ++i)
+            {
+                if (vector1[i] != std::to_string(i)) { return false; }
+            }
+        }
+
+        if (resource1.BytesInUse() != 0) { return false; }
+    }
+    {
+        //The default allocator does not increase the size of the container
+        if (sizeof(Vector<TestStruct>) != 3 * sizeof(size_t) + sizeof(TestStruct*)) { return false; }
+
+        CountingResource resource;
+        {
+            PmrVector<TestStruct> vector(4, &resource);
+            for (size_t i = 0; i < 20; ++i)
+            {
+                vector.EmplaceBack((float)i);
+            }
+            vector.Shrink();
+
+            if (vector.Capacity() != 20) { return false; }
+            if (resource.BytesInUse() != 20 * sizeof(TestStruct)) { return false; }
+            for (size_t i = 0; i < vector.Size(); ++i)
+            {
+                if (vector[i] != TestStruct((float)i)) { return false; }
+            }
+        }
+
+        if (resource.BytesInUse() != 0) { return false; }
+    }
 
     return true;
 }
@@ -22,4 +22,9 @@ public:
     static bool Clear();
     static bool Append();
     static bool Swap();
+    static bool Growth();
+    static bool Relocation();
+    static bool InsertRange();
+    static bool EraseRange();
+    static bool Allocators();
 };
@@ -0,0 +1,119 @@
+#include "ArenaPerformance.hpp"
+
+#include <iostream> //For std::cout
+
+static std::stringstream s_FileBuffer;
+
+void ArenaPerformance::RunAllTest()
+{
+    s_FileBuffer << "Arena Performance Test:" << std::endl;
+
+    PushBackTeardown();
+    Teardown();
+    PushBackTeardownNonTrivial();
+}
+
+/*
+* PRIVATE IMPLEMENTATIONS
+*/
+
+void ArenaPerformance::PushBackTeardown()
+{
+    auto heap_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            List<size_t> list;
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                list.PushBack(i);
+            }
+        }
+        return timer.Stop();
+    };
+    auto arena_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            MonotonicArena arena;
+            List<size_t, ArenaAllocator<size_t>> list(&arena);
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                list.PushBack(i);
+            }
+        }
+        return timer.Stop();
+    };
+
+    std::cout << "Testing PushBack And Teardown Performance" << std::endl;
+    ArenaPerformance::Test(s_FileBuffer, "PushBack And Teardown", "size_t", heap_predicate, arena_predicate);
+    Serializer::SerializePerformance("Arena_Results.txt", s_FileBuffer);
+}
+
+void ArenaPerformance::Teardown()
+{
+    auto heap_predicate = [](Timer& timer) -> double
+    {
+        List<size_t>* list = new List<size_t>();
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            list->PushBack(i);
+        }
+
+        timer.Start();
+        delete list;
+        return timer.Stop();
+    };
+    auto arena_predicate = [](Timer& timer) -> double
+    {
+        MonotonicArena* arena = new MonotonicArena();
+        List<size_t, ArenaAllocator<size_t>>* list = new List<size_t, ArenaAllocator<size_t>>(arena);
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            list->PushBack(i);
+        }
+
+        timer.Start();
+        delete list;
+        delete arena;
+        return timer.Stop();
+    };
+
+    std::cout << "Testing Teardown Performance" << std::endl;
+    ArenaPerformance::Test(s_FileBuffer, "Teardown", "size_t", heap_predicate, arena_predicate);
+    Serializer::SerializePerformance("Arena_Results.txt", s_FileBuffer);
+}
+
+void ArenaPerformance::PushBackTeardownNonTrivial()
+{
+    //The elements are destroyed one by one, only the node deallocations are saved
+    auto heap_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            List<TestStruct> list;
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                list.EmplaceBack((float)i);
+            }
+        }
+        return timer.Stop();
+    };
+    auto arena_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            MonotonicArena arena;
+            List<TestStruct, ArenaAllocator<TestStruct>> list(&arena);
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                list.EmplaceBack((float)i);
+            }
+        }
+        return timer.Stop();
+    };
+
+    std::cout << "Testing PushBack And Teardown Non Trivial Performance" << std::endl;
+    ArenaPerformance::Test(s_FileBuffer, "PushBack And Teardown Non Trivial", "TestStruct", heap_predicate, arena_predicate);
+    Serializer::SerializePerformance("Arena_Results.txt", s_FileBuffer);
+}
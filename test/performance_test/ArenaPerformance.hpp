@@ -0,0 +1,97 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* This class is for test the performance of the containers on a MonotonicArena vs the global heap.
+* The workloads build a container and tear it down, like a request handler does.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include "../Serializer.hpp"
+#include "../TestStruct.hpp"
+#include "../Timer.hpp"
+
+#include <sstream>  //For stringstream
+
+#include "List.hpp"
+#include "MonotonicArena.hpp"
+
+class ArenaPerformance
+{
+    static constexpr size_t ITERATIONS = 10;
+    static constexpr size_t ELEMENTS = 1000000;
+
+public:
+    static void RunAllTest();
+
+public:
+    static void PushBackTeardown();
+    static void Teardown();
+    static void PushBackTeardownNonTrivial();
+
+private:
+    template <typename Predicate1, typename Predicate2>
+    static void Test(std::stringstream& stream, const std::string& test_name, const std::string& data_type,
+        Predicate1 heap_predicate, Predicate2 arena_predicate)
+    {
+        double heap_time = 0.0;
+        double arena_time = 0.0;
+
+        double heap_best = (double)INFINITY;
+        double heap_worst = 0.0;
+        double heap_average = 0.0;
+        double arena_best = (double)INFINITY;
+        double arena_worst = 0.0;
+        double arena_average = 0.0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                heap_time = heap_predicate(timer);
+
+                if (heap_time < heap_best) { heap_best = heap_time; }
+                if (heap_time > heap_worst) { heap_worst = heap_time; }
+                heap_average += heap_time;
+
+                arena_time = arena_predicate(timer);
+
+                if (arena_time < arena_best) { arena_best = arena_time; }
+                if (arena_time > arena_worst) { arena_worst = arena_time; }
+                arena_average += arena_time;
+            }
+
+            heap_average /= (double)ITERATIONS;
+            arena_average /= (double)ITERATIONS;
+
+            Serializer::WriteResults(stream, "List (heap)", "List (arena)", test_name, data_type, ELEMENTS, ITERATIONS, heap_best, heap_worst, heap_average, arena_best, arena_worst, arena_average);
+        }
+    }
+};
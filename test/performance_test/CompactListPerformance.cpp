@@ -0,0 +1,150 @@
+#include "CompactListPerformance.hpp"
+
+#include <iostream> //For std::cout
+
+static std::stringstream s_FileBuffer;
+
+void CompactListPerformance::RunAllTest()
+{
+    s_FileBuffer << "CompactList Performance Test:" << std::endl;
+
+    PushBack();
+    Iterate();
+    EraseAndRefill();
+    Footprint();
+}
+
+/*
+* PRIVATE IMPLEMENTATIONS
+*/
+
+void CompactListPerformance::PushBack()
+{
+    auto list_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            List<size_t> list;
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                list.PushBack(i);
+            }
+        }
+        return timer.Stop();
+    };
+    auto compact_list_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            CompactList<size_t> list;
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                list.PushBack(i);
+            }
+        }
+        return timer.Stop();
+    };
+
+    std::cout << "Testing CompactList PushBack Performance" << std::endl;
+    CompactListPerformance::Test(s_FileBuffer, "PushBack", "size_t", list_predicate, compact_list_predicate);
+    Serializer::SerializePerformance("CompactList_Results.txt", s_FileBuffer);
+}
+
+void CompactListPerformance::Iterate()
+{
+    auto list_predicate = [](Timer& timer) -> double
+    {
+        List<size_t> list;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            list.PushBack(i);
+        }
+
+        timer.Start();
+        size_t sum = 0;
+        for (List<size_t>::iterator it = list.begin(); it != list.end(); ++it)
+        {
+            sum += *it;
+        }
+        Timer::Consume(sum);
+        return timer.Stop();
+    };
+    auto compact_list_predicate = [](Timer& timer) -> double
+    {
+        CompactList<size_t> list;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            list.PushBack(i);
+        }
+
+        timer.Start();
+        size_t sum = 0;
+        for (CompactList<size_t>::iterator it = list.begin(); it != list.end(); ++it)
+        {
+            sum += *it;
+        }
+        Timer::Consume(sum);
+        return timer.Stop();
+    };
+
+    std::cout << "Testing CompactList Iterate Performance" << std::endl;
+    CompactListPerformance::Test(s_FileBuffer, "Iterate", "size_t", list_predicate, compact_list_predicate);
+    Serializer::SerializePerformance("CompactList_Results.txt", s_FileBuffer);
+}
+
+void CompactListPerformance::EraseAndRefill()
+{
+    //Every second element is erased and pushed again, both containers reuse the freed nodes
+    auto list_predicate = [](Timer& timer) -> double
+    {
+        List<TestStruct> list;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            list.EmplaceBack((float)i);
+        }
+
+        timer.Start();
+        for (List<TestStruct>::iterator it = list.begin(); it != list.end();)
+        {
+            it = list.Erase(it);
+            ++it;
+        }
+        for (size_t i = 0; i < ELEMENTS / 2; ++i)
+        {
+            list.EmplaceBack((float)i);
+        }
+        return timer.Stop();
+    };
+    auto compact_list_predicate = [](Timer& timer) -> double
+    {
+        CompactList<TestStruct> list;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            list.EmplaceBack((float)i);
+        }
+
+        timer.Start();
+        for (CompactList<TestStruct>::iterator it = list.begin(); it != list.end();)
+        {
+            it = list.Erase(it);
+            ++it;
+        }
+        for (size_t i = 0; i < ELEMENTS / 2; ++i)
+        {
+            list.EmplaceBack((float)i);
+        }
+        return timer.Stop();
+    };
+
+    std::cout << "Testing CompactList Erase And Refill Performance" << std::endl;
+    CompactListPerformance::Test(s_FileBuffer, "Erase And Refill", "TestStruct", list_predicate, compact_list_predicate);
+    Serializer::SerializePerformance("CompactList_Results.txt", s_FileBuffer);
+}
+
+void CompactListPerformance::Footprint()
+{
+    std::cout << "Testing CompactList Memory Footprint" << std::endl;
+    CompactListPerformance::TestFootprint<size_t>(s_FileBuffer, "size_t");
+    CompactListPerformance::TestFootprint<TestStruct>(s_FileBuffer, "TestStruct");
+    Serializer::SerializePerformance("CompactList_Results.txt", s_FileBuffer);
+}
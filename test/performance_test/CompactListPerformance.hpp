@@ -0,0 +1,120 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* This class is for test the performance and the memory footprint of CompactList vs List.
+* The footprint is measured through a CountingResource, so it includes every byte the containers request.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include "../Serializer.hpp"
+#include "../TestStruct.hpp"
+#include "../Timer.hpp"
+#include "../CountingResource.hpp"
+
+#include <sstream>  //For stringstream
+
+#include "List.hpp"
+#include "CompactList.hpp"
+
+class CompactListPerformance
+{
+    static constexpr size_t ITERATIONS = 10;
+    static constexpr size_t ELEMENTS = 1000000;
+
+public:
+    static void RunAllTest();
+
+public:
+    static void PushBack();
+    static void Iterate();
+    static void EraseAndRefill();
+    static void Footprint();
+
+private:
+    template <typename Predicate1, typename Predicate2>
+    static void Test(std::stringstream& stream, const std::string& test_name, const std::string& data_type,
+        Predicate1 list_predicate, Predicate2 compact_list_predicate)
+    {
+        double list_time = 0.0;
+        double compact_list_time = 0.0;
+
+        double list_best = (double)INFINITY;
+        double list_worst = 0.0;
+        double list_average = 0.0;
+        double compact_list_best = (double)INFINITY;
+        double compact_list_worst = 0.0;
+        double compact_list_average = 0.0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                list_time = list_predicate(timer);
+
+                if (list_time < list_best) { list_best = list_time; }
+                if (list_time > list_worst) { list_worst = list_time; }
+                list_average += list_time;
+
+                compact_list_time = compact_list_predicate(timer);
+
+                if (compact_list_time < compact_list_best) { compact_list_best = compact_list_time; }
+                if (compact_list_time > compact_list_worst) { compact_list_worst = compact_list_time; }
+                compact_list_average += compact_list_time;
+            }
+
+            list_average /= (double)ITERATIONS;
+            compact_list_average /= (double)ITERATIONS;
+
+            Serializer::WriteResults(stream, "List", "CompactList", test_name, data_type, ELEMENTS, ITERATIONS, list_best, list_worst, list_average, compact_list_best, compact_list_worst, compact_list_average);
+        }
+    }
+
+    /**
+    * @brief: Fills both containers on their own CountingResource and writes the bytes in use.
+    */
+    template <typename T>
+    static void TestFootprint(std::stringstream& stream, const std::string& data_type)
+    {
+        CountingResource list_resource;
+        CountingResource compact_list_resource;
+        {
+            PmrList<T> list(&list_resource);
+            PmrCompactList<T> compact_list(&compact_list_resource);
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                list.EmplaceBack();
+                compact_list.EmplaceBack();
+            }
+
+            Serializer::WriteFootprint(stream, "List", "CompactList", data_type, ELEMENTS, list_resource.BytesInUse(), compact_list_resource.BytesInUse());
+        }
+    }
+};
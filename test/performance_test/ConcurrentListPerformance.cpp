@@ -0,0 +1,33 @@
+#include "ConcurrentListPerformance.hpp"
+
+#include <iostream> //For std::cout
+
+static std::stringstream s_FileBuffer;
+
+void ConcurrentListPerformance::RunAllTest()
+{
+    s_FileBuffer << "ConcurrentList Performance Test:" << std::endl;
+
+    ReadMostly();
+    WriteHeavy();
+}
+
+/*
+* PRIVATE IMPLEMENTATIONS
+*/
+
+void ConcurrentListPerformance::ReadMostly()
+{
+    //80% lookups, 10% insertions and 10% erases
+    std::cout << "Testing ConcurrentList Read Mostly Performance" << std::endl;
+    ConcurrentListPerformance::Scale(s_FileBuffer, "Read Mostly", 2);
+    Serializer::SerializePerformance("ConcurrentList_Results.txt", s_FileBuffer);
+}
+
+void ConcurrentListPerformance::WriteHeavy()
+{
+    //40% lookups, 30% insertions and 30% erases
+    std::cout << "Testing ConcurrentList Write Heavy Performance" << std::endl;
+    ConcurrentListPerformance::Scale(s_FileBuffer, "Write Heavy", 6);
+    Serializer::SerializePerformance("ConcurrentList_Results.txt", s_FileBuffer);
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* This class is for test the throughput of ConcurrentList vs a List protected by a mutex, from one thread to all the hardware threads.
+* Both containers keep a sorted set of keys and run the same mix of lookups, insertions and erases,
+* the List is searched linearly like the ConcurrentList, so only the synchronization differs.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include "../Serializer.hpp"
+#include "../Timer.hpp"
+
+#include <sstream>  //For stringstream
+#include <string>  //For std::to_string
+#include <mutex>  //For std::mutex
+#include <thread>  //For std::thread
+
+#include "List.hpp"
+#include "Vector.hpp"
+#include "ConcurrentList.hpp"
+
+class ConcurrentListPerformance
+{
+    static constexpr size_t ITERATIONS = 10;
+    static constexpr size_t KEYS = 1024;
+    static constexpr size_t OPERATIONS = 400000;
+
+    /*
+    * Sorted set on a List, every operation holds the mutex.
+    */
+    class LockedList
+    {
+    public:
+        bool Insert(size_t key)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            List<size_t>::iterator it = LowerBound(key);
+            if (it != m_List.end() && *it == key) { return false; }
+            m_List.Insert(it, key);
+            return true;
+        }
+
+        bool Erase(size_t key)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            List<size_t>::iterator it = LowerBound(key);
+            if (it == m_List.end() || *it != key) { return false; }
+            m_List.Erase(it);
+            return true;
+        }
+
+        bool Contains(size_t key)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            List<size_t>::iterator it = LowerBound(key);
+            return it != m_List.end() && *it == key;
+        }
+
+    private:
+        List<size_t>::iterator LowerBound(size_t key)
+        {
+            List<size_t>::iterator it = m_List.begin();
+            while (it != m_List.end() && *it < key)
+            {
+                ++it;
+            }
+            return it;
+        }
+
+    private:
+        std::mutex m_Mutex;
+        List<size_t> m_List;
+    };
+
+public:
+    static void RunAllTest();
+
+public:
+    static void ReadMostly();
+    static void WriteHeavy();
+
+private:
+    /**
+    * @brief: Runs the workload on both containers from one thread to all the hardware threads, doubling the threads each time.
+    * @details: Every thread runs its share of the operations, one of every writes_per_ten operations is an insertion or an erase.
+    */
+    static void Scale(std::stringstream& stream, const std::string& test_name, size_t writes_per_ten)
+    {
+        const size_t hardware_threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+        for (size_t threads = 1; ; threads *= 2)
+        {
+            if (threads > hardware_threads) { threads = hardware_threads; }
+
+            auto locked_list_predicate = [threads, writes_per_ten](Timer& timer) -> double
+            {
+                LockedList list;
+                return Run(list, timer, threads, writes_per_ten);
+            };
+            auto concurrent_list_predicate = [threads, writes_per_ten](Timer& timer) -> double
+            {
+                ConcurrentList<size_t> list;
+                return Run(list, timer, threads, writes_per_ten);
+            };
+
+            Test(stream, test_name + ", " + std::to_string(threads) + " Threads", "size_t", locked_list_predicate, concurrent_list_predicate);
+            if (threads == hardware_threads) { return; }
+        }
+    }
+
+    /**
+    * @brief: Fills half of the keys and times the threads running the mix of operations.
+    */
+    template<typename ListType>
+    static double Run(ListType& list, Timer& timer, size_t threads, size_t writes_per_ten)
+    {
+        for (size_t key = 0; key < KEYS; key += 2)
+        {
+            list.Insert(key);
+        }
+
+        //Every thread writes its own result, they are consumed after the join
+        Vector<size_t> results;
+        for (size_t t = 0; t < threads; ++t)
+        {
+            results.PushBack(0);
+        }
+
+        Vector<std::thread> workers;
+        timer.Start();
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers.EmplaceBack([&list, &results, t, threads, writes_per_ten]()
+            {
+                size_t seed = t * 0x9E3779B97F4A7C15ull + 1;
+                size_t found = 0;
+                for (size_t i = 0; i < OPERATIONS / threads; ++i)
+                {
+                    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+                    const size_t key = (size_t)(seed >> 33) % KEYS;
+                    const size_t operation = (size_t)(seed >> 20) % 10;
+
+                    if (operation >= writes_per_ten) { found += list.Contains(key); }
+                    else if (operation % 2 == 0) { found += list.Insert(key); }
+                    else { found += list.Erase(key); }
+                }
+                results[t] = found;
+            });
+        }
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers[t].join();
+        }
+        const double time = timer.Stop();
+
+        size_t found = 0;
+        for (size_t t = 0; t < threads; ++t)
+        {
+            found += results[t];
+        }
+        Timer::Consume(found);
+
+        return time;
+    }
+
+    template <typename Predicate1, typename Predicate2>
+    static void Test(std::stringstream& stream, const std::string& test_name, const std::string& data_type,
+        Predicate1 locked_list_predicate, Predicate2 concurrent_list_predicate)
+    {
+        double locked_list_time = 0.0;
+        double concurrent_list_time = 0.0;
+
+        double locked_list_best = (double)INFINITY;
+        double locked_list_worst = 0.0;
+        double locked_list_average = 0.0;
+        double concurrent_list_best = (double)INFINITY;
+        double concurrent_list_worst = 0.0;
+        double concurrent_list_average = 0.0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                locked_list_time = locked_list_predicate(timer);
+
+                if (locked_list_time < locked_list_best) { locked_list_best = locked_list_time; }
+                if (locked_list_time > locked_list_worst) { locked_list_worst = locked_list_time; }
+                locked_list_average += locked_list_time;
+
+                concurrent_list_time = concurrent_list_predicate(timer);
+
+                if (concurrent_list_time < concurrent_list_best) { concurrent_list_best = concurrent_list_time; }
+                if (concurrent_list_time > concurrent_list_worst) { concurrent_list_worst = concurrent_list_time; }
+                concurrent_list_average += concurrent_list_time;
+            }
+
+            locked_list_average /= (double)ITERATIONS;
+            concurrent_list_average /= (double)ITERATIONS;
+
+            Serializer::WriteResults(stream, "Locked List", "ConcurrentList", test_name, data_type, OPERATIONS, ITERATIONS, locked_list_best, locked_list_worst, locked_list_average, concurrent_list_best, concurrent_list_worst, concurrent_list_average);
+        }
+    }
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* Growth policy wrapper used by the performance tests to count the reallocations of the containers.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include <cstddef> //For size_t
+
+/*
+* Growth policy wrapper that records the reallocations performed and the peak of memory used during them.
+*/
+template<typename Policy>
+struct CountingGrowthPolicy
+{
+    static size_t NextCapacity(size_t capacity, size_t element_size) noexcept
+    {
+        const size_t next_capacity = Policy::NextCapacity(capacity, element_size);
+        const size_t bytes = (capacity + next_capacity) * element_size;
+
+        ++s_Reallocations;
+        if (bytes > s_PeakBytes) { s_PeakBytes = bytes; }
+
+        return next_capacity;
+    }
+
+    static void Reset() noexcept
+    {
+        s_Reallocations = 0;
+        s_PeakBytes = 0;
+    }
+
+    static inline size_t s_Reallocations = 0;
+    static inline size_t s_PeakBytes = 0;
+};
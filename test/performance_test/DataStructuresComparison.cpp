@@ -38,9 +38,27 @@ void DataStructuresComparison::PushBack()
             list.PushBack(aux);
         }
     };
+    auto deque_predicate = [](Deque<TestStruct>& deque) -> void
+    {
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            TestStruct aux((float)i);
+            deque.PushBack(aux);
+        }
+    };
+    auto tiered_vector_predicate = [](TieredVector<TestStruct>& vector) -> void
+    {
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            TestStruct aux((float)i);
+            vector.PushBack(aux);
+        }
+    };
 
     std::cout << "Testing PushBack Performance" << std::endl;
-    DataStructuresComparison::Test(s_FileBuffer, "PushBack", vector_predicate, list_predicate);
+    auto averages = DataStructuresComparison::Test(s_FileBuffer, "PushBack", vector_predicate, list_predicate);
+    DataStructuresComparison::TestContender<Deque<TestStruct>>(s_FileBuffer, "Deque", deque_predicate, averages);
+    DataStructuresComparison::TestContender<TieredVector<TestStruct>>(s_FileBuffer, "TieredVector", tiered_vector_predicate, averages);
     Serializer::SerializePerformance("Comparison.txt", s_FileBuffer);
 }
 
@@ -63,9 +81,27 @@ void DataStructuresComparison::InsertFront()
             list.PushFront(aux);
         }
     };
+    auto deque_predicate = [elements](Deque<TestStruct>& deque) -> void
+    {
+        for (size_t i = 0; i < elements; ++i)
+        {
+            TestStruct aux((float)i);
+            deque.PushFront(aux);
+        }
+    };
+    auto tiered_vector_predicate = [elements](TieredVector<TestStruct>& vector) -> void
+    {
+        for (size_t i = 0; i < elements; ++i)
+        {
+            TestStruct aux((float)i);
+            vector.PushFront(aux);
+        }
+    };
 
     std::cout << "Testing Insert at Front Performance" << std::endl;
-    DataStructuresComparison::Test(s_FileBuffer, "Insert Front", vector_predicate, list_predicate, elements);
+    auto averages = DataStructuresComparison::Test(s_FileBuffer, "Insert Front", vector_predicate, list_predicate, elements);
+    DataStructuresComparison::TestContender<Deque<TestStruct>>(s_FileBuffer, "Deque", deque_predicate, averages, elements);
+    DataStructuresComparison::TestContender<TieredVector<TestStruct>>(s_FileBuffer, "TieredVector", tiered_vector_predicate, averages, elements);
     Serializer::SerializePerformance("Comparison.txt", s_FileBuffer);
 }
 
@@ -90,9 +126,29 @@ void DataStructuresComparison::InsertMiddle()
             list.Insert(list.begin() + middle, aux);
         }
     };
+    auto deque_predicate = [elements](Deque<TestStruct>& deque) -> void
+    {
+        for (size_t i = 0; i < elements; ++i)
+        {
+            TestStruct aux((float)i);
+            size_t middle = deque.Size() / 2;
+            deque.Insert(middle, aux);
+        }
+    };
+    auto tiered_vector_predicate = [elements](TieredVector<TestStruct>& vector) -> void
+    {
+        for (size_t i = 0; i < elements; ++i)
+        {
+            TestStruct aux((float)i);
+            size_t middle = vector.Size() / 2;
+            vector.Insert(middle, aux);
+        }
+    };
 
     std::cout << "Testing Insert at Middle Performance" << std::endl;
-    DataStructuresComparison::Test(s_FileBuffer, "Insert Middle", vector_predicate, list_predicate, elements);
+    auto averages = DataStructuresComparison::Test(s_FileBuffer, "Insert Middle", vector_predicate, list_predicate, elements);
+    DataStructuresComparison::TestContender<Deque<TestStruct>>(s_FileBuffer, "Deque", deque_predicate, averages, elements);
+    DataStructuresComparison::TestContender<TieredVector<TestStruct>>(s_FileBuffer, "TieredVector", tiered_vector_predicate, averages, elements);
     Serializer::SerializePerformance("Comparison.txt", s_FileBuffer);
 }
 
@@ -125,8 +181,39 @@ void DataStructuresComparison::InsertRandom()
             list.Insert(list.begin() + *it, aux);
         }
     };
+    auto unrolled_list_predicate = [&random_numbers, elements](UnrolledList<TestStruct>& list) -> void
+    {
+        Vector<size_t>::const_iterator it = random_numbers.cbegin();
+        for (size_t i = 0; i < elements; ++i, ++it)
+        {
+            TestStruct aux((float)i);
+            list.Insert(list.begin() + *it, aux);
+        }
+    };
+
+    auto deque_predicate = [&random_numbers, elements](Deque<TestStruct>& deque) -> void
+    {
+        Vector<size_t>::const_iterator it = random_numbers.cbegin();
+        for (size_t i = 0; i < elements; ++i, ++it)
+        {
+            TestStruct aux((float)i);
+            deque.Insert(*it, aux);
+        }
+    };
+    auto tiered_vector_predicate = [&random_numbers, elements](TieredVector<TestStruct>& vector) -> void
+    {
+        Vector<size_t>::const_iterator it = random_numbers.cbegin();
+        for (size_t i = 0; i < elements; ++i, ++it)
+        {
+            TestStruct aux((float)i);
+            vector.Insert(*it, aux);
+        }
+    };
 
     std::cout << "Testing Insert at Random Performance" << std::endl;
-    DataStructuresComparison::Test(s_FileBuffer, "Insert Random", vector_predicate, list_predicate, elements);
+    auto averages = DataStructuresComparison::Test(s_FileBuffer, "Insert Random", vector_predicate, list_predicate, elements);
+    DataStructuresComparison::TestContender<UnrolledList<TestStruct>>(s_FileBuffer, "UnrolledList", unrolled_list_predicate, averages, elements);
+    DataStructuresComparison::TestContender<Deque<TestStruct>>(s_FileBuffer, "Deque", deque_predicate, averages, elements);
+    DataStructuresComparison::TestContender<TieredVector<TestStruct>>(s_FileBuffer, "TieredVector", tiered_vector_predicate, averages, elements);
     Serializer::SerializePerformance("Comparison.txt", s_FileBuffer);
 }
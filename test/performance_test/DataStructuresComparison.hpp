@@ -38,11 +38,15 @@ Copyright (c) 2020 Luis Poveda Cano
 #include "../Timer.hpp"
 #include "Vector.hpp"
 #include "List.hpp"
+#include "UnrolledList.hpp"
+#include "Deque.hpp"
+#include "TieredVector.hpp"
 
 #include <iostream> //For std::fixed
 #include <iomanip>  //For std::setprecision
 #include <string>
 #include <sstream>  //For std::stringstream
+#include <utility>  //For std::pair
 
 class DataStructuresComparison
 {
@@ -58,8 +62,12 @@ public:
     static void InsertRandom();
 
 private:
+    /*
+    * Times the vector and list predicates and writes the comparison.
+    * Returns the vector and list average times so other containers can be compared with them.
+    */
     template <typename Predicate1, typename Predicate2>
-    static void Test(std::stringstream& stream, const std::string& test_name,
+    static std::pair<double, double> Test(std::stringstream& stream, const std::string& test_name,
         Predicate1 vector_predicate, Predicate2 list_predicate, size_t elements = ELEMENTS)
     {
         double vector_time = 0.0;
@@ -100,6 +108,40 @@ private:
         }
 
         Serializer::WriteResults(stream, test_name, "TestStruct", elements, ITERATIONS, vector_best, vector_worst, vector_average, list_best, list_worst, list_average);
+
+        return std::pair<double, double>(vector_average, list_average);
+    }
+
+    /*
+    * Times the predicate with an extra container and writes its stats after the vector and list comparison.
+    */
+    template <typename Container, typename Predicate>
+    static void TestContender(std::stringstream& stream, const std::string& container_name, Predicate predicate,
+        const std::pair<double, double>& averages, size_t elements = ELEMENTS)
+    {
+        double time = 0.0;
+        double best = (double)INFINITY;
+        double worst = 0.0;
+        double average = 0.0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                Container container;
+                timer.Start();
+                predicate(container);
+                time = timer.Stop();
+
+                if (time < best) { best = time; }
+                if (time > worst) { worst = time; }
+                average += time;
+            }
+
+            average /= (double)ITERATIONS;
+        }
+
+        Serializer::WriteContenderResults(stream, container_name, elements, best, worst, average, averages.first, averages.second);
     }
 };
 
@@ -0,0 +1,62 @@
+#include "GapBufferPerformance.hpp"
+
+#include <iostream> //For std::cout
+#include <random>  //For std::mt19937
+
+static std::stringstream s_FileBuffer;
+
+void GapBufferPerformance::RunAllTest()
+{
+    s_FileBuffer << "GapBuffer Performance Test:" << std::endl;
+
+    EditTrace();
+}
+
+/*
+* PRIVATE IMPLEMENTATIONS
+*/
+
+void GapBufferPerformance::EditTrace()
+{
+    const Vector<Edit> trace = BuildTrace();
+
+    std::cout << "Testing GapBuffer Edit Trace Performance" << std::endl;
+    GapBufferPerformance::TestTrace<char>(s_FileBuffer, "char", trace);
+    GapBufferPerformance::TestTrace<TestStruct>(s_FileBuffer, "TestStruct", trace);
+    Serializer::SerializePerformance("GapBuffer_Results.txt", s_FileBuffer);
+}
+
+Vector<GapBufferPerformance::Edit> GapBufferPerformance::BuildTrace()
+{
+    //Every burst moves the cursor up to 64 elements away, then types 8 elements or deletes 4 one time in four
+    std::mt19937 generator(42);
+    Vector<Edit> trace(BURSTS);
+    size_t size = ELEMENTS;
+    size_t cursor = ELEMENTS / 2;
+
+    for (size_t i = 0; i < BURSTS; ++i)
+    {
+        const size_t distance = generator() % 65;
+        if (generator() % 2 == 0) { cursor = cursor > distance ? cursor - distance : 0; }
+        else { cursor = cursor + distance < size ? cursor + distance : size; }
+
+        Edit edit;
+        edit.Position = cursor;
+        edit.Insertion = generator() % 4 != 0 || cursor < 4;
+        edit.Count = edit.Insertion ? 8 : 4;
+        trace.PushBack(edit);
+
+        if (edit.Insertion)
+        {
+            cursor += edit.Count;
+            size += edit.Count;
+        }
+        else
+        {
+            cursor -= edit.Count;
+            size -= edit.Count;
+        }
+    }
+
+    return trace;
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* This class is for test the performance of GapBuffer vs Vector replaying an edit trace.
+* The trace is a sequence of bursts, each burst moves the cursor a short distance and then types or deletes a few elements,
+* like a user editing a document.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include "../Serializer.hpp"
+#include "../TestStruct.hpp"
+#include "../Timer.hpp"
+
+#include <sstream>  //For stringstream
+
+#include "Vector.hpp"
+#include "GapBuffer.hpp"
+
+class GapBufferPerformance
+{
+    static constexpr size_t ITERATIONS = 10;
+    static constexpr size_t ELEMENTS = 100000;
+    static constexpr size_t BURSTS = 2000;
+
+public:
+    static void RunAllTest();
+
+public:
+    static void EditTrace();
+
+public:
+    /*
+    * One burst of the trace, the cursor goes to Position and then Count elements are typed or deleted before it.
+    */
+    struct Edit
+    {
+        size_t Position;
+        size_t Count;
+        bool Insertion;
+    };
+
+private:
+    /**
+    * @brief: Builds the same trace of BURSTS edits over a document of ELEMENTS elements for every run.
+    */
+    static Vector<Edit> BuildTrace();
+
+    /**
+    * @brief: Replays the trace over both containers, only the replay is timed.
+    */
+    template <typename T>
+    static void TestTrace(std::stringstream& stream, const std::string& data_type, const Vector<Edit>& trace)
+    {
+        auto vector_predicate = [&trace](Timer& timer) -> double
+        {
+            Vector<T> vector(ELEMENTS);
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                vector.EmplaceBack();
+            }
+
+            timer.Start();
+            for (size_t i = 0; i < trace.Size(); ++i)
+            {
+                const size_t cursor = trace[i].Position;
+                if (trace[i].Insertion)
+                {
+                    for (size_t j = 0; j < trace[i].Count; ++j)
+                    {
+                        vector.Insert(cursor + j, T());
+                    }
+                }
+                else { vector.EraseRange(vector.begin() + (cursor - trace[i].Count), vector.begin() + cursor); }
+            }
+            Timer::Consume(vector.Size());
+            return timer.Stop();
+        };
+        auto gap_buffer_predicate = [&trace](Timer& timer) -> double
+        {
+            GapBuffer<T> buffer(ELEMENTS);
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                buffer.Emplace();
+            }
+
+            timer.Start();
+            for (size_t i = 0; i < trace.Size(); ++i)
+            {
+                buffer.MoveCursor(trace[i].Position);
+                if (trace[i].Insertion)
+                {
+                    for (size_t j = 0; j < trace[i].Count; ++j)
+                    {
+                        buffer.Emplace();
+                    }
+                }
+                else { buffer.EraseBefore(trace[i].Count); }
+            }
+            Timer::Consume(buffer.Size());
+            return timer.Stop();
+        };
+
+        Test(stream, "Edit Trace", data_type, vector_predicate, gap_buffer_predicate);
+    }
+
+    template <typename Predicate1, typename Predicate2>
+    static void Test(std::stringstream& stream, const std::string& test_name, const std::string& data_type,
+        Predicate1 vector_predicate, Predicate2 gap_buffer_predicate)
+    {
+        double vector_time = 0.0;
+        double gap_buffer_time = 0.0;
+
+        double vector_best = (double)INFINITY;
+        double vector_worst = 0.0;
+        double vector_average = 0.0;
+        double gap_buffer_best = (double)INFINITY;
+        double gap_buffer_worst = 0.0;
+        double gap_buffer_average = 0.0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                vector_time = vector_predicate(timer);
+
+                if (vector_time < vector_best) { vector_best = vector_time; }
+                if (vector_time > vector_worst) { vector_worst = vector_time; }
+                vector_average += vector_time;
+
+                gap_buffer_time = gap_buffer_predicate(timer);
+
+                if (gap_buffer_time < gap_buffer_best) { gap_buffer_best = gap_buffer_time; }
+                if (gap_buffer_time > gap_buffer_worst) { gap_buffer_worst = gap_buffer_time; }
+                gap_buffer_average += gap_buffer_time;
+            }
+
+            vector_average /= (double)ITERATIONS;
+            gap_buffer_average /= (double)ITERATIONS;
+
+            Serializer::WriteResults(stream, "Vector", "GapBuffer", test_name, data_type, ELEMENTS, ITERATIONS, vector_best, vector_worst, vector_average, gap_buffer_best, gap_buffer_worst, gap_buffer_average);
+        }
+    }
+};
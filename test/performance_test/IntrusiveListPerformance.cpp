@@ -0,0 +1,178 @@
+#include "IntrusiveListPerformance.hpp"
+
+#include <iostream> //For std::cout
+
+static std::stringstream s_FileBuffer;
+
+void IntrusiveListPerformance::RunAllTest()
+{
+    s_FileBuffer << "IntrusiveList Performance Test:" << std::endl;
+
+    Touch();
+    ConnectAndDisconnect();
+    Expire();
+}
+
+/*
+* PRIVATE IMPLEMENTATIONS
+*/
+
+void IntrusiveListPerformance::Touch()
+{
+    //Every activity moves the connection to the back of the timeout queue
+    const Vector<size_t> sequence = Sequence();
+
+    auto list_predicate = [&sequence](Timer& timer) -> double
+    {
+        Vector<Connection> connections(ELEMENTS);
+        List<Connection*> timers;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            connections.EmplaceBack();
+            timers.PushBack(&connections[i]);
+            connections[i].TimerIterator = --timers.end();
+        }
+
+        timer.Start();
+        for (size_t i = 0; i < OPERATIONS; ++i)
+        {
+            Connection& connection = connections[sequence[i]];
+            connection.LastActivity = i;
+            timers.Splice(timers.end(), timers, connection.TimerIterator);
+        }
+        Timer::Consume(timers.Front()->LastActivity);
+        return timer.Stop();
+    };
+    auto intrusive_list_predicate = [&sequence](Timer& timer) -> double
+    {
+        Vector<Connection> connections(ELEMENTS);
+        IntrusiveTimers timers;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            connections.EmplaceBack();
+            timers.PushBack(connections[i]);
+        }
+
+        timer.Start();
+        for (size_t i = 0; i < OPERATIONS; ++i)
+        {
+            Connection& connection = connections[sequence[i]];
+            connection.LastActivity = i;
+            timers.Splice(timers.end(), timers, timers.GetIterator(connection));
+        }
+        Timer::Consume(timers.Front().LastActivity);
+        return timer.Stop();
+    };
+
+    std::cout << "Testing IntrusiveList Touch Performance" << std::endl;
+    IntrusiveListPerformance::Test(s_FileBuffer, "Touch", "Connection", list_predicate, intrusive_list_predicate);
+    Serializer::SerializePerformance("IntrusiveList_Results.txt", s_FileBuffer);
+}
+
+void IntrusiveListPerformance::ConnectAndDisconnect()
+{
+    //A connection leaves the timeout queue by reference and a new one takes its place at the back
+    const Vector<size_t> sequence = Sequence();
+
+    auto list_predicate = [&sequence](Timer& timer) -> double
+    {
+        Vector<Connection> connections(ELEMENTS);
+        List<Connection*> timers;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            connections.EmplaceBack();
+            timers.PushBack(&connections[i]);
+            connections[i].TimerIterator = --timers.end();
+        }
+
+        timer.Start();
+        for (size_t i = 0; i < OPERATIONS; ++i)
+        {
+            Connection& connection = connections[sequence[i]];
+            timers.Erase(connection.TimerIterator);
+            connection.Id = i;
+            timers.PushBack(&connection);
+            connection.TimerIterator = --timers.end();
+        }
+        Timer::Consume(timers.Front()->Id);
+        return timer.Stop();
+    };
+    auto intrusive_list_predicate = [&sequence](Timer& timer) -> double
+    {
+        Vector<Connection> connections(ELEMENTS);
+        IntrusiveTimers timers;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            connections.EmplaceBack();
+            timers.PushBack(connections[i]);
+        }
+
+        timer.Start();
+        for (size_t i = 0; i < OPERATIONS; ++i)
+        {
+            Connection& connection = connections[sequence[i]];
+            timers.Erase(connection);
+            connection.Id = i;
+            timers.PushBack(connection);
+        }
+        Timer::Consume(timers.Front().Id);
+        return timer.Stop();
+    };
+
+    std::cout << "Testing IntrusiveList Connect And Disconnect Performance" << std::endl;
+    IntrusiveListPerformance::Test(s_FileBuffer, "Connect And Disconnect", "Connection", list_predicate, intrusive_list_predicate);
+    Serializer::SerializePerformance("IntrusiveList_Results.txt", s_FileBuffer);
+}
+
+void IntrusiveListPerformance::Expire()
+{
+    //The oldest connections are expired from the front of the queue and reconnected at the back
+    auto list_predicate = [](Timer& timer) -> double
+    {
+        Vector<Connection> connections(ELEMENTS);
+        List<Connection*> timers;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            connections.EmplaceBack();
+            timers.PushBack(&connections[i]);
+            connections[i].TimerIterator = --timers.end();
+        }
+
+        timer.Start();
+        for (size_t i = 0; i < OPERATIONS; ++i)
+        {
+            Connection* connection = timers.Front();
+            timers.PopFront();
+            connection->LastActivity = i;
+            timers.PushBack(connection);
+            connection->TimerIterator = --timers.end();
+        }
+        Timer::Consume(timers.Front()->LastActivity);
+        return timer.Stop();
+    };
+    auto intrusive_list_predicate = [](Timer& timer) -> double
+    {
+        Vector<Connection> connections(ELEMENTS);
+        IntrusiveTimers timers;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            connections.EmplaceBack();
+            timers.PushBack(connections[i]);
+        }
+
+        timer.Start();
+        for (size_t i = 0; i < OPERATIONS; ++i)
+        {
+            Connection& connection = timers.Front();
+            timers.PopFront();
+            connection.LastActivity = i;
+            timers.PushBack(connection);
+        }
+        Timer::Consume(timers.Front().LastActivity);
+        return timer.Stop();
+    };
+
+    std::cout << "Testing IntrusiveList Expire Performance" << std::endl;
+    IntrusiveListPerformance::Test(s_FileBuffer, "Expire", "Connection", list_predicate, intrusive_list_predicate);
+    Serializer::SerializePerformance("IntrusiveList_Results.txt", s_FileBuffer);
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* This class is for test the performance of IntrusiveList vs List in the bookkeeping of connections and timers.
+* The List keeps a pointer to every connection and every connection keeps the iterator to its node,
+* that is how a non intrusive list gives constant time erase by reference.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include "../Serializer.hpp"
+#include "../Timer.hpp"
+
+#include <sstream>  //For stringstream
+
+#include "List.hpp"
+#include "Vector.hpp"
+#include "IntrusiveList.hpp"
+
+class IntrusiveListPerformance
+{
+    static constexpr size_t ITERATIONS = 10;
+    static constexpr size_t ELEMENTS = 100000;
+    static constexpr size_t OPERATIONS = 1000000;
+
+    /*
+    * Connection linked in a timeout queue, through its hook or through the iterator to its node.
+    */
+    struct Connection
+    {
+        size_t Id = 0;
+        size_t LastActivity = 0;
+        IntrusiveListHook TimerHook;
+        List<Connection*>::iterator TimerIterator;
+    };
+
+    using IntrusiveTimers = IntrusiveList<Connection, &Connection::TimerHook>;
+
+public:
+    static void RunAllTest();
+
+public:
+    static void Touch();
+    static void ConnectAndDisconnect();
+    static void Expire();
+
+private:
+    /**
+    * @brief: Returns the connections touched by the workload, in a pseudo random order that is the same for both containers.
+    */
+    static Vector<size_t> Sequence()
+    {
+        Vector<size_t> sequence;
+        sequence.Reserve(OPERATIONS);
+        size_t seed = 12345;
+        for (size_t i = 0; i < OPERATIONS; ++i)
+        {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            sequence.PushBack((size_t)(seed >> 33) % ELEMENTS);
+        }
+        return sequence;
+    }
+
+    template <typename Predicate1, typename Predicate2>
+    static void Test(std::stringstream& stream, const std::string& test_name, const std::string& data_type,
+        Predicate1 list_predicate, Predicate2 intrusive_list_predicate)
+    {
+        double list_time = 0.0;
+        double intrusive_list_time = 0.0;
+
+        double list_best = (double)INFINITY;
+        double list_worst = 0.0;
+        double list_average = 0.0;
+        double intrusive_list_best = (double)INFINITY;
+        double intrusive_list_worst = 0.0;
+        double intrusive_list_average = 0.0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                list_time = list_predicate(timer);
+
+                if (list_time < list_best) { list_best = list_time; }
+                if (list_time > list_worst) { list_worst = list_time; }
+                list_average += list_time;
+
+                intrusive_list_time = intrusive_list_predicate(timer);
+
+                if (intrusive_list_time < intrusive_list_best) { intrusive_list_best = intrusive_list_time; }
+                if (intrusive_list_time > intrusive_list_worst) { intrusive_list_worst = intrusive_list_time; }
+                intrusive_list_average += intrusive_list_time;
+            }
+
+            list_average /= (double)ITERATIONS;
+            intrusive_list_average /= (double)ITERATIONS;
+
+            Serializer::WriteResults(stream, "List", "IntrusiveList", test_name, data_type, OPERATIONS, ITERATIONS, list_best, list_worst, list_average, intrusive_list_best, intrusive_list_worst, intrusive_list_average);
+        }
+    }
+};
@@ -0,0 +1,173 @@
+#include "LargeVectorPerformance.hpp"
+
+#include <iostream> //For std::cout
+#include <random>  //For std::mt19937_64
+
+static std::stringstream s_FileBuffer;
+
+void LargeVectorPerformance::RunAllTest()
+{
+    s_FileBuffer << "LargeVector Performance Test:" << std::endl;
+
+    PushBack();
+    RandomRead();
+    LargePushBack();
+    LargeRandomRead();
+}
+
+/*
+* PRIVATE IMPLEMENTATIONS
+*/
+
+void LargeVectorPerformance::PushBack()
+{
+    auto vector_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            Vector<size_t> vector;
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                vector.PushBack(i);
+            }
+        }
+        return timer.Stop();
+    };
+    auto large_vector_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            LargeVector<size_t> vector;
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                vector.PushBack(i);
+            }
+        }
+        return timer.Stop();
+    };
+
+    std::cout << "Testing LargeVector PushBack Performance" << std::endl;
+    LargeVectorPerformance::Test(s_FileBuffer, "Vector", "LargeVector", "PushBack", "size_t", ELEMENTS, vector_predicate, large_vector_predicate);
+    Serializer::SerializePerformance("LargeVector_Results.txt", s_FileBuffer);
+}
+
+void LargeVectorPerformance::RandomRead()
+{
+    auto vector_predicate = [](Timer& timer) -> double
+    {
+        Vector<size_t> vector;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            vector.PushBack(i);
+        }
+        std::mt19937_64 generator(7);
+
+        timer.Start();
+        size_t sum = 0;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            sum += vector[generator() % ELEMENTS];
+        }
+        Timer::Consume(sum);
+        return timer.Stop();
+    };
+    auto large_vector_predicate = [](Timer& timer) -> double
+    {
+        LargeVector<size_t> vector;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            vector.PushBack(i);
+        }
+        std::mt19937_64 generator(7);
+
+        timer.Start();
+        size_t sum = 0;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            sum += vector[generator() % ELEMENTS];
+        }
+        Timer::Consume(sum);
+        return timer.Stop();
+    };
+
+    std::cout << "Testing LargeVector Random Read Performance" << std::endl;
+    LargeVectorPerformance::Test(s_FileBuffer, "Vector", "LargeVector", "Random Read", "size_t", ELEMENTS, vector_predicate, large_vector_predicate);
+    Serializer::SerializePerformance("LargeVector_Results.txt", s_FileBuffer);
+}
+
+void LargeVectorPerformance::LargePushBack()
+{
+    //Vector can not hold this many elements, the huge pages are compared instead
+    auto large_vector_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            LargeVector<size_t> vector;
+            for (size_t i = 0; i < LARGE_ELEMENTS; ++i)
+            {
+                vector.PushBack(i);
+            }
+        }
+        return timer.Stop();
+    };
+    auto huge_pages_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            LargeVector<size_t> vector(LargeVector<size_t>::s_DefaultMaxSize, true);
+            for (size_t i = 0; i < LARGE_ELEMENTS; ++i)
+            {
+                vector.PushBack(i);
+            }
+        }
+        return timer.Stop();
+    };
+
+    std::cout << "Testing LargeVector Large PushBack Performance" << std::endl;
+    LargeVectorPerformance::Test(s_FileBuffer, "LargeVector", "LargeVector Huge Pages", "PushBack", "size_t", LARGE_ELEMENTS, large_vector_predicate, huge_pages_predicate);
+    Serializer::SerializePerformance("LargeVector_Results.txt", s_FileBuffer);
+}
+
+void LargeVectorPerformance::LargeRandomRead()
+{
+    auto large_vector_predicate = [](Timer& timer) -> double
+    {
+        LargeVector<size_t> vector;
+        for (size_t i = 0; i < LARGE_ELEMENTS; ++i)
+        {
+            vector.PushBack(i);
+        }
+        std::mt19937_64 generator(7);
+
+        timer.Start();
+        size_t sum = 0;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            sum += vector[generator() % LARGE_ELEMENTS];
+        }
+        Timer::Consume(sum);
+        return timer.Stop();
+    };
+    auto huge_pages_predicate = [](Timer& timer) -> double
+    {
+        LargeVector<size_t> vector(LargeVector<size_t>::s_DefaultMaxSize, true);
+        for (size_t i = 0; i < LARGE_ELEMENTS; ++i)
+        {
+            vector.PushBack(i);
+        }
+        std::mt19937_64 generator(7);
+
+        timer.Start();
+        size_t sum = 0;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            sum += vector[generator() % LARGE_ELEMENTS];
+        }
+        Timer::Consume(sum);
+        return timer.Stop();
+    };
+
+    std::cout << "Testing LargeVector Large Random Read Performance" << std::endl;
+    LargeVectorPerformance::Test(s_FileBuffer, "LargeVector", "LargeVector Huge Pages", "Random Read", "size_t", LARGE_ELEMENTS, large_vector_predicate, huge_pages_predicate);
+    Serializer::SerializePerformance("LargeVector_Results.txt", s_FileBuffer);
+}
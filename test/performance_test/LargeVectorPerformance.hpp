@@ -0,0 +1,99 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* This class is for test the performance of LargeVector.
+* Vector is compared up to its maximum size, beyond it LargeVector is compared with and without transparent huge pages.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include "../Serializer.hpp"
+#include "../Timer.hpp"
+
+#include <sstream>  //For stringstream
+
+#include "Vector.hpp"
+#include "LargeVector.hpp"
+
+class LargeVectorPerformance
+{
+    static constexpr size_t ITERATIONS = 10;
+    static constexpr size_t ELEMENTS = 10000000;
+    static constexpr size_t LARGE_ELEMENTS = 100000000;
+
+public:
+    static void RunAllTest();
+
+public:
+    static void PushBack();
+    static void RandomRead();
+    static void LargePushBack();
+    static void LargeRandomRead();
+
+private:
+    template <typename Predicate1, typename Predicate2>
+    static void Test(std::stringstream& stream, const std::string& first_name, const std::string& second_name,
+        const std::string& test_name, const std::string& data_type, size_t elements,
+        Predicate1 first_predicate, Predicate2 second_predicate)
+    {
+        double first_time = 0.0;
+        double second_time = 0.0;
+
+        double first_best = (double)INFINITY;
+        double first_worst = 0.0;
+        double first_average = 0.0;
+        double second_best = (double)INFINITY;
+        double second_worst = 0.0;
+        double second_average = 0.0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                first_time = first_predicate(timer);
+
+                if (first_time < first_best) { first_best = first_time; }
+                if (first_time > first_worst) { first_worst = first_time; }
+                first_average += first_time;
+
+                second_time = second_predicate(timer);
+
+                if (second_time < second_best) { second_best = second_time; }
+                if (second_time > second_worst) { second_worst = second_time; }
+                second_average += second_time;
+            }
+
+            first_average /= (double)ITERATIONS;
+            second_average /= (double)ITERATIONS;
+
+            Serializer::WriteResults(stream, first_name, second_name, test_name, data_type, elements, ITERATIONS, first_best, first_worst, first_average, second_best, second_worst, second_average);
+        }
+    }
+};
@@ -1,6 +1,7 @@
 #include "ListPerformance.hpp"
 
 #include <iostream> //For std::cout
+#include <iterator> //For std::advance
 
 static std::stringstream s_FileBuffer;
 
@@ -16,6 +17,18 @@ void ListPerformance::RunAllTest()
     EmplaceFront();
     EmplaceMiddle();
     EmplaceRandom();
+    Iterate();
+    Destroy();
+    IndexedAccess();
+    SpliceBatches();
+    Sort();
+    FragmentedIterate();
+    Defragment();
+    TraverseSequential();
+    TraverseFragmented();
+    TraverseBatch();
+    TraverseInterleaved();
+    NearSequentialAccess();
 }
 
 /*
@@ -237,3 +250,332 @@ void ListPerformance::EmplaceRandom()
     ListPerformance::Test(s_FileBuffer, "EmplaceRandom", std_predicate, predicate);
     Serializer::SerializePerformance("List_Results.txt", s_FileBuffer);
 }
+
+void ListPerformance::Iterate()
+{
+    auto std_predicate = [](std::list<TestStruct>& list) -> void
+    {
+        float sum = 0.0f;
+        for (std::list<TestStruct>::iterator it = list.begin(); it != list.end(); ++it)
+        {
+            sum += it->x;
+        }
+        Timer::Consume(sum);
+    };
+    auto predicate = [](List<TestStruct>& list) -> void
+    {
+        float sum = 0.0f;
+        for (List<TestStruct>::iterator it = list.begin(); it != list.end(); ++it)
+        {
+            sum += it->x;
+        }
+        Timer::Consume(sum);
+    };
+
+    std::cout << "Testing Iterate Performance" << std::endl;
+    ListPerformance::TestFilled(s_FileBuffer, "Iterate", std_predicate, predicate);
+    Serializer::SerializePerformance("List_Results.txt", s_FileBuffer);
+}
+
+void ListPerformance::Destroy()
+{
+    auto std_predicate = [](std::list<TestStruct>& list) -> void
+    {
+        std::list<TestStruct> destroyed(std::move(list));
+    };
+    auto predicate = [](List<TestStruct>& list) -> void
+    {
+        List<TestStruct> destroyed(std::move(list));
+    };
+
+    std::cout << "Testing Destroy Performance" << std::endl;
+    ListPerformance::TestFilled(s_FileBuffer, "Destroy", std_predicate, predicate);
+    Serializer::SerializePerformance("List_Results.txt", s_FileBuffer);
+}
+
+void ListPerformance::IndexedAccess()
+{
+    Vector<size_t> random_numbers(INDEXED_OPERATIONS * 3);
+    for (size_t i = 0; i < random_numbers.Capacity(); ++i)
+    {
+        random_numbers.PushBack(((size_t)rand() * (RAND_MAX + (size_t)1) + (size_t)rand()) % INDEXED_ELEMENTS);
+    }
+
+    auto list_predicate = [&random_numbers](List<TestStruct>& list) -> void
+    {
+        float sum = 0.0f;
+        Vector<size_t>::const_iterator it = random_numbers.cbegin();
+        for (size_t i = 0; i < INDEXED_OPERATIONS; ++i)
+        {
+            TestStruct aux((float)i);
+            list.Insert(*it++, aux);
+            list.Erase(*it++);
+            sum += list[*it++].x;
+        }
+        Timer::Consume(sum);
+    };
+    auto indexed_predicate = [&random_numbers](IndexedList<TestStruct>& list) -> void
+    {
+        float sum = 0.0f;
+        Vector<size_t>::const_iterator it = random_numbers.cbegin();
+        for (size_t i = 0; i < INDEXED_OPERATIONS; ++i)
+        {
+            TestStruct aux((float)i);
+            list.Insert(*it++, aux);
+            list.Erase(*it++);
+            sum += list[*it++].x;
+        }
+        Timer::Consume(sum);
+    };
+
+    std::cout << "Testing Indexed Access Performance" << std::endl;
+    ListPerformance::TestIndexed(s_FileBuffer, "IndexedAccess", list_predicate, indexed_predicate);
+    Serializer::SerializePerformance("List_Results.txt", s_FileBuffer);
+}
+
+void ListPerformance::SpliceBatches()
+{
+    //Batches of elements go from one stage to the next one and back, as in a work queue
+    auto std_predicate = [](std::list<TestStruct>& list) -> void
+    {
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            list.emplace_back((float)i);
+        }
+
+        std::list<TestStruct> stage;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            auto last = list.begin();
+            std::advance(last, SPLICE_BATCH);
+            stage.splice(stage.end(), list, list.begin(), last);
+            stage.splice(stage.end(), list, list.begin());
+            list.splice(list.end(), stage);
+        }
+    };
+    auto predicate = [](List<TestStruct>& list) -> void
+    {
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            list.EmplaceBack((float)i);
+        }
+
+        List<TestStruct> stage;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            stage.Splice(stage.end(), list, list.begin(), list.begin() + SPLICE_BATCH);
+            stage.Splice(stage.end(), list, list.begin());
+            list.Splice(list.end(), stage);
+        }
+    };
+
+    std::cout << "Testing Splice Batches Performance" << std::endl;
+    ListPerformance::Test(s_FileBuffer, "SpliceBatches", std_predicate, predicate);
+    Serializer::SerializePerformance("List_Results.txt", s_FileBuffer);
+}
+
+void ListPerformance::Sort()
+{
+    auto compare = [](const TestStruct& a, const TestStruct& b) -> bool { return a.x < b.x; };
+
+    auto std_predicate = [&compare](std::list<TestStruct>& list) -> void
+    {
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            list.emplace_back((float)((i * 7919) % ELEMENTS));
+        }
+        list.sort(compare);
+    };
+    auto predicate = [&compare](List<TestStruct>& list) -> void
+    {
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            list.EmplaceBack((float)((i * 7919) % ELEMENTS));
+        }
+        list.Sort(compare);
+    };
+
+    std::cout << "Testing Sort Performance" << std::endl;
+    ListPerformance::Test(s_FileBuffer, "Sort", std_predicate, predicate);
+    Serializer::SerializePerformance("List_Results.txt", s_FileBuffer);
+}
+
+void ListPerformance::FragmentedIterate()
+{
+    auto iterate = [](List<TestStruct>& list) -> void
+    {
+        float sum = 0.0f;
+        for (List<TestStruct>::iterator it = list.begin(); it != list.end(); ++it)
+        {
+            sum += it->x;
+        }
+        Timer::Consume(sum);
+    };
+
+    auto fragmented_predicate = [&iterate](List<TestStruct>& list, Timer& timer) -> double
+    {
+        timer.Start();
+        iterate(list);
+        return timer.Stop();
+    };
+    auto defragmented_predicate = [&iterate](List<TestStruct>& list, Timer& timer) -> double
+    {
+        list.Defragment();
+        timer.Start();
+        iterate(list);
+        return timer.Stop();
+    };
+
+    std::cout << "Testing Fragmented Iterate Performance" << std::endl;
+    ListPerformance::TestFragmented(s_FileBuffer, "Fragmented Iterate", "Fragmented List", "Defragmented List", fragmented_predicate, defragmented_predicate);
+    Serializer::SerializePerformance("List_Results.txt", s_FileBuffer);
+}
+
+void ListPerformance::Defragment()
+{
+    //The incremental version runs in steps of DEFRAGMENT_BUDGET elements, as from a maintenance tick
+    auto defragment_predicate = [](List<TestStruct>& list, Timer& timer) -> double
+    {
+        timer.Start();
+        list.Defragment();
+        return timer.Stop();
+    };
+    auto incremental_predicate = [](List<TestStruct>& list, Timer& timer) -> double
+    {
+        timer.Start();
+        List<TestStruct>::iterator it = list.begin();
+        while (it != list.end())
+        {
+            it = list.Defragment(it, DEFRAGMENT_BUDGET);
+        }
+        return timer.Stop();
+    };
+
+    std::cout << "Testing Defragment Performance" << std::endl;
+    ListPerformance::TestFragmented(s_FileBuffer, "Defragment", "Defragment", "Incremental Defragment", defragment_predicate, incremental_predicate);
+    Serializer::SerializePerformance("List_Results.txt", s_FileBuffer);
+}
+
+static void IterateSum(List<size_t>& list)
+{
+    size_t sum = 0;
+    for (List<size_t>::iterator it = list.begin(); it != list.end(); ++it)
+    {
+        sum += *it;
+    }
+    Timer::Consume(sum);
+}
+
+void ListPerformance::TraverseSequential()
+{
+    auto for_each_predicate = [](List<size_t>& list) -> void
+    {
+        size_t sum = 0;
+        list.ForEach([&sum](size_t& element) { sum += element; });
+        Timer::Consume(sum);
+    };
+
+    List<size_t> list;
+    FillTraversal(list, false);
+
+    std::cout << "Testing Sequential Traversal Performance" << std::endl;
+    ListPerformance::TestTraversal(s_FileBuffer, "Traverse Sequential", "ForEach", list, IterateSum, for_each_predicate);
+    Serializer::SerializePerformance("List_Results.txt", s_FileBuffer);
+}
+
+void ListPerformance::TraverseFragmented()
+{
+    auto for_each_predicate = [](List<size_t>& list) -> void
+    {
+        size_t sum = 0;
+        list.ForEach([&sum](size_t& element) { sum += element; });
+        Timer::Consume(sum);
+    };
+
+    List<size_t> list;
+    FillTraversal(list, true);
+
+    std::cout << "Testing Fragmented Traversal Performance" << std::endl;
+    ListPerformance::TestTraversal(s_FileBuffer, "Traverse Fragmented", "ForEach", list, IterateSum, for_each_predicate);
+    Serializer::SerializePerformance("List_Results.txt", s_FileBuffer);
+}
+
+void ListPerformance::TraverseBatch()
+{
+    auto batch_predicate = [](List<size_t>& list) -> void
+    {
+        size_t sum = 0;
+        list.ForEachBatch([&sum](size_t* const* elements, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                sum += *elements[i];
+            }
+        });
+        Timer::Consume(sum);
+    };
+
+    List<size_t> list;
+    FillTraversal(list, true);
+
+    std::cout << "Testing Batch Traversal Performance" << std::endl;
+    ListPerformance::TestTraversal(s_FileBuffer, "Traverse Fragmented Batch", "ForEachBatch", list, IterateSum, batch_predicate);
+    Serializer::SerializePerformance("List_Results.txt", s_FileBuffer);
+}
+
+void ListPerformance::TraverseInterleaved()
+{
+    List<size_t> list;
+    FillTraversal(list, true);
+
+    //The starts of the sub-ranges are found once, as a program that keeps them between traversals would
+    Vector<List<size_t>::iterator> starts;
+    List<size_t>::iterator it = list.begin();
+    for (size_t i = 0; i < TRAVERSAL_CURSORS; ++i)
+    {
+        starts.PushBack(it);
+        it += TRAVERSAL_ELEMENTS / TRAVERSAL_CURSORS;
+    }
+
+    auto interleaved_predicate = [&starts](List<size_t>& list) -> void
+    {
+        size_t sum = 0;
+        list.ForEachInterleaved([&sum](size_t& element) { sum += element; }, starts.Data(), starts.Size());
+        Timer::Consume(sum);
+    };
+
+    std::cout << "Testing Interleaved Traversal Performance" << std::endl;
+    ListPerformance::TestTraversal(s_FileBuffer, "Traverse Fragmented Interleaved", "ForEachInterleaved", list, IterateSum, interleaved_predicate);
+    Serializer::SerializePerformance("List_Results.txt", s_FileBuffer);
+}
+
+void ListPerformance::NearSequentialAccess()
+{
+    //The index moves forward from the middle with small jumps in both directions
+    Vector<size_t> steps(FINGER_OPERATIONS);
+    for (size_t i = 0; i < steps.Capacity(); ++i)
+    {
+        steps.PushBack((size_t)rand() % 8);
+    }
+
+    auto predicate = [&steps](List<TestStruct>& list) -> void
+    {
+        float sum = 0.0f;
+        size_t index = FINGER_ELEMENTS / 2;
+        for (size_t i = 0; i < FINGER_OPERATIONS; ++i)
+        {
+            index = index + steps[i] - 2;
+            switch (i % 4)
+            {
+            case 0: list.Insert(index, TestStruct((float)i)); break;
+            case 1: list.Erase(index); break;
+            default: sum += list[index].x; break;
+            }
+        }
+        Timer::Consume(sum);
+    };
+
+    std::cout << "Testing Near Sequential Access Performance" << std::endl;
+    ListPerformance::TestFinger(s_FileBuffer, "Near Sequential Access", predicate);
+    Serializer::SerializePerformance("List_Results.txt", s_FileBuffer);
+}
@@ -41,11 +41,21 @@ Copyright (c) 2020 Luis Poveda Cano
 
 #include <list>
 #include "List.hpp"
+#include "Vector.hpp"
 
 class ListPerformance
 {
     static constexpr size_t ITERATIONS = 10;
     static constexpr size_t ELEMENTS = 5000;
+    static constexpr size_t INDEXED_ELEMENTS = 1000000;
+    static constexpr size_t INDEXED_OPERATIONS = 100;
+    static constexpr size_t SPLICE_BATCH = 32;
+    static constexpr size_t FRAGMENTED_ELEMENTS = 1000000;
+    static constexpr size_t DEFRAGMENT_BUDGET = 4096;
+    static constexpr size_t TRAVERSAL_ELEMENTS = 5000000;
+    static constexpr size_t TRAVERSAL_CURSORS = 16;
+    static constexpr size_t FINGER_ELEMENTS = 100000;
+    static constexpr size_t FINGER_OPERATIONS = 10000;
 
 public:
     static void RunAllTest();
@@ -59,6 +69,18 @@ public:
     static void EmplaceFront();
     static void EmplaceMiddle();
     static void EmplaceRandom();
+    static void Iterate();
+    static void Destroy();
+    static void IndexedAccess();
+    static void SpliceBatches();
+    static void Sort();
+    static void FragmentedIterate();
+    static void Defragment();
+    static void TraverseSequential();
+    static void TraverseFragmented();
+    static void TraverseBatch();
+    static void TraverseInterleaved();
+    static void NearSequentialAccess();
 
 private:
     template <typename Predicate1, typename Predicate2>
@@ -104,4 +126,306 @@ private:
             Serializer::WriteResults(stream, "std::list", "List", test_name, "TestStruct", ELEMENTS, ITERATIONS, std_list_best, std_list_worst, std_list_average, list_best, list_worst, list_average);
         }
     }
+
+    /**
+    * @brief: Same as Test, but the containers are filled with ELEMENTS elements before the predicates are timed.
+    */
+    template <typename Predicate1, typename Predicate2>
+    static void TestFilled(std::stringstream& stream, const std::string& test_name,
+        Predicate1 std_predicate, Predicate2 predicate)
+    {
+        auto std_fill = [&std_predicate](std::list<TestStruct>& list, Timer& timer) -> void
+        {
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                list.emplace_back((float)i);
+            }
+            timer.Start();
+            std_predicate(list);
+        };
+        auto fill = [&predicate](List<TestStruct>& list, Timer& timer) -> void
+        {
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                list.EmplaceBack((float)i);
+            }
+            timer.Start();
+            predicate(list);
+        };
+
+        double std_time = 0.0;
+        double list_time = 0.0;
+
+        double std_list_best = (double)INFINITY;
+        double std_list_worst = 0.0;
+        double std_list_average = 0.0;
+        double list_best = (double)INFINITY;
+        double list_worst = 0.0;
+        double list_average = 0.0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                std::list<TestStruct> std_list;
+                std_fill(std_list, timer);
+                std_time = timer.Stop();
+
+                if (std_time < std_list_best) { std_list_best = std_time; }
+                if (std_time > std_list_worst) { std_list_worst = std_time; }
+                std_list_average += std_time;
+
+                List<TestStruct> list;
+                fill(list, timer);
+                list_time = timer.Stop();
+
+                if (list_time < list_best) { list_best = list_time; }
+                if (list_time > list_worst) { list_worst = list_time; }
+                list_average += list_time;
+            }
+
+            std_list_average /= (double)ITERATIONS;
+            list_average /= (double)ITERATIONS;
+
+            Serializer::WriteResults(stream, "std::list", "List", test_name, "TestStruct", ELEMENTS, ITERATIONS, std_list_best, std_list_worst, std_list_average, list_best, list_worst, list_average);
+        }
+    }
+
+    /**
+    * @brief: Compares a List with an IndexedList, both are filled with INDEXED_ELEMENTS elements before the predicates are timed.
+    */
+    template <typename Predicate1, typename Predicate2>
+    static void TestIndexed(std::stringstream& stream, const std::string& test_name,
+        Predicate1 list_predicate, Predicate2 indexed_predicate)
+    {
+        double list_time = 0.0;
+        double indexed_time = 0.0;
+
+        double list_best = (double)INFINITY;
+        double list_worst = 0.0;
+        double list_average = 0.0;
+        double indexed_best = (double)INFINITY;
+        double indexed_worst = 0.0;
+        double indexed_average = 0.0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                {
+                    List<TestStruct> list(INDEXED_ELEMENTS);
+                    for (size_t j = 0; j < INDEXED_ELEMENTS; ++j)
+                    {
+                        list.EmplaceBack((float)j);
+                    }
+                    timer.Start();
+                    list_predicate(list);
+                    list_time = timer.Stop();
+                }
+
+                if (list_time < list_best) { list_best = list_time; }
+                if (list_time > list_worst) { list_worst = list_time; }
+                list_average += list_time;
+
+                {
+                    IndexedList<TestStruct> list(INDEXED_ELEMENTS);
+                    for (size_t j = 0; j < INDEXED_ELEMENTS; ++j)
+                    {
+                        list.EmplaceBack((float)j);
+                    }
+                    timer.Start();
+                    indexed_predicate(list);
+                    indexed_time = timer.Stop();
+                }
+
+                if (indexed_time < indexed_best) { indexed_best = indexed_time; }
+                if (indexed_time > indexed_worst) { indexed_worst = indexed_time; }
+                indexed_average += indexed_time;
+            }
+
+            list_average /= (double)ITERATIONS;
+            indexed_average /= (double)ITERATIONS;
+
+            Serializer::WriteResults(stream, "List", "IndexedList", test_name, "TestStruct", INDEXED_OPERATIONS, ITERATIONS, list_best, list_worst, list_average, indexed_best, indexed_worst, indexed_average);
+        }
+    }
+
+    /**
+    * @brief: Fills a List as a long running program would leave it, the order of the elements no longer follows the memory of the nodes.
+    * @details: The elements are sorted from a scrambled order, then every other element is erased and the holes are refilled.
+    */
+    static void Fragment(List<TestStruct>& list)
+    {
+        for (size_t i = 0; i < FRAGMENTED_ELEMENTS; ++i)
+        {
+            list.EmplaceBack((float)((i * 7919) % FRAGMENTED_ELEMENTS));
+        }
+        list.Sort([](const TestStruct& a, const TestStruct& b) -> bool { return a.x < b.x; });
+
+        for (List<TestStruct>::iterator it = list.begin(); it != list.end();)
+        {
+            it = list.Erase(it);
+            if (it != list.end()) { ++it; }
+        }
+        for (List<TestStruct>::iterator it = list.begin(); it != list.end(); ++it)
+        {
+            it = list.Insert(it, TestStruct(it->x - 0.5f));
+            ++it;
+        }
+    }
+
+    /**
+    * @brief: Runs both predicates on fragmented Lists and writes the results.
+    */
+    template <typename Predicate1, typename Predicate2>
+    static void TestFragmented(std::stringstream& stream, const std::string& test_name, const std::string& first_name, const std::string& second_name,
+        Predicate1 first_predicate, Predicate2 second_predicate)
+    {
+        double first_time = 0.0;
+        double second_time = 0.0;
+
+        double first_best = (double)INFINITY;
+        double first_worst = 0.0;
+        double first_average = 0.0;
+        double second_best = (double)INFINITY;
+        double second_worst = 0.0;
+        double second_average = 0.0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                {
+                    List<TestStruct> list;
+                    Fragment(list);
+                    first_time = first_predicate(list, timer);
+                }
+
+                if (first_time < first_best) { first_best = first_time; }
+                if (first_time > first_worst) { first_worst = first_time; }
+                first_average += first_time;
+
+                {
+                    List<TestStruct> list;
+                    Fragment(list);
+                    second_time = second_predicate(list, timer);
+                }
+
+                if (second_time < second_best) { second_best = second_time; }
+                if (second_time > second_worst) { second_worst = second_time; }
+                second_average += second_time;
+            }
+
+            first_average /= (double)ITERATIONS;
+            second_average /= (double)ITERATIONS;
+
+            Serializer::WriteResults(stream, first_name, second_name, test_name, "TestStruct", FRAGMENTED_ELEMENTS, ITERATIONS, first_best, first_worst, first_average, second_best, second_worst, second_average);
+        }
+    }
+
+    /**
+    * @brief: Fills a List with TRAVERSAL_ELEMENTS elements, sorted from a scrambled order when fragmented, so the nodes are visited in random memory order.
+    */
+    static void FillTraversal(List<size_t>& list, bool fragmented)
+    {
+        for (size_t i = 0; i < TRAVERSAL_ELEMENTS; ++i)
+        {
+            list.PushBack(fragmented ? (i * 7919) % TRAVERSAL_ELEMENTS : i);
+        }
+        if (fragmented) { list.Sort(); }
+    }
+
+    /**
+    * @brief: Runs both traversals over the same List and writes the results, the first one is the loop with Iterator.
+    */
+    template <typename Predicate1, typename Predicate2>
+    static void TestTraversal(std::stringstream& stream, const std::string& test_name, const std::string& traversal_name,
+        List<size_t>& list, Predicate1 iterator_predicate, Predicate2 traversal_predicate)
+    {
+        double iterator_time = 0.0;
+        double traversal_time = 0.0;
+
+        double iterator_best = (double)INFINITY;
+        double iterator_worst = 0.0;
+        double iterator_average = 0.0;
+        double traversal_best = (double)INFINITY;
+        double traversal_worst = 0.0;
+        double traversal_average = 0.0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                timer.Start();
+                iterator_predicate(list);
+                iterator_time = timer.Stop();
+
+                if (iterator_time < iterator_best) { iterator_best = iterator_time; }
+                if (iterator_time > iterator_worst) { iterator_worst = iterator_time; }
+                iterator_average += iterator_time;
+
+                timer.Start();
+                traversal_predicate(list);
+                traversal_time = timer.Stop();
+
+                if (traversal_time < traversal_best) { traversal_best = traversal_time; }
+                if (traversal_time > traversal_worst) { traversal_worst = traversal_time; }
+                traversal_average += traversal_time;
+            }
+
+            iterator_average /= (double)ITERATIONS;
+            traversal_average /= (double)ITERATIONS;
+
+            Serializer::WriteResults(stream, "Iterator", traversal_name, test_name, "size_t", TRAVERSAL_ELEMENTS, ITERATIONS, iterator_best, iterator_worst, iterator_average, traversal_best, traversal_worst, traversal_average);
+        }
+    }
+
+    /**
+    * @brief: Runs the predicate on a List without and with the finger, both are filled with FINGER_ELEMENTS elements before the predicate is timed.
+    */
+    template <typename Predicate>
+    static void TestFinger(std::stringstream& stream, const std::string& test_name, Predicate predicate)
+    {
+        double list_time = 0.0;
+        double finger_time = 0.0;
+
+        double list_best = (double)INFINITY;
+        double list_worst = 0.0;
+        double list_average = 0.0;
+        double finger_best = (double)INFINITY;
+        double finger_worst = 0.0;
+        double finger_average = 0.0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                for (bool finger : { false, true })
+                {
+                    List<TestStruct> list(FINGER_ELEMENTS);
+                    list.EnableFinger(finger);
+                    for (size_t j = 0; j < FINGER_ELEMENTS; ++j)
+                    {
+                        list.EmplaceBack((float)j);
+                    }
+                    timer.Start();
+                    predicate(list);
+                    (finger ? finger_time : list_time) = timer.Stop();
+                }
+
+                if (list_time < list_best) { list_best = list_time; }
+                if (list_time > list_worst) { list_worst = list_time; }
+                list_average += list_time;
+
+                if (finger_time < finger_best) { finger_best = finger_time; }
+                if (finger_time > finger_worst) { finger_worst = finger_time; }
+                finger_average += finger_time;
+            }
+
+            list_average /= (double)ITERATIONS;
+            finger_average /= (double)ITERATIONS;
+
+            Serializer::WriteResults(stream, "List", "List with finger", test_name, "TestStruct", FINGER_OPERATIONS, ITERATIONS, list_best, list_worst, list_average, finger_best, finger_worst, finger_average);
+        }
+    }
 };
@@ -0,0 +1,107 @@
+#include "MappedVectorPerformance.hpp"
+
+#include <iostream> //For std::cout
+#include <cstdio>  //For std::remove
+
+static std::stringstream s_FileBuffer;
+
+static const char* s_IndexFile = "data/MappedVector_Index.bin";
+
+void MappedVectorPerformance::RunAllTest()
+{
+    s_FileBuffer << "MappedVector Performance Test:" << std::endl;
+
+    PushBack();
+    Load();
+}
+
+/*
+* PRIVATE IMPLEMENTATIONS
+*/
+
+void MappedVectorPerformance::PushBack()
+{
+    auto vector_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            Vector<size_t> vector;
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                vector.PushBack(i);
+            }
+        }
+        return timer.Stop();
+    };
+    auto mapped_vector_predicate = [](Timer& timer) -> double
+    {
+        std::remove(s_IndexFile);
+
+        timer.Start();
+        {
+            MappedVector<size_t> vector(s_IndexFile);
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                vector.PushBack(i);
+            }
+        }
+        return timer.Stop();
+    };
+
+    std::cout << "Testing MappedVector PushBack Performance" << std::endl;
+    MappedVectorPerformance::Test(s_FileBuffer, "Vector", "MappedVector", "PushBack", "size_t", ELEMENTS, vector_predicate, mapped_vector_predicate);
+    Serializer::SerializePerformance("MappedVector_Results.txt", s_FileBuffer);
+    std::remove(s_IndexFile);
+}
+
+void MappedVectorPerformance::Load()
+{
+    //The Vector builds the index again, the MappedVector opens the index stored by a previous run
+    {
+        MappedVector<size_t> vector(s_IndexFile);
+        vector.Clear();
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            vector.PushBack(i * 2654435761u);
+        }
+        vector.Flush();
+    }
+
+    auto vector_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        size_t sum = 0;
+        {
+            Vector<size_t> vector;
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                vector.PushBack(i * 2654435761u);
+            }
+            for (size_t i = 0; i < vector.Size(); ++i)
+            {
+                sum += vector[i];
+            }
+        }
+        Timer::Consume(sum);
+        return timer.Stop();
+    };
+    auto mapped_vector_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        size_t sum = 0;
+        {
+            MappedVector<size_t> vector(s_IndexFile, true);
+            for (size_t i = 0; i < vector.Size(); ++i)
+            {
+                sum += vector[i];
+            }
+        }
+        Timer::Consume(sum);
+        return timer.Stop();
+    };
+
+    std::cout << "Testing MappedVector Load Performance" << std::endl;
+    MappedVectorPerformance::Test(s_FileBuffer, "Vector", "MappedVector", "Load Index", "size_t", ELEMENTS, vector_predicate, mapped_vector_predicate);
+    Serializer::SerializePerformance("MappedVector_Results.txt", s_FileBuffer);
+    std::remove(s_IndexFile);
+}
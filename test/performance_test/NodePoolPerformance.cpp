@@ -0,0 +1,99 @@
+#include "NodePoolPerformance.hpp"
+
+#include <iostream> //For std::cout
+
+static std::stringstream s_FileBuffer;
+
+void NodePoolPerformance::RunAllTest()
+{
+    s_FileBuffer << "NodePool Performance Test:" << std::endl;
+
+    ShortLived();
+    ShortLivedNonTrivial();
+    ShortLivedThreads();
+}
+
+/*
+* PRIVATE IMPLEMENTATIONS
+*/
+
+void NodePoolPerformance::ShortLived()
+{
+    auto heap_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        Churn<List<float>>(LISTS);
+        return timer.Stop();
+    };
+    auto pool_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        Churn<List<float, NodePoolAllocator<float>>>(LISTS);
+        return timer.Stop();
+    };
+
+    std::cout << "Testing Short Lived Lists Performance" << std::endl;
+    NodePoolPerformance::Test(s_FileBuffer, "Short Lived Lists", "float", heap_predicate, pool_predicate);
+    Serializer::SerializePerformance("NodePool_Results.txt", s_FileBuffer);
+}
+
+void NodePoolPerformance::ShortLivedNonTrivial()
+{
+    auto heap_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        Churn<List<TestStruct>>(LISTS);
+        return timer.Stop();
+    };
+    auto pool_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        Churn<List<TestStruct, NodePoolAllocator<TestStruct>>>(LISTS);
+        return timer.Stop();
+    };
+
+    std::cout << "Testing Short Lived Lists Non Trivial Performance" << std::endl;
+    NodePoolPerformance::Test(s_FileBuffer, "Short Lived Lists Non Trivial", "TestStruct", heap_predicate, pool_predicate);
+    Serializer::SerializePerformance("NodePool_Results.txt", s_FileBuffer);
+}
+
+void NodePoolPerformance::ShortLivedThreads()
+{
+    //Every thread churns its share of the Lists, the pooled nodes move between threads through the global tier
+    auto heap_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            std::thread threads[THREADS];
+            for (size_t i = 0; i < THREADS; ++i)
+            {
+                threads[i] = std::thread(Churn<List<float>>, LISTS / THREADS);
+            }
+            for (size_t i = 0; i < THREADS; ++i)
+            {
+                threads[i].join();
+            }
+        }
+        return timer.Stop();
+    };
+    auto pool_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            std::thread threads[THREADS];
+            for (size_t i = 0; i < THREADS; ++i)
+            {
+                threads[i] = std::thread(Churn<List<float, NodePoolAllocator<float>>>, LISTS / THREADS);
+            }
+            for (size_t i = 0; i < THREADS; ++i)
+            {
+                threads[i].join();
+            }
+        }
+        return timer.Stop();
+    };
+
+    std::cout << "Testing Short Lived Lists Threads Performance" << std::endl;
+    NodePoolPerformance::Test(s_FileBuffer, "Short Lived Lists Threads", "float", heap_predicate, pool_predicate);
+    Serializer::SerializePerformance("NodePool_Results.txt", s_FileBuffer);
+}
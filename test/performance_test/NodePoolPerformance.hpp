@@ -0,0 +1,116 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* This class is for test the performance of Lists on the shared NodePool vs the global heap.
+* The workloads create and destroy many short lived Lists, so the pooled nodes are reused by the next List.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include "../Serializer.hpp"
+#include "../TestStruct.hpp"
+#include "../Timer.hpp"
+
+#include <sstream>  //For stringstream
+#include <thread>  //For std::thread
+
+#include "List.hpp"
+#include "NodePool.hpp"
+
+class NodePoolPerformance
+{
+    static constexpr size_t ITERATIONS = 10;
+    static constexpr size_t LISTS = 100000;
+    static constexpr size_t ELEMENTS = 16;
+    static constexpr size_t THREADS = 4;
+
+public:
+    static void RunAllTest();
+
+public:
+    static void ShortLived();
+    static void ShortLivedNonTrivial();
+    static void ShortLivedThreads();
+
+private:
+    /**
+    * @brief: Creates, fills and destroys the given number of Lists one after the other.
+    */
+    template <typename ListType>
+    static void Churn(size_t lists)
+    {
+        for (size_t i = 0; i < lists; ++i)
+        {
+            ListType list;
+            for (size_t j = 0; j < ELEMENTS; ++j)
+            {
+                list.EmplaceBack((float)j);
+            }
+        }
+    }
+
+    template <typename Predicate1, typename Predicate2>
+    static void Test(std::stringstream& stream, const std::string& test_name, const std::string& data_type,
+        Predicate1 heap_predicate, Predicate2 pool_predicate)
+    {
+        double heap_time = 0.0;
+        double pool_time = 0.0;
+
+        double heap_best = (double)INFINITY;
+        double heap_worst = 0.0;
+        double heap_average = 0.0;
+        double pool_best = (double)INFINITY;
+        double pool_worst = 0.0;
+        double pool_average = 0.0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                heap_time = heap_predicate(timer);
+
+                if (heap_time < heap_best) { heap_best = heap_time; }
+                if (heap_time > heap_worst) { heap_worst = heap_time; }
+                heap_average += heap_time;
+
+                pool_time = pool_predicate(timer);
+
+                if (pool_time < pool_best) { pool_best = pool_time; }
+                if (pool_time > pool_worst) { pool_worst = pool_time; }
+                pool_average += pool_time;
+            }
+
+            heap_average /= (double)ITERATIONS;
+            pool_average /= (double)ITERATIONS;
+
+            Serializer::WriteResults(stream, "List (heap)", "List (node pool)", test_name, data_type, LISTS * ELEMENTS, ITERATIONS, heap_best, heap_worst, heap_average, pool_best, pool_worst, pool_average);
+        }
+    }
+};
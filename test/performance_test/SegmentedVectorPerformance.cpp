@@ -0,0 +1,176 @@
+#include "SegmentedVectorPerformance.hpp"
+
+#include <iostream> //For std::cout
+#include <random>  //For std::mt19937
+
+static std::stringstream s_FileBuffer;
+
+void SegmentedVectorPerformance::RunAllTest()
+{
+    s_FileBuffer << "SegmentedVector Performance Test:" << std::endl;
+
+    PushBack();
+    PushBackLatency();
+    Iterate();
+    RandomAccess();
+}
+
+/*
+* PRIVATE IMPLEMENTATIONS
+*/
+
+void SegmentedVectorPerformance::PushBack()
+{
+    auto vector_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            Vector<size_t> vector;
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                vector.PushBack(i);
+            }
+        }
+        return timer.Stop();
+    };
+    auto segmented_vector_predicate = [](Timer& timer) -> double
+    {
+        timer.Start();
+        {
+            SegmentedVector<size_t> vector;
+            for (size_t i = 0; i < ELEMENTS; ++i)
+            {
+                vector.PushBack(i);
+            }
+        }
+        return timer.Stop();
+    };
+
+    std::cout << "Testing SegmentedVector PushBack Performance" << std::endl;
+    SegmentedVectorPerformance::Test(s_FileBuffer, "PushBack", "size_t", vector_predicate, segmented_vector_predicate);
+    Serializer::SerializePerformance("SegmentedVector_Results.txt", s_FileBuffer);
+}
+
+void SegmentedVectorPerformance::PushBackLatency()
+{
+    //Every PushBack is timed on its own and the slowest one of the run is reported
+    auto vector_predicate = [](Timer& timer) -> double
+    {
+        Vector<TestStruct> vector;
+        double slowest = 0.0;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            timer.Start();
+            vector.EmplaceBack((float)i);
+            const double time = timer.Stop();
+            if (time > slowest) { slowest = time; }
+        }
+        return slowest;
+    };
+    auto segmented_vector_predicate = [](Timer& timer) -> double
+    {
+        SegmentedVector<TestStruct> vector;
+        double slowest = 0.0;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            timer.Start();
+            vector.EmplaceBack((float)i);
+            const double time = timer.Stop();
+            if (time > slowest) { slowest = time; }
+        }
+        return slowest;
+    };
+
+    std::cout << "Testing SegmentedVector PushBack Latency" << std::endl;
+    SegmentedVectorPerformance::Test(s_FileBuffer, "Slowest PushBack", "TestStruct", vector_predicate, segmented_vector_predicate);
+    Serializer::SerializePerformance("SegmentedVector_Results.txt", s_FileBuffer);
+}
+
+void SegmentedVectorPerformance::Iterate()
+{
+    auto vector_predicate = [](Timer& timer) -> double
+    {
+        Vector<size_t> vector;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            vector.PushBack(i);
+        }
+
+        timer.Start();
+        size_t sum = 0;
+        for (Vector<size_t>::iterator it = vector.begin(); it != vector.end(); ++it)
+        {
+            sum += *it;
+        }
+        Timer::Consume(sum);
+        return timer.Stop();
+    };
+    auto segmented_vector_predicate = [](Timer& timer) -> double
+    {
+        SegmentedVector<size_t> vector;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            vector.PushBack(i);
+        }
+
+        timer.Start();
+        size_t sum = 0;
+        vector.ForEachSegment([&sum](const size_t* data, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                sum += data[i];
+            }
+        });
+        Timer::Consume(sum);
+        return timer.Stop();
+    };
+
+    std::cout << "Testing SegmentedVector Iterate Performance" << std::endl;
+    SegmentedVectorPerformance::Test(s_FileBuffer, "Iterate", "size_t", vector_predicate, segmented_vector_predicate);
+    Serializer::SerializePerformance("SegmentedVector_Results.txt", s_FileBuffer);
+}
+
+void SegmentedVectorPerformance::RandomAccess()
+{
+    auto vector_predicate = [](Timer& timer) -> double
+    {
+        Vector<size_t> vector;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            vector.PushBack(i);
+        }
+        std::mt19937 generator(7);
+
+        timer.Start();
+        size_t sum = 0;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            sum += vector[generator() % ELEMENTS];
+        }
+        Timer::Consume(sum);
+        return timer.Stop();
+    };
+    auto segmented_vector_predicate = [](Timer& timer) -> double
+    {
+        SegmentedVector<size_t> vector;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            vector.PushBack(i);
+        }
+        std::mt19937 generator(7);
+
+        timer.Start();
+        size_t sum = 0;
+        for (size_t i = 0; i < ELEMENTS; ++i)
+        {
+            sum += vector[generator() % ELEMENTS];
+        }
+        Timer::Consume(sum);
+        return timer.Stop();
+    };
+
+    std::cout << "Testing SegmentedVector Random Access Performance" << std::endl;
+    SegmentedVectorPerformance::Test(s_FileBuffer, "Random Access", "size_t", vector_predicate, segmented_vector_predicate);
+    Serializer::SerializePerformance("SegmentedVector_Results.txt", s_FileBuffer);
+}
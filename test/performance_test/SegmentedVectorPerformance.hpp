@@ -0,0 +1,98 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* This class is for test the performance of SegmentedVector vs Vector.
+* Besides the total times, the latency test reports the slowest single PushBack of each run, where Vector pays the relocation.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include "../Serializer.hpp"
+#include "../TestStruct.hpp"
+#include "../Timer.hpp"
+
+#include <sstream>  //For stringstream
+
+#include "Vector.hpp"
+#include "SegmentedVector.hpp"
+
+class SegmentedVectorPerformance
+{
+    static constexpr size_t ITERATIONS = 10;
+    static constexpr size_t ELEMENTS = 1000000;
+
+public:
+    static void RunAllTest();
+
+public:
+    static void PushBack();
+    static void PushBackLatency();
+    static void Iterate();
+    static void RandomAccess();
+
+private:
+    template <typename Predicate1, typename Predicate2>
+    static void Test(std::stringstream& stream, const std::string& test_name, const std::string& data_type,
+        Predicate1 vector_predicate, Predicate2 segmented_vector_predicate)
+    {
+        double vector_time = 0.0;
+        double segmented_vector_time = 0.0;
+
+        double vector_best = (double)INFINITY;
+        double vector_worst = 0.0;
+        double vector_average = 0.0;
+        double segmented_vector_best = (double)INFINITY;
+        double segmented_vector_worst = 0.0;
+        double segmented_vector_average = 0.0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                vector_time = vector_predicate(timer);
+
+                if (vector_time < vector_best) { vector_best = vector_time; }
+                if (vector_time > vector_worst) { vector_worst = vector_time; }
+                vector_average += vector_time;
+
+                segmented_vector_time = segmented_vector_predicate(timer);
+
+                if (segmented_vector_time < segmented_vector_best) { segmented_vector_best = segmented_vector_time; }
+                if (segmented_vector_time > segmented_vector_worst) { segmented_vector_worst = segmented_vector_time; }
+                segmented_vector_average += segmented_vector_time;
+            }
+
+            vector_average /= (double)ITERATIONS;
+            segmented_vector_average /= (double)ITERATIONS;
+
+            Serializer::WriteResults(stream, "Vector", "SegmentedVector", test_name, data_type, ELEMENTS, ITERATIONS, vector_best, vector_worst, vector_average, segmented_vector_best, segmented_vector_worst, segmented_vector_average);
+        }
+    }
+};
@@ -0,0 +1,137 @@
+#include "SmallVectorPerformance.hpp"
+
+#include <iostream> //For std::cout
+
+static std::stringstream s_FileBuffer;
+
+void SmallVectorPerformance::RunAllTest()
+{
+    s_FileBuffer << "SmallVector Performance Test:" << std::endl;
+
+    ShortLived();
+    ShortLivedSpill();
+    Copy();
+}
+
+/*
+* PRIVATE IMPLEMENTATIONS
+*/
+
+void SmallVectorPerformance::ShortLived()
+{
+    //Every container fits in the inline storage
+    Vector<size_t> sizes(CONTAINERS);
+    for (size_t i = 0; i < CONTAINERS; ++i)
+    {
+        sizes.PushBack(rand() % INLINE_ELEMENTS + 1);
+    }
+
+    auto vector_predicate = [&sizes]() -> size_t
+    {
+        size_t allocations = 0;
+        for (size_t i = 0; i < CONTAINERS; ++i)
+        {
+            VectorType vector;
+            for (size_t j = 0; j < sizes[i]; ++j)
+            {
+                vector.EmplaceBack((float)j);
+            }
+            allocations += vector.Capacity() != 0;
+        }
+        return allocations;
+    };
+    auto small_vector_predicate = [&sizes]() -> size_t
+    {
+        for (size_t i = 0; i < CONTAINERS; ++i)
+        {
+            SmallVectorType vector;
+            for (size_t j = 0; j < sizes[i]; ++j)
+            {
+                vector.EmplaceBack((float)j);
+            }
+        }
+        return 0;
+    };
+
+    std::cout << "Testing Short Lived Performance" << std::endl;
+    SmallVectorPerformance::Test(s_FileBuffer, "Short Lived", vector_predicate, small_vector_predicate);
+    Serializer::SerializePerformance("SmallVector_Results.txt", s_FileBuffer);
+}
+
+void SmallVectorPerformance::ShortLivedSpill()
+{
+    //Around half of the containers exceed the inline storage
+    Vector<size_t> sizes(CONTAINERS);
+    for (size_t i = 0; i < CONTAINERS; ++i)
+    {
+        sizes.PushBack(rand() % (INLINE_ELEMENTS * 2) + 1);
+    }
+
+    auto vector_predicate = [&sizes]() -> size_t
+    {
+        size_t allocations = 0;
+        for (size_t i = 0; i < CONTAINERS; ++i)
+        {
+            VectorType vector;
+            for (size_t j = 0; j < sizes[i]; ++j)
+            {
+                vector.EmplaceBack((float)j);
+            }
+            allocations += vector.Capacity() != 0;
+        }
+        return allocations;
+    };
+    auto small_vector_predicate = [&sizes]() -> size_t
+    {
+        for (size_t i = 0; i < CONTAINERS; ++i)
+        {
+            SmallVectorType vector;
+            for (size_t j = 0; j < sizes[i]; ++j)
+            {
+                vector.EmplaceBack((float)j);
+            }
+        }
+        return 0;
+    };
+
+    std::cout << "Testing Short Lived Spill Performance" << std::endl;
+    SmallVectorPerformance::Test(s_FileBuffer, "Short Lived Spill", vector_predicate, small_vector_predicate);
+    Serializer::SerializePerformance("SmallVector_Results.txt", s_FileBuffer);
+}
+
+void SmallVectorPerformance::Copy()
+{
+    //Small containers passed around by value
+    const size_t elements = CONTAINERS / 10;
+
+    VectorType vector_source;
+    SmallVectorType small_vector_source;
+    for (size_t i = 0; i < INLINE_ELEMENTS / 2; ++i)
+    {
+        vector_source.EmplaceBack((float)i);
+        small_vector_source.EmplaceBack((float)i);
+    }
+
+    auto vector_predicate = [&vector_source, elements]() -> size_t
+    {
+        size_t allocations = 0;
+        for (size_t i = 0; i < elements; ++i)
+        {
+            VectorType vector(vector_source);
+            allocations += vector.Capacity() != 0;
+        }
+        return allocations;
+    };
+    auto small_vector_predicate = [&small_vector_source, elements]() -> size_t
+    {
+        for (size_t i = 0; i < elements; ++i)
+        {
+            SmallVectorType vector(small_vector_source);
+        }
+        return 0;
+    };
+
+    std::cout << "Testing Copy Performance" << std::endl;
+    SmallVectorPerformance::Test(s_FileBuffer, "Copy", vector_predicate, small_vector_predicate, elements);
+    Serializer::SerializePerformance("SmallVector_Results.txt", s_FileBuffer);
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+/*
+* Author: Luis Poveda Cano.
+* luispovedacano@gmail.com
+*/
+
+/*
+* This class is for test the performance of the SmallVector vs Vector.
+* The workloads create many short-lived containers, where avoiding the heap matters the most.
+*/
+
+/*
+MIT License
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Copyright (c) 2020 Luis Poveda Cano
+*/
+
+#include "../Serializer.hpp"
+#include "../TestStruct.hpp"
+#include "../Timer.hpp"
+
+#include <sstream>  //For stringstream
+
+#include "Vector.hpp"
+#include "SmallVector.hpp"
+#include "CountingGrowthPolicy.hpp"
+
+class SmallVectorPerformance
+{
+    static constexpr size_t ITERATIONS = 10;
+    static constexpr size_t CONTAINERS = 1000000;
+    static constexpr size_t INLINE_ELEMENTS = 16;
+
+    using Counter = CountingGrowthPolicy<DoublingGrowthPolicy>;
+    using VectorType = Vector<TestStruct, Counter>;
+    using SmallVectorType = SmallVector<TestStruct, INLINE_ELEMENTS, Counter>;
+
+public:
+    static void RunAllTest();
+
+public:
+    static void ShortLived();
+    static void ShortLivedSpill();
+    static void Copy();
+
+private:
+    /**
+    * @brief: Times both predicates and counts their heap allocations.
+    * @details: Every reallocation calls the growth policy, so the allocations are the returned ones
+    * (the first block of a Vector does not use the policy) plus the calls recorded by the counter.
+    */
+    template <typename Predicate1, typename Predicate2>
+    static void Test(std::stringstream& stream, const std::string& test_name,
+        Predicate1 vector_predicate, Predicate2 small_vector_predicate, size_t elements = CONTAINERS)
+    {
+        double vector_time = 0.0;
+        double small_vector_time = 0.0;
+
+        double vector_best = (double)INFINITY;
+        double vector_worst = 0.0;
+        double vector_average = 0.0;
+        double small_vector_best = (double)INFINITY;
+        double small_vector_worst = 0.0;
+        double small_vector_average = 0.0;
+
+        size_t vector_allocations = 0;
+        size_t small_vector_allocations = 0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                Counter::Reset();
+                timer.Start();
+                vector_allocations = vector_predicate();
+                vector_time = timer.Stop();
+                vector_allocations += Counter::s_Reallocations;
+
+                if (vector_time < vector_best) { vector_best = vector_time; }
+                if (vector_time > vector_worst) { vector_worst = vector_time; }
+                vector_average += vector_time;
+
+                Counter::Reset();
+                timer.Start();
+                small_vector_allocations = small_vector_predicate();
+                small_vector_time = timer.Stop();
+                small_vector_allocations += Counter::s_Reallocations;
+
+                if (small_vector_time < small_vector_best) { small_vector_best = small_vector_time; }
+                if (small_vector_time > small_vector_worst) { small_vector_worst = small_vector_time; }
+                small_vector_average += small_vector_time;
+            }
+
+            vector_average /= (double)ITERATIONS;
+            small_vector_average /= (double)ITERATIONS;
+
+            Serializer::WriteResults(stream, "Vector", "SmallVector", test_name, "TestStruct", elements, ITERATIONS, vector_best, vector_worst, vector_average, small_vector_best, small_vector_worst, small_vector_average);
+            Serializer::WriteAllocations(stream, "Vector", "SmallVector", vector_allocations, small_vector_allocations);
+        }
+    }
+};
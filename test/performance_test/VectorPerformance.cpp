@@ -1,6 +1,7 @@
 #include "VectorPerformance.hpp"
 
 #include <iostream> //For std::cout
+#include <algorithm> //For std::remove_if
 
 static std::stringstream s_FileBuffer;
 
@@ -13,9 +14,13 @@ void VectorPerformance::RunAllTest()
     InsertFront();
     InsertMiddle();
     InsertRandom();
+    InsertMiddleBulk();
+    InsertRandomBulk();
     EmplaceFront();
     EmplaceMiddle();
     EmplaceRandom();
+    EraseIf();
+    GrowthPolicies();
 }
 
 /*
@@ -155,6 +160,73 @@ void VectorPerformance::InsertRandom()
     Serializer::SerializePerformance("Vector_Results.txt", s_FileBuffer);
 }
 
+void VectorPerformance::InsertMiddleBulk()
+{
+    const size_t elements = ELEMENTS / 1000;
+    std::vector<TestStruct> std_batch;
+    Vector<TestStruct> batch;
+    for (size_t i = 0; i < BATCH; ++i)
+    {
+        std_batch.emplace_back((float)i);
+        batch.EmplaceBack((float)i);
+    }
+
+    auto std_predicate = [&std_batch, elements](std::vector<TestStruct>& vector) -> void
+    {
+        for (size_t i = 0; i < elements; i += BATCH)
+        {
+            size_t middle = vector.size() / 2;
+            vector.insert(vector.begin() + middle, std_batch.begin(), std_batch.end());
+        }
+    };
+    auto predicate = [&batch, elements](Vector<TestStruct>& vector) -> void
+    {
+        for (size_t i = 0; i < elements; i += BATCH)
+        {
+            size_t middle = vector.Size() / 2;
+            vector.InsertRange(vector.begin() + middle, batch.begin(), batch.end());
+        }
+    };
+
+    std::cout << "Testing Insert Middle Bulk Performance" << std::endl;
+    VectorPerformance::Test(s_FileBuffer, "InsertMiddleBulk", std_predicate, predicate, elements);
+    Serializer::SerializePerformance("Vector_Results.txt", s_FileBuffer);
+}
+
+void VectorPerformance::InsertRandomBulk()
+{
+    const size_t elements = ELEMENTS / 1000;
+    Vector<size_t> random_numbers(elements / BATCH);
+    random_numbers.PushBack(0);
+    for (size_t i = 1; i < random_numbers.Capacity(); ++i)
+    {
+        random_numbers.PushBack(rand() % (i * BATCH));
+    }
+
+    auto std_predicate = [&random_numbers, elements](std::vector<TestStruct>& vector) -> void
+    {
+        Vector<size_t>::const_iterator it = random_numbers.cbegin();
+        for (size_t i = 0; i < elements; i += BATCH, ++it)
+        {
+            TestStruct aux((float)i);
+            vector.insert(vector.begin() + *it, BATCH, aux);
+        }
+    };
+    auto predicate = [&random_numbers, elements](Vector<TestStruct>& vector) -> void
+    {
+        Vector<size_t>::const_iterator it = random_numbers.cbegin();
+        for (size_t i = 0; i < elements; i += BATCH, ++it)
+        {
+            TestStruct aux((float)i);
+            vector.InsertN(vector.begin() + *it, BATCH, aux);
+        }
+    };
+
+    std::cout << "Testing Insert Random Bulk Performance" << std::endl;
+    VectorPerformance::Test(s_FileBuffer, "InsertRandomBulk", std_predicate, predicate, elements);
+    Serializer::SerializePerformance("Vector_Results.txt", s_FileBuffer);
+}
+
 void VectorPerformance::EmplaceFront()
 {
     const size_t elements = ELEMENTS / 10000;
@@ -235,3 +307,40 @@ void VectorPerformance::EmplaceRandom()
     VectorPerformance::Test(s_FileBuffer, "EmplaceRandom", std_predicate, predicate, elements);
     Serializer::SerializePerformance("Vector_Results.txt", s_FileBuffer);
 }
+
+void VectorPerformance::EraseIf()
+{
+    const size_t elements = ELEMENTS / 10;
+    auto std_predicate = [elements](std::vector<TestStruct>& vector) -> void
+    {
+        for (size_t i = 0; i < elements; ++i)
+        {
+            vector.emplace_back((float)i);
+        }
+        auto new_end = std::remove_if(vector.begin(), vector.end(), [](const TestStruct& value) { return ((size_t)value.x) % 10 == 0; });
+        vector.erase(new_end, vector.end());
+    };
+    auto predicate = [elements](Vector<TestStruct>& vector) -> void
+    {
+        for (size_t i = 0; i < elements; ++i)
+        {
+            vector.EmplaceBack((float)i);
+        }
+        vector.EraseIf([](const TestStruct& value) { return ((size_t)value.x) % 10 == 0; });
+    };
+
+    std::cout << "Testing EraseIf Performance" << std::endl;
+    VectorPerformance::Test(s_FileBuffer, "EraseIf", std_predicate, predicate, elements);
+    Serializer::SerializePerformance("Vector_Results.txt", s_FileBuffer);
+}
+
+void VectorPerformance::GrowthPolicies()
+{
+    std::cout << "Testing Growth Policies Performance" << std::endl;
+    VectorPerformance::TestGrowth<DoublingGrowthPolicy>(s_FileBuffer, "Growth Doubling");
+    VectorPerformance::TestGrowth<OneAndHalfGrowthPolicy>(s_FileBuffer, "Growth 1.5x");
+    VectorPerformance::TestGrowth<SizeClassGrowthPolicy>(s_FileBuffer, "Growth Size Class");
+    VectorPerformance::TestGrowth<FixedStepGrowthPolicy<ELEMENTS / 8>>(s_FileBuffer, "Growth Fixed Step");
+    VectorPerformance::TestGrowth<DoublingGrowthPolicy>(s_FileBuffer, "Growth Doubling With Hint", ELEMENTS);
+    Serializer::SerializePerformance("Vector_Results.txt", s_FileBuffer);
+}
@@ -41,11 +41,13 @@ Copyright (c) 2020 Luis Poveda Cano
 
 #include <vector>
 #include "Vector.hpp"
+#include "CountingGrowthPolicy.hpp"
 
 class VectorPerformance
 {
     static constexpr size_t ITERATIONS = 10;
     static constexpr size_t ELEMENTS = 5000000;
+    static constexpr size_t BATCH = 10;
 
 public:
     static void RunAllTest();
@@ -56,9 +58,13 @@ public:
     static void InsertFront();
     static void InsertMiddle();
     static void InsertRandom();
+    static void InsertMiddleBulk();
+    static void InsertRandomBulk();
     static void EmplaceFront();
     static void EmplaceMiddle();
     static void EmplaceRandom();
+    static void EraseIf();
+    static void GrowthPolicies();
 
 private:
     template <typename Predicate1, typename Predicate2>
@@ -104,4 +110,49 @@ private:
             Serializer::WriteResults(stream, "std::vector", "Vector", test_name, "TestStruct", elements, ITERATIONS, std_vector_best, std_vector_worst, std_vector_average, vector_best, vector_worst, vector_average);
         }
     }
+
+    template <typename Policy>
+    static void TestGrowth(std::stringstream& stream, const std::string& test_name, size_t growth_hint = 0)
+    {
+        using Counter = CountingGrowthPolicy<Policy>;
+
+        double time = 0.0;
+        double best = (double)INFINITY;
+        double worst = 0.0;
+        double average = 0.0;
+
+        size_t reallocations = 0;
+        size_t peak_bytes = 0;
+        size_t final_bytes = 0;
+
+        Timer timer;
+        {
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                Counter::Reset();
+                Vector<TestStruct, Counter> vector;
+                vector.SetGrowthHint(growth_hint);
+
+                timer.Start();
+                for (size_t j = 0; j < ELEMENTS; ++j)
+                {
+                    vector.EmplaceBack((float)j);
+                }
+                time = timer.Stop();
+
+                if (time < best) { best = time; }
+                if (time > worst) { worst = time; }
+                average += time;
+
+                reallocations = Counter::s_Reallocations;
+                final_bytes = vector.Capacity() * sizeof(TestStruct);
+                peak_bytes = Counter::s_PeakBytes > final_bytes ? Counter::s_PeakBytes : final_bytes;
+            }
+
+            average /= (double)ITERATIONS;
+
+            Serializer::WriteGrowthResults(stream, test_name, "TestStruct", ELEMENTS, ITERATIONS, best, worst, average,
+                reallocations, peak_bytes, final_bytes, ELEMENTS * sizeof(TestStruct));
+        }
+    }
 };